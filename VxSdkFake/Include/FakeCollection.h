@@ -0,0 +1,118 @@
+// Declares the fake collection helpers.
+#ifndef FakeCollection_h__
+#define FakeCollection_h__
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "VxSdk.h"
+
+namespace VxSdkFake {
+
+    /// <summary>
+    /// Gets whether a string field matches the value of a filter.
+    /// </summary>
+    /// <param name="filter">The filter.</param>
+    /// <param name="value">The field value.</param>
+    /// <returns><c>true</c> if the field matches, otherwise <c>false</c>.</returns>
+    inline bool Matches(const VxSdk::VxCollectionFilter& filter, const std::string& value) {
+        return value == filter.value;
+    }
+
+    /// <summary>
+    /// Gets whether a number field matches the value of a filter.
+    /// </summary>
+    /// <param name="filter">The filter.</param>
+    /// <param name="value">The field value.</param>
+    /// <returns><c>true</c> if the field matches, otherwise <c>false</c>.</returns>
+    inline bool Matches(const VxSdk::VxCollectionFilter& filter, int value) {
+        return value == std::atoi(filter.value);
+    }
+
+    /// <summary>
+    /// Returns no items, as the native SDK does for a collection that is empty on the system.
+    /// </summary>
+    /// <param name="collection">The collection to fill in.</param>
+    /// <returns><c>kOK</c>.</returns>
+    template <typename T>
+    VxSdk::VxResult::Value FillEmpty(VxSdk::VxCollection<T>& collection) {
+        collection.collectionSize = 0;
+        return VxSdk::VxResult::kOK;
+    }
+
+    /// <summary>
+    /// Fills in a collection the way the native SDK does.  The first call, made without an array, returns the number
+    /// of matching items with <c>kInsufficientSize</c>; the second fills in the array the caller allocated for them.
+    /// The <c>kStart</c> and <c>kCount</c> filters page through the matching items.
+    /// </summary>
+    /// <param name="collection">The collection to fill in.</param>
+    /// <param name="recordCount">The number of records to choose from.</param>
+    /// <param name="matches">
+    /// Gets whether the record at an index matches a filter; it is also called with a null filter, to skip records that
+    /// are not part of the collection at all.
+    /// </param>
+    /// <param name="create">Creates the native object of the record at an index.</param>
+    /// <returns>The result of filling in the collection.</returns>
+    template <typename T, typename TMatches, typename TCreate>
+    VxSdk::VxResult::Value FillCollection(VxSdk::VxCollection<T**>& collection, int recordCount, TMatches matches, TCreate create) {
+        int start = 0;
+        int count = recordCount;
+        for (int i = 0; i < collection.filterSize; i++) {
+            if (collection.filters[i].key == VxSdk::VxCollectionFilterItem::kStart)
+                start = std::atoi(collection.filters[i].value);
+            else if (collection.filters[i].key == VxSdk::VxCollectionFilterItem::kCount)
+                count = std::atoi(collection.filters[i].value);
+        }
+
+        std::vector<int> indexes;
+        for (int i = 0; i < recordCount; i++) {
+            bool isMatch = matches(i, static_cast<const VxSdk::VxCollectionFilter*>(nullptr));
+            for (int j = 0; j < collection.filterSize && isMatch; j++) {
+                VxSdk::VxCollectionFilterItem::Value key = collection.filters[j].key;
+                if (key != VxSdk::VxCollectionFilterItem::kStart && key != VxSdk::VxCollectionFilterItem::kCount)
+                    isMatch = matches(i, &collection.filters[j]);
+            }
+
+            if (isMatch)
+                indexes.push_back(i);
+        }
+
+        int first = start < 0 ? 0 : start > static_cast<int>(indexes.size()) ? static_cast<int>(indexes.size()) : start;
+        int size = static_cast<int>(indexes.size()) - first;
+        if (count >= 0 && count < size)
+            size = count;
+
+        if (collection.collection == nullptr || collection.collectionSize < size) {
+            collection.collectionSize = size;
+            return size == 0 ? VxSdk::VxResult::kOK : VxSdk::VxResult::kInsufficientSize;
+        }
+
+        for (int i = 0; i < size; i++)
+            collection.collection[i] = create(indexes[first + i]);
+
+        collection.collectionSize = size;
+        return VxSdk::VxResult::kOK;
+    }
+
+    /// <summary>
+    /// Returns a string the way the native SDK does, in two calls: the first, made without a buffer, returns the size
+    /// needed with <c>kInsufficientSize</c>; the second copies the string into the buffer the caller allocated.
+    /// </summary>
+    /// <param name="value">The string to return.</param>
+    /// <param name="buffer">The buffer allocated by the caller, or <c>nullptr</c>.</param>
+    /// <param name="size">The size of the buffer; set to the size needed.</param>
+    /// <returns>The result of returning the string.</returns>
+    inline VxSdk::VxResult::Value FillString(const std::string& value, char* buffer, int& size) {
+        int needed = static_cast<int>(value.size()) + 1;
+        if (buffer == nullptr || size < needed) {
+            size = needed;
+            return VxSdk::VxResult::kInsufficientSize;
+        }
+
+        std::memcpy(buffer, value.c_str(), needed);
+        size = needed;
+        return VxSdk::VxResult::kOK;
+    }
+}
+#endif // FakeCollection_h__
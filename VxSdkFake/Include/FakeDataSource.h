@@ -0,0 +1,78 @@
+// Declares the fake data source class.
+#ifndef FakeDataSource_h__
+#define FakeDataSource_h__
+
+#include <memory>
+#include "FakeDataset.h"
+#include "VxSdk.h"
+
+namespace VxSdkFake {
+
+    /// <summary>
+    /// The FakeDataSource class is an <c>IVxDataSource</c> over a data source of a fake system's <see cref="Dataset"/>.
+    /// Its fields are a copy of the data source, taken when it is created or refreshed, and changes made through it
+    /// are stored in the data set.  Recorded media, analytics and configuration are not available.
+    /// </summary>
+    class FakeDataSource : public VxSdk::IVxDataSource {
+    public:
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="dataset">The data set of the system.</param>
+        /// <param name="index">The index of the data source.  The data set lock must be held.</param>
+        FakeDataSource(std::shared_ptr<Dataset> dataset, int index);
+
+        /// <summary>
+        /// Destructor.
+        /// </summary>
+        virtual ~FakeDataSource();
+
+        VxSdk::VxResult::Value AddAnalyticConfig(VxSdk::VxNewAnalyticConfig& newAnalyticConfig) const override;
+        VxSdk::VxResult::Value AddAnalyticSession(VxSdk::VxNewAnalyticSession& newAnalyticSession) const override;
+        VxSdk::VxResult::Value CanPixelSearch(bool& result) const override;
+        VxSdk::VxResult::Value CanPtz(bool& result) const override;
+        VxSdk::VxResult::Value CreateMjpegDataSession(VxSdk::IVxDataSession*& dataSession) const override;
+        VxSdk::VxResult::Value CreatePixelSearch(VxSdk::VxNewPixelSearch& newPixelSearch, VxSdk::IVxPixelSearch*& pixelSearch) const override;
+        VxSdk::VxResult::Value Delete() const override;
+        VxSdk::VxResult::Value Disable() const override;
+        VxSdk::VxResult::Value Enable() const override;
+        VxSdk::VxResult::Value GetAllDataStorages(VxSdk::VxCollection<VxSdk::IVxDataStorage**>& dataStorageCollection) const override;
+        VxSdk::VxResult::Value GetAnalyticCapabilities(VxSdk::VxAnalyticCapability::Value* analyticCapabilities, int& size) const override;
+        VxSdk::VxResult::Value GetAnalyticConfigs(VxSdk::VxCollection<VxSdk::IVxAnalyticConfig**>& analyticConfigCollection) const override;
+        VxSdk::VxResult::Value GetAnalyticSessions(VxSdk::VxCollection<VxSdk::IVxAnalyticSession**>& analyticSessionCollection) const override;
+        VxSdk::VxResult::Value GetAudioRelations(VxSdk::VxCollection<VxSdk::IVxResourceRel**>& resourceRelCollection) const override;
+        VxSdk::VxResult::Value GetAvailableAnalyticBehaviorTypes(VxSdk::VxAnalyticBehaviorType::Value* analyticBehaviorTypes, int& size) const override;
+        VxSdk::VxResult::Value GetBookmarks(VxSdk::VxCollection<VxSdk::IVxBookmark**>& bookmarkCollection) const override;
+        VxSdk::VxResult::Value GetClips(VxSdk::VxCollection<VxSdk::IVxClip**>& clipCollection) const override;
+        VxSdk::VxResult::Value GetDataStorages(VxSdk::VxCollection<VxSdk::IVxDataStorage**>& dataStorageCollection) const override;
+        VxSdk::VxResult::Value GetEdgeClips(VxSdk::VxCollection<VxSdk::IVxClip**>& clipCollection) const override;
+        VxSdk::VxResult::Value GetGaps(VxSdk::VxCollection<VxSdk::IVxGap**>& gapCollection) const override;
+        VxSdk::VxResult::Value GetHostDevice(VxSdk::IVxDevice*& hostDevice) const override;
+        VxSdk::VxResult::Value GetLimits(VxSdk::VxLimits*& limits) const override;
+        VxSdk::VxResult::Value GetLineCounts(VxSdk::VxLineCountingRequest& lineCountingRequest, VxSdk::VxLineCounts*& lineCounts) const override;
+        VxSdk::VxResult::Value GetMember(VxSdk::IVxMember*& member) const override;
+        VxSdk::VxResult::Value GetMetadataRelations(VxSdk::VxCollection<VxSdk::IVxResourceRel**>& resourceRelCollection) const override;
+        VxSdk::VxResult::Value GetMetadataSnapshotEndpoint(char* endpoint, int& size, char* snapshotTime) const override;
+        VxSdk::VxResult::Value GetMotionConfiguration(VxSdk::IVxDataSourceConfig::Motion*& motionConfig) const override;
+        VxSdk::VxResult::Value GetMultiviewInfo(VxSdk::VxCollection<VxSdk::IVxUserInfo**>& userInfoCollection) const override;
+        VxSdk::VxResult::Value GetPtzConfiguration(VxSdk::IVxDataSourceConfig::Ptz*& ptzConfig) const override;
+        VxSdk::VxResult::Value GetPtzController(VxSdk::IVxPtzController*& ptzController) const override;
+        VxSdk::VxResult::Value GetRtspEndpoint(char* endpoint, int& size) const override;
+        VxSdk::VxResult::Value GetSmartCompressionConfiguration(VxSdk::IVxDataSourceConfig::SmartCompression*& smartCompressionConfig) const override;
+        VxSdk::VxResult::Value GetTags(VxSdk::VxCollection<VxSdk::IVxTag**>& tagCollection) const override;
+        VxSdk::VxResult::Value GetVideoEncodingsConfiguration(VxSdk::VxCollection<VxSdk::IVxDataSourceConfig::VideoEncoding**>& videoEncodingCollection) const override;
+        VxSdk::VxResult::Value GetVideoRelations(VxSdk::VxCollection<VxSdk::IVxResourceRel**>& resourceRelCollection) const override;
+        VxSdk::VxResult::Value Refresh() const override;
+        VxSdk::VxResult::Value SetName(char* dataSourceName) const override;
+        VxSdk::VxResult::Value SetNumber(int dataSourceNumber) const override;
+        VxSdk::VxResult::Value SetPruningThreshold(int threshold) const override;
+        VxSdk::VxResult::Value SetRetentionLimit(int limit) const override;
+
+    private:
+        std::shared_ptr<Dataset> _dataset;
+        int _index;
+        void _Load(const DataSourceRecord& record);
+        VxSdk::VxResult::Value _Reload() const;
+    };
+}
+#endif // FakeDataSource_h__
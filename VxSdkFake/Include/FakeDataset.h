@@ -0,0 +1,82 @@
+// Declares the fake dataset class.
+#ifndef FakeDataset_h__
+#define FakeDataset_h__
+
+#include <chrono>
+#include <mutex>
+#include <random>
+#include <string>
+#include <vector>
+#include "FakeSdk.h"
+
+namespace VxSdkFake {
+
+    /// <summary>
+    /// The Dataset class holds the data sources, devices and events of a fake system.  It is shared by the system and
+    /// every object it returns, so that changes made through one object are seen by the others.  Members must only
+    /// be used while holding <c>lock</c>.
+    /// </summary>
+    class Dataset {
+    public:
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="settings">The sizes of the data set.</param>
+        /// <param name="recording">
+        /// The recorded data sources, devices and events to serve in place of generated ones, or <c>nullptr</c>.
+        /// </param>
+        Dataset(const Settings& settings, const Recording* recording);
+
+        /// <summary>
+        /// Creates an event raised now by a random device.
+        /// </summary>
+        /// <returns>The new event.</returns>
+        EventRecord CreateEvent();
+
+        /// <summary>
+        /// Creates an event from the given situation type and devices, as inserted by a client.
+        /// </summary>
+        /// <param name="situationType">The situation type.</param>
+        /// <param name="generatorDeviceId">The id of the device that generated the event.</param>
+        /// <param name="sourceDeviceId">The id of the device the event is about.</param>
+        /// <param name="time">The time of the event.</param>
+        /// <returns>The new event.</returns>
+        EventRecord CreateEvent(const char* situationType, const char* generatorDeviceId, const char* sourceDeviceId, const char* time);
+
+        /// <summary>
+        /// Finds the device with the given id.
+        /// </summary>
+        /// <param name="id">The device id.</param>
+        /// <returns>The index of the device, or -1 if there is none.</returns>
+        int FindDevice(const std::string& id) const;
+
+        /// <summary>
+        /// Formats a time the way the native SDK does.
+        /// </summary>
+        /// <param name="time">The time.</param>
+        /// <returns>The time in UTC, with milliseconds.</returns>
+        static std::string FormatTime(std::chrono::system_clock::time_point time);
+
+        /// <summary>
+        /// Makes an id in the form of a UUID.
+        /// </summary>
+        /// <param name="kind">The kind of object.</param>
+        /// <param name="number">The number of the object.</param>
+        /// <returns>The id.</returns>
+        static std::string MakeId(int kind, long long number);
+
+        std::mutex lock;
+        std::vector<DataSourceRecord> dataSources;
+        std::vector<DeviceRecord> devices;
+        std::vector<EventRecord> events;
+        std::vector<std::string> situationTypes;
+
+    private:
+        std::mt19937 _random;
+        long long _eventNumber;
+        EventRecord _CreateEvent(std::chrono::system_clock::time_point time);
+        void _Generate(const Settings& settings);
+        void _Load(const Recording& recording);
+    };
+}
+#endif // FakeDataset_h__
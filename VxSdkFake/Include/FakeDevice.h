@@ -0,0 +1,76 @@
+// Declares the fake device class.
+#ifndef FakeDevice_h__
+#define FakeDevice_h__
+
+#include <memory>
+#include "FakeDataset.h"
+#include "VxSdk.h"
+
+namespace VxSdkFake {
+
+    /// <summary>
+    /// The FakeDevice class is an <c>IVxDevice</c> over a device of a fake system's <see cref="Dataset"/>.  Its fields
+    /// are a copy of the device, taken when it is created or refreshed, and changes made through it are stored in the
+    /// data set.  It lists the data sources it hosts; logs, backups and configuration are not available.
+    /// </summary>
+    class FakeDevice : public VxSdk::IVxDevice {
+    public:
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="dataset">The data set of the system.</param>
+        /// <param name="index">The index of the device.  The data set lock must be held.</param>
+        FakeDevice(std::shared_ptr<Dataset> dataset, int index);
+
+        /// <summary>
+        /// Destructor.
+        /// </summary>
+        virtual ~FakeDevice();
+
+        VxSdk::VxResult::Value AddAnalyticSession(VxSdk::VxNewAnalyticSession& newAnalyticSession) const override;
+        VxSdk::VxResult::Value CanCreateLogs(bool& result) const override;
+        VxSdk::VxResult::Value CreateLog() const override;
+        VxSdk::VxResult::Value Delete() const override;
+        VxSdk::VxResult::Value DeleteDevice() const override;
+        VxSdk::VxResult::Value GetAccessPoints(VxSdk::VxCollection<VxSdk::IVxAccessPoint**>& accessPointCollection) const override;
+        VxSdk::VxResult::Value GetAlarmInputs(VxSdk::VxCollection<VxSdk::IVxAlarmInput**>& alarmInputCollection) const override;
+        VxSdk::VxResult::Value GetAnalyticSessions(VxSdk::VxCollection<VxSdk::IVxAnalyticSession**>& analyticSessionCollection) const override;
+        VxSdk::VxResult::Value GetAuthenticationConfiguration(VxSdk::IVxConfiguration::Auth*& authConfig) const override;
+        VxSdk::VxResult::Value GetBackup(char* endpoint, int& size) const override;
+        VxSdk::VxResult::Value GetDatabaseBackups(VxSdk::IVxDbBackups*& dbBackups) const override;
+        VxSdk::VxResult::Value GetDataSources(VxSdk::VxCollection<VxSdk::IVxDataSource**>& dataSourceCollection) const override;
+        VxSdk::VxResult::Value GetDataStorage(VxSdk::IVxDataStorage*& dataStorage) const override;
+        VxSdk::VxResult::Value GetDeviceAssignments(VxSdk::VxCollection<VxSdk::IVxDeviceAssignment**>& deviceAssignmentCollection) const override;
+        VxSdk::VxResult::Value GetDiagnostics(VxSdk::VxDiagnostics*& diagnostics) const override;
+        VxSdk::VxResult::Value GetLimits(VxSdk::VxLimits*& limits) const override;
+        VxSdk::VxResult::Value GetLogs(VxSdk::VxCollection<VxSdk::IVxLog**>& logCollection) const override;
+        VxSdk::VxResult::Value GetMonitors(VxSdk::VxCollection<VxSdk::IVxMonitor**>& monitorCollection) const override;
+        VxSdk::VxResult::Value GetRelayOutputs(VxSdk::VxCollection<VxSdk::IVxRelayOutput**>& relayOutputCollection) const override;
+        VxSdk::VxResult::Value GetThermalEtdConfiguration(VxSdk::IVxConfiguration::ThermalEtd*& thermalEtdConfig) const override;
+        VxSdk::VxResult::Value GetTimeConfiguration(VxSdk::IVxConfiguration::Time*& timeConfig) const override;
+        VxSdk::VxResult::Value HasDiagnostics(bool& result) const override;
+        VxSdk::VxResult::Value Refresh() const override;
+        VxSdk::VxResult::Value Replace(const char* replacementDeviceId) const override;
+        VxSdk::VxResult::Value RestoreBackup(char* backupFile) const override;
+        VxSdk::VxResult::Value SetDevicePort(int devicePort) const override;
+        VxSdk::VxResult::Value SetDriverTypeId(char* deviceDriverTypeId) const override;
+        VxSdk::VxResult::Value SetEndpoints(char** deviceEndpoints, int size) const override;
+        VxSdk::VxResult::Value SetHostname(char* deviceHostname) const override;
+        VxSdk::VxResult::Value SetIp(char* deviceIp) const override;
+        VxSdk::VxResult::Value SetName(char* deviceName) const override;
+        VxSdk::VxResult::Value SetPassword(char* devicePassword) const override;
+        VxSdk::VxResult::Value SetUsername(char* deviceUsername) const override;
+        VxSdk::VxResult::Value SetVersion(char* deviceVersion) const override;
+        VxSdk::VxResult::Value Silence() const override;
+        VxSdk::VxResult::Value TriggerRefresh() const override;
+        VxSdk::VxResult::Value UpdateSoftware(VxSdk::IVxFile& updateFile) const override;
+
+    private:
+        std::shared_ptr<Dataset> _dataset;
+        int _index;
+        void _FreeEndpoints();
+        void _Load(const DeviceRecord& record);
+        VxSdk::VxResult::Value _Reload() const;
+    };
+}
+#endif // FakeDevice_h__
@@ -0,0 +1,44 @@
+// Declares the fake event class.
+#ifndef FakeEvent_h__
+#define FakeEvent_h__
+
+#include <memory>
+#include "FakeDataset.h"
+#include "VxSdk.h"
+
+namespace VxSdkFake {
+
+    /// <summary>
+    /// The FakeEvent class is an <c>IVxEvent</c> holding a copy of an event of a fake system's <see cref="Dataset"/>,
+    /// either a past event or one raised by the generator.  Its generator and source devices can be fetched; its
+    /// situation and user are not available.
+    /// </summary>
+    class FakeEvent : public VxSdk::IVxEvent {
+    public:
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="dataset">The data set of the system.</param>
+        /// <param name="record">The event.</param>
+        FakeEvent(std::shared_ptr<Dataset> dataset, const EventRecord& record);
+
+        /// <summary>
+        /// Destructor.
+        /// </summary>
+        virtual ~FakeEvent();
+
+        VxSdk::VxResult::Value Acknowledge() const override;
+        VxSdk::VxResult::Value Delete() const override;
+        VxSdk::VxResult::Value GetGeneratorDevice(VxSdk::IVxDevice*& device) const override;
+        VxSdk::VxResult::Value GetSituation(VxSdk::IVxSituation*& situation) const override;
+        VxSdk::VxResult::Value GetSourceDevice(VxSdk::IVxDevice*& device) const override;
+        VxSdk::VxResult::Value GetUser(VxSdk::IVxUser*& user) const override;
+        VxSdk::VxResult::Value Refresh() const override;
+        VxSdk::VxResult::Value Silence(int wakeupTime) const override;
+
+    private:
+        std::shared_ptr<Dataset> _dataset;
+        VxSdk::VxResult::Value _GetDevice(const char* deviceId, VxSdk::IVxDevice*& device) const;
+    };
+}
+#endif // FakeEvent_h__
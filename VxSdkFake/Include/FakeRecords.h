@@ -0,0 +1,96 @@
+// Declares the fake record types.
+#ifndef FakeRecords_h__
+#define FakeRecords_h__
+
+#include <string>
+#include <vector>
+
+namespace VxSdkFake {
+
+    /// <summary>
+    /// The values of the native data source and device states.
+    /// </summary>
+    namespace State {
+        enum Value { kUnknown, kOffline, kOnline };
+    }
+
+    /// <summary>
+    /// The values of the native data source types.
+    /// </summary>
+    namespace DataSourceType {
+        enum Value { kUnknown, kVideo, kAudio, kMetadata };
+    }
+
+    /// <summary>
+    /// The values of the native device types, up to the camera type used by the generated data set.  A recorded device
+    /// may have any native device type.
+    /// </summary>
+    namespace DeviceType {
+        enum Value { kAcc, kAccessController, kAllInOne, kCamera };
+    }
+
+    /// <summary>
+    /// A data source of the fake data set, or recorded in a trace.
+    /// </summary>
+    struct DataSourceRecord {
+        std::string id;
+        std::string name;
+        std::string ip;
+        int deviceIndex;
+        int number;
+        DataSourceType::Value type;
+        State::Value state;
+        bool isEnabled;
+        bool isRecording;
+        int pruningThreshold;
+        int retentionLimit;
+    };
+
+    /// <summary>
+    /// A device of the fake data set, or recorded in a trace.
+    /// </summary>
+    struct DeviceRecord {
+        std::string id;
+        std::string name;
+        std::string ip;
+        std::string hostname;
+        std::string model;
+        std::string serial;
+        std::string vendor;
+        std::string version;
+        std::string username;
+        std::string password;
+        std::string driverTypeId;
+        std::vector<std::string> endpoints;
+        int port;
+        int type;
+        State::Value state;
+        bool isDeleted;
+    };
+
+    /// <summary>
+    /// An event of the fake data set, or recorded in a trace.
+    /// </summary>
+    struct EventRecord {
+        std::string id;
+        std::string situationType;
+        std::string situationName;
+        std::string generatorDeviceId;
+        std::string generatorDeviceName;
+        std::string sourceDeviceId;
+        std::string sourceDeviceName;
+        std::string time;
+        unsigned short severity;
+    };
+
+    /// <summary>
+    /// The data sources, devices and events recorded in a trace.  The data source device indexes are ignored; each
+    /// data source is hosted by the device with the same IP address.
+    /// </summary>
+    struct Recording {
+        std::vector<DataSourceRecord> dataSources;
+        std::vector<DeviceRecord> devices;
+        std::vector<EventRecord> events;
+    };
+}
+#endif // FakeRecords_h__
@@ -0,0 +1,89 @@
+// Declares the fake sdk settings.
+#ifndef FakeSdk_h__
+#define FakeSdk_h__
+
+#ifdef _WIN32
+#ifdef VXSDKFAKE_EXPORTS
+#define VXSDKFAKE_API __declspec(dllexport)
+#else
+#define VXSDKFAKE_API __declspec(dllimport)
+#endif
+#else
+#define VXSDKFAKE_API
+#endif
+
+#include "FakeRecords.h"
+
+namespace VxSdkFake {
+
+    /// <summary>
+    /// The Settings struct describes the data set served by each system logged in to through the fake SDK, and the
+    /// synthetic events it generates.  A system takes a copy of the settings when it is logged in to.
+    /// </summary>
+    struct Settings {
+        Settings() : dataSourceCount(1000), dataSourcesPerDevice(4), eventCount(10000), eventInterval(0),
+            eventsPerInterval(1), situationTypeCount(8), seed(0) { }
+
+        /// <summary>
+        /// The number of data sources on the system.
+        /// </summary>
+        int dataSourceCount;
+
+        /// <summary>
+        /// The number of data sources hosted by each device; the system has as many devices as it takes to host its
+        /// data sources.
+        /// </summary>
+        int dataSourcesPerDevice;
+
+        /// <summary>
+        /// The number of past events returned by <c>GetEvents</c>.
+        /// </summary>
+        int eventCount;
+
+        /// <summary>
+        /// The time, in milliseconds, between batches of generated events while notifications are started.  0 stops
+        /// the generator, so that only inserted events are notified.
+        /// </summary>
+        int eventInterval;
+
+        /// <summary>
+        /// The number of events generated in each batch.
+        /// </summary>
+        int eventsPerInterval;
+
+        /// <summary>
+        /// The number of situation types that events are spread over.
+        /// </summary>
+        int situationTypeCount;
+
+        /// <summary>
+        /// The seed of the random numbers used to generate events, so that a run can be repeated.
+        /// </summary>
+        unsigned int seed;
+    };
+
+    /// <summary>
+    /// Gets the settings used by systems logged in to from now on.
+    /// </summary>
+    /// <returns>The current settings.</returns>
+    VXSDKFAKE_API Settings GetSettings();
+
+    /// <summary>
+    /// Sets the settings used by systems logged in to from now on.
+    /// </summary>
+    /// <param name="settings">The new settings.</param>
+    VXSDKFAKE_API void SetSettings(const Settings& settings);
+
+    /// <summary>
+    /// Sets the recorded data sources, devices and events that systems logged in to from now on serve in place of a
+    /// generated data set.  Synthetic events are still raised by recorded devices.
+    /// </summary>
+    /// <param name="recording">The recording to serve.</param>
+    VXSDKFAKE_API void SetRecording(const Recording& recording);
+
+    /// <summary>
+    /// Clears the recording, so that systems logged in to from now on serve a generated data set again.
+    /// </summary>
+    VXSDKFAKE_API void ClearRecording();
+}
+#endif // FakeSdk_h__
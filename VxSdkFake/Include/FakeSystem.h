@@ -0,0 +1,147 @@
+// Declares the fake system class.
+#ifndef FakeSystem_h__
+#define FakeSystem_h__
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "FakeDataset.h"
+#include "VxSdk.h"
+
+namespace VxSdkFake {
+
+    /// <summary>
+    /// The event notifications of a fake system.  The notifier thread shares them with the system, so that it can
+    /// outlive the system when notifications are stopped from one of its own callbacks.
+    /// </summary>
+    struct Notifications {
+        Notifications() : callback(nullptr), generation(0), isStarted(false) { }
+
+        std::mutex lock;
+        std::condition_variable wake;
+        VxSdk::VxEventCallback callback;
+        std::vector<std::string> situationTypes;
+        std::deque<EventRecord> inserted;
+        int generation;
+        bool isStarted;
+    };
+
+    /// <summary>
+    /// The FakeSystem class is an in-process <c>IVxSystem</c> serving a generated or recorded <see cref="Dataset"/>.  Data sources,
+    /// devices and events can be listed, filtered and changed, and events are notified from a generator thread.
+    /// Every other call returns an empty collection or <c>kActionUnavailable</c>.
+    /// </summary>
+    class FakeSystem : public VxSdk::IVxSystem {
+    public:
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="loginInfo">The login info of the system.</param>
+        /// <param name="settings">The settings of the system.</param>
+        /// <param name="recording">The recording to serve in place of a generated data set, or <c>nullptr</c>.</param>
+        FakeSystem(const VxSdk::VxLoginInfo& loginInfo, const Settings& settings, const Recording* recording);
+
+        /// <summary>
+        /// Destructor.
+        /// </summary>
+        virtual ~FakeSystem();
+
+        VxSdk::VxResult::Value AcknowledgeAllEvents() const override;
+        VxSdk::VxResult::Value AddAnalyticSession(VxSdk::VxNewAnalyticSession& newAnalyticSession) const override;
+        VxSdk::VxResult::Value AddBookmark(VxSdk::VxNewBookmark& newBookmark) const override;
+        VxSdk::VxResult::Value AddDataObject(VxSdk::VxNewDataObject& newDataObject) const override;
+        VxSdk::VxResult::Value AddDevice(VxSdk::VxNewDevice& newDevice) const override;
+        VxSdk::VxResult::Value AddDrawing(VxSdk::VxNewDrawing& newDrawing) const override;
+        VxSdk::VxResult::Value AddFile(char* filePath, char* fileName) const override;
+        VxSdk::VxResult::Value AddManualRecording(VxSdk::VxNewManualRecording& newManualRecording, VxSdk::IVxManualRecording*& manualRecording) const override;
+        VxSdk::VxResult::Value AddMember(VxSdk::VxNewMember& newMember) const override;
+        VxSdk::VxResult::Value AddRecording(VxSdk::VxNewRecording& newRecording, VxSdk::IVxRecording*& recording) const override;
+        VxSdk::VxResult::Value AddReportTemplate(VxSdk::VxNewReportTemplate& newReportTemplate) const override;
+        VxSdk::VxResult::Value AddRole(const char* roleName) const override;
+        VxSdk::VxResult::Value AddRule(VxSdk::VxNewRule& newRule) const override;
+        VxSdk::VxResult::Value AddSchedule(VxSdk::VxNewSchedule& newSchedule) const override;
+        VxSdk::VxResult::Value AddSituation(VxSdk::VxNewSituation& newSituation) const override;
+        VxSdk::VxResult::Value AddTag(VxSdk::VxNewTag& newTag) const override;
+        VxSdk::VxResult::Value AddTimeTable(VxSdk::VxNewTimeTable& newTimeTable) const override;
+        VxSdk::VxResult::Value AddUser(VxSdk::VxNewUser& newUser) const override;
+        VxSdk::VxResult::Value CreateExport(VxSdk::VxNewExport& newExport, VxSdk::IVxExport*& exportItem) const override;
+        VxSdk::VxResult::Value CreateMonitor(VxSdk::VxNewMonitor& newMonitor) const override;
+        VxSdk::VxResult::Value CreateMonitorWall(const char* monitorWallName) const override;
+        VxSdk::VxResult::Value CreateReport(VxSdk::VxNewReport& newReport, VxSdk::IVxReport*& report) const override;
+        VxSdk::VxResult::Value Delete() const override;
+        VxSdk::VxResult::Value GetAccessPoints(VxSdk::VxCollection<VxSdk::IVxAccessPoint**>& accessPointCollection) const override;
+        VxSdk::VxResult::Value GetAlarmInputs(VxSdk::VxCollection<VxSdk::IVxAlarmInput**>& alarmInputCollection) const override;
+        VxSdk::VxResult::Value GetAnalyticSessions(VxSdk::VxCollection<VxSdk::IVxAnalyticSession**>& analyticSessionCollection) const override;
+        VxSdk::VxResult::Value GetAuthenticationConfiguration(VxSdk::IVxConfiguration::Auth*& authConfig) const override;
+        VxSdk::VxResult::Value GetAvailableReportTemplates(VxSdk::VxCollection<VxSdk::VxNewReportTemplate**>& newReportTemplateCollection) const override;
+        VxSdk::VxResult::Value GetAvailableScheduleTriggerEvents(char** situationTypes, int& size) const override;
+        VxSdk::VxResult::Value GetBookmarkAutoUnlockTime(int& autoUnlockTime) const override;
+        VxSdk::VxResult::Value GetBookmarkConfiguration(VxSdk::IVxConfiguration::Bookmark*& bookmarkConfig) const override;
+        VxSdk::VxResult::Value GetBookmarks(VxSdk::VxCollection<VxSdk::IVxBookmark**>& bookmarkCollection) const override;
+        VxSdk::VxResult::Value GetClusterConfiguration(VxSdk::IVxConfiguration::Cluster*& clusterConfig) const override;
+        VxSdk::VxResult::Value GetCurrentUser(VxSdk::IVxUser*& user) const override;
+        VxSdk::VxResult::Value GetDataObjects(VxSdk::VxCollection<VxSdk::IVxDataObject**>& dataObjectCollection) const override;
+        VxSdk::VxResult::Value GetDataSources(VxSdk::VxCollection<VxSdk::IVxDataSource**>& dataSourceCollection) const override;
+        VxSdk::VxResult::Value GetDataStorages(VxSdk::VxCollection<VxSdk::IVxDataStorage**>& dataStorageCollection) const override;
+        VxSdk::VxResult::Value GetDeviceAssignments(VxSdk::VxCollection<VxSdk::IVxDeviceAssignment**>& deviceAssignmentCollection) const override;
+        VxSdk::VxResult::Value GetDevices(VxSdk::VxCollection<VxSdk::IVxDevice**>& deviceCollection) const override;
+        VxSdk::VxResult::Value GetDiscoveryStatus(VxSdk::IVxDiscovery*& discovery) const override;
+        VxSdk::VxResult::Value GetDrawings(VxSdk::VxCollection<VxSdk::IVxDrawing**>& drawingCollection) const override;
+        VxSdk::VxResult::Value GetDrivers(VxSdk::VxCollection<VxSdk::IVxDriver**>& driverCollection) const override;
+        VxSdk::VxResult::Value GetEventConfiguration(VxSdk::IVxConfiguration::Event*& eventConfig) const override;
+        VxSdk::VxResult::Value GetEvents(VxSdk::VxCollection<VxSdk::IVxEvent**>& eventCollection) const override;
+        VxSdk::VxResult::Value GetExportConfiguration(VxSdk::IVxConfiguration::Export*& exportConfig) const override;
+        VxSdk::VxResult::Value GetExportEstimate(VxSdk::VxNewExport& newExport, VxSdk::VxExportEstimate*& exportEstimate) const override;
+        VxSdk::VxResult::Value GetExports(VxSdk::VxCollection<VxSdk::IVxExport**>& exportCollection) const override;
+        VxSdk::VxResult::Value GetFiles(VxSdk::VxCollection<VxSdk::IVxFile**>& fileCollection) const override;
+        VxSdk::VxResult::Value GetHostDevice(VxSdk::IVxDevice*& hostDevice) const override;
+        VxSdk::VxResult::Value GetLdapConfiguration(VxSdk::IVxConfiguration::Ldap*& ldapConfig) const override;
+        VxSdk::VxResult::Value GetLicense(VxSdk::IVxLicense*& license) const override;
+        VxSdk::VxResult::Value GetManualRecordings(VxSdk::VxCollection<VxSdk::IVxManualRecording**>& manualRecordingCollection) const override;
+        VxSdk::VxResult::Value GetMembers(VxSdk::VxCollection<VxSdk::IVxMember**>& memberCollection) const override;
+        VxSdk::VxResult::Value GetMonitors(VxSdk::VxCollection<VxSdk::IVxMonitor**>& monitorCollection) const override;
+        VxSdk::VxResult::Value GetMonitorWalls(VxSdk::VxCollection<VxSdk::IVxMonitorWall**>& monitorWallCollection) const override;
+        VxSdk::VxResult::Value GetRecordings(VxSdk::VxCollection<VxSdk::IVxRecording**>& recordingCollection) const override;
+        VxSdk::VxResult::Value GetRelayOutputs(VxSdk::VxCollection<VxSdk::IVxRelayOutput**>& relayOutputCollection) const override;
+        VxSdk::VxResult::Value GetReportConfiguration(VxSdk::IVxConfiguration::Report*& reportConfig) const override;
+        VxSdk::VxResult::Value GetReports(VxSdk::VxCollection<VxSdk::IVxReport**>& reportCollection) const override;
+        VxSdk::VxResult::Value GetReportTemplates(VxSdk::VxCollection<VxSdk::IVxReportTemplate**>& reportTemplateCollection) const override;
+        VxSdk::VxResult::Value GetRolePermissionSchema(VxSdk::VxPermissionSchema*& permissionSchema) const override;
+        VxSdk::VxResult::Value GetRoles(VxSdk::VxCollection<VxSdk::IVxRole**>& roleCollection) const override;
+        VxSdk::VxResult::Value GetRules(VxSdk::VxCollection<VxSdk::IVxRule**>& ruleCollection) const override;
+        VxSdk::VxResult::Value GetSchedules(VxSdk::VxCollection<VxSdk::IVxSchedule**>& scheduleCollection) const override;
+        VxSdk::VxResult::Value GetServerConfiguration(VxSdk::IVxConfiguration::Server*& serverConfig) const override;
+        VxSdk::VxResult::Value GetSituations(VxSdk::VxCollection<VxSdk::IVxSituation**>& situationCollection) const override;
+        VxSdk::VxResult::Value GetSmtpConfiguration(VxSdk::IVxConfiguration::Smtp*& smtpConfig) const override;
+        VxSdk::VxResult::Value GetSnmpConfiguration(VxSdk::IVxConfiguration::Snmp*& snmpConfig) const override;
+        VxSdk::VxResult::Value GetSystemTime(char* systemTime) const override;
+        VxSdk::VxResult::Value GetTags(VxSdk::VxCollection<VxSdk::IVxTag**>& tagCollection) const override;
+        VxSdk::VxResult::Value GetTimeConfiguration(VxSdk::IVxConfiguration::Time*& timeConfig) const override;
+        VxSdk::VxResult::Value GetTimeTables(VxSdk::VxCollection<VxSdk::IVxTimeTable**>& timeTableCollection) const override;
+        VxSdk::VxResult::Value GetTwilioConfiguration(VxSdk::IVxConfiguration::Twilio*& twilioConfig) const override;
+        VxSdk::VxResult::Value GetUsers(VxSdk::VxCollection<VxSdk::IVxUser**>& userCollection) const override;
+        VxSdk::VxResult::Value InsertEvent(VxSdk::VxNewEvent& newEvent) const override;
+        VxSdk::VxResult::Value Refresh() const override;
+        VxSdk::VxResult::Value SetBookmarkAutoUnlockTime(int autoUnlockTime) const override;
+        VxSdk::VxResult::Value SetName(char* systemName) const override;
+        VxSdk::VxResult::Value StartInternalNotifications(VxSdk::VxInternalEventCallback callback) const override;
+        VxSdk::VxResult::Value StartNotifications(VxSdk::VxEventCallback callback) const override;
+        VxSdk::VxResult::Value StartNotifications(VxSdk::VxEventCallback callback, VxSdk::VxCollection<VxSdk::IVxSituation**>& situations, bool userNotification) const override;
+        VxSdk::VxResult::Value StopInternalNotifications() const override;
+        VxSdk::VxResult::Value StopNotifications() const override;
+        VxSdk::VxResult::Value ValidateMember(bool& result, const char* host, int port, const char* username, const char* password) const override;
+
+    private:
+        std::shared_ptr<Dataset> _dataset;
+        std::shared_ptr<Notifications> _notifications;
+        Settings _settings;
+        mutable int _bookmarkAutoUnlockTime;
+        VxSdk::VxResult::Value _StartNotifications(VxSdk::VxEventCallback callback, std::vector<std::string> situationTypes) const;
+        static void _Notify(std::shared_ptr<Dataset> dataset, std::shared_ptr<Notifications> notifications, Settings settings, int generation);
+    };
+}
+#endif // FakeSystem_h__
@@ -0,0 +1,249 @@
+/// <summary>
+/// Implements the fake data source class.
+/// </summary>
+#include "FakeDataSource.h"
+#include "FakeCollection.h"
+#include "FakeDevice.h"
+
+VxSdkFake::FakeDataSource::FakeDataSource(std::shared_ptr<Dataset> dataset, int index) : _dataset(dataset), _index(index) {
+    capabilities = nullptr;
+    capabilitiesSize = 0;
+    dataInterfaces = nullptr;
+    dataInterfaceSize = 0;
+    linkedPtzInfo = nullptr;
+    linkedPtzInfoSize = 0;
+    _Load(_dataset->dataSources[_index]);
+}
+
+VxSdkFake::FakeDataSource::~FakeDataSource() {
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::AddAnalyticConfig(VxSdk::VxNewAnalyticConfig& newAnalyticConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::AddAnalyticSession(VxSdk::VxNewAnalyticSession& newAnalyticSession) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::CanPixelSearch(bool& result) const {
+    result = false;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::CanPtz(bool& result) const {
+    result = false;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::CreateMjpegDataSession(VxSdk::IVxDataSession*& dataSession) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::CreatePixelSearch(VxSdk::VxNewPixelSearch& newPixelSearch, VxSdk::IVxPixelSearch*& pixelSearch) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::Delete() const {
+    delete this;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::Disable() const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->dataSources[_index].isEnabled = false;
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::Enable() const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->dataSources[_index].isEnabled = true;
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetAllDataStorages(VxSdk::VxCollection<VxSdk::IVxDataStorage**>& dataStorageCollection) const {
+    return FillEmpty(dataStorageCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetAnalyticCapabilities(VxSdk::VxAnalyticCapability::Value* analyticCapabilities, int& size) const {
+    size = 0;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetAnalyticConfigs(VxSdk::VxCollection<VxSdk::IVxAnalyticConfig**>& analyticConfigCollection) const {
+    return FillEmpty(analyticConfigCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetAnalyticSessions(VxSdk::VxCollection<VxSdk::IVxAnalyticSession**>& analyticSessionCollection) const {
+    return FillEmpty(analyticSessionCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetAudioRelations(VxSdk::VxCollection<VxSdk::IVxResourceRel**>& resourceRelCollection) const {
+    return FillEmpty(resourceRelCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetAvailableAnalyticBehaviorTypes(VxSdk::VxAnalyticBehaviorType::Value* analyticBehaviorTypes, int& size) const {
+    size = 0;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetBookmarks(VxSdk::VxCollection<VxSdk::IVxBookmark**>& bookmarkCollection) const {
+    return FillEmpty(bookmarkCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetClips(VxSdk::VxCollection<VxSdk::IVxClip**>& clipCollection) const {
+    return FillEmpty(clipCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetDataStorages(VxSdk::VxCollection<VxSdk::IVxDataStorage**>& dataStorageCollection) const {
+    return FillEmpty(dataStorageCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetEdgeClips(VxSdk::VxCollection<VxSdk::IVxClip**>& clipCollection) const {
+    return FillEmpty(clipCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetGaps(VxSdk::VxCollection<VxSdk::IVxGap**>& gapCollection) const {
+    return FillEmpty(gapCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetHostDevice(VxSdk::IVxDevice*& hostDevice) const {
+    std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+    int deviceIndex = _dataset->dataSources[_index].deviceIndex;
+    if (_dataset->devices[deviceIndex].isDeleted)
+        return VxSdk::VxResult::kInvalidParameters;
+
+    hostDevice = new FakeDevice(_dataset, deviceIndex);
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetLimits(VxSdk::VxLimits*& limits) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetLineCounts(VxSdk::VxLineCountingRequest& lineCountingRequest, VxSdk::VxLineCounts*& lineCounts) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetMember(VxSdk::IVxMember*& member) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetMetadataRelations(VxSdk::VxCollection<VxSdk::IVxResourceRel**>& resourceRelCollection) const {
+    return FillEmpty(resourceRelCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetMetadataSnapshotEndpoint(char* endpoint, int& size, char* snapshotTime) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetMotionConfiguration(VxSdk::IVxDataSourceConfig::Motion*& motionConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetMultiviewInfo(VxSdk::VxCollection<VxSdk::IVxUserInfo**>& userInfoCollection) const {
+    return FillEmpty(userInfoCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetPtzConfiguration(VxSdk::IVxDataSourceConfig::Ptz*& ptzConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetPtzController(VxSdk::IVxPtzController*& ptzController) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetRtspEndpoint(char* endpoint, int& size) const {
+    // The endpoint is well formed, but nothing serves it
+    return FillString(std::string("rtsp://") + ip + "/" + id, endpoint, size);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetSmartCompressionConfiguration(VxSdk::IVxDataSourceConfig::SmartCompression*& smartCompressionConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetTags(VxSdk::VxCollection<VxSdk::IVxTag**>& tagCollection) const {
+    return FillEmpty(tagCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetVideoEncodingsConfiguration(VxSdk::VxCollection<VxSdk::IVxDataSourceConfig::VideoEncoding**>& videoEncodingCollection) const {
+    return FillEmpty(videoEncodingCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::GetVideoRelations(VxSdk::VxCollection<VxSdk::IVxResourceRel**>& resourceRelCollection) const {
+    return FillEmpty(resourceRelCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::Refresh() const {
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::SetName(char* dataSourceName) const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->dataSources[_index].name = dataSourceName;
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::SetNumber(int dataSourceNumber) const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->dataSources[_index].number = dataSourceNumber;
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::SetPruningThreshold(int threshold) const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->dataSources[_index].pruningThreshold = threshold;
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::SetRetentionLimit(int limit) const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->dataSources[_index].retentionLimit = limit;
+    }
+
+    return _Reload();
+}
+
+void VxSdkFake::FakeDataSource::_Load(const DataSourceRecord& record) {
+    VxSdk::Utilities::StrCopySafe(id, record.id.c_str());
+    VxSdk::Utilities::StrCopySafe(name, record.name.c_str());
+    VxSdk::Utilities::StrCopySafe(ip, record.ip.c_str());
+    VxSdk::Utilities::StrCopySafe(encoding, record.type == DataSourceType::kVideo ? "h264" : record.type == DataSourceType::kAudio ? "g711" : "");
+    VxSdk::Utilities::StrCopySafe(snapshotUri, "");
+    VxSdk::Utilities::StrCopySafe(sourceEndpoint, "");
+    hasLive = true;
+    hasRecorded = record.isRecording;
+    index = _index;
+    isCapturing = record.isEnabled && record.state == State::kOnline;
+    isEnabled = record.isEnabled;
+    isManuallyRecording = false;
+    isRecording = record.isRecording;
+    number = record.number;
+    pruningThreshold = record.pruningThreshold;
+    retentionLimit = record.retentionLimit;
+    state = static_cast<decltype(state)>(record.state);
+    type = static_cast<decltype(type)>(record.type);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDataSource::_Reload() const {
+    // The native interface is const throughout, but the fields of this copy are refreshed like those of the native SDK
+    std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+    const_cast<FakeDataSource*>(this)->_Load(_dataset->dataSources[_index]);
+    return VxSdk::VxResult::kOK;
+}
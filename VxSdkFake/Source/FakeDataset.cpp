@@ -0,0 +1,193 @@
+/// <summary>
+/// Implements the fake dataset class.
+/// </summary>
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include "FakeDataset.h"
+
+using namespace std::chrono;
+
+VxSdkFake::Dataset::Dataset(const Settings& settings, const Recording* recording) : _random(settings.seed), _eventNumber(0) {
+    if (recording == nullptr)
+        _Generate(settings);
+    else
+        _Load(*recording);
+
+    // Synthetic events raised by the generator use recorded situation types when there are any
+    if (situationTypes.empty()) {
+        char text[64];
+        situationTypes.resize(std::max(settings.situationTypeCount, 1));
+        for (int i = 0; i < static_cast<int>(situationTypes.size()); i++) {
+            snprintf(text, sizeof(text), "fake/situation_%d", i + 1);
+            situationTypes[i] = text;
+        }
+    }
+
+    // Past events are a second apart, ending now
+    if (recording == nullptr) {
+        int eventCount = std::max(settings.eventCount, 0);
+        system_clock::time_point now = system_clock::now();
+        events.reserve(eventCount);
+        for (int i = 0; i < eventCount; i++)
+            events.push_back(_CreateEvent(now - seconds(eventCount - i)));
+    }
+}
+
+void VxSdkFake::Dataset::_Generate(const Settings& settings) {
+    int dataSourcesPerDevice = std::max(settings.dataSourcesPerDevice, 1);
+    int deviceCount = (std::max(settings.dataSourceCount, 0) + dataSourcesPerDevice - 1) / dataSourcesPerDevice;
+    char text[64];
+
+    // Each device is a camera hosting a video data source, followed by its audio and metadata data sources
+    devices.resize(deviceCount);
+    for (int i = 0; i < deviceCount; i++) {
+        DeviceRecord& device = devices[i];
+        snprintf(text, sizeof(text), "10.%d.%d.%d", (i >> 16) & 0xff, (i >> 8) & 0xff, i & 0xff);
+        device.ip = text;
+        snprintf(text, sizeof(text), "camera-%d", i + 1);
+        device.hostname = text;
+        snprintf(text, sizeof(text), "Camera %d", i + 1);
+        device.name = text;
+        snprintf(text, sizeof(text), "FK%08d", i + 1);
+        device.serial = text;
+        device.id = MakeId(1, i);
+        device.model = "Fake Camera";
+        device.vendor = "Pelco";
+        device.version = "1.0.0";
+        device.port = 80;
+        device.type = DeviceType::kCamera;
+        device.state = State::kOnline;
+        device.isDeleted = false;
+    }
+
+    dataSources.resize(std::max(settings.dataSourceCount, 0));
+    for (int i = 0; i < static_cast<int>(dataSources.size()); i++) {
+        DataSourceRecord& dataSource = dataSources[i];
+        int channel = i % dataSourcesPerDevice;
+        dataSource.deviceIndex = i / dataSourcesPerDevice;
+        dataSource.id = MakeId(2, i);
+        dataSource.ip = devices[dataSource.deviceIndex].ip;
+        dataSource.number = i + 1;
+        dataSource.type = channel == 0 ? DataSourceType::kVideo : channel % 2 == 1 ? DataSourceType::kAudio : DataSourceType::kMetadata;
+        snprintf(text, sizeof(text), "%s %d", devices[dataSource.deviceIndex].name.c_str(), channel + 1);
+        dataSource.name = text;
+        dataSource.state = State::kOnline;
+        dataSource.isEnabled = true;
+        dataSource.isRecording = dataSource.type == DataSourceType::kVideo;
+        dataSource.pruningThreshold = 0;
+        dataSource.retentionLimit = 0;
+    }
+}
+
+void VxSdkFake::Dataset::_Load(const Recording& recording) {
+    devices = recording.devices;
+    for (DeviceRecord& device : devices)
+        device.isDeleted = false;
+
+    // Each data source is hosted by the recorded device with its IP address, or by a placeholder device when the
+    // trace did not record one
+    int placeholder = -1;
+    dataSources = recording.dataSources;
+    for (DataSourceRecord& dataSource : dataSources) {
+        dataSource.deviceIndex = -1;
+        for (int i = 0; i < static_cast<int>(devices.size()) && dataSource.deviceIndex < 0; i++) {
+            if (devices[i].ip == dataSource.ip)
+                dataSource.deviceIndex = i;
+        }
+
+        if (dataSource.deviceIndex < 0) {
+            if (placeholder < 0) {
+                DeviceRecord device;
+                device.id = MakeId(1, static_cast<long long>(devices.size()));
+                device.name = "Unrecorded Device";
+                device.model = "Fake Camera";
+                device.vendor = "Pelco";
+                device.version = "1.0.0";
+                device.port = 80;
+                device.type = DeviceType::kCamera;
+                device.state = State::kOnline;
+                device.isDeleted = false;
+                placeholder = static_cast<int>(devices.size());
+                devices.push_back(device);
+            }
+
+            dataSource.deviceIndex = placeholder;
+        }
+    }
+
+    events = recording.events;
+    for (const EventRecord& event : events) {
+        if (std::find(situationTypes.begin(), situationTypes.end(), event.situationType) == situationTypes.end())
+            situationTypes.push_back(event.situationType);
+    }
+}
+
+VxSdkFake::EventRecord VxSdkFake::Dataset::CreateEvent() {
+    return _CreateEvent(system_clock::now());
+}
+
+VxSdkFake::EventRecord VxSdkFake::Dataset::CreateEvent(const char* situationType, const char* generatorDeviceId, const char* sourceDeviceId, const char* time) {
+    EventRecord event = _CreateEvent(system_clock::now());
+    event.situationType = situationType;
+    event.situationName = situationType;
+    event.generatorDeviceId = generatorDeviceId;
+    event.sourceDeviceId = sourceDeviceId;
+    if (time[0] != '\0')
+        event.time = time;
+
+    int generator = FindDevice(event.generatorDeviceId);
+    event.generatorDeviceName = generator < 0 ? "" : devices[generator].name;
+    int source = FindDevice(event.sourceDeviceId);
+    event.sourceDeviceName = source < 0 ? "" : devices[source].name;
+    return event;
+}
+
+int VxSdkFake::Dataset::FindDevice(const std::string& id) const {
+    for (int i = 0; i < static_cast<int>(devices.size()); i++) {
+        if (!devices[i].isDeleted && devices[i].id == id)
+            return i;
+    }
+
+    return -1;
+}
+
+std::string VxSdkFake::Dataset::FormatTime(system_clock::time_point time) {
+    std::time_t unixTime = system_clock::to_time_t(time);
+    int fraction = static_cast<int>(duration_cast<milliseconds>(time.time_since_epoch()).count() % 1000);
+    std::tm utc;
+#ifdef _WIN32
+    gmtime_s(&utc, &unixTime);
+#else
+    gmtime_r(&unixTime, &utc);
+#endif
+
+    char text[64];
+    snprintf(text, sizeof(text), "%04d-%02d-%02dT%02d:%02d:%02d.%03dZ", utc.tm_year + 1900, utc.tm_mon + 1, utc.tm_mday,
+        utc.tm_hour, utc.tm_min, utc.tm_sec, fraction);
+    return text;
+}
+
+std::string VxSdkFake::Dataset::MakeId(int kind, long long number) {
+    char text[40];
+    snprintf(text, sizeof(text), "%08x-0000-4000-8000-%012llx", static_cast<unsigned int>(kind), static_cast<unsigned long long>(number));
+    return text;
+}
+
+VxSdkFake::EventRecord VxSdkFake::Dataset::_CreateEvent(system_clock::time_point time) {
+    EventRecord event;
+    event.id = MakeId(3, _eventNumber++);
+    event.situationType = situationTypes[std::uniform_int_distribution<int>(0, static_cast<int>(situationTypes.size()) - 1)(_random)];
+    event.situationName = event.situationType;
+    event.time = FormatTime(time);
+    event.severity = static_cast<unsigned short>(std::uniform_int_distribution<int>(1, 10)(_random));
+    if (!devices.empty()) {
+        const DeviceRecord& device = devices[std::uniform_int_distribution<int>(0, static_cast<int>(devices.size()) - 1)(_random)];
+        event.generatorDeviceId = device.id;
+        event.generatorDeviceName = device.name;
+        event.sourceDeviceId = device.id;
+        event.sourceDeviceName = device.name;
+    }
+
+    return event;
+}
@@ -0,0 +1,289 @@
+/// <summary>
+/// Implements the fake device class.
+/// </summary>
+#include <cstring>
+#include "FakeDevice.h"
+#include "FakeCollection.h"
+#include "FakeDataSource.h"
+
+VxSdkFake::FakeDevice::FakeDevice(std::shared_ptr<Dataset> dataset, int index) : _dataset(dataset), _index(index) {
+    endpoints = nullptr;
+    endpointsSize = 0;
+    licensableFeatures = nullptr;
+    licensableFeaturesSize = 0;
+    licensedFeatures = nullptr;
+    licensedFeaturesSize = 0;
+    status = nullptr;
+    statusSize = 0;
+    _Load(_dataset->devices[_index]);
+}
+
+VxSdkFake::FakeDevice::~FakeDevice() {
+    _FreeEndpoints();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::AddAnalyticSession(VxSdk::VxNewAnalyticSession& newAnalyticSession) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::CanCreateLogs(bool& result) const {
+    result = false;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::CreateLog() const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::Delete() const {
+    delete this;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::DeleteDevice() const {
+    // The data sources of the device are deleted with it
+    std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+    _dataset->devices[_index].isDeleted = true;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetAccessPoints(VxSdk::VxCollection<VxSdk::IVxAccessPoint**>& accessPointCollection) const {
+    return FillEmpty(accessPointCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetAlarmInputs(VxSdk::VxCollection<VxSdk::IVxAlarmInput**>& alarmInputCollection) const {
+    return FillEmpty(alarmInputCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetAnalyticSessions(VxSdk::VxCollection<VxSdk::IVxAnalyticSession**>& analyticSessionCollection) const {
+    return FillEmpty(analyticSessionCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetAuthenticationConfiguration(VxSdk::IVxConfiguration::Auth*& authConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetBackup(char* endpoint, int& size) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetDatabaseBackups(VxSdk::IVxDbBackups*& dbBackups) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetDataSources(VxSdk::VxCollection<VxSdk::IVxDataSource**>& dataSourceCollection) const {
+    std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+    if (_dataset->devices[_index].isDeleted)
+        return VxSdk::VxResult::kInvalidParameters;
+
+    const std::vector<DataSourceRecord>& dataSources = _dataset->dataSources;
+    return FillCollection(dataSourceCollection, static_cast<int>(dataSources.size()),
+        [&](int i, const VxSdk::VxCollectionFilter* filter) {
+            if (filter == nullptr)
+                return dataSources[i].deviceIndex == _index;
+
+            if (filter->key == VxSdk::VxCollectionFilterItem::kId)
+                return Matches(*filter, dataSources[i].id);
+            if (filter->key == VxSdk::VxCollectionFilterItem::kName)
+                return Matches(*filter, dataSources[i].name);
+
+            return true;
+        },
+        [&](int i) { return new FakeDataSource(_dataset, i); });
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetDataStorage(VxSdk::IVxDataStorage*& dataStorage) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetDeviceAssignments(VxSdk::VxCollection<VxSdk::IVxDeviceAssignment**>& deviceAssignmentCollection) const {
+    return FillEmpty(deviceAssignmentCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetDiagnostics(VxSdk::VxDiagnostics*& diagnostics) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetLimits(VxSdk::VxLimits*& limits) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetLogs(VxSdk::VxCollection<VxSdk::IVxLog**>& logCollection) const {
+    return FillEmpty(logCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetMonitors(VxSdk::VxCollection<VxSdk::IVxMonitor**>& monitorCollection) const {
+    return FillEmpty(monitorCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetRelayOutputs(VxSdk::VxCollection<VxSdk::IVxRelayOutput**>& relayOutputCollection) const {
+    return FillEmpty(relayOutputCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetThermalEtdConfiguration(VxSdk::IVxConfiguration::ThermalEtd*& thermalEtdConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::GetTimeConfiguration(VxSdk::IVxConfiguration::Time*& timeConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::HasDiagnostics(bool& result) const {
+    result = false;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::Refresh() const {
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::Replace(const char* replacementDeviceId) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::RestoreBackup(char* backupFile) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::SetDevicePort(int devicePort) const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->devices[_index].port = devicePort;
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::SetDriverTypeId(char* deviceDriverTypeId) const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->devices[_index].driverTypeId = deviceDriverTypeId;
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::SetEndpoints(char** deviceEndpoints, int size) const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->devices[_index].endpoints.assign(deviceEndpoints, deviceEndpoints + size);
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::SetHostname(char* deviceHostname) const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->devices[_index].hostname = deviceHostname;
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::SetIp(char* deviceIp) const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->devices[_index].ip = deviceIp;
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::SetName(char* deviceName) const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->devices[_index].name = deviceName;
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::SetPassword(char* devicePassword) const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->devices[_index].password = devicePassword;
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::SetUsername(char* deviceUsername) const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->devices[_index].username = deviceUsername;
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::SetVersion(char* deviceVersion) const {
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        _dataset->devices[_index].version = deviceVersion;
+    }
+
+    return _Reload();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::Silence() const {
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::TriggerRefresh() const {
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::UpdateSoftware(VxSdk::IVxFile& updateFile) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+void VxSdkFake::FakeDevice::_FreeEndpoints() {
+    for (int i = 0; i < endpointsSize; i++)
+        delete[] endpoints[i];
+
+    delete[] endpoints;
+    endpoints = nullptr;
+    endpointsSize = 0;
+}
+
+void VxSdkFake::FakeDevice::_Load(const DeviceRecord& record) {
+    VxSdk::Utilities::StrCopySafe(id, record.id.c_str());
+    VxSdk::Utilities::StrCopySafe(name, record.name.c_str());
+    VxSdk::Utilities::StrCopySafe(ip, record.ip.c_str());
+    VxSdk::Utilities::StrCopySafe(hostname, record.hostname.c_str());
+    VxSdk::Utilities::StrCopySafe(model, record.model.c_str());
+    VxSdk::Utilities::StrCopySafe(serial, record.serial.c_str());
+    VxSdk::Utilities::StrCopySafe(vendor, record.vendor.c_str());
+    VxSdk::Utilities::StrCopySafe(version, record.version.c_str());
+    VxSdk::Utilities::StrCopySafe(username, record.username.c_str());
+    VxSdk::Utilities::StrCopySafe(driverTypeId, record.driverTypeId.c_str());
+    VxSdk::Utilities::StrCopySafe(driverDeviceId, "");
+    VxSdk::Utilities::StrCopySafe(discovered, "");
+    VxSdk::Utilities::StrCopySafe(macAddress, "");
+    VxSdk::Utilities::StrCopySafe(virtualIp, "");
+    VxSdk::Utilities::StrCopySafe(webappUrl, "");
+    initializationStatusReason = static_cast<decltype(initializationStatusReason)>(0);
+    isCommissioned = true;
+    isLicenseRequired = false;
+    port = record.port;
+    state = static_cast<decltype(state)>(record.state);
+    type = static_cast<decltype(type)>(record.type);
+
+    _FreeEndpoints();
+    endpointsSize = static_cast<int>(record.endpoints.size());
+    if (endpointsSize > 0) {
+        endpoints = new char*[endpointsSize];
+        for (int i = 0; i < endpointsSize; i++) {
+            endpoints[i] = new char[record.endpoints[i].size() + 1];
+            std::memcpy(endpoints[i], record.endpoints[i].c_str(), record.endpoints[i].size() + 1);
+        }
+    }
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeDevice::_Reload() const {
+    // The native interface is const throughout, but the fields of this copy are refreshed like those of the native SDK
+    std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+    const_cast<FakeDevice*>(this)->_Load(_dataset->devices[_index]);
+    return VxSdk::VxResult::kOK;
+}
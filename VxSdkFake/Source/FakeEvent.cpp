@@ -0,0 +1,89 @@
+/// <summary>
+/// Implements the fake event class.
+/// </summary>
+#include "FakeEvent.h"
+#include "FakeDevice.h"
+
+namespace {
+    /// <summary>
+    /// The value of the native acknowledgement state of an event that needs acknowledging.
+    /// </summary>
+    const int kAckNeeded = 1;
+
+    /// <summary>
+    /// The value of the native acknowledgement state of an acknowledged event.
+    /// </summary>
+    const int kAcked = 2;
+}
+
+VxSdkFake::FakeEvent::FakeEvent(std::shared_ptr<Dataset> dataset, const EventRecord& record) : _dataset(dataset) {
+    VxSdk::Utilities::StrCopySafe(id, record.id.c_str());
+    VxSdk::Utilities::StrCopySafe(situationType, record.situationType.c_str());
+    VxSdk::Utilities::StrCopySafe(situationName, record.situationName.c_str());
+    VxSdk::Utilities::StrCopySafe(generatorDeviceId, record.generatorDeviceId.c_str());
+    VxSdk::Utilities::StrCopySafe(generatorDeviceName, record.generatorDeviceName.c_str());
+    VxSdk::Utilities::StrCopySafe(sourceDeviceId, record.sourceDeviceId.c_str());
+    VxSdk::Utilities::StrCopySafe(sourceDeviceName, record.sourceDeviceName.c_str());
+    VxSdk::Utilities::StrCopySafe(time, record.time.c_str());
+    VxSdk::Utilities::StrCopySafe(ackClientId, "");
+    VxSdk::Utilities::StrCopySafe(ackClientName, "");
+    VxSdk::Utilities::StrCopySafe(ackTime, "");
+    VxSdk::Utilities::StrCopySafe(ackUser, "");
+    VxSdk::Utilities::StrCopySafe(sourceClientId, "");
+    VxSdk::Utilities::StrCopySafe(sourceUserName, "");
+    ackState = static_cast<decltype(ackState)>(kAckNeeded);
+    isInitial = false;
+    severity = record.severity;
+    shouldAudiblyNotify = false;
+    wakeup = 0;
+    properties = nullptr;
+    propertySize = 0;
+}
+
+VxSdkFake::FakeEvent::~FakeEvent() {
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeEvent::Acknowledge() const {
+    const_cast<FakeEvent*>(this)->ackState = static_cast<decltype(ackState)>(kAcked);
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeEvent::Delete() const {
+    delete this;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeEvent::GetGeneratorDevice(VxSdk::IVxDevice*& device) const {
+    return _GetDevice(generatorDeviceId, device);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeEvent::GetSituation(VxSdk::IVxSituation*& situation) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeEvent::GetSourceDevice(VxSdk::IVxDevice*& device) const {
+    return _GetDevice(sourceDeviceId, device);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeEvent::GetUser(VxSdk::IVxUser*& user) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeEvent::Refresh() const {
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeEvent::Silence(int wakeupTime) const {
+    const_cast<FakeEvent*>(this)->wakeup = wakeupTime;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeEvent::_GetDevice(const char* deviceId, VxSdk::IVxDevice*& device) const {
+    std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+    int index = _dataset->FindDevice(deviceId);
+    if (index < 0)
+        return VxSdk::VxResult::kInvalidParameters;
+
+    device = new FakeDevice(_dataset, index);
+    return VxSdk::VxResult::kOK;
+}
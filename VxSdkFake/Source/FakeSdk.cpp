@@ -0,0 +1,67 @@
+/// <summary>
+/// Implements the fake sdk entry points.
+/// </summary>
+#include <memory>
+#include <mutex>
+#include "FakeSdk.h"
+#include "FakeSystem.h"
+
+namespace {
+    /// <summary>
+    /// Guards the settings and the recording.
+    /// </summary>
+    std::mutex settingsLock;
+
+    /// <summary>
+    /// The settings used by systems logged in to from now on.
+    /// </summary>
+    VxSdkFake::Settings settings;
+
+    /// <summary>
+    /// The recording served by systems logged in to from now on, if any.
+    /// </summary>
+    std::shared_ptr<const VxSdkFake::Recording> recording;
+}
+
+VxSdkFake::Settings VxSdkFake::GetSettings() {
+    std::lock_guard<std::mutex> lock(settingsLock);
+    return settings;
+}
+
+void VxSdkFake::SetSettings(const Settings& newSettings) {
+    std::lock_guard<std::mutex> lock(settingsLock);
+    settings = newSettings;
+}
+
+void VxSdkFake::SetRecording(const Recording& newRecording) {
+    std::shared_ptr<const Recording> copy = std::make_shared<Recording>(newRecording);
+    std::lock_guard<std::mutex> lock(settingsLock);
+    recording = copy;
+}
+
+void VxSdkFake::ClearRecording() {
+    std::lock_guard<std::mutex> lock(settingsLock);
+    recording.reset();
+}
+
+VxSdk::VxResult::Value VxSdk::VxSystemLogin(VxSdk::VxLoginInfo& loginInfo, VxSdk::IVxSystem*& system) {
+    // Any login succeeds; each system serves its own copy of the data set
+    VxSdkFake::Settings loginSettings;
+    std::shared_ptr<const VxSdkFake::Recording> loginRecording;
+    {
+        std::lock_guard<std::mutex> lock(settingsLock);
+        loginSettings = settings;
+        loginRecording = recording;
+    }
+
+    system = new VxSdkFake::FakeSystem(loginInfo, loginSettings, loginRecording.get());
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdk::VxSetLogLevel(VxSdk::VxLogLevel::Value logLevel) {
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdk::VxSetLogPath(const char* logPath) {
+    return VxSdk::VxResult::kOK;
+}
@@ -0,0 +1,552 @@
+/// <summary>
+/// Implements the fake system class.
+/// </summary>
+#include <algorithm>
+#include "FakeSystem.h"
+#include "FakeCollection.h"
+#include "FakeDataSource.h"
+#include "FakeDevice.h"
+#include "FakeEvent.h"
+
+namespace {
+    /// <summary>
+    /// Gets the name used by the collection filters for a data source type.
+    /// </summary>
+    /// <param name="type">The data source type.</param>
+    /// <returns>The name of the type.</returns>
+    const char* GetTypeName(VxSdkFake::DataSourceType::Value type) {
+        switch (type) {
+        case VxSdkFake::DataSourceType::kAudio:
+            return "audio";
+        case VxSdkFake::DataSourceType::kMetadata:
+            return "metadata";
+        case VxSdkFake::DataSourceType::kVideo:
+            return "video";
+        default:
+            return "";
+        }
+    }
+}
+
+VxSdkFake::FakeSystem::FakeSystem(const VxSdk::VxLoginInfo& loginInfo, const Settings& settings, const Recording* recording) :
+    _dataset(std::make_shared<Dataset>(settings, recording)), _notifications(std::make_shared<Notifications>()), _settings(settings),
+    _bookmarkAutoUnlockTime(0) {
+    VxSdk::Utilities::StrCopySafe(id, Dataset::MakeId(0, 0).c_str());
+    VxSdk::Utilities::StrCopySafe(name, (std::string("Fake system ") + loginInfo.ipAddress).c_str());
+    VxSdk::Utilities::StrCopySafe(graceLicenseExpirationTime, "");
+}
+
+VxSdkFake::FakeSystem::~FakeSystem() {
+    StopNotifications();
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AcknowledgeAllEvents() const {
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddAnalyticSession(VxSdk::VxNewAnalyticSession& newAnalyticSession) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddBookmark(VxSdk::VxNewBookmark& newBookmark) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddDataObject(VxSdk::VxNewDataObject& newDataObject) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddDevice(VxSdk::VxNewDevice& newDevice) const {
+    // The new device hosts no data sources
+    DeviceRecord device;
+    device.name = newDevice.name;
+    device.ip = newDevice.ip;
+    device.hostname = newDevice.host;
+    device.model = newDevice.model;
+    device.serial = newDevice.serial;
+    device.vendor = newDevice.vendor;
+    device.version = newDevice.version;
+    device.username = newDevice.username;
+    device.password = newDevice.password;
+    device.endpoints.assign(newDevice.endpoints, newDevice.endpoints + newDevice.endpointsSize);
+    device.port = newDevice.port;
+    device.type = static_cast<DeviceType::Value>(newDevice.type);
+    device.state = State::kOnline;
+    device.isDeleted = false;
+
+    std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+    device.id = newDevice.id[0] != '\0' ? newDevice.id : Dataset::MakeId(1, static_cast<long long>(_dataset->devices.size()));
+    if (_dataset->FindDevice(device.id) >= 0)
+        return VxSdk::VxResult::kInvalidParameters;
+
+    _dataset->devices.push_back(device);
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddDrawing(VxSdk::VxNewDrawing& newDrawing) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddFile(char* filePath, char* fileName) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddManualRecording(VxSdk::VxNewManualRecording& newManualRecording, VxSdk::IVxManualRecording*& manualRecording) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddMember(VxSdk::VxNewMember& newMember) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddRecording(VxSdk::VxNewRecording& newRecording, VxSdk::IVxRecording*& recording) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddReportTemplate(VxSdk::VxNewReportTemplate& newReportTemplate) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddRole(const char* roleName) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddRule(VxSdk::VxNewRule& newRule) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddSchedule(VxSdk::VxNewSchedule& newSchedule) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddSituation(VxSdk::VxNewSituation& newSituation) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddTag(VxSdk::VxNewTag& newTag) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddTimeTable(VxSdk::VxNewTimeTable& newTimeTable) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::AddUser(VxSdk::VxNewUser& newUser) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::CreateExport(VxSdk::VxNewExport& newExport, VxSdk::IVxExport*& exportItem) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::CreateMonitor(VxSdk::VxNewMonitor& newMonitor) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::CreateMonitorWall(const char* monitorWallName) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::CreateReport(VxSdk::VxNewReport& newReport, VxSdk::IVxReport*& report) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::Delete() const {
+    delete this;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetAccessPoints(VxSdk::VxCollection<VxSdk::IVxAccessPoint**>& accessPointCollection) const {
+    return FillEmpty(accessPointCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetAlarmInputs(VxSdk::VxCollection<VxSdk::IVxAlarmInput**>& alarmInputCollection) const {
+    return FillEmpty(alarmInputCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetAnalyticSessions(VxSdk::VxCollection<VxSdk::IVxAnalyticSession**>& analyticSessionCollection) const {
+    return FillEmpty(analyticSessionCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetAuthenticationConfiguration(VxSdk::IVxConfiguration::Auth*& authConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetAvailableReportTemplates(VxSdk::VxCollection<VxSdk::VxNewReportTemplate**>& newReportTemplateCollection) const {
+    return FillEmpty(newReportTemplateCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetAvailableScheduleTriggerEvents(char** situationTypes, int& size) const {
+    // Each situation type is allocated for the caller, who owns it along with the array
+    const std::vector<std::string>& types = _dataset->situationTypes;
+    if (situationTypes == nullptr || size < static_cast<int>(types.size())) {
+        size = static_cast<int>(types.size());
+        return size == 0 ? VxSdk::VxResult::kOK : VxSdk::VxResult::kInsufficientSize;
+    }
+
+    size = static_cast<int>(types.size());
+    for (int i = 0; i < size; i++) {
+        situationTypes[i] = new char[types[i].size() + 1];
+        std::memcpy(situationTypes[i], types[i].c_str(), types[i].size() + 1);
+    }
+
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetBookmarkAutoUnlockTime(int& autoUnlockTime) const {
+    autoUnlockTime = _bookmarkAutoUnlockTime;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetBookmarkConfiguration(VxSdk::IVxConfiguration::Bookmark*& bookmarkConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetBookmarks(VxSdk::VxCollection<VxSdk::IVxBookmark**>& bookmarkCollection) const {
+    return FillEmpty(bookmarkCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetClusterConfiguration(VxSdk::IVxConfiguration::Cluster*& clusterConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetCurrentUser(VxSdk::IVxUser*& user) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetDataObjects(VxSdk::VxCollection<VxSdk::IVxDataObject**>& dataObjectCollection) const {
+    return FillEmpty(dataObjectCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetDataSources(VxSdk::VxCollection<VxSdk::IVxDataSource**>& dataSourceCollection) const {
+    std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+    const std::vector<DataSourceRecord>& dataSources = _dataset->dataSources;
+    const std::vector<DeviceRecord>& devices = _dataset->devices;
+    return FillCollection(dataSourceCollection, static_cast<int>(dataSources.size()),
+        [&](int i, const VxSdk::VxCollectionFilter* filter) {
+            if (filter == nullptr)
+                return !devices[dataSources[i].deviceIndex].isDeleted;
+
+            if (filter->key == VxSdk::VxCollectionFilterItem::kId)
+                return Matches(*filter, dataSources[i].id);
+            if (filter->key == VxSdk::VxCollectionFilterItem::kName)
+                return Matches(*filter, dataSources[i].name);
+            if (filter->key == VxSdk::VxCollectionFilterItem::kType)
+                return Matches(*filter, GetTypeName(dataSources[i].type));
+            if (filter->key == VxSdk::VxCollectionFilterItem::kDataSourceNumber)
+                return Matches(*filter, dataSources[i].number);
+
+            return true;
+        },
+        [&](int i) { return new FakeDataSource(_dataset, i); });
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetDataStorages(VxSdk::VxCollection<VxSdk::IVxDataStorage**>& dataStorageCollection) const {
+    return FillEmpty(dataStorageCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetDeviceAssignments(VxSdk::VxCollection<VxSdk::IVxDeviceAssignment**>& deviceAssignmentCollection) const {
+    return FillEmpty(deviceAssignmentCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetDevices(VxSdk::VxCollection<VxSdk::IVxDevice**>& deviceCollection) const {
+    std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+    const std::vector<DeviceRecord>& devices = _dataset->devices;
+    return FillCollection(deviceCollection, static_cast<int>(devices.size()),
+        [&](int i, const VxSdk::VxCollectionFilter* filter) {
+            if (filter == nullptr)
+                return !devices[i].isDeleted;
+
+            if (filter->key == VxSdk::VxCollectionFilterItem::kId)
+                return Matches(*filter, devices[i].id);
+            if (filter->key == VxSdk::VxCollectionFilterItem::kName)
+                return Matches(*filter, devices[i].name);
+
+            return true;
+        },
+        [&](int i) { return new FakeDevice(_dataset, i); });
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetDiscoveryStatus(VxSdk::IVxDiscovery*& discovery) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetDrawings(VxSdk::VxCollection<VxSdk::IVxDrawing**>& drawingCollection) const {
+    return FillEmpty(drawingCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetDrivers(VxSdk::VxCollection<VxSdk::IVxDriver**>& driverCollection) const {
+    return FillEmpty(driverCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetEventConfiguration(VxSdk::IVxConfiguration::Event*& eventConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetEvents(VxSdk::VxCollection<VxSdk::IVxEvent**>& eventCollection) const {
+    std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+    const std::vector<EventRecord>& events = _dataset->events;
+    return FillCollection(eventCollection, static_cast<int>(events.size()),
+        [&](int i, const VxSdk::VxCollectionFilter* filter) {
+            if (filter == nullptr)
+                return true;
+
+            if (filter->key == VxSdk::VxCollectionFilterItem::kId)
+                return Matches(*filter, events[i].id);
+            if (filter->key == VxSdk::VxCollectionFilterItem::kSituationType)
+                return Matches(*filter, events[i].situationType);
+
+            return true;
+        },
+        [&](int i) { return new FakeEvent(_dataset, events[i]); });
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetExportConfiguration(VxSdk::IVxConfiguration::Export*& exportConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetExportEstimate(VxSdk::VxNewExport& newExport, VxSdk::VxExportEstimate*& exportEstimate) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetExports(VxSdk::VxCollection<VxSdk::IVxExport**>& exportCollection) const {
+    return FillEmpty(exportCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetFiles(VxSdk::VxCollection<VxSdk::IVxFile**>& fileCollection) const {
+    return FillEmpty(fileCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetHostDevice(VxSdk::IVxDevice*& hostDevice) const {
+    // The first device stands in for the host
+    std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+    if (_dataset->devices.empty() || _dataset->devices[0].isDeleted)
+        return VxSdk::VxResult::kActionUnavailable;
+
+    hostDevice = new FakeDevice(_dataset, 0);
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetLdapConfiguration(VxSdk::IVxConfiguration::Ldap*& ldapConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetLicense(VxSdk::IVxLicense*& license) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetManualRecordings(VxSdk::VxCollection<VxSdk::IVxManualRecording**>& manualRecordingCollection) const {
+    return FillEmpty(manualRecordingCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetMembers(VxSdk::VxCollection<VxSdk::IVxMember**>& memberCollection) const {
+    return FillEmpty(memberCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetMonitors(VxSdk::VxCollection<VxSdk::IVxMonitor**>& monitorCollection) const {
+    return FillEmpty(monitorCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetMonitorWalls(VxSdk::VxCollection<VxSdk::IVxMonitorWall**>& monitorWallCollection) const {
+    return FillEmpty(monitorWallCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetRecordings(VxSdk::VxCollection<VxSdk::IVxRecording**>& recordingCollection) const {
+    return FillEmpty(recordingCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetRelayOutputs(VxSdk::VxCollection<VxSdk::IVxRelayOutput**>& relayOutputCollection) const {
+    return FillEmpty(relayOutputCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetReportConfiguration(VxSdk::IVxConfiguration::Report*& reportConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetReports(VxSdk::VxCollection<VxSdk::IVxReport**>& reportCollection) const {
+    return FillEmpty(reportCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetReportTemplates(VxSdk::VxCollection<VxSdk::IVxReportTemplate**>& reportTemplateCollection) const {
+    return FillEmpty(reportTemplateCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetRolePermissionSchema(VxSdk::VxPermissionSchema*& permissionSchema) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetRoles(VxSdk::VxCollection<VxSdk::IVxRole**>& roleCollection) const {
+    return FillEmpty(roleCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetRules(VxSdk::VxCollection<VxSdk::IVxRule**>& ruleCollection) const {
+    return FillEmpty(ruleCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetSchedules(VxSdk::VxCollection<VxSdk::IVxSchedule**>& scheduleCollection) const {
+    return FillEmpty(scheduleCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetServerConfiguration(VxSdk::IVxConfiguration::Server*& serverConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetSituations(VxSdk::VxCollection<VxSdk::IVxSituation**>& situationCollection) const {
+    return FillEmpty(situationCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetSmtpConfiguration(VxSdk::IVxConfiguration::Smtp*& smtpConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetSnmpConfiguration(VxSdk::IVxConfiguration::Snmp*& snmpConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetSystemTime(char* systemTime) const {
+    std::string now = Dataset::FormatTime(std::chrono::system_clock::now());
+    std::memcpy(systemTime, now.c_str(), now.size() + 1);
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetTags(VxSdk::VxCollection<VxSdk::IVxTag**>& tagCollection) const {
+    return FillEmpty(tagCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetTimeConfiguration(VxSdk::IVxConfiguration::Time*& timeConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetTimeTables(VxSdk::VxCollection<VxSdk::IVxTimeTable**>& timeTableCollection) const {
+    return FillEmpty(timeTableCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetTwilioConfiguration(VxSdk::IVxConfiguration::Twilio*& twilioConfig) const {
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::GetUsers(VxSdk::VxCollection<VxSdk::IVxUser**>& userCollection) const {
+    return FillEmpty(userCollection);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::InsertEvent(VxSdk::VxNewEvent& newEvent) const {
+    // The event is stored, and notified by the generator thread if notifications are started
+    EventRecord event;
+    {
+        std::lock_guard<std::mutex> datasetLock(_dataset->lock);
+        event = _dataset->CreateEvent(newEvent.situationType, newEvent.generatorDeviceId, newEvent.sourceDeviceId, newEvent.time);
+        _dataset->events.push_back(event);
+    }
+
+    std::lock_guard<std::mutex> notificationLock(_notifications->lock);
+    if (_notifications->isStarted) {
+        _notifications->inserted.push_back(event);
+        _notifications->wake.notify_all();
+    }
+
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::Refresh() const {
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::SetBookmarkAutoUnlockTime(int autoUnlockTime) const {
+    _bookmarkAutoUnlockTime = autoUnlockTime;
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::SetName(char* systemName) const {
+    VxSdk::Utilities::StrCopySafe(const_cast<FakeSystem*>(this)->name, systemName);
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::StartInternalNotifications(VxSdk::VxInternalEventCallback callback) const {
+    // The fake raises no internal events
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::StartNotifications(VxSdk::VxEventCallback callback) const {
+    return _StartNotifications(callback, std::vector<std::string>());
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::StartNotifications(VxSdk::VxEventCallback callback, VxSdk::VxCollection<VxSdk::IVxSituation**>& situations, bool userNotification) const {
+    std::vector<std::string> situationTypes;
+    for (int i = 0; i < situations.collectionSize; i++)
+        situationTypes.push_back(situations.collection[i]->type);
+
+    return _StartNotifications(callback, situationTypes);
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::StopInternalNotifications() const {
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::StopNotifications() const {
+    std::lock_guard<std::mutex> notificationLock(_notifications->lock);
+    if (_notifications->isStarted) {
+        // The notifier thread exits once it sees the generation change, even if it is the caller
+        _notifications->isStarted = false;
+        _notifications->generation++;
+        _notifications->inserted.clear();
+        _notifications->wake.notify_all();
+    }
+
+    return VxSdk::VxResult::kOK;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::ValidateMember(bool& result, const char* host, int port, const char* username, const char* password) const {
+    result = false;
+    return VxSdk::VxResult::kActionUnavailable;
+}
+
+VxSdk::VxResult::Value VxSdkFake::FakeSystem::_StartNotifications(VxSdk::VxEventCallback callback, std::vector<std::string> situationTypes) const {
+    // Like the native SDK, a system has one subscription; starting it again replaces its callback and filter
+    std::lock_guard<std::mutex> notificationLock(_notifications->lock);
+    _notifications->callback = callback;
+    _notifications->situationTypes.swap(situationTypes);
+    if (!_notifications->isStarted) {
+        _notifications->isStarted = true;
+        std::thread(&FakeSystem::_Notify, _dataset, _notifications, _settings, ++_notifications->generation).detach();
+    }
+
+    return VxSdk::VxResult::kOK;
+}
+
+void VxSdkFake::FakeSystem::_Notify(std::shared_ptr<Dataset> dataset, std::shared_ptr<Notifications> notifications, Settings settings, int generation) {
+    // Events are generated in batches at the configured interval; inserted events are notified as soon as they arrive
+    std::chrono::milliseconds interval(settings.eventInterval);
+    std::chrono::steady_clock::time_point due = std::chrono::steady_clock::now() + interval;
+    std::unique_lock<std::mutex> notificationLock(notifications->lock);
+    while (notifications->generation == generation) {
+        std::deque<EventRecord> batch;
+        batch.swap(notifications->inserted);
+        if (settings.eventInterval > 0 && std::chrono::steady_clock::now() >= due) {
+            std::lock_guard<std::mutex> datasetLock(dataset->lock);
+            for (int i = 0; i < settings.eventsPerInterval; i++)
+                batch.push_back(dataset->CreateEvent());
+
+            due += interval;
+        }
+
+        if (batch.empty()) {
+            if (settings.eventInterval > 0)
+                notifications->wake.wait_until(notificationLock, due);
+            else
+                notifications->wake.wait(notificationLock);
+
+            continue;
+        }
+
+        // The callback owns the events it is given, and may start or stop the notifications itself
+        VxSdk::VxEventCallback callback = notifications->callback;
+        std::vector<std::string> situationTypes = notifications->situationTypes;
+        notificationLock.unlock();
+        for (size_t i = 0; i < batch.size(); i++) {
+            if (situationTypes.empty() || std::find(situationTypes.begin(), situationTypes.end(), batch[i].situationType) != situationTypes.end())
+                callback(new FakeEvent(dataset, batch[i]));
+        }
+
+        notificationLock.lock();
+    }
+}
@@ -87,7 +87,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~AccessPoint() {
-            this->!AccessPoint();
+            NativeMemory::Remove(_accessPoint);
+            _accessPoint->Delete();
+            _accessPoint = nullptr;
         }
 
         /// <summary>
@@ -214,6 +216,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxAccessPoint* _accessPoint;
+        IdentityMap^ _identityMap;
         VxSdkNet::Device^ _GetHostDevice();
         VxSdkNet::ResourceLimits^ _GetLimits();
     };
@@ -53,7 +53,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~AlarmInput() {
-            this->!AlarmInput();
+            NativeMemory::Remove(_alarmInput);
+            _alarmInput->Delete();
+            _alarmInput = nullptr;
         }
 
         /// <summary>
@@ -143,6 +145,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxAlarmInput* _alarmInput;
+        IdentityMap^ _identityMap;
         VxSdkNet::Device^ _GetHostDevice();
         VxSdkNet::ResourceLimits^ _GetLimits();
     };
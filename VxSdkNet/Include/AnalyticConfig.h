@@ -26,7 +26,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~AnalyticConfig() {
-            this->!AnalyticConfig();
+            NativeMemory::Remove(_analyticConfig);
+            _analyticConfig->Delete();
+            _analyticConfig = nullptr;
         }
 
         /// <summary>
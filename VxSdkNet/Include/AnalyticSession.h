@@ -25,7 +25,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~AnalyticSession() {
-            this->!AnalyticSession();
+            NativeMemory::Remove(_analyticSession);
+            _analyticSession->Delete();
+            _analyticSession = nullptr;
         }
 
         /// <summary>
@@ -115,6 +117,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxAnalyticSession* _analyticSession;
+        IdentityMap^ _identityMap;
         VxSdkNet::AnalyticConfig^ _GetAnalyticConfig();
         VxSdkNet::DataSource^ _GetDataSource();
         VxSdkNet::Device^ _GetHostDevice();
@@ -25,7 +25,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Bookmark() {
-            this->!Bookmark();
+            NativeMemory::Remove(_bookmark);
+            _bookmark->Delete();
+            _bookmark = nullptr;
         }
 
         /// <summary>
@@ -133,6 +135,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxBookmark* _bookmark;
+        IdentityMap^ _identityMap;
         VxSdkNet::DataSource^ _GetDataSource();
         VxSdkNet::ResourceLimits^ _GetLimits();
         VxSdkNet::BookmarkLock^ _GetLock();
@@ -25,7 +25,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~BookmarkLock() {
-            this->!BookmarkLock();
+            NativeMemory::Remove(_bookmarkLock);
+            _bookmarkLock->Delete();
+            _bookmarkLock = nullptr;
         }
 
         /// <summary>
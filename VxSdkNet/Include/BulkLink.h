@@ -0,0 +1,171 @@
+// Declares the bulk link class.
+#ifndef BulkLink_h__
+#define BulkLink_h__
+
+#include "Utils.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// A single link or unlink to be made as part of a <see cref="BulkLink::SetLinked"/> call.
+    /// </summary>
+    private ref class LinkOperation {
+    public:
+        LinkOperation(System::String^ id, System::Object^ item, bool link) : Id(id), Item(item), Link(link) {}
+        System::String^ Id;
+        System::Object^ Item;
+        bool Link;
+    };
+
+    /// <summary>
+    /// The BulkLink class links and unlinks large numbers of resources.  The resources that should be linked are
+    /// compared with those that already are, so that only the changes are sent; if the linked resources cannot be
+    /// read, nothing is changed and each resource that should be linked reports the read result.  A native object does
+    /// not support concurrent calls, so a large number of changes to one object is spread over further native handles
+    /// to the same resource, up to <see cref="MaxHandlesPerObject"/>, each used by one thread.  The links of different
+    /// objects may be changed at once, up to <see cref="MaxConcurrentObjects"/>.  It is used by the <c>SetLinked</c>
+    /// methods of <see cref="Privilege"/>, <see cref="Schedule"/>, <see cref="Situation"/> and <see cref="Tag"/>.
+    /// </summary>
+    public ref class BulkLink abstract sealed {
+    public:
+
+        /// <summary>
+        /// Gets or sets the maximum number of objects whose links may be changed at once, across every thread.
+        /// Defaults to 8.
+        /// </summary>
+        /// <value>The maximum number of objects changed concurrently.</value>
+        static property int MaxConcurrentObjects {
+        public:
+            int get() { return _maxConcurrentObjects; }
+            void set(int value);
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of native handles the changes to one object are spread over, and so the
+        /// maximum number of its links changed at once.  A further handle is only fetched for every
+        /// <c>ChangesPerHandle</c> changes.  1 makes the changes to one object in turn.  Defaults to 4.
+        /// </summary>
+        /// <value>The maximum number of handles used for one object.</value>
+        static property int MaxHandlesPerObject {
+        public:
+            int get() { return _maxHandlesPerObject; }
+            void set(int value) { _maxHandlesPerObject = System::Math::Max(value, 1); }
+        }
+
+    internal:
+        delegate Results::Value LinkDelegate(System::Object^ item, bool link);
+        delegate System::Object^ FetchDelegate();
+        static const int ChangesPerHandle = 32;
+        static int _maxConcurrentObjects = 8;
+        static int _maxHandlesPerObject = 4;
+        static System::Threading::SemaphoreSlim^ _objectSlots = gcnew System::Threading::SemaphoreSlim(8);
+
+        /// <summary>
+        /// Links the desired resources that are not linked and unlinks the linked resources that are not desired.
+        /// <c>nullptr</c> entries are ignored.
+        /// </summary>
+        /// <param name="desiredItems">The resources that should be linked.</param>
+        /// <param name="linkedItems">The resources that are currently linked.</param>
+        /// <param name="readResult">The result of reading the linked resources.</param>
+        /// <param name="linkDelegate">Links or unlinks a single resource through the object's own handle.</param>
+        /// <param name="fetchDelegate">
+        /// Fetches a new wrapper of the same type over a separate native handle to the object's resource, or returns
+        /// <c>nullptr</c> if none can be fetched.  Each wrapper is deleted once its changes are made.
+        /// </param>
+        /// <returns>The result of each link or unlink made, keyed by unique identifier.</returns>
+        template <typename TItem>
+        static System::Collections::Generic::Dictionary<System::String^, Results::Value>^ SetLinked(
+            System::Collections::Generic::IEnumerable<TItem^>^ desiredItems,
+            System::Collections::Generic::IEnumerable<TItem^>^ linkedItems, VxSdk::VxResult::Value readResult,
+            LinkDelegate^ linkDelegate, FetchDelegate^ fetchDelegate) {
+            // Key the resources that should be linked and those that are linked by their unique identifiers
+            System::Collections::Generic::Dictionary<System::String^, System::Object^>^ desired =
+                gcnew System::Collections::Generic::Dictionary<System::String^, System::Object^>();
+            if (desiredItems != nullptr) {
+                for each (TItem^ item in desiredItems) {
+                    if (item != nullptr)
+                        desired[item->Id] = item;
+                }
+            }
+
+            System::Collections::Generic::Dictionary<System::String^, System::Object^>^ linked =
+                gcnew System::Collections::Generic::Dictionary<System::String^, System::Object^>();
+            for each (TItem^ item in linkedItems) {
+                if (item != nullptr)
+                    linked[item->Id] = item;
+            }
+
+            return _SetLinked(desired, linked, readResult, linkDelegate, fetchDelegate);
+        }
+
+        /// <summary>
+        /// Fetches a separate native handle to a resource by a filter that identifies it.
+        /// </summary>
+        /// <param name="method">The name of the native method, as recorded by <see cref="SdkCall"/>.</param>
+        /// <param name="owner">The native object the resource is fetched from.</param>
+        /// <param name="fetch">The native method that fills in a collection of the resources.</param>
+        /// <param name="key">The filter that identifies the resource, such as <c>kId</c>.</param>
+        /// <param name="value">The value of the filter.</param>
+        /// <returns>The new native handle, or <c>nullptr</c> if the resource could not be fetched.</returns>
+        template <typename TOwner, typename TNative>
+        static TNative* _FetchHandle(const char* method, TOwner* owner,
+            VxSdk::VxResult::Value (TOwner::*fetch)(VxSdk::VxCollection<TNative**>&) const,
+            VxSdk::VxCollectionFilterItem::Value key, System::String^ value) {
+            VxSdk::VxCollectionFilter filter;
+            filter.key = key;
+            VxSdk::Utilities::StrCopySafe(filter.value, Utils::ConvertCSharpString(value).c_str());
+            VxSdk::VxCollection<TNative**> collection;
+            collection.filterSize = 1;
+            collection.filters = &filter;
+
+            TNative* handle = nullptr;
+            SdkCall sdkCall(method, collection);
+            VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : (owner->*fetch)(collection));
+            if (result == VxSdk::VxResult::kInsufficientSize) {
+                collection.collection = new TNative*[collection.collectionSize];
+                sdkCall.Restart(method, collection);
+                result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : (owner->*fetch)(collection));
+                if (result == VxSdk::VxResult::kOK) {
+                    for (int i = 0; i < collection.collectionSize; i++) {
+                        if (handle == nullptr)
+                            handle = collection.collection[i];
+                        else
+                            collection.collection[i]->Delete();
+                    }
+                }
+
+                delete[] collection.collection;
+            }
+
+            return handle;
+        }
+
+        static System::Collections::Generic::Dictionary<System::String^, Results::Value>^ _SetLinked(
+            System::Collections::Generic::Dictionary<System::String^, System::Object^>^ desired,
+            System::Collections::Generic::Dictionary<System::String^, System::Object^>^ linked,
+            VxSdk::VxResult::Value readResult, LinkDelegate^ linkDelegate, FetchDelegate^ fetchDelegate);
+        static void _RunOperations(System::Object^ state);
+    };
+
+    /// <summary>
+    /// The state shared by the workers of a <see cref="BulkLink::SetLinked"/> call.
+    /// </summary>
+    private ref class BulkLinkJob {
+    public:
+        System::Collections::Concurrent::ConcurrentQueue<LinkOperation^>^ Operations;
+        System::Threading::CountdownEvent^ Workers;
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ ItemResults;
+        System::Exception^ Fault;
+    };
+
+    /// <summary>
+    /// A worker of a <see cref="BulkLink::SetLinked"/> call, making changes through its own native handle.
+    /// </summary>
+    private ref class BulkLinkWorker {
+    public:
+        BulkLinkWorker(BulkLinkJob^ job, BulkLink::LinkDelegate^ linkDelegate) : Job(job), LinkDelegate(linkDelegate) {}
+        BulkLinkJob^ Job;
+        BulkLink::LinkDelegate^ LinkDelegate;
+    };
+}
+#endif // BulkLink_h__
@@ -64,7 +64,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Clip() {
-            this->!Clip();
+            NativeMemory::Remove(_clip);
+            _clip->Delete();
+            _clip = nullptr;
         }
 
         /// <summary>
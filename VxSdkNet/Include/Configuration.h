@@ -227,7 +227,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Auth() {
-                this->!Auth();
+                NativeMemory::Remove(_configAuth);
+                _configAuth->Delete();
+                _configAuth = nullptr;
             }
 
             /// <summary>
@@ -316,7 +318,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Bookmark() {
-                this->!Bookmark();
+                NativeMemory::Remove(_configBookmark);
+                _configBookmark->Delete();
+                _configBookmark = nullptr;
             }
 
             /// <summary>
@@ -395,7 +399,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Cluster() {
-                this->!Cluster();
+                NativeMemory::Remove(_configCluster);
+                _configCluster->Delete();
+                _configCluster = nullptr;
             }
 
             /// <summary>
@@ -668,7 +674,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Event() {
-                this->!Event();
+                NativeMemory::Remove(_configEvent);
+                _configEvent->Delete();
+                _configEvent = nullptr;
             }
 
             /// <summary>
@@ -745,7 +753,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Export() {
-                this->!Export();
+                NativeMemory::Remove(_configExport);
+                _configExport->Delete();
+                _configExport = nullptr;
             }
 
             /// <summary>
@@ -806,7 +816,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Ldap() {
-                this->!Ldap();
+                NativeMemory::Remove(_configLdap);
+                _configLdap->Delete();
+                _configLdap = nullptr;
             }
 
             /// <summary>
@@ -1044,7 +1056,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Motion() {
-                this->!Motion();
+                NativeMemory::Remove(_configMotion);
+                _configMotion->Delete();
+                _configMotion = nullptr;
             }
 
             /// <summary>
@@ -1120,7 +1134,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Node() {
-                this->!Node();
+                NativeMemory::Remove(_configNode);
+                _configNode->Delete();
+                _configNode = nullptr;
             }
 
             /// <summary>
@@ -1209,7 +1225,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Report() {
-                this->!Report();
+                NativeMemory::Remove(_configReport);
+                _configReport->Delete();
+                _configReport = nullptr;
             }
 
             /// <summary>
@@ -1265,7 +1283,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Server() {
-                this->!Server();
+                NativeMemory::Remove(_configServer);
+                _configServer->Delete();
+                _configServer = nullptr;
             }
 
             /// <summary>
@@ -1355,7 +1375,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Smtp() {
-                this->!Smtp();
+                NativeMemory::Remove(_configSmtp);
+                _configSmtp->Delete();
+                _configSmtp = nullptr;
             }
 
             /// <summary>
@@ -1501,7 +1523,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Snmp() {
-                this->!Snmp();
+                NativeMemory::Remove(_configSnmp);
+                _configSnmp->Delete();
+                _configSnmp = nullptr;
             }
 
             /// <summary>
@@ -1639,7 +1663,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Storage() {
-                this->!Storage();
+                NativeMemory::Remove(_configStorage);
+                _configStorage->Delete();
+                _configStorage = nullptr;
             }
 
             /// <summary>
@@ -1929,7 +1955,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~ThermalEtd() {
-                this->!ThermalEtd();
+                NativeMemory::Remove(_configThermalEtd);
+                _configThermalEtd->Delete();
+                _configThermalEtd = nullptr;
             }
 
             /// <summary>
@@ -2005,7 +2033,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Time() {
-                this->!Time();
+                NativeMemory::Remove(_configTime);
+                _configTime->Delete();
+                _configTime = nullptr;
             }
 
             /// <summary>
@@ -2107,7 +2137,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Twilio() {
-                this->!Twilio();
+                NativeMemory::Remove(_configTwilio);
+                _configTwilio->Delete();
+                _configTwilio = nullptr;
             }
 
             /// <summary>
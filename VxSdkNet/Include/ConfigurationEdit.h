@@ -0,0 +1,115 @@
+// Declares the configuration edit class.
+#ifndef ConfigurationEdit_h__
+#define ConfigurationEdit_h__
+
+#include "Utils.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The ConfigurationEdit class records a set of property changes for a configuration object, such as a
+    /// <see cref="Configuration::Cluster"/> or a <see cref="DataSourceConfig::Motion"/>, and applies them together.
+    /// Each change is compared with the value the object held after its last <c>Refresh</c>, and only the values that
+    /// differ are sent; the object is then refreshed once to confirm which changes took effect.  The same edit may be
+    /// applied to many configuration objects of the same kind at once, for example to apply a site template.
+    /// </summary>
+    public ref class ConfigurationEdit {
+    public:
+
+        /// <summary>
+        /// The apply result callback delegate.
+        /// </summary>
+        /// <param name="configuration">The configuration object the edit was applied to.</param>
+        /// <param name="results">The result of each change, keyed by property name.</param>
+        delegate void ApplyDelegate(System::Object^ configuration,
+            System::Collections::Generic::Dictionary<System::String^, Results::Value>^ results);
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        ConfigurationEdit();
+
+        /// <summary>
+        /// Applies the changes to a configuration object.  Changes to values that already match are not sent and are
+        /// reported as <c>OK</c>.  A property that does not exist or cannot be set is reported as
+        /// <c>InvalidParameters</c>, and a change that was sent but did not take effect, or whose getter or setter threw,
+        /// as <c>OperationFailed</c>.  A change that was sent but cannot be confirmed, because the object has no
+        /// <c>Refresh</c> method or the value cannot be compared, is reported as <c>UnknownError</c>.
+        /// </summary>
+        /// <param name="configuration">The configuration object to apply the changes to.</param>
+        /// <returns>The result of each change, keyed by property name.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ Apply(System::Object^ configuration);
+
+        /// <summary>
+        /// Applies the changes to each of the given configuration objects, several at a time.  This method blocks until
+        /// every configuration object has been handled.
+        /// </summary>
+        /// <param name="configurations">The configuration objects to apply the changes to.</param>
+        /// <param name="callback">An optional callback to pass the results of each configuration object to as it finishes.</param>
+        /// <returns>The number of configuration objects whose changes all succeeded.</returns>
+        int Apply(System::Collections::IEnumerable^ configurations, ApplyDelegate^ callback);
+
+        /// <summary>
+        /// Removes all changes.
+        /// </summary>
+        void Clear();
+
+        /// <summary>
+        /// Removes the change to a property.
+        /// </summary>
+        /// <param name="propertyName">The name of the property.</param>
+        /// <returns><c>true</c> if there was a change to remove, otherwise <c>false</c>.</returns>
+        bool Remove(System::String^ propertyName);
+
+        /// <summary>
+        /// Records a change to a property, replacing any earlier change to it.
+        /// </summary>
+        /// <param name="propertyName">The name of the property, for example <c>AggregatedEventLimit</c>.</param>
+        /// <param name="value">The new value of the property.</param>
+        void Set(System::String^ propertyName, System::Object^ value);
+
+        /// <summary>
+        /// Gets the number of exceptions thrown by the callbacks passed to <c>Apply</c>.  They are caught so that the
+        /// changes are still applied to the remaining configuration objects.
+        /// </summary>
+        /// <value>The number of callback exceptions.</value>
+        property int CallbackErrors {
+        public:
+            int get() { return _callbackErrors; }
+        }
+
+        /// <summary>
+        /// Gets the recorded changes, in the order they were first set.
+        /// </summary>
+        /// <value>A <c>List</c> of property names and values.</value>
+        property System::Collections::Generic::List<System::Collections::Generic::KeyValuePair<System::String^, System::Object^>>^ Changes {
+        public:
+            System::Collections::Generic::List<System::Collections::Generic::KeyValuePair<System::String^, System::Object^>>^ get();
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of configuration objects the changes may be applied to at once.  Defaults to 8.
+        /// </summary>
+        /// <value>The maximum number of concurrent applies.</value>
+        property int MaxConcurrentApplies;
+
+    internal:
+        int _callbackErrors;
+        System::Collections::Generic::List<System::String^>^ _names;
+        System::Collections::Generic::Dictionary<System::String^, System::Object^>^ _values;
+        static bool _TryConvertValue(System::Object^ value, System::Type^ type, System::Object^% converted);
+        void _RunApplies(System::Object^ state);
+    };
+
+    /// <summary>
+    /// The state shared by the workers of a <see cref="ConfigurationEdit::Apply"/> call.
+    /// </summary>
+    private ref class ConfigurationEditJob {
+    public:
+        System::Collections::Concurrent::ConcurrentQueue<System::Object^>^ Configurations;
+        System::Threading::CountdownEvent^ Workers;
+        ConfigurationEdit::ApplyDelegate^ Callback;
+        int Succeeded;
+    };
+}
+#endif // ConfigurationEdit_h__
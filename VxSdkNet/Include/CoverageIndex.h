@@ -0,0 +1,154 @@
+// Declares the coverage index class.
+#ifndef CoverageIndex_h__
+#define CoverageIndex_h__
+
+#include "DataSource.h"
+#include "Gap.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The CoverageIndex class indexes the recorded time of a data source.  The recorded spans are held as a sorted set
+    /// of merged, non-overlapping intervals so that point, range and percentage queries take logarithmic time instead
+    /// of a scan over the clips.  New clips may be merged into the index as they are recorded.
+    /// </summary>
+    public ref class CoverageIndex {
+    public:
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="dataSourceId">The unique identifier of the data source the index is for.</param>
+        CoverageIndex(System::String^ dataSourceId);
+
+        /// <summary>
+        /// Creates an index of the recorded time of a data source between a start and end time.
+        /// </summary>
+        /// <param name="dataSource">The data source to index.</param>
+        /// <param name="startTime">The start of the time range to index.</param>
+        /// <param name="endTime">The end of the time range to index.</param>
+        /// <returns>The coverage index.</returns>
+        static CoverageIndex^ Create(DataSource^ dataSource, System::DateTime startTime, System::DateTime endTime);
+
+        /// <summary>
+        /// Adds a recorded span of time to the index, merging it with any spans it overlaps or adjoins.
+        /// </summary>
+        /// <param name="startTime">The start time of the span.</param>
+        /// <param name="endTime">The end time of the span.</param>
+        void Add(System::DateTime startTime, System::DateTime endTime);
+
+        /// <summary>
+        /// Adds the spans of the given clips to the index.
+        /// </summary>
+        /// <param name="clips">The clips to add.</param>
+        void AddClips(System::Collections::Generic::IEnumerable<Clip^>^ clips);
+
+        /// <summary>
+        /// Removes all spans from the index.
+        /// </summary>
+        void Clear();
+
+        /// <summary>
+        /// Gets whether the given time has been recorded.
+        /// </summary>
+        /// <param name="time">The time to check.</param>
+        /// <returns><c>true</c> if the time is recorded, otherwise <c>false</c>.</returns>
+        bool Contains(System::DateTime time);
+
+        /// <summary>
+        /// Gets the fraction of the time between a start and end time that has been recorded.
+        /// </summary>
+        /// <param name="startTime">The start of the time range.</param>
+        /// <param name="endTime">The end of the time range.</param>
+        /// <returns>A value from 0 to 1; 0 if the end time is not after the start time.</returns>
+        double GetCoverage(System::DateTime startTime, System::DateTime endTime);
+
+        /// <summary>
+        /// Gets the amount of time between a start and end time that has been recorded.
+        /// </summary>
+        /// <param name="startTime">The start of the time range.</param>
+        /// <param name="endTime">The end of the time range.</param>
+        /// <returns>The recorded time within the range.</returns>
+        System::TimeSpan GetCoveredTime(System::DateTime startTime, System::DateTime endTime);
+
+        /// <summary>
+        /// Gets the spans of time between a start and end time that have not been recorded.
+        /// </summary>
+        /// <param name="startTime">The start of the time range.</param>
+        /// <param name="endTime">The end of the time range.</param>
+        /// <returns>A list of start and end time pairs, in order.</returns>
+        System::Collections::Generic::List<System::Collections::Generic::KeyValuePair<System::DateTime, System::DateTime>>^ GetUncoveredSpans(
+            System::DateTime startTime, System::DateTime endTime);
+
+        /// <summary>
+        /// Gets whether any of the time between a start and end time has been recorded.
+        /// </summary>
+        /// <param name="startTime">The start of the time range.</param>
+        /// <param name="endTime">The end of the time range.</param>
+        /// <returns><c>true</c> if any of the range is recorded, otherwise <c>false</c>.</returns>
+        bool Intersects(System::DateTime startTime, System::DateTime endTime);
+
+        /// <summary>
+        /// Removes a span of time from the index, splitting any span that it falls within.
+        /// </summary>
+        /// <param name="startTime">The start time of the span.</param>
+        /// <param name="endTime">The end time of the span.</param>
+        void Remove(System::DateTime startTime, System::DateTime endTime);
+
+        /// <summary>
+        /// Removes the spans of the given gaps from the index.  Gaps are reported per data storage, so this should
+        /// only be used when the gaps are known not to be covered by a clip on another data storage.
+        /// </summary>
+        /// <param name="gaps">The gaps to remove.</param>
+        void RemoveGaps(System::Collections::Generic::IEnumerable<Gap^>^ gaps);
+
+        /// <summary>
+        /// Gets the number of merged spans in the index.
+        /// </summary>
+        /// <value>The number of spans.</value>
+        property int Count {
+        public:
+            int get() { return _starts->Count; }
+        }
+
+        /// <summary>
+        /// Gets the unique identifier of the data source the index is for.
+        /// </summary>
+        /// <value>The unique identifier of the data source.</value>
+        property System::String^ DataSourceId {
+        public:
+            System::String^ get() { return _dataSourceId; }
+        }
+
+        /// <summary>
+        /// Gets the merged spans in the index, in order.
+        /// </summary>
+        /// <value>A list of start and end time pairs.</value>
+        property System::Collections::Generic::List<System::Collections::Generic::KeyValuePair<System::DateTime, System::DateTime>>^ Spans {
+        public:
+            System::Collections::Generic::List<System::Collections::Generic::KeyValuePair<System::DateTime, System::DateTime>>^ get() { return _GetSpans(); }
+        }
+
+        /// <summary>
+        /// Gets the total amount of recorded time in the index.
+        /// </summary>
+        /// <value>The total recorded time.</value>
+        property System::TimeSpan TotalCoveredTime {
+        public:
+            System::TimeSpan get();
+        }
+
+    internal:
+        System::String^ _dataSourceId;
+        System::Collections::Generic::List<long long>^ _starts;
+        System::Collections::Generic::List<long long>^ _ends;
+        System::Collections::Generic::List<long long>^ _coveredBefore;
+        void _Add(long long start, long long end);
+        long long _CoveredUntil(long long time);
+        int _Find(long long time);
+        System::Collections::Generic::List<System::Collections::Generic::KeyValuePair<System::DateTime, System::DateTime>>^ _GetSpans();
+        void _Remove(long long start, long long end);
+        void _UpdateCoveredBefore(int index);
+    };
+}
+#endif // CoverageIndex_h__
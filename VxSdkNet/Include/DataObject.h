@@ -27,7 +27,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~DataObject() {
-            this->!DataObject();
+            NativeMemory::Remove(_dataObject);
+            _dataObject->Delete();
+            _dataObject = nullptr;
         }
 
         /// <summary>
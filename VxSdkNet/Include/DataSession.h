@@ -4,6 +4,7 @@
 
 #include "VxSdk.h"
 #include "ResourceLimits.h"
+#include "NativeReleaseQueue.h"
 
 namespace VxSdkNet {
 
@@ -20,20 +21,23 @@ namespace VxSdkNet {
         /// <param name="vxDataSession">The vx data session.</param>
         DataSession(VxSdk::IVxDataSession* vxDataSession) {
             _dataSession = vxDataSession;
+            NativeMemory::Add(_dataSession);
         }
 
         /// <summary>
         /// Destructor.
         /// </summary>
         virtual ~DataSession() {
-            this->!DataSession();
+            NativeMemory::Remove(_dataSession);
+            _dataSession->Delete();
+            _dataSession = nullptr;
         }
 
         /// <summary>
         /// Finaliser.
         /// </summary>
         !DataSession() {
-            _dataSession->Delete();
+            NativeReleaseQueue::Release(_dataSession);
             _dataSession = nullptr;
         }
 
@@ -116,9 +116,7 @@ namespace VxSdkNet {
         /// <summary>
         /// Destructor.
         /// </summary>
-        virtual ~DataSource() {
-            this->!DataSource();
-        }
+        virtual ~DataSource();
 
         /// <summary>
         /// Finaliser.
@@ -376,6 +374,7 @@ namespace VxSdkNet {
         property System::Collections::Generic::List<DataSourceCapability>^ Capabilities {
         public:
             System::Collections::Generic::List<DataSourceCapability>^ get() {
+                NativeReadLock nativeLock(_nativeLock);
                 System::Collections::Generic::List<DataSourceCapability>^ mlist = gcnew System::Collections::Generic::List<DataSourceCapability>();
                 for (int i = 0; i < _dataSource->capabilitiesSize; i++)
                     mlist->Add((DataSourceCapability)_dataSource->capabilities[i]);
@@ -425,7 +424,10 @@ namespace VxSdkNet {
         /// </summary>
         property System::String^ Encoding {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_dataSource->encoding); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_dataSource->encoding);
+            }
         }
 
         /// <summary>
@@ -443,7 +445,10 @@ namespace VxSdkNet {
         /// <value><c>true</c> if live is available, <c>false</c> if not.</value>
         property bool HasLiveStream {
         public:
-            bool get() { return _dataSource->hasLive; }
+            bool get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return _dataSource->hasLive;
+            }
         }
 
         /// <summary>
@@ -452,7 +457,10 @@ namespace VxSdkNet {
         /// <value><c>true</c> if recorded video is available, <c>false</c> if not.</value>
         property bool HasRecordedVideo {
         public:
-            bool get() { return _dataSource->hasRecorded; }
+            bool get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return _dataSource->hasRecorded;
+            }
         }
 
         /// <summary>
@@ -470,7 +478,10 @@ namespace VxSdkNet {
         /// <value>The unique identifier.</value>
         property System::String^ Id {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_dataSource->id); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_dataSource->id);
+            }
         }
 
         /// <summary>
@@ -480,7 +491,10 @@ namespace VxSdkNet {
         /// <value>The data source index.</value>
         property int Index {
         public:
-            int get() { return _dataSource->index; }
+            int get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return _dataSource->index;
+            }
         }
 
         /// <summary>
@@ -489,7 +503,10 @@ namespace VxSdkNet {
         /// <value>The IP.</value>
         property System::String^ Ip {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_dataSource->ip); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_dataSource->ip);
+            }
         }
 
         /// <summary>
@@ -498,7 +515,10 @@ namespace VxSdkNet {
         /// <value><c>true</c> if capturing, <c>false</c> if not.</value>
         property bool IsCapturing {
         public:
-            bool get() { return _dataSource->isCapturing; }
+            bool get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return _dataSource->isCapturing;
+            }
         }
 
         /// <summary>
@@ -508,7 +528,10 @@ namespace VxSdkNet {
         /// <value><c>true</c> if manually recording, <c>false</c> if not.</value>
         property bool IsManuallyRecording {
         public:
-            bool get() { return _dataSource->isManuallyRecording; }
+            bool get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return _dataSource->isManuallyRecording;
+            }
         }
 
         /// <summary>
@@ -517,7 +540,10 @@ namespace VxSdkNet {
         /// <value><c>true</c> if recording, <c>false</c> if not.</value>
         property bool IsRecording {
         public:
-            bool get() { return _dataSource->isRecording; }
+            bool get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return _dataSource->isRecording;
+            }
         }
 
         /// <summary>
@@ -535,8 +561,12 @@ namespace VxSdkNet {
         /// <value><c>true</c> if recording, <c>false</c> if not.</value>
         property bool IsEnabled {
         public:
-            bool get() { return _dataSource->isEnabled; }
+            bool get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return _dataSource->isEnabled;
+            }
             void set(bool value) {
+                NativeReadLock nativeLock(_nativeLock);
                 if (value)
                     _dataSource->Enable();
                 else
@@ -634,8 +664,12 @@ namespace VxSdkNet {
         /// <value>The friendly name.</value>
         property System::String^ Name {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_dataSource->name); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_dataSource->name);
+            }
             void set(System::String^ value) {
+                NativeReadLock nativeLock(_nativeLock);
                 char name[64];
                 VxSdk::Utilities::StrCopySafe(name, Utils::ConvertCSharpString(value).c_str());
                 _dataSource->SetName(name);
@@ -648,8 +682,14 @@ namespace VxSdkNet {
         /// <value>The data source number.</value>
         property int Number {
         public:
-            int get() { return _dataSource->number; }
-            void set(int value) { _dataSource->SetNumber(value); }
+            int get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return _dataSource->number;
+            }
+            void set(int value) {
+                NativeReadLock nativeLock(_nativeLock);
+                _dataSource->SetNumber(value);
+            }
         }
 
         /// <summary>
@@ -661,8 +701,14 @@ namespace VxSdkNet {
         /// <value>The threshold, in hours.</value>
         property int PruningThreshold {
         public:
-            int get() { return _dataSource->pruningThreshold; }
-            void set(int value) { _dataSource->SetPruningThreshold(value); }
+            int get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return _dataSource->pruningThreshold;
+            }
+            void set(int value) {
+                NativeReadLock nativeLock(_nativeLock);
+                _dataSource->SetPruningThreshold(value);
+            }
         }
 
         /// <summary>
@@ -691,8 +737,14 @@ namespace VxSdkNet {
         /// <value>The retention limit (in hours).</value>
         property int RetentionLimit {
         public:
-            int get() { return _dataSource->retentionLimit; }
-            void set(int value) { _dataSource->SetRetentionLimit(value); }
+            int get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return _dataSource->retentionLimit;
+            }
+            void set(int value) {
+                NativeReadLock nativeLock(_nativeLock);
+                _dataSource->SetRetentionLimit(value);
+            }
         }
 
         /// <summary>
@@ -719,7 +771,10 @@ namespace VxSdkNet {
         /// <value>The JPEG URI.</value>
         property System::String^ SnapshotUri {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_dataSource->snapshotUri); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_dataSource->snapshotUri);
+            }
         }
 
         /// <summary>
@@ -728,7 +783,10 @@ namespace VxSdkNet {
         /// <value>The source URI.</value>
         property System::String^ SourceEndpoint {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_dataSource->sourceEndpoint); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_dataSource->sourceEndpoint);
+            }
         }
 
         /// <summary>
@@ -737,7 +795,10 @@ namespace VxSdkNet {
         /// <value>The current device state.</value>
         property States State {
         public:
-            States get() { return States(_dataSource->state); }
+            States get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return States(_dataSource->state);
+            }
         }
 
         /// <summary>
@@ -755,7 +816,10 @@ namespace VxSdkNet {
         /// <value>The media type.</value>
         property Types Type {
         public:
-            Types get() { return Types(_dataSource->type); }
+            Types get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Types(_dataSource->type);
+            }
         }
 
         /// <summary>
@@ -790,6 +854,9 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxDataSource* _dataSource;
+        IdentityMap^ _identityMap;
+        System::Threading::ReaderWriterLockSlim^ _nativeLock;
+        volatile bool _isDisposed;
         bool _CanPixelSearch();
         bool _CanPtz();
         System::Collections::Generic::List<AnalyticCapability>^ _GetAnalyticCapabilities();
@@ -807,6 +874,7 @@ namespace VxSdkNet {
         System::String^ _GetRtspEndpoint();
         DataSourceConfig::SmartCompression^ _GetSmartCompressionConfig();
         System::Collections::Generic::List<DataSourceConfig::VideoEncoding^>^ _GetVideoEncodingConfigs();
+        void _Replace(VxSdk::IVxDataSource* vxDataSource);
     };
 }
 #endif // DataSource_h__
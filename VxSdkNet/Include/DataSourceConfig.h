@@ -66,7 +66,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Motion() {
-                this->!Motion();
+                NativeMemory::Remove(_configMotion);
+                _configMotion->Delete();
+                _configMotion = nullptr;
             }
 
             /// <summary>
@@ -142,7 +144,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~Ptz() {
-                this->!Ptz();
+                NativeMemory::Remove(_configPtz);
+                _configPtz->Delete();
+                _configPtz = nullptr;
             }
 
             /// <summary>
@@ -186,7 +190,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~SmartCompression() {
-                this->!SmartCompression();
+                NativeMemory::Remove(_configSmartCompression);
+                _configSmartCompression->Delete();
+                _configSmartCompression = nullptr;
             }
 
             /// <summary>
@@ -341,7 +347,9 @@ namespace VxSdkNet {
             /// Destructor.
             /// </summary>
             virtual ~VideoEncoding() {
-                this->!VideoEncoding();
+                NativeMemory::Remove(_configVideoEncoding);
+                _configVideoEncoding->Delete();
+                _configVideoEncoding = nullptr;
             }
 
             /// <summary>
@@ -50,7 +50,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~DataStorage() {
-            this->!DataStorage();
+            NativeMemory::Remove(_dataStorage);
+            _dataStorage->Delete();
+            _dataStorage = nullptr;
         }
 
         /// <summary>
@@ -209,6 +211,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxDataStorage* _dataStorage;
+        IdentityMap^ _identityMap;
         VxSdkNet::Device^ _GetHostDevice();
         VxSdkNet::ResourceLimits^ _GetLimits();
         VxSdkNet::Configuration::Storage^ _GetStorageConfig();
@@ -66,7 +66,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~DbBackup() {
-            this->!DbBackup();
+            NativeMemory::Remove(_dbBackup);
+            _dbBackup->Delete();
+            _dbBackup = nullptr;
         }
 
         /// <summary>
@@ -25,7 +25,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~DbBackups() {
-            this->!DbBackups();
+            NativeMemory::Remove(_dbBackups);
+            _dbBackups->Delete();
+            _dbBackups = nullptr;
         }
 
         /// <summary>
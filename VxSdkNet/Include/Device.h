@@ -145,9 +145,7 @@ namespace VxSdkNet {
         /// <summary>
         /// Destructor.
         /// </summary>
-        virtual ~Device() {
-            this->!Device();
-        }
+        virtual ~Device();
 
         /// <summary>
         /// Finaliser.
@@ -387,7 +385,10 @@ namespace VxSdkNet {
         /// <value>The time when this device was discovered.</value>
         property System::DateTime Discovered {
         public:
-            System::DateTime get() { return Utils::ConvertCppDateTime(_device->discovered); }
+            System::DateTime get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppDateTime(_device->discovered);
+            }
         }
 
         /// <summary>
@@ -396,7 +397,10 @@ namespace VxSdkNet {
         /// <value>The driver device identifier.</value>
         property System::String^ DriverDeviceId {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->driverDeviceId); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->driverDeviceId);
+            }
         }
 
         /// <summary>
@@ -405,8 +409,12 @@ namespace VxSdkNet {
         /// <value>The driver type identifier.</value>
         property System::String^ DriverTypeId {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->driverTypeId); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->driverTypeId);
+            }
             void set(System::String^ value) {
+                NativeReadLock nativeLock(_nativeLock);
                 char driverTypeId[64];
                 VxSdk::Utilities::StrCopySafe(driverTypeId, Utils::ConvertCSharpString(value).c_str());
                 _device->SetDriverTypeId(driverTypeId);
@@ -439,8 +447,12 @@ namespace VxSdkNet {
         /// <value>The hostname.</value>
         property System::String^ Hostname {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->hostname); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->hostname);
+            }
             void set(System::String^ value) {
+                NativeReadLock nativeLock(_nativeLock);
                 char hostname[256];
                 VxSdk::Utilities::StrCopySafe(hostname, Utils::ConvertCSharpString(value).c_str());
                 _device->SetHostname(hostname);
@@ -453,7 +465,10 @@ namespace VxSdkNet {
         /// <value>The unique identifier.</value>
         property System::String^ Id {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->id); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->id);
+            }
         }
 
         /// <summary>
@@ -462,7 +477,10 @@ namespace VxSdkNet {
         /// <value>The initialization error status reason.</value>
         property InitializationStatusReasons InitializationStatusReason {
         public:
-            InitializationStatusReasons get() { return InitializationStatusReasons(_device->initializationStatusReason); }
+            InitializationStatusReasons get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return InitializationStatusReasons(_device->initializationStatusReason);
+            }
         }
 
         /// <summary>
@@ -471,8 +489,12 @@ namespace VxSdkNet {
         /// <value>The IP.</value>
         property System::String^ Ip {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->ip); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->ip);
+            }
             void set(System::String^ value) {
+                NativeReadLock nativeLock(_nativeLock);
                 char ip[64];
                 VxSdk::Utilities::StrCopySafe(ip, Utils::ConvertCSharpString(value).c_str());
                 _device->SetIp(ip);
@@ -485,7 +507,10 @@ namespace VxSdkNet {
         /// <value><c>true</c> if commissioned, <c>false</c> if not.</value>
         property bool IsCommissioned {
         public:
-            bool get() { return _device->isCommissioned; }
+            bool get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return _device->isCommissioned;
+            }
         }
 
         /// <summary>
@@ -494,7 +519,10 @@ namespace VxSdkNet {
         /// <value><c>true</c> if license required, <c>false</c> if not.</value>
         property bool IsLicenseRequired {
         public:
-            bool get() { return _device->isLicenseRequired; }
+            bool get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return _device->isLicenseRequired;
+            }
         }
 
         /// <summary>
@@ -539,7 +567,10 @@ namespace VxSdkNet {
         /// <value>The MAC address.</value>
         property System::String^ MacAddress {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->macAddress); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->macAddress);
+            }
         }
 
         /// <summary>
@@ -548,7 +579,10 @@ namespace VxSdkNet {
         /// <value>The model name.</value>
         property System::String^ Model {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->model); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->model);
+            }
         }
 
         /// <summary>
@@ -566,8 +600,12 @@ namespace VxSdkNet {
         /// <value>The friendly name.</value>
         property System::String^ Name {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->name); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->name);
+            }
             void set(System::String^ value) {
+                NativeReadLock nativeLock(_nativeLock);
                 char name[64];
                 VxSdk::Utilities::StrCopySafe(name, Utils::ConvertCSharpString(value).c_str());
                 _device->SetName(name);
@@ -581,6 +619,7 @@ namespace VxSdkNet {
         property System::String^ Password {
         public:
             void set(System::String^ value) {
+                NativeReadLock nativeLock(_nativeLock);
                 char password[64];
                 VxSdk::Utilities::StrCopySafe(password, Utils::ConvertCSharpString(value).c_str());
                 _device->SetPassword(password);
@@ -593,8 +632,14 @@ namespace VxSdkNet {
         /// <value>The Port.</value>
         property int Port {
         public:
-            int get() { return _device->port; }
-            void set(int value) { _device->SetDevicePort(value); }
+            int get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return _device->port;
+            }
+            void set(int value) {
+                NativeReadLock nativeLock(_nativeLock);
+                _device->SetDevicePort(value);
+            }
         }
 
         /// <summary>
@@ -612,7 +657,10 @@ namespace VxSdkNet {
         /// <value>The serial number.</value>
         property System::String^ Serial {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->serial); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->serial);
+            }
         }
 
         /// <summary>
@@ -621,7 +669,10 @@ namespace VxSdkNet {
         /// <value>The current state of the device.</value>
         property DataSource::States State {
         public:
-            DataSource::States get() { return DataSource::States(_device->state); }
+            DataSource::States get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return DataSource::States(_device->state);
+            }
         }
 
         /// <summary>
@@ -631,6 +682,7 @@ namespace VxSdkNet {
         property System::Collections::Generic::List<DeviceStatus>^ Status {
         public:
             System::Collections::Generic::List<DeviceStatus>^ get() {
+                NativeReadLock nativeLock(_nativeLock);
                 System::Collections::Generic::List<DeviceStatus>^ mlist = gcnew System::Collections::Generic::List<DeviceStatus>();
                 for (int i = 0; i < _device->statusSize; i++)
                     mlist->Add((DeviceStatus)_device->status[i]);
@@ -663,7 +715,10 @@ namespace VxSdkNet {
         /// <value>The device <see cref="Types">Type</see>.</value>
         property Types Type {
         public:
-            Types get() { return Types(_device->type); }
+            Types get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Types(_device->type);
+            }
         }
 
         /// <summary>
@@ -672,8 +727,12 @@ namespace VxSdkNet {
         /// <value>The username.</value>
         property System::String^ Username {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->username); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->username);
+            }
             void set(System::String^ value) {
+                NativeReadLock nativeLock(_nativeLock);
                 char username[64];
                 VxSdk::Utilities::StrCopySafe(username, Utils::ConvertCSharpString(value).c_str());
                 _device->SetUsername(username);
@@ -686,7 +745,10 @@ namespace VxSdkNet {
         /// <value>The name of the devices vendor.</value>
         property System::String^ Vendor {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->vendor); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->vendor);
+            }
         }
 
         /// <summary>
@@ -695,8 +757,12 @@ namespace VxSdkNet {
         /// <value>The software version.</value>
         property System::String^ Version {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->version); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->version);
+            }
             void set(System::String^ value) {
+                NativeReadLock nativeLock(_nativeLock);
                 char version[64];
                 VxSdk::Utilities::StrCopySafe(version, Utils::ConvertCSharpString(value).c_str());
                 _device->SetVersion(version);
@@ -709,7 +775,10 @@ namespace VxSdkNet {
         /// <value>The virtual IP.</value>
         property System::String^ VirtualIp {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->virtualIp); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->virtualIp);
+            }
         }
 
         /// <summary>
@@ -718,11 +787,17 @@ namespace VxSdkNet {
         /// <value>The product webapp URL.</value>
         property System::String^ WebappUrl {
         public:
-            System::String^ get() { return Utils::ConvertCppString(_device->webappUrl); }
+            System::String^ get() {
+                NativeReadLock nativeLock(_nativeLock);
+                return Utils::ConvertCppString(_device->webappUrl);
+            }
         }
 
     internal:
         VxSdk::IVxDevice* _device;
+        IdentityMap^ _identityMap;
+        System::Threading::ReaderWriterLockSlim^ _nativeLock;
+        volatile bool _isDisposed;
         bool _CanCreateLogs();
         Configuration::Auth^ _GetAuthConfig();
         VxSdkNet::DataStorage^ _GetDataStorage();
@@ -735,6 +810,7 @@ namespace VxSdkNet {
         Configuration::ThermalEtd^ _GetThermalEtdConfig();
         Configuration::Time^ _GetTimeConfig();
         bool _HasDiagnostics();
+        void _Replace(VxSdk::IVxDevice* vxDevice);
         void _SetEndpoints(System::Collections::Generic::List<System::String^>^ endpoints);
     };
 }
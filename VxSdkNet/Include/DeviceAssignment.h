@@ -25,7 +25,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~DeviceAssignment() {
-            this->!DeviceAssignment();
+            NativeMemory::Remove(_deviceAssignment);
+            _deviceAssignment->Delete();
+            _deviceAssignment = nullptr;
         }
 
         /// <summary>
@@ -109,6 +111,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxDeviceAssignment* _deviceAssignment;
+        IdentityMap^ _identityMap;
         VxSdkNet::DataStorage^ _GetDataStorage();
         VxSdkNet::Device^ _GetDevice();
         VxSdkNet::ResourceLimits^ _GetLimits();
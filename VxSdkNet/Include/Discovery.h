@@ -24,7 +24,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Discovery() {
-            this->!Discovery();
+            NativeMemory::Remove(_discovery);
+            _discovery->Delete();
+            _discovery = nullptr;
         }
 
         /// <summary>
@@ -40,7 +40,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Drawing() {
-            this->!Drawing();
+            NativeMemory::Remove(_drawing);
+            _drawing->Delete();
+            _drawing = nullptr;
         }
 
         /// <summary>
@@ -24,7 +24,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Driver() {
-            this->!Driver();
+            NativeMemory::Remove(_driver);
+            _driver->Delete();
+            _driver = nullptr;
         }
 
         /// <summary>
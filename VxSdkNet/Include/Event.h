@@ -48,7 +48,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Event() {
-            this->!Event();
+            NativeMemory::Remove(_event);
+            _event->Delete();
+            _event = nullptr;
         }
 
         /// <summary>
@@ -298,6 +300,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxEvent* _event;
+        IdentityMap^ _identityMap;
         VxSdkNet::Device^ _GetGeneratorDevice();
         System::Collections::Generic::List<System::Collections::Generic::KeyValuePair<System::String^, System::String^>>^ _GetProperties();
         VxSdkNet::Situation^ _GetSituation();
@@ -77,7 +77,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Export() {
-            this->!Export();
+            NativeMemory::Remove(_export);
+            _export->Delete();
+            _export = nullptr;
         }
 
         /// <summary>
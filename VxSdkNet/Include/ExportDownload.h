@@ -0,0 +1,190 @@
+// Declares the export download class.
+#ifndef ExportDownload_h__
+#define ExportDownload_h__
+
+#include "Export.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The state shared by the workers of an <see cref="ExportDownload::Download"/> call.
+    /// </summary>
+    private ref class ExportDownloadJob {
+    public:
+        System::Collections::Concurrent::ConcurrentQueue<int>^ Chunks;
+        System::Threading::CountdownEvent^ Workers;
+        System::IO::StreamWriter^ Checkpoint;
+        volatile bool IsFailed;
+    };
+
+    /// <summary>
+    /// The ExportDownload class downloads the data of a completed export to a file.  The file is fetched as a number
+    /// of ranged chunks in parallel and written into a preallocated file.  Each completed chunk is recorded, along with
+    /// its SHA-256 checksum, in a checkpoint file beside the download so that an interrupted download resumes with
+    /// the chunks that are missing or fail verification.  Chunks that are interrupted are retried.
+    /// </summary>
+    public ref class ExportDownload {
+    public:
+
+        /// <summary>
+        /// The download progress delegate.
+        /// </summary>
+        /// <param name="download">The download that has progressed.</param>
+        delegate void ProgressDelegate(ExportDownload^ download);
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="exportItem">The completed export to download.</param>
+        /// <param name="filePath">The path of the file to download the export to.</param>
+        ExportDownload(Export^ exportItem, System::String^ filePath);
+
+        /// <summary>
+        /// Cancels the download.  The checkpoint is kept so that the download can be resumed later.
+        /// </summary>
+        void Cancel();
+
+        /// <summary>
+        /// Downloads the export, resuming from the checkpoint of a previous attempt if there is one.  This method
+        /// blocks until the download completes, fails or is canceled.
+        /// </summary>
+        /// <returns>
+        /// <c>OK</c> if the download completed, <c>NotReady</c> if the export has no data to download,
+        /// <c>CommunicationError</c> if a chunk could not be fetched or the file could not be written, otherwise
+        /// <c>OperationFailed</c> if the download was canceled or failed checksum verification.
+        /// </returns>
+        Results::Value Download();
+
+        /// <summary>
+        /// Gets the number of bytes that have been downloaded, including those recovered from a checkpoint.
+        /// </summary>
+        /// <value>The number of bytes downloaded.</value>
+        property long long BytesDownloaded {
+        public:
+            long long get() { return _bytesDownloaded; }
+        }
+
+        /// <summary>
+        /// Gets or sets the size of each chunk in bytes.  Defaults to 8 MB.  Changing the chunk size discards the
+        /// checkpoint of a previous attempt.
+        /// </summary>
+        /// <value>The chunk size in bytes.</value>
+        property int ChunkSize;
+
+        /// <summary>
+        /// Gets or sets the expected SHA-256 checksum of the complete file as a hex string, if known.  When set,
+        /// the file is verified once every chunk has been downloaded.
+        /// </summary>
+        /// <value>The expected checksum.</value>
+        property System::String^ ExpectedChecksum;
+
+        /// <summary>
+        /// Gets the path of the file the export is downloaded to.
+        /// </summary>
+        /// <value>The file path.</value>
+        property System::String^ FilePath {
+        public:
+            System::String^ get() { return _filePath; }
+        }
+
+        /// <summary>
+        /// Gets the number of exceptions thrown by <see cref="ProgressEvent"/> handlers.  They are caught so that the
+        /// download continues.
+        /// </summary>
+        /// <value>The number of handler exceptions.</value>
+        property int HandlerErrors {
+        public:
+            int get() { return _handlerErrors; }
+        }
+
+        /// <summary>
+        /// Gets the headers added to each request, such as those needed to authenticate with the server.
+        /// </summary>
+        /// <value>The request headers.</value>
+        property System::Net::WebHeaderCollection^ Headers {
+        public:
+            System::Net::WebHeaderCollection^ get() { return _headers; }
+        }
+
+        /// <summary>
+        /// Gets whether the download has been canceled.
+        /// </summary>
+        /// <value><c>true</c> if the download was canceled, otherwise <c>false</c>.</value>
+        property bool IsCanceled {
+        public:
+            bool get() { return _isCanceled; }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of chunks that are fetched at once.  Defaults to 4.
+        /// </summary>
+        /// <value>The maximum number of concurrent chunks.</value>
+        property int MaxConcurrentChunks;
+
+        /// <summary>
+        /// Gets or sets the number of times a chunk is retried after being interrupted.  Defaults to 5.
+        /// </summary>
+        /// <value>The maximum number of retries per chunk.</value>
+        property int MaxRetries;
+
+        /// <summary>
+        /// Gets the average download rate, in bytes per second, of the current or most recent download.
+        /// </summary>
+        /// <value>The throughput in bytes per second.</value>
+        property double Throughput {
+        public:
+            double get();
+        }
+
+        /// <summary>
+        /// Gets or sets the amount of time, in milliseconds, to wait for a response or for data.  Defaults to 30000.
+        /// </summary>
+        /// <value>The timeout in milliseconds.</value>
+        property int Timeout;
+
+        /// <summary>
+        /// Gets the total size of the export data in bytes, once known.
+        /// </summary>
+        /// <value>The total number of bytes.</value>
+        property long long TotalBytes {
+        public:
+            long long get() { return _totalBytes; }
+        }
+
+        /// <summary>
+        /// ProgressEvent is raised whenever a chunk has been downloaded, on the worker that downloaded it.
+        /// </summary>
+        event ProgressDelegate ^ ProgressEvent {
+            void add(ProgressDelegate ^eventDelegate) { _progressEvent += eventDelegate; }
+            void remove(ProgressDelegate ^eventDelegate) { _progressEvent -= eventDelegate; }
+        }
+
+    internal:
+        Export^ _export;
+        System::String^ _filePath;
+        System::String^ _partPath;
+        System::String^ _checkpointPath;
+        System::String^ _uri;
+        System::Net::WebHeaderCollection^ _headers;
+        volatile bool _isCanceled;
+        bool _acceptsRanges;
+        long long _bytesDownloaded;
+        long long _downloadedThisRun;
+        long long _totalBytes;
+        long long _chunkSize;
+        int _chunkCount;
+        int _handlerErrors;
+        System::Diagnostics::Stopwatch^ _elapsed;
+        System::Collections::Generic::Dictionary<int, System::String^>^ _completedChunks;
+        ProgressDelegate ^ _progressEvent;
+        System::Net::HttpWebRequest^ _CreateRequest();
+        bool _FetchChunk(int chunk, array<unsigned char>^ buffer, System::String^% checksum);
+        long long _GetChunkLength(int chunk);
+        System::String^ _HashFile(long long offset, long long length, array<unsigned char>^ buffer);
+        bool _Probe();
+        void _ReadCheckpoint();
+        void _RunChunks(System::Object^ state);
+        static System::String^ _ToHex(array<unsigned char>^ hash);
+    };
+}
+#endif // ExportDownload_h__
@@ -0,0 +1,147 @@
+// Declares the export job class.
+#ifndef ExportJob_h__
+#define ExportJob_h__
+
+#include "Export.h"
+#include "NewExport.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The ExportJob class represents a new export that has been queued on an <see cref="ExportQueue"/>.
+    /// </summary>
+    public ref class ExportJob {
+    public:
+
+        /// <summary>
+        /// Values that represent the state of an export job.
+        /// </summary>
+        enum class States {
+            /// <summary>The job is waiting to be submitted.</summary>
+            Queued,
+
+            /// <summary>The export has been submitted and is in progress.</summary>
+            Exporting,
+
+            /// <summary>The export failed and is waiting to be submitted again.</summary>
+            Retrying,
+
+            /// <summary>The export completed successfully.</summary>
+            Successful,
+
+            /// <summary>The export failed.</summary>
+            Failed,
+
+            /// <summary>The export was not submitted because its estimate exceeded the allowed size.</summary>
+            Rejected,
+
+            /// <summary>The job was removed from the queue before it was submitted.</summary>
+            Canceled
+        };
+
+        /// <summary>
+        /// Gets the number of times the export has been submitted.
+        /// </summary>
+        /// <value>The number of submissions.</value>
+        property int Attempts {
+        public:
+            int get() { return _attempts; }
+        }
+
+        /// <summary>
+        /// Gets the time the job finished, if it has.
+        /// </summary>
+        /// <value>The completion time.</value>
+        property System::DateTime Completed {
+        public:
+            System::DateTime get() { return _completed; }
+        }
+
+        /// <summary>
+        /// Gets the estimated file size of the export in kilobytes (KB); 0 if no estimate was available.
+        /// </summary>
+        /// <value>The estimated file size in kilobytes (KB).</value>
+        property int EstimatedSizeKb {
+        public:
+            int get() { return _estimatedSizeKb; }
+        }
+
+        /// <summary>
+        /// Gets the export on the system for the most recent submission, if any.
+        /// </summary>
+        /// <value>The export.</value>
+        property VxSdkNet::Export^ Export {
+        public:
+            VxSdkNet::Export^ get() { return _export; }
+        }
+
+        /// <summary>
+        /// Gets whether the job has finished, either successfully or not.
+        /// </summary>
+        /// <value><c>true</c> if the job has finished, otherwise <c>false</c>.</value>
+        property bool IsFinished {
+        public:
+            bool get() { return _status >= States::Successful; }
+        }
+
+        /// <summary>
+        /// Gets the new export that the job submits.
+        /// </summary>
+        /// <value>The new export.</value>
+        property VxSdkNet::NewExport^ NewExport {
+        public:
+            VxSdkNet::NewExport^ get() { return _newExport; }
+        }
+
+        /// <summary>
+        /// Gets a value from 0 to 100 specifying how close the export is to completion.
+        /// </summary>
+        /// <value>The percent complete.</value>
+        property float PercentComplete {
+        public:
+            float get() { return _percentComplete; }
+        }
+
+        /// <summary>
+        /// Gets the current state of the job.
+        /// </summary>
+        /// <value>The current job state.</value>
+        property States Status {
+        public:
+            States get() { return _status; }
+        }
+
+        /// <summary>
+        /// Gets the reason for the most recent export failure, if any.
+        /// </summary>
+        /// <value>The export status reason.</value>
+        property VxSdkNet::Export::StateReasons StatusReason {
+        public:
+            VxSdkNet::Export::StateReasons get() { return _statusReason; }
+        }
+
+        /// <summary>
+        /// Gets the time the export was first submitted, if it has been.
+        /// </summary>
+        /// <value>The submission time.</value>
+        property System::DateTime Submitted {
+        public:
+            System::DateTime get() { return _submitted; }
+        }
+
+    internal:
+        ExportJob(VxSdkNet::NewExport^ newExport) : _newExport(newExport), _status(States::Queued) {}
+        int _attempts;
+        System::DateTime _completed;
+        int _estimatedSizeKb;
+        VxSdkNet::Export^ _export;
+        VxSdkNet::NewExport^ _newExport;
+        System::DateTime _nextPoll;
+        float _percentComplete;
+        int _pollInterval;
+        States _status;
+        VxSdkNet::Export::StateReasons _statusReason;
+        System::DateTime _submitted;
+    };
+}
+#endif // ExportJob_h__
@@ -0,0 +1,224 @@
+// Declares the export queue class.
+#ifndef ExportQueue_h__
+#define ExportQueue_h__
+
+#include "ExportJob.h"
+#include "VXSystem.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The ExportQueue class submits new exports to a VideoXpert system with a limit on the number that run at once.
+    /// Each export is checked against its estimate before it is submitted, and its progress is polled at an interval
+    /// that adapts to the estimated time remaining.  Exports that fail because the export storage is full or
+    /// unavailable are submitted again after a delay.  All work is done on a single background thread.
+    /// </summary>
+    public ref class ExportQueue {
+    public:
+
+        /// <summary>
+        /// The export job event delegate.
+        /// </summary>
+        /// <param name="job">The export job that has changed.</param>
+        delegate void ExportJobDelegate(ExportJob^ job);
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="system">The system to submit the exports to.</param>
+        ExportQueue(VXSystem^ system);
+
+        /// <summary>
+        /// Destructor.  Stops the background thread, waiting for it to finish its current step, and cancels the jobs
+        /// that have not yet been submitted.  Exports already submitted continue on the system.
+        /// </summary>
+        virtual ~ExportQueue();
+
+        /// <summary>
+        /// Cancels all jobs that have not yet been submitted.  Exports already in progress are left to complete.
+        /// </summary>
+        /// <returns>The number of jobs canceled.</returns>
+        int CancelPending();
+
+        /// <summary>
+        /// Adds a new export to the queue.
+        /// </summary>
+        /// <param name="newExport">The new export to submit.</param>
+        /// <returns>The job tracking the export.</returns>
+        /// <exception cref="System::ObjectDisposedException">The queue has been disposed.</exception>
+        ExportJob^ Enqueue(NewExport^ newExport);
+
+        /// <summary>
+        /// Waits until every job in the queue has finished.
+        /// </summary>
+        /// <param name="timeout">The maximum amount of time to wait.</param>
+        /// <returns><c>true</c> if every job finished, <c>false</c> if the timeout elapsed first.</returns>
+        bool WaitAll(System::TimeSpan timeout);
+
+        /// <summary>
+        /// Gets the number of exports currently in progress.
+        /// </summary>
+        /// <value>The number of active exports.</value>
+        property int ActiveCount {
+        public:
+            int get() { return _activeCount; }
+        }
+
+        /// <summary>
+        /// Gets the number of jobs that have completed successfully.
+        /// </summary>
+        /// <value>The number of successful jobs.</value>
+        property int CompletedCount {
+        public:
+            int get() { return _completedCount; }
+        }
+
+        /// <summary>
+        /// Gets the total size of the successfully completed exports in kilobytes (KB).
+        /// </summary>
+        /// <value>The exported size in kilobytes (KB).</value>
+        property long long ExportedKb {
+        public:
+            long long get() { return _exportedKb; }
+        }
+
+        /// <summary>
+        /// Gets the number of exceptions thrown by <see cref="JobProgress"/> and <see cref="JobCompleted"/> handlers.
+        /// They are caught so that the background thread keeps running.
+        /// </summary>
+        /// <value>The number of handler exceptions.</value>
+        property int HandlerErrors {
+        public:
+            int get() { return _handlerErrors; }
+        }
+
+        /// <summary>
+        /// Gets the number of jobs that failed or were rejected.
+        /// </summary>
+        /// <value>The number of failed jobs.</value>
+        property int FailedCount {
+        public:
+            int get() { return _failedCount; }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of exports that may be in progress at once.  Defaults to 2.
+        /// </summary>
+        /// <value>The maximum number of concurrent exports.</value>
+        property int MaxConcurrentExports;
+
+        /// <summary>
+        /// Gets or sets the largest estimated size, in kilobytes (KB), of an export that will be submitted; 0 for
+        /// no limit.  Defaults to 0.
+        /// </summary>
+        /// <value>The maximum estimated export size in kilobytes (KB).</value>
+        property int MaxEstimatedSizeKb;
+
+        /// <summary>
+        /// Gets or sets the amount of time, in milliseconds, between checks on the progress of an export when the
+        /// progress is not changing.  Defaults to 30000.
+        /// </summary>
+        /// <value>The maximum poll interval in milliseconds.</value>
+        property int MaxPollInterval;
+
+        /// <summary>
+        /// Gets or sets the number of times an export is submitted again after failing because the export storage is
+        /// full or unavailable.  Defaults to 3.
+        /// </summary>
+        /// <value>The maximum number of retries.</value>
+        property int MaxRetries;
+
+        /// <summary>
+        /// Gets or sets the minimum amount of time, in milliseconds, between checks on the progress of an export.
+        /// Defaults to 1000.
+        /// </summary>
+        /// <value>The minimum poll interval in milliseconds.</value>
+        property int MinPollInterval;
+
+        /// <summary>
+        /// Gets the number of jobs waiting to be submitted, including those waiting to be retried.
+        /// </summary>
+        /// <value>The number of pending jobs.</value>
+        property int PendingCount {
+        public:
+            int get();
+        }
+
+        /// <summary>
+        /// Gets the number of times the progress of an export has been refreshed from the system.
+        /// </summary>
+        /// <value>The number of refreshes.</value>
+        property int RefreshCount {
+        public:
+            int get() { return _refreshCount; }
+        }
+
+        /// <summary>
+        /// Gets or sets the amount of time, in milliseconds, to wait before the first retry of a failed export; the
+        /// delay doubles for each further retry.  Defaults to 30000.
+        /// </summary>
+        /// <value>The retry delay in milliseconds.</value>
+        property int RetryDelay;
+
+        /// <summary>
+        /// Gets the number of times an export has been submitted again after failing.
+        /// </summary>
+        /// <value>The number of retries.</value>
+        property int RetryCount {
+        public:
+            int get() { return _retryCount; }
+        }
+
+        /// <summary>
+        /// Gets the average rate, in kilobytes (KB) per second, at which exports have completed since the first was
+        /// submitted.
+        /// </summary>
+        /// <value>The export throughput in kilobytes (KB) per second.</value>
+        property double Throughput {
+        public:
+            double get();
+        }
+
+        /// <summary>
+        /// JobCompleted is raised whenever a job finishes, successfully or not.
+        /// </summary>
+        event ExportJobDelegate ^ JobCompleted {
+            void add(ExportJobDelegate ^eventDelegate) { _jobCompleted += eventDelegate; }
+            void remove(ExportJobDelegate ^eventDelegate) { _jobCompleted -= eventDelegate; }
+        }
+
+        /// <summary>
+        /// JobProgress is raised whenever the progress or state of a job changes.
+        /// </summary>
+        event ExportJobDelegate ^ JobProgress {
+            void add(ExportJobDelegate ^eventDelegate) { _jobProgress += eventDelegate; }
+            void remove(ExportJobDelegate ^eventDelegate) { _jobProgress -= eventDelegate; }
+        }
+
+    internal:
+        VXSystem^ _system;
+        System::Collections::Generic::List<ExportJob^>^ _pending;
+        System::Collections::Generic::List<ExportJob^>^ _active;
+        System::Threading::Thread^ _dispatcher;
+        System::Threading::AutoResetEvent^ _wake;
+        System::Threading::ManualResetEvent^ _idle;
+        bool _isDisposed;
+        int _activeCount;
+        int _completedCount;
+        long long _exportedKb;
+        int _failedCount;
+        int _handlerErrors;
+        int _refreshCount;
+        int _retryCount;
+        System::Diagnostics::Stopwatch^ _elapsed;
+        ExportJobDelegate ^ _jobCompleted;
+        ExportJobDelegate ^ _jobProgress;
+        void _Dispatch();
+        void _Finish(ExportJob^ job, ExportJob::States status);
+        void _Poll(ExportJob^ job);
+        void _Raise(ExportJobDelegate^ handler, ExportJob^ job);
+        bool _Retry(ExportJob^ job);
+        void _Submit(ExportJob^ job);
+    };
+}
+#endif // ExportQueue_h__
@@ -59,7 +59,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~ExportStream() {
-            this->!ExportStream();
+            NativeMemory::Remove(_exportStream);
+            _exportStream->Delete();
+            _exportStream = nullptr;
         }
 
         /// <summary>
@@ -0,0 +1,39 @@
+// Declares the federated item class.
+#ifndef FederatedItem_h__
+#define FederatedItem_h__
+
+#include "FederationSite.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The FederatedItem class represents a single result of a <see cref="Federation"/> query, tagged with the site it
+    /// came from.
+    /// </summary>
+    public ref class FederatedItem {
+    public:
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="site">The site the item came from.</param>
+        /// <param name="item">The item.</param>
+        FederatedItem(FederationSite^ site, System::Object^ item) {
+            Site = site;
+            Item = item;
+        }
+
+        /// <summary>
+        /// Gets the item, for example a <see cref="DataSource"/>, <see cref="Event"/> or <see cref="Situation"/>.
+        /// </summary>
+        /// <value>The item.</value>
+        property System::Object^ Item;
+
+        /// <summary>
+        /// Gets the site the item came from.
+        /// </summary>
+        /// <value>The site.</value>
+        property FederationSite^ Site;
+    };
+}
+#endif // FederatedItem_h__
@@ -0,0 +1,251 @@
+// Declares the federation class.
+#ifndef Federation_h__
+#define Federation_h__
+
+#include "FederatedItem.h"
+#include "FederationSite.h"
+
+namespace VxSdkNet {
+    ref class FederatedQuery;
+
+    /// <summary>
+    /// The Federation class manages a number of independent VideoXpert systems, or sites, as one.  Logins and queries
+    /// are made on every site in parallel, each with its own timeout, and their results are merged and tagged with
+    /// the site they came from.  A site that fails or does not respond in time is reported in the per-site results
+    /// without holding up the others.  The events of every site can also be received through a single
+    /// <see cref="SystemEvent"/>, raised in order from one dispatch thread.
+    /// </summary>
+    public ref class Federation {
+    public:
+
+        /// <summary>
+        /// The federated event delegate.
+        /// </summary>
+        /// <param name="site">The site the event came from.</param>
+        /// <param name="vxEvent">The event.</param>
+        delegate void FederatedEventDelegate(FederationSite^ site, Event^ vxEvent);
+
+        /// <summary>
+        /// The federated item callback delegate.
+        /// </summary>
+        /// <param name="item">An item returned by one of the sites.</param>
+        delegate void ItemDelegate(FederatedItem^ item);
+
+        /// <summary>
+        /// The query delegate, run against the system of each site.
+        /// </summary>
+        /// <param name="system">The system of the site.</param>
+        /// <returns>The items returned by the site.</returns>
+        delegate System::Collections::IEnumerable^ QueryDelegate(VXSystem^ system);
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        Federation();
+
+        /// <summary>
+        /// Destructor.
+        /// </summary>
+        virtual ~Federation() {
+            this->!Federation();
+        }
+
+        /// <summary>
+        /// Finaliser.
+        /// </summary>
+        !Federation();
+
+        /// <summary>
+        /// Adds a site to the federation.  The site is not logged in until <see cref="Login"/> is called.
+        /// </summary>
+        /// <param name="name">The unique name of the site.</param>
+        /// <param name="system">The system of the site.</param>
+        /// <param name="username">The username to log in to the site with.</param>
+        /// <param name="password">The password to log in to the site with.</param>
+        /// <returns>The new site.</returns>
+        FederationSite^ AddSite(System::String^ name, VXSystem^ system, System::String^ username, System::String^ password);
+
+        /// <summary>
+        /// Gets the data sources of every site using an optional collection filter.
+        /// </summary>
+        /// <param name="filters">The collection filters to be used in the request.</param>
+        /// <returns>A <c>List</c> of data sources, tagged with their sites.</returns>
+        System::Collections::Generic::List<FederatedItem^>^ GetDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters);
+
+        /// <summary>
+        /// Gets the events of every site using an optional collection filter.
+        /// </summary>
+        /// <param name="filters">The collection filters to be used in the request.</param>
+        /// <returns>A <c>List</c> of events, tagged with their sites.</returns>
+        System::Collections::Generic::List<FederatedItem^>^ GetEvents(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters);
+
+        /// <summary>
+        /// Gets the situations of every site using an optional collection filter.
+        /// </summary>
+        /// <param name="filters">The collection filters to be used in the request.</param>
+        /// <returns>A <c>List</c> of situations, tagged with their sites.</returns>
+        System::Collections::Generic::List<FederatedItem^>^ GetSituations(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters);
+
+        /// <summary>
+        /// Logs in to every site in parallel.  A site that has not finished logging in within the site timeout is
+        /// reported as <c>CommunicationError</c>, and becomes available to queries if its login later succeeds.
+        /// </summary>
+        /// <returns>The result of each login, keyed by site name.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ Login();
+
+        /// <summary>
+        /// Runs a query against every logged in site in parallel, passing the items to the callback as each site
+        /// returns them.  Sites that are not logged in are reported as <c>Unauthenticated</c>, sites that have not
+        /// returned within the site timeout as <c>CommunicationError</c>, and any items they return later are
+        /// discarded.
+        /// </summary>
+        /// <param name="query">The query to run against each site.</param>
+        /// <param name="callback">The callback to pass each item to.  It is not called concurrently.</param>
+        /// <returns>The result of the query on each site, keyed by site name.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ Query(QueryDelegate^ query, ItemDelegate^ callback);
+
+        /// <summary>
+        /// Subscribes to the events of every logged in site, which are then raised through <see cref="SystemEvent"/>.
+        /// The subscription is shared with any other subscribers to the events of the site's system, so while the
+        /// system is subscribed by situation type, only events of those types are received.
+        /// </summary>
+        /// <returns>The result of the subscription on each site, keyed by site name.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ SubscribeToEvents();
+
+        /// <summary>
+        /// Unsubscribes from the events of every site.  Events already received are still raised.
+        /// </summary>
+        /// <returns>The result of unsubscribing from each site, keyed by site name.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ UnsubscribeFromEvents();
+
+        /// <summary>
+        /// Gets the number of events raised through <see cref="SystemEvent"/>.
+        /// </summary>
+        /// <value>The number of dispatched events.</value>
+        property long long DispatchedEventCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_dispatchedEventCount); }
+        }
+
+        /// <summary>
+        /// Gets the number of events dropped because <see cref="MaxPendingEvents"/> were already waiting to be raised.
+        /// </summary>
+        /// <value>The number of dropped events.</value>
+        property long long DroppedEventCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_droppedEventCount); }
+        }
+
+        /// <summary>
+        /// Gets the number of exceptions thrown by the handlers of <see cref="SystemEvent"/>.  They are caught so that
+        /// the remaining events are still raised.
+        /// </summary>
+        /// <value>The number of handler exceptions.</value>
+        property int HandlerErrors {
+        public:
+            int get() { return _handlerErrors; }
+        }
+
+        /// <summary>
+        /// Gets or sets the largest number of events that may wait to be raised through <see cref="SystemEvent"/>
+        /// before further events are dropped.  Defaults to 65536.
+        /// </summary>
+        /// <value>The maximum number of pending events.</value>
+        property int MaxPendingEvents;
+
+        /// <summary>
+        /// Gets the number of events received but not yet raised through <see cref="SystemEvent"/>.
+        /// </summary>
+        /// <value>The number of pending events.</value>
+        property int PendingEventCount {
+        public:
+            int get() { return _pendingEventCount; }
+        }
+
+        /// <summary>
+        /// Gets the sites of the federation.
+        /// </summary>
+        /// <value>A <c>List</c> of sites.</value>
+        property System::Collections::Generic::List<FederationSite^>^ Sites {
+        public:
+            System::Collections::Generic::List<FederationSite^>^ get();
+        }
+
+        /// <summary>
+        /// Gets or sets the time, in milliseconds, to wait for each site to respond to a login, query or subscription.
+        /// Defaults to 30000.
+        /// </summary>
+        /// <value>The site timeout.</value>
+        property int SiteTimeout;
+
+        /// <summary>
+        /// SystemEvent is raised for each event received from any site while subscribed.
+        /// </summary>
+        event FederatedEventDelegate ^ SystemEvent {
+            void add(FederatedEventDelegate ^eventDelegate) { _systemEvent += eventDelegate; }
+            void remove(FederatedEventDelegate ^eventDelegate) { _systemEvent -= eventDelegate; }
+        }
+
+    internal:
+        delegate Results::Value SiteOperation(FederationSite^ site, FederatedQuery^ job);
+        System::Collections::Generic::List<FederationSite^>^ _sites;
+        System::Collections::Concurrent::ConcurrentQueue<FederatedItem^>^ _events;
+        System::Threading::Thread^ _dispatcher;
+        System::Threading::AutoResetEvent^ _wake;
+        bool _isSubscribed;
+        long long _dispatchedEventCount;
+        long long _droppedEventCount;
+        int _handlerErrors;
+        int _pendingEventCount;
+        FederatedEventDelegate ^ _systemEvent;
+        void _Dispatch();
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ _FanOut(FederatedQuery^ job);
+        Results::Value _LoginSite(FederationSite^ site, FederatedQuery^ job);
+        Results::Value _QuerySite(FederationSite^ site, FederatedQuery^ job);
+        void _QueueEvent(FederatedItem^ vxEvent);
+        void _RunSite(System::Object^ state);
+        Results::Value _SubscribeSite(FederationSite^ site, FederatedQuery^ job);
+        Results::Value _UnsubscribeSite(FederationSite^ site, FederatedQuery^ job);
+    };
+
+    /// <summary>
+    /// The state shared by the sites of a single federation login, query or subscription.
+    /// </summary>
+    private ref class FederatedQuery {
+    public:
+        Federation::SiteOperation^ Operation;
+        Federation::QueryDelegate^ Query;
+        Federation::ItemDelegate^ Callback;
+        System::Threading::CountdownEvent^ Pending;
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ SiteResults;
+        bool IsClosed;
+    };
+
+    /// <summary>
+    /// A single site's part of a <see cref="FederatedQuery"/>.
+    /// </summary>
+    private ref class FederatedSiteTask {
+    public:
+        FederatedSiteTask(FederatedQuery^ job, FederationSite^ site) : Job(job), Site(site) {}
+        FederatedQuery^ Job;
+        FederationSite^ Site;
+    };
+
+    /// <summary>
+    /// The queries and result collection used by the <c>Get</c> methods of <see cref="Federation"/>.
+    /// </summary>
+    private ref class FederatedGet {
+    public:
+        FederatedGet(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) : CollectionFilters(filters) {
+            Items = gcnew System::Collections::Generic::List<FederatedItem^>();
+        }
+
+        System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ CollectionFilters;
+        System::Collections::Generic::List<FederatedItem^>^ Items;
+        void Add(FederatedItem^ item) { Items->Add(item); }
+        System::Collections::IEnumerable^ GetDataSources(VXSystem^ system) { return system->GetDataSources(CollectionFilters); }
+        System::Collections::IEnumerable^ GetEvents(VXSystem^ system) { return system->GetEvents(CollectionFilters); }
+        System::Collections::IEnumerable^ GetSituations(VXSystem^ system) { return system->GetSituations(CollectionFilters); }
+    };
+}
+#endif // Federation_h__
@@ -0,0 +1,65 @@
+// Declares the federation site class.
+#ifndef FederationSite_h__
+#define FederationSite_h__
+
+#include "VXSystem.h"
+
+namespace VxSdkNet {
+    ref class Federation;
+
+    /// <summary>
+    /// The FederationSite class represents one of the VideoXpert systems of a <see cref="Federation"/>.
+    /// </summary>
+    public ref class FederationSite {
+    public:
+
+        /// <summary>
+        /// Gets the result of the most recent login, query or subscription made on this site by the federation.
+        /// </summary>
+        /// <value>The <see cref="Results::Value">Result</see> of the last operation.</value>
+        property Results::Value LastResult {
+        public:
+            Results::Value get() { return _lastResult; }
+        }
+
+        /// <summary>
+        /// Gets the result of the most recent login to this site.  Sites that are not logged in are skipped by queries.
+        /// </summary>
+        /// <value>The <see cref="Results::Value">Result</see> of the last login.</value>
+        property Results::Value LoginResult {
+        public:
+            Results::Value get() { return _loginResult; }
+        }
+
+        /// <summary>
+        /// Gets the name of this site, which identifies it in results and events.
+        /// </summary>
+        /// <value>The site name.</value>
+        property System::String^ Name {
+        public:
+            System::String^ get() { return _name; }
+        }
+
+        /// <summary>
+        /// Gets the VideoXpert system of this site.
+        /// </summary>
+        /// <value>The VideoXpert system.</value>
+        property VXSystem^ VxSystem {
+        public:
+            VXSystem^ get() { return _system; }
+        }
+
+    internal:
+        FederationSite(Federation^ federation, System::String^ name, VXSystem^ system, System::String^ username, System::String^ password);
+        Federation^ _federation;
+        System::String^ _name;
+        System::String^ _username;
+        System::String^ _password;
+        VXSystem^ _system;
+        Results::Value _lastResult;
+        Results::Value _loginResult;
+        Results::Value _Login();
+        void _OnEvent(Event^ vxEvent);
+    };
+}
+#endif // FederationSite_h__
@@ -73,7 +73,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Gap() {
-            this->!Gap();
+            NativeMemory::Remove(_gap);
+            _gap->Delete();
+            _gap = nullptr;
         }
 
         /// <summary>
@@ -166,6 +168,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxGap* _gap;
+        IdentityMap^ _identityMap;
         VxSdkNet::DataSource^ _GetDataSource();
         VxSdkNet::DataStorage^ _GetDataStorage();
         System::Collections::Generic::List<System::Collections::Generic::KeyValuePair<System::String^, System::String^>>^ _GetReasonData();
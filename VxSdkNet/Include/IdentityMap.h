@@ -0,0 +1,156 @@
+// Declares the identity map class.
+#ifndef IdentityMap_h__
+#define IdentityMap_h__
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The IdentityMap class keeps a single wrapper for each <see cref="DataSource"/> and <see cref="Device"/> of a
+    /// <see cref="VXSystem"/>, so that listings and navigation properties such as <see cref="Event::GeneratorDevice"/>
+    /// or <see cref="Gap::DataSource"/> return the same object for the same resource rather than a new wrapper each
+    /// time.  Each system has its own map, so wrappers from different systems or logins are never shared.  When a
+    /// resource is fetched again its existing wrapper is updated in place with the newly fetched state, unless a call
+    /// is using the wrapper at the time, in which case it keeps its current state.  Wrappers are held by weak
+    /// reference, so the map does not keep them alive.  The map is disabled by default; while it is enabled, wrappers
+    /// are shared and should not be disposed by one user while another may still be using them.  Wrappers reached
+    /// through objects that are not themselves created from the system's map, such as the privileges of a role, are
+    /// not shared.  The map also holds the native system once logged in, so that <see cref="BulkLink"/> can fetch
+    /// further handles to a resource from it.
+    /// </summary>
+    public ref class IdentityMap {
+    public:
+
+        /// <summary>
+        /// Removes all wrappers from the map.  Wrappers already returned remain valid.
+        /// </summary>
+        void Clear();
+
+        /// <summary>
+        /// Gets the number of live wrappers of each type held in the map.
+        /// </summary>
+        /// <returns>A <c>Dictionary</c> of wrapper type names and the number of live wrappers of that type.</returns>
+        System::Collections::Generic::Dictionary<System::String^, int>^ GetLiveCounts();
+
+        /// <summary>
+        /// Gets or sets whether wrappers are shared through the map.  Defaults to <c>false</c>.
+        /// </summary>
+        /// <value><c>true</c> if the map is enabled, otherwise <c>false</c>.</value>
+        property bool Enabled {
+        public:
+            bool get() { return _enabled; }
+            void set(bool value) { _enabled = value; }
+        }
+
+        /// <summary>
+        /// Gets the number of fetches that returned an existing wrapper.
+        /// </summary>
+        /// <value>The number of hits.</value>
+        property long long HitCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_hitCount); }
+        }
+
+        /// <summary>
+        /// Gets the fraction of fetches that returned an existing wrapper.
+        /// </summary>
+        /// <value>The hit rate, from 0 to 1.</value>
+        property double HitRate {
+        public:
+            double get();
+        }
+
+        /// <summary>
+        /// Gets the number of live wrappers held in the map.
+        /// </summary>
+        /// <value>The number of live wrappers.</value>
+        property int LiveCount {
+        public:
+            int get();
+        }
+
+        /// <summary>
+        /// Gets the number of fetches that created a new wrapper.
+        /// </summary>
+        /// <value>The number of misses.</value>
+        property long long MissCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_missCount); }
+        }
+
+    internal:
+        static const int MinPruneCount = 1024;
+        System::Collections::Generic::Dictionary<System::String^, System::WeakReference^>^ _wrappers;
+        volatile bool _enabled;
+        VxSdk::IVxSystem* _system;
+        int _pruneCount;
+        long long _hitCount;
+        long long _missCount;
+        IdentityMap();
+
+        /// <summary>
+        /// Gets the wrapper for a native object, reusing the existing wrapper for the same resource if there is one.
+        /// The wrapper takes ownership of the native object either way.
+        /// </summary>
+        /// <param name="map">The map of the system the object belongs to, or <c>null</c> if it is not known.</param>
+        /// <param name="handle">The native object.</param>
+        /// <returns>The wrapper for the resource.</returns>
+        template<typename TWrapper, typename TNative>
+        static TWrapper^ Intern(IdentityMap^ map, TNative* handle) {
+            if (map == nullptr || !map->_enabled)
+                return Wrap<TWrapper>(map, handle);
+
+            System::String^ key = System::String::Concat(TWrapper::typeid->Name, "/", gcnew System::String(handle->id));
+            TWrapper^ wrapper = dynamic_cast<TWrapper^>(map->_Find(key));
+            if (wrapper != nullptr && !wrapper->_isDisposed) {
+                wrapper->_Replace(handle);
+                return wrapper;
+            }
+
+            // Only shared wrappers have their native object replaced, so only they need a native lock
+            wrapper = Wrap<TWrapper>(map, handle);
+            wrapper->_nativeLock = gcnew System::Threading::ReaderWriterLockSlim(System::Threading::LockRecursionPolicy::SupportsRecursion);
+            map->_Add(key, wrapper);
+            return wrapper;
+        }
+
+        /// <summary>
+        /// Creates a new wrapper for a native object that carries the map, so that the wrappers it returns in turn
+        /// are shared through the same map.
+        /// </summary>
+        /// <param name="map">The map of the system the object belongs to, or <c>null</c> if it is not known.</param>
+        /// <param name="handle">The native object.</param>
+        /// <returns>The new wrapper.</returns>
+        template<typename TWrapper, typename TNative>
+        static TWrapper^ Wrap(IdentityMap^ map, TNative* handle) {
+            TWrapper^ wrapper = gcnew TWrapper(handle);
+            wrapper->_identityMap = map;
+            return wrapper;
+        }
+
+        void _Add(System::String^ key, System::Object^ wrapper);
+        System::Object^ _Find(System::String^ key);
+    };
+
+    /// <summary>
+    /// Holds the native lock of a shared wrapper for reading while its native object is in use, so that the
+    /// <see cref="IdentityMap"/> cannot replace the object until the lock is released at the end of the scope.
+    /// A <c>null</c> lock, such as that of a wrapper that is not shared or of an optional source, is ignored.
+    /// </summary>
+    private ref class NativeReadLock {
+    public:
+        NativeReadLock(System::Threading::ReaderWriterLockSlim^ nativeLock) {
+            _nativeLock = nativeLock;
+            if (_nativeLock != nullptr)
+                _nativeLock->EnterReadLock();
+        }
+
+        ~NativeReadLock() {
+            if (_nativeLock != nullptr)
+                _nativeLock->ExitReadLock();
+        }
+
+    private:
+        System::Threading::ReaderWriterLockSlim^ _nativeLock;
+    };
+}
+#endif // IdentityMap_h__
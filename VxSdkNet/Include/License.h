@@ -45,7 +45,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~License() {
-            this->!License();
+            NativeMemory::Remove(_license);
+            _license->Delete();
+            _license = nullptr;
         }
 
         /// <summary>
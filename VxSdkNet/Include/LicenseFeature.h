@@ -22,7 +22,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~LicenseFeature() {
-            this->!LicenseFeature();
+            NativeMemory::Remove(_licenseFeature);
+            _licenseFeature->Delete();
+            _licenseFeature = nullptr;
         }
 
         /// <summary>
@@ -176,6 +178,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxLicenseFeature* _licenseFeature;
+        IdentityMap^ _identityMap;
         System::String^ _GetCapabilityRequest();
     };
 }
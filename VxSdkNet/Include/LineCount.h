@@ -84,6 +84,9 @@ namespace VxSdkNet {
         /// </summary>
         /// <value>The start time.</value>
         property System::DateTime StartTime;
+
+    internal:
+        LineCount() {}
     };
 }
 #endif // LineCount_h__
@@ -0,0 +1,158 @@
+// Declares the line count store class.
+#ifndef LineCountStore_h__
+#define LineCountStore_h__
+
+#include "CoverageIndex.h"
+#include "DataSource.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// Holds a run of consecutive hourly line counts in columns.  Blocks loaded from a store file are left encoded in
+    /// the mapped file, at the given offset and length, until they are first used.
+    /// </summary>
+    private ref class LineCountBlock {
+    public:
+        static const int MaxRows = 256;
+        int FirstHour;
+        int RowCount;
+        long long Offset;
+        int Length;
+        System::Collections::Generic::List<int>^ Hours;
+        array<System::Collections::Generic::List<int>^>^ Columns;
+    };
+
+    /// <summary>
+    /// Holds the hourly line counts of a single analytic behavior in blocks ordered by hour, along with the hours that
+    /// have been fetched.
+    /// </summary>
+    private ref class LineCountSeries {
+    public:
+        LineCountSeries(System::String^ dataSourceId, System::String^ analyticBehaviorId);
+        LineCountBlock^ Decode(int blockIndex);
+        int FindBlock(int hour);
+        int GetRowCount();
+        void Set(int hour, LineCount^ lineCount);
+
+        static const int ColumnCount = 6;
+        System::String^ DataSourceId;
+        System::String^ AnalyticBehaviorId;
+        CoverageIndex^ Fetched;
+        System::Collections::Generic::List<LineCountBlock^>^ Blocks;
+        System::IO::MemoryMappedFiles::MemoryMappedViewAccessor^ View;
+
+    private:
+        static LineCountBlock^ _CreateBlock();
+    };
+
+    /// <summary>
+    /// The LineCountStore class caches line counts locally so that repeated queries over the same time ranges do not
+    /// go back to the system.  Counts are fetched by the hour and only for hours that have not been fetched before;
+    /// day, week and month totals are rolled up locally from the hourly counts.  The store may be saved to a compact
+    /// file, which holds the counts in blocks of delta encoded hours and variable length counters along with a
+    /// fixed-width index of the blocks.  The file is memory mapped when the store is created, and each block is only
+    /// decoded once it is queried.
+    /// </summary>
+    public ref class LineCountStore {
+    public:
+
+        /// <summary>
+        /// Values that represent the interval line counts are totaled over.
+        /// </summary>
+        enum class Intervals {
+            /// <summary>A time interval of one hour.</summary>
+            Hour,
+
+            /// <summary>A time interval of one day.</summary>
+            Day,
+
+            /// <summary>A time interval of one week, starting on Monday.</summary>
+            Week,
+
+            /// <summary>A time interval of one month.</summary>
+            Month
+        };
+
+        /// <summary>
+        /// Constructor for a store that is held in memory only.
+        /// </summary>
+        LineCountStore();
+
+        /// <summary>
+        /// Constructor for a store that is saved to a file.  The store is loaded from the file if it exists.
+        /// </summary>
+        /// <param name="filePath">The path of the file to load and save the store.</param>
+        LineCountStore(System::String^ filePath);
+
+        /// <summary>
+        /// Destructor.  Releases the mapped store file.
+        /// </summary>
+        virtual ~LineCountStore();
+
+        /// <summary>
+        /// Removes all line counts from the store.
+        /// </summary>
+        void Clear();
+
+        /// <summary>
+        /// Gets the line counts of an analytic behavior between a start and end time, totaled over the given interval.
+        /// Any hours in the range that have not been fetched before are fetched from the data source first.  Intervals
+        /// with no counts are omitted.
+        /// </summary>
+        /// <param name="dataSource">The data source the analytic behavior belongs to.</param>
+        /// <param name="analyticBehaviorId">The unique identifier of the analytic behavior.</param>
+        /// <param name="startTime">The start of the time range.</param>
+        /// <param name="endTime">The end of the time range.</param>
+        /// <param name="interval">The interval to total the line counts over.</param>
+        /// <returns>A <c>List</c> of line counts, in order.</returns>
+        System::Collections::Generic::List<LineCount^>^ GetLineCounts(DataSource^ dataSource, System::String^ analyticBehaviorId,
+            System::DateTime startTime, System::DateTime endTime, Intervals interval);
+
+        /// <summary>
+        /// Saves the store to its file.
+        /// </summary>
+        /// <returns>The <see cref="Results::Value">Result</see> of saving the store.</returns>
+        Results::Value Save();
+
+        /// <summary>
+        /// Gets the path of the file the store is saved to, if any.
+        /// </summary>
+        /// <value>The file path.</value>
+        property System::String^ FilePath {
+        public:
+            System::String^ get() { return _filePath; }
+        }
+
+        /// <summary>
+        /// Gets the number of hourly line counts held in the store.
+        /// </summary>
+        /// <value>The number of hourly line counts.</value>
+        property int RowCount {
+        public:
+            int get();
+        }
+
+        /// <summary>
+        /// Gets or sets the time zone that day, week and month intervals are aligned to.  Defaults to the local time zone.
+        /// </summary>
+        /// <value>The time zone.</value>
+        property System::TimeZoneInfo^ TimeZone;
+
+    internal:
+        System::String^ _filePath;
+        System::IO::MemoryMappedFiles::MemoryMappedFile^ _file;
+        System::IO::MemoryMappedFiles::MemoryMappedViewAccessor^ _view;
+        System::Collections::Generic::Dictionary<System::String^, LineCountSeries^>^ _series;
+        static array<unsigned char>^ _EncodeBlock(LineCountBlock^ block);
+        System::DateTime _GetBucketStart(System::DateTime hour, Intervals interval);
+        System::DateTime _GetBucketEnd(System::DateTime bucketStart, Intervals interval);
+        LineCountSeries^ _GetSeries(System::String^ dataSourceId, System::String^ analyticBehaviorId);
+        void _Load();
+        void _Map();
+        System::DateTime _ToUtc(System::DateTime localTime);
+        void _Unmap();
+        static unsigned long long _ReadVarint(System::IO::BinaryReader^ reader);
+        static void _WriteVarint(System::IO::BinaryWriter^ writer, unsigned long long value);
+    };
+}
+#endif // LineCountStore_h__
@@ -22,7 +22,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Log() {
-            this->!Log();
+            NativeMemory::Remove(_log);
+            _log->Delete();
+            _log = nullptr;
         }
 
         /// <summary>
@@ -27,7 +27,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~ManualRecording() {
-            this->!ManualRecording();
+            NativeMemory::Remove(_manualRecording);
+            _manualRecording->Delete();
+            _manualRecording = nullptr;
         }
 
         /// <summary>
@@ -94,6 +96,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxManualRecording* _manualRecording;
+        IdentityMap^ _identityMap;
         VxSdkNet::DataSource^ _GetDataSource();
     };
 }
@@ -26,7 +26,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Marker() {
-            this->!Marker();
+            NativeMemory::Remove(_marker);
+            _marker->Delete();
+            _marker = nullptr;
         }
 
         /// <summary>
@@ -179,6 +181,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxMarker* _marker;
+        IdentityMap^ _identityMap;
         VxSdkNet::DataSource^ _GetAssociatedDataSource();
         VxSdkNet::Drawing^ _GetAssociatedDrawing();
         VxSdkNet::Drawing^ _GetDrawing();
@@ -64,7 +64,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Member() {
-            this->!Member();
+            NativeMemory::Remove(_member);
+            _member->Delete();
+            _member = nullptr;
         }
 
         /// <summary>
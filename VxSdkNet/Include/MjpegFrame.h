@@ -0,0 +1,83 @@
+// Declares the MJPEG frame class.
+#ifndef MjpegFrame_h__
+#define MjpegFrame_h__
+
+namespace VxSdkNet {
+    ref class MjpegStream;
+
+    /// <summary>
+    /// The MjpegFrame class represents a JPEG frame pulled from an <see cref="MjpegStream"/>.  The frame data is held
+    /// in a pooled buffer that is reused once the frame callback returns, so it must be copied (see <see cref="ToArray"/>)
+    /// if it is needed afterwards.
+    /// </summary>
+    public ref class MjpegFrame {
+    public:
+
+        /// <summary>
+        /// Copies the frame data into a new array.
+        /// </summary>
+        /// <returns>The JPEG data.</returns>
+        array<unsigned char>^ ToArray() {
+            array<unsigned char>^ data = gcnew array<unsigned char>(_length);
+            System::Buffer::BlockCopy(_data, 0, data, 0, _length);
+            return data;
+        }
+
+        /// <summary>
+        /// Gets the buffer holding the JPEG data.  The buffer may be longer than the frame; only the first
+        /// <see cref="Length"/> bytes are valid.
+        /// </summary>
+        /// <value>The JPEG data buffer.</value>
+        property array<unsigned char>^ Data {
+        public:
+            array<unsigned char>^ get() { return _data; }
+        }
+
+        /// <summary>
+        /// Gets the length of the JPEG data in bytes.
+        /// </summary>
+        /// <value>The JPEG data length.</value>
+        property int Length {
+        public:
+            int get() { return _length; }
+        }
+
+        /// <summary>
+        /// Gets the time the frame was received.
+        /// </summary>
+        /// <value>The time received.</value>
+        property System::DateTime Received {
+        public:
+            System::DateTime get() { return _received; }
+        }
+
+        /// <summary>
+        /// Gets the sequence number of the frame within its stream.  Frames are delivered in increasing sequence order,
+        /// but not every sequence number is delivered.
+        /// </summary>
+        /// <value>The sequence number.</value>
+        property long long Sequence {
+        public:
+            long long get() { return _sequence; }
+        }
+
+        /// <summary>
+        /// Gets the stream the frame was pulled from.
+        /// </summary>
+        /// <value>The MJPEG stream.</value>
+        property MjpegStream^ Stream {
+        public:
+            MjpegStream^ get() { return _stream; }
+        }
+
+    internal:
+        MjpegFrame(MjpegStream^ stream, array<unsigned char>^ data, int length, long long sequence) :
+            _stream(stream), _data(data), _length(length), _sequence(sequence), _received(System::DateTime::UtcNow) {}
+        MjpegStream^ _stream;
+        array<unsigned char>^ _data;
+        int _length;
+        long long _sequence;
+        System::DateTime _received;
+    };
+}
+#endif // MjpegFrame_h__
@@ -0,0 +1,93 @@
+// Declares the MJPEG puller class.
+#ifndef MjpegPuller_h__
+#define MjpegPuller_h__
+
+#include "MjpegStream.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The MjpegPuller class pulls JPEG frames from any number of MJPEG data sessions (see
+    /// <see cref="DataSource::CreateMjpegStream"/>).  Requests are made over persistent connections with a number of
+    /// them in flight per session, and frames are delivered in pooled buffers.  The request rate of each session adapts
+    /// between <see cref="MinFrameRate"/> and <see cref="MaxFrameRate"/> to how quickly its callback consumes frames, and
+    /// each data session is kept alive automatically.
+    /// </summary>
+    public ref class MjpegPuller {
+    public:
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        MjpegPuller();
+
+        /// <summary>
+        /// Destructor.  Stops pulling frames from every stream.
+        /// </summary>
+        virtual ~MjpegPuller();
+
+        /// <summary>
+        /// Starts pulling frames from a data session.  The callback is called on a worker thread, and never for more
+        /// than one frame of the same stream at a time.
+        /// </summary>
+        /// <param name="session">The MJPEG data session to pull frames from.</param>
+        /// <param name="callback">The callback to pass each frame to.</param>
+        /// <returns><c>nullptr</c> if the session has no JPEG URI, else the new stream.</returns>
+        MjpegStream^ Add(DataSession^ session, MjpegStream::FrameDelegate^ callback);
+
+        /// <summary>
+        /// Stops pulling frames from a stream.  The data session is not deleted.
+        /// </summary>
+        /// <param name="stream">The stream to stop.</param>
+        void Remove(MjpegStream^ stream);
+
+        /// <summary>
+        /// Gets or sets the interval, in milliseconds, at which each data session is updated to keep it alive.
+        /// Defaults to 10000.
+        /// </summary>
+        /// <value>The keep alive interval in milliseconds.</value>
+        property int KeepAliveInterval;
+
+        /// <summary>
+        /// Gets or sets the highest rate, in frames per second, at which frames are requested from a stream.
+        /// Defaults to 30.
+        /// </summary>
+        /// <value>The maximum frame rate.</value>
+        property int MaxFrameRate;
+
+        /// <summary>
+        /// Gets or sets the lowest rate, in frames per second, at which frames are requested from a stream when its
+        /// callback is slow.  Defaults to 1.
+        /// </summary>
+        /// <value>The minimum frame rate.</value>
+        property int MinFrameRate;
+
+        /// <summary>
+        /// Gets or sets the number of frame requests that may be in flight at once for each stream.  Defaults to 2.
+        /// </summary>
+        /// <value>The pipeline depth.</value>
+        property int PipelineDepth;
+
+        /// <summary>
+        /// Gets the streams being pulled.
+        /// </summary>
+        /// <value>A <c>List</c> of the streams.</value>
+        property System::Collections::Generic::List<MjpegStream^>^ Streams {
+        public:
+            System::Collections::Generic::List<MjpegStream^>^ get();
+        }
+
+        /// <summary>
+        /// Gets or sets the amount of time, in milliseconds, to wait for a frame.  Defaults to 5000.
+        /// </summary>
+        /// <value>The frame timeout in milliseconds.</value>
+        property int Timeout;
+
+    internal:
+        System::Collections::Generic::List<MjpegStream^>^ _streams;
+        System::Collections::Concurrent::ConcurrentBag<array<unsigned char>^>^ _buffers;
+        array<unsigned char>^ _RentBuffer(int size);
+        void _ReturnBuffer(array<unsigned char>^ buffer);
+    };
+}
+#endif // MjpegPuller_h__
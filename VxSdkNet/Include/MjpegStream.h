@@ -0,0 +1,128 @@
+// Declares the MJPEG stream class.
+#ifndef MjpegStream_h__
+#define MjpegStream_h__
+
+#include "DataSession.h"
+#include "MjpegFrame.h"
+
+namespace VxSdkNet {
+    ref class MjpegPuller;
+
+    /// <summary>
+    /// A frame request that is in flight for an <see cref="MjpegStream"/>, along with the frame read so far.
+    /// </summary>
+    private ref class MjpegRequest {
+    public:
+        MjpegRequest(System::Net::HttpWebRequest^ request, long long sequence) : Request(request), Sequence(sequence) {}
+        System::Net::HttpWebRequest^ Request;
+        long long Sequence;
+        System::Net::WebResponse^ Response;
+        System::IO::Stream^ Body;
+        array<unsigned char>^ Buffer;
+        int Length;
+        long long ContentLength;
+    };
+
+    /// <summary>
+    /// The MjpegStream class represents an MJPEG data session being pulled by an <see cref="MjpegPuller"/>.  Frames are
+    /// requested at a rate that adapts to how quickly the frame callback consumes them.
+    /// </summary>
+    public ref class MjpegStream {
+    public:
+
+        /// <summary>
+        /// The frame callback delegate.
+        /// </summary>
+        /// <param name="frame">The frame that has been pulled.</param>
+        delegate void FrameDelegate(MjpegFrame^ frame);
+
+        /// <summary>
+        /// Gets the number of frame requests that have failed, including frames for which the callback threw an
+        /// exception.
+        /// </summary>
+        /// <value>The number of failed requests.</value>
+        property int Errors {
+        public:
+            int get() { return _errors; }
+        }
+
+        /// <summary>
+        /// Gets the current rate, in frames per second, at which frames are being delivered to the callback.
+        /// </summary>
+        /// <value>The delivered frame rate.</value>
+        property double FrameRate {
+        public:
+            double get() { return _frameInterval > 0 ? 1000 / _frameInterval : 0; }
+        }
+
+        /// <summary>
+        /// Gets the number of frames that have been delivered to the callback.
+        /// </summary>
+        /// <value>The number of delivered frames.</value>
+        property int FramesDelivered {
+        public:
+            int get() { return _framesDelivered; }
+        }
+
+        /// <summary>
+        /// Gets the number of frames that were received but not delivered, either because a newer frame had already
+        /// been delivered or because the callback was still busy with the previous frame.
+        /// </summary>
+        /// <value>The number of dropped frames.</value>
+        property int FramesDropped {
+        public:
+            int get() { return _framesDropped; }
+        }
+
+        /// <summary>
+        /// Gets the current amount of time, in milliseconds, between frame requests.
+        /// </summary>
+        /// <value>The request interval in milliseconds.</value>
+        property int RequestInterval {
+        public:
+            int get() { return _interval; }
+        }
+
+        /// <summary>
+        /// Gets the data session being pulled.
+        /// </summary>
+        /// <value>The data session.</value>
+        property DataSession^ Session {
+        public:
+            DataSession^ get() { return _session; }
+        }
+
+    internal:
+        MjpegStream(MjpegPuller^ puller, DataSession^ session, FrameDelegate^ callback);
+        MjpegPuller^ _puller;
+        DataSession^ _session;
+        System::String^ _uri;
+        FrameDelegate^ _callback;
+        System::Threading::Timer^ _timer;
+        System::Diagnostics::Stopwatch^ _sinceKeepAlive;
+        System::Object^ _deliveryLock;
+        bool _isStopped;
+        int _inFlight;
+        int _interval;
+        int _errors;
+        int _framesDelivered;
+        int _framesDropped;
+        long long _nextSequence;
+        long long _lastDelivered;
+        long long _lastDeliveryTicks;
+        double _consumerTime;
+        double _frameInterval;
+        void _Adapt(bool isError);
+        void _Complete(MjpegRequest^ pending, bool isError);
+        void _Deliver(array<unsigned char>^ buffer, int length, long long sequence);
+        bool _EndRead(MjpegRequest^ pending, System::IAsyncResult^ result);
+        void _Issue();
+        void _OnRead(System::IAsyncResult^ result);
+        void _OnResponse(System::IAsyncResult^ result);
+        void _Read(MjpegRequest^ pending);
+        void _Start();
+        void _Stop();
+        void _Tick(System::Object^ state);
+    };
+}
+#endif // MjpegStream_h__
@@ -99,7 +99,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Monitor() {
-            this->!Monitor();
+            NativeMemory::Remove(_monitor);
+            _monitor->Delete();
+            _monitor = nullptr;
         }
 
         /// <summary>
@@ -263,6 +265,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxMonitor* _monitor;
+        IdentityMap^ _identityMap;
         VxSdkNet::ResourceLimits^ _GetLimits();
         System::Collections::Generic::List<MonitorCell^>^ _GetMonitorCells();
         System::Collections::Generic::List<VxSdkNet::Monitor::Layouts>^ _GetAvailableLayouts();
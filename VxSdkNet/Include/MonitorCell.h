@@ -40,7 +40,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~MonitorCell() {
-            this->!MonitorCell();
+            NativeMemory::Remove(_monitorCell);
+            _monitorCell->Delete();
+            _monitorCell = nullptr;
         }
 
         /// <summary>
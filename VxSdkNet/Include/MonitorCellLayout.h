@@ -0,0 +1,63 @@
+// Declares the monitor cell layout class.
+#ifndef MonitorCellLayout_h__
+#define MonitorCellLayout_h__
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The MonitorCellLayout class describes the target state of a <see cref="MonitorCell"/> within a
+    /// <see cref="MonitorWallLayout"/>.  Values that are not set are left as they are on the cell.
+    /// </summary>
+    public ref class MonitorCellLayout {
+    public:
+
+        /// <summary>
+        /// Gets or sets the height of the crop bounds expressed as a percentage (0-1).  If only one of the crop height
+        /// and width is set, the other keeps its current value.
+        /// </summary>
+        /// <value>The crop height, or <c>null</c> to leave it unchanged.</value>
+        property System::Nullable<float> CropHeight;
+
+        /// <summary>
+        /// Gets or sets the width of the crop bounds expressed as a percentage (0-1).  If only one of the crop height
+        /// and width is set, the other keeps its current value.
+        /// </summary>
+        /// <value>The crop width, or <c>null</c> to leave it unchanged.</value>
+        property System::Nullable<float> CropWidth;
+
+        /// <summary>
+        /// Gets or sets the unique identifier of the data source that the cell shall display.  An empty string
+        /// disconnects the data source currently displayed.
+        /// </summary>
+        /// <value>The unique identifier of the data source, or <c>null</c> to leave it unchanged.</value>
+        property System::String^ DataSourceId;
+
+        /// <summary>
+        /// Gets or sets whether or not the cell is part of the monitor's sync group.
+        /// </summary>
+        /// <value><c>true</c> to join the sync group, <c>false</c> to leave, or <c>null</c> to leave it unchanged.</value>
+        property System::Nullable<bool> IsInSync;
+
+        /// <summary>
+        /// Gets or sets the X location of the crop bounds or immersive position.  Any location values that are not set
+        /// keep their current values.
+        /// </summary>
+        /// <value>The X location, or <c>null</c> to leave it unchanged.</value>
+        property System::Nullable<int> LocationX;
+
+        /// <summary>
+        /// Gets or sets the Y location of the crop bounds or immersive position.  Any location values that are not set
+        /// keep their current values.
+        /// </summary>
+        /// <value>The Y location, or <c>null</c> to leave it unchanged.</value>
+        property System::Nullable<int> LocationY;
+
+        /// <summary>
+        /// Gets or sets the Z location of the crop bounds or immersive position.  Any location values that are not set
+        /// keep their current values.
+        /// </summary>
+        /// <value>The Z location, or <c>null</c> to leave it unchanged.</value>
+        property System::Nullable<int> LocationZ;
+    };
+}
+#endif // MonitorCellLayout_h__
@@ -25,7 +25,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~MonitorWall() {
-            this->!MonitorWall();
+            NativeMemory::Remove(_monitorWall);
+            _monitorWall->Delete();
+            _monitorWall = nullptr;
         }
 
         /// <summary>
@@ -0,0 +1,108 @@
+// Declares the monitor wall layout class.
+#ifndef MonitorWallLayout_h__
+#define MonitorWallLayout_h__
+
+#include "MonitorCellLayout.h"
+#include "MonitorWall.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The MonitorWallLayout class describes the target state of the monitors and cells of a <see cref="MonitorWall"/>,
+    /// such as a salvo, and applies it in one step.  The current state of the wall is read first and only the values
+    /// that differ are sent.  The monitors are updated concurrently; each monitor's layout is changed before its cells,
+    /// and its cells are then updated one after another, in index order.
+    /// </summary>
+    public ref class MonitorWallLayout {
+    public:
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        MonitorWallLayout();
+
+        /// <summary>
+        /// Applies the layout to a monitor wall.  Values that already match are not sent and are reported as
+        /// <c>OK</c>.  A monitor or cell that does not exist on the wall is reported as <c>InvalidParameters</c>.
+        /// This method blocks until every change has been sent.
+        /// </summary>
+        /// <param name="monitorWall">The monitor wall to apply the layout to.</param>
+        /// <returns>
+        /// The result of each change, keyed by monitor number, cell index and value, for example <c>3.Layout</c> or
+        /// <c>3.2.DataSourceId</c>, and <c>Selection</c> for the monitor selection.
+        /// </returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ Apply(MonitorWall^ monitorWall);
+
+        /// <summary>
+        /// Gets the target state of a monitor cell, adding it to the layout if it is not already part of it.
+        /// </summary>
+        /// <param name="monitorNumber">The number of the monitor.</param>
+        /// <param name="cellIndex">The index of the cell within the monitor's layout.</param>
+        /// <returns>The target state of the cell.</returns>
+        MonitorCellLayout^ GetCell(int monitorNumber, int cellIndex);
+
+        /// <summary>
+        /// Sets the cell layout of a monitor.
+        /// </summary>
+        /// <param name="monitorNumber">The number of the monitor.</param>
+        /// <param name="layout">The cell layout of the monitor.</param>
+        void SetMonitorLayout(int monitorNumber, Monitor::Layouts layout);
+
+        /// <summary>
+        /// Sets the monitor/cell selection to make on the monitor wall.
+        /// </summary>
+        /// <param name="cellIndex">Index of the monitor cell to select within the monitor (1-based).</param>
+        /// <param name="monitorIndex">Index of the monitor to select within the monitor wall (1-based).</param>
+        /// <param name="inputMode">Input mode for the selected monitor cell.</param>
+        void SetMonitorSelection(int cellIndex, int monitorIndex, MonitorSelection::CellInputMode inputMode);
+
+        /// <summary>
+        /// Gets or sets the maximum number of monitors that may be updated at once.  Defaults to 48.
+        /// </summary>
+        /// <value>The maximum number of concurrent updates.</value>
+        property int MaxConcurrentUpdates;
+
+        /// <summary>
+        /// Gets or sets the owner of the monitor selection.  If set, the selection is only sent when that owner's
+        /// current selection differs; otherwise it is always sent.
+        /// </summary>
+        /// <value>The owner of the monitor selection.</value>
+        property System::String^ SelectionOwner;
+
+    internal:
+        System::Collections::Generic::Dictionary<int, Monitor::Layouts>^ _layouts;
+        System::Collections::Generic::Dictionary<int, System::Collections::Generic::SortedDictionary<int, MonitorCellLayout^>^>^ _cells;
+        bool _hasSelection;
+        int _selectionCell;
+        int _selectionMonitor;
+        MonitorSelection::CellInputMode _selectionInputMode;
+        void _ApplyCell(System::String^ key, MonitorCell^ cell, MonitorCellLayout^ target,
+            System::Collections::Generic::Dictionary<System::String^, Results::Value>^ results);
+        Results::Value _ApplySelection(MonitorWall^ monitorWall);
+        void _RunCells(System::Object^ state);
+        void _RunMonitors(System::Object^ state);
+    };
+
+    /// <summary>
+    /// A monitor cell and its target state, to be updated as part of a <see cref="MonitorWallLayout::Apply"/> call.
+    /// </summary>
+    private ref class MonitorCellChange {
+    public:
+        MonitorCellChange(System::String^ key, MonitorCell^ cell, MonitorCellLayout^ target) : Key(key), Cell(cell), Target(target) {}
+        System::String^ Key;
+        MonitorCell^ Cell;
+        MonitorCellLayout^ Target;
+    };
+
+    /// <summary>
+    /// The state shared by the workers of a <see cref="MonitorWallLayout::Apply"/> call.
+    /// </summary>
+    private ref class MonitorWallLayoutJob {
+    public:
+        System::Collections::Concurrent::ConcurrentQueue<Monitor^>^ Monitors;
+        System::Collections::Concurrent::ConcurrentQueue<System::Collections::Generic::Queue<MonitorCellChange^>^>^ Cells;
+        System::Threading::CountdownEvent^ Workers;
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ ItemResults;
+    };
+}
+#endif // MonitorWallLayout_h__
@@ -0,0 +1,124 @@
+// Declares the multi pixel search class.
+#ifndef MultiPixelSearch_h__
+#define MultiPixelSearch_h__
+
+#include "NewPixelSearch.h"
+#include "PixelSearchMatch.h"
+#include "PixelSearchResult.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The MultiPixelSearch class runs pixel searches across a number of data sources at once.  Searches are created
+    /// with a limit on how many run at the same time and are polled with an increasing interval until they complete.
+    /// The result of each search is passed to a callback as soon as it is available, and the matches of all searches
+    /// are merged into a single timeline.  Each search is deleted from its data source once its results are read.
+    /// </summary>
+    public ref class MultiPixelSearch {
+    public:
+
+        /// <summary>
+        /// The search result callback delegate.
+        /// </summary>
+        /// <param name="result">The result of the search of a single data source.</param>
+        delegate void ResultDelegate(PixelSearchResult^ result);
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        MultiPixelSearch();
+
+        /// <summary>
+        /// Cancels the searches in progress.  Searches that have not started are skipped, and those that have are
+        /// stopped with the clips found so far.
+        /// </summary>
+        void Cancel();
+
+        /// <summary>
+        /// Runs the same pixel search on each of the given data sources.  This method blocks until every search has
+        /// finished, timed out or been canceled.
+        /// </summary>
+        /// <param name="dataSources">The data sources to search.</param>
+        /// <param name="newPixelSearch">The pixel search to run on each data source.</param>
+        /// <param name="callback">An optional callback to pass the result of each search to as it finishes.</param>
+        /// <returns>A <c>List</c> of matches from all data sources, ordered by start time.</returns>
+        System::Collections::Generic::List<PixelSearchMatch^>^ Run(System::Collections::Generic::IEnumerable<DataSource^>^ dataSources,
+            NewPixelSearch^ newPixelSearch, ResultDelegate^ callback);
+
+        /// <summary>
+        /// Runs a pixel search on each of the given data sources, allowing a different search (for example, different
+        /// zones) per data source.  This method blocks until every search has finished, timed out or been canceled.
+        /// </summary>
+        /// <param name="searches">The data sources to search and the pixel search to run on each.</param>
+        /// <param name="callback">An optional callback to pass the result of each search to as it finishes.</param>
+        /// <returns>A <c>List</c> of matches from all data sources, ordered by start time.</returns>
+        System::Collections::Generic::List<PixelSearchMatch^>^ Run(
+            System::Collections::Generic::IEnumerable<System::Collections::Generic::KeyValuePair<DataSource^, NewPixelSearch^>>^ searches,
+            ResultDelegate^ callback);
+
+        /// <summary>
+        /// Gets the number of exceptions thrown by the callback passed to <c>Run</c>.  They are caught so that the
+        /// remaining searches still run.
+        /// </summary>
+        /// <value>The number of callback exceptions.</value>
+        property int CallbackErrors {
+        public:
+            int get() { return _callbackErrors; }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of searches that may run at once.  Defaults to 4.
+        /// </summary>
+        /// <value>The maximum number of concurrent searches.</value>
+        property int MaxConcurrentSearches;
+
+        /// <summary>
+        /// Gets or sets the longest amount of time, in milliseconds, between checks on the status of a search.
+        /// Defaults to 5000.
+        /// </summary>
+        /// <value>The maximum poll interval in milliseconds.</value>
+        property int MaxPollInterval;
+
+        /// <summary>
+        /// Gets or sets the amount of time, in milliseconds, before the first check on the status of a search; the
+        /// interval doubles after each check up to <see cref="MaxPollInterval"/>.  Defaults to 250.
+        /// </summary>
+        /// <value>The minimum poll interval in milliseconds.</value>
+        property int MinPollInterval;
+
+        /// <summary>
+        /// Gets the results of the most recent run, in the order the searches finished.
+        /// </summary>
+        /// <value>A <c>List</c> of search results.</value>
+        property System::Collections::Generic::List<PixelSearchResult^>^ SearchResults {
+        public:
+            System::Collections::Generic::List<PixelSearchResult^>^ get() { return _results; }
+        }
+
+        /// <summary>
+        /// Gets or sets the longest amount of time, in milliseconds, that a single search may run.  Defaults to 300000.
+        /// </summary>
+        /// <value>The search timeout in milliseconds.</value>
+        property int Timeout;
+
+    internal:
+        volatile bool _isCanceled;
+        int _callbackErrors;
+        System::Collections::Generic::List<PixelSearchResult^>^ _results;
+        static int _CompareMatches(PixelSearchMatch^ left, PixelSearchMatch^ right);
+        void _RunSearches(System::Object^ state);
+        PixelSearchResult^ _Search(DataSource^ dataSource, NewPixelSearch^ newPixelSearch);
+    };
+
+    /// <summary>
+    /// The state shared by the workers of a <see cref="MultiPixelSearch::Run"/> call.
+    /// </summary>
+    private ref class MultiPixelSearchJob {
+    public:
+        System::Collections::Concurrent::ConcurrentQueue<System::Collections::Generic::KeyValuePair<DataSource^, NewPixelSearch^>>^ Searches;
+        System::Threading::CountdownEvent^ Workers;
+        MultiPixelSearch::ResultDelegate^ Callback;
+        System::Collections::Generic::List<PixelSearchResult^>^ Results;
+    };
+}
+#endif // MultiPixelSearch_h__
@@ -0,0 +1,83 @@
+// Declares the native memory class.
+#ifndef NativeMemory_h__
+#define NativeMemory_h__
+
+#include <typeinfo>
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The NativeMemory class accounts for the native objects held by wrappers.  The garbage collector cannot see the
+    /// memory held by a native object, so the estimated size of each one is reported to it as memory pressure while its
+    /// wrapper is alive, and removed when the native object is deleted.  The number of live native objects of each type
+    /// is counted to help find leaks.
+    /// </summary>
+    public ref class NativeMemory abstract sealed {
+    public:
+
+        /// <summary>
+        /// Gets the number of live native objects of each type.
+        /// </summary>
+        /// <returns>A <c>Dictionary</c> of native type names and the number of live objects of that type.</returns>
+        static System::Collections::Generic::Dictionary<System::String^, long long>^ GetLiveCounts();
+
+        /// <summary>
+        /// Gets the estimated number of bytes held by live native objects.
+        /// </summary>
+        /// <value>The estimated native memory in bytes.</value>
+        static property long long LiveBytes {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_liveBytes); }
+        }
+
+        /// <summary>
+        /// Gets the number of live native objects.
+        /// </summary>
+        /// <value>The number of live native objects.</value>
+        static property long long LiveCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_liveCount); }
+        }
+
+    internal:
+        static const int MaxTypes = 256;
+        static const long long PressureThreshold = 64 * 1024;
+        static array<long long>^ _liveCounts = gcnew array<long long>(MaxTypes);
+        static array<System::String^>^ _typeNames = gcnew array<System::String^>(MaxTypes);
+        static int _typeCount;
+        static long long _liveBytes;
+        static long long _liveCount;
+        static long long _unreportedPressure;
+
+        /// <summary>
+        /// Accounts for a native object taken by a wrapper.
+        /// </summary>
+        /// <param name="handle">The native object.</param>
+        template<typename T>
+        static void Add(T* handle) {
+            if (handle != nullptr)
+                _Add(_GetTypeIndex<T>(), sizeof(T));
+        }
+
+        /// <summary>
+        /// Accounts for a native object that is about to be deleted.
+        /// </summary>
+        /// <param name="handle">The native object.</param>
+        template<typename T>
+        static void Remove(T* handle) {
+            if (handle != nullptr)
+                _Add(_GetTypeIndex<T>(), -static_cast<long long>(sizeof(T)));
+        }
+
+        template<typename T>
+        static int _GetTypeIndex() {
+            // Each native type is registered once, the first time an object of that type is seen
+            static int typeIndex = _RegisterType(typeid(T).name());
+            return typeIndex;
+        }
+
+        static void _Add(int typeIndex, long long size);
+        static int _RegisterType(const char* typeName);
+    };
+}
+#endif // NativeMemory_h__
@@ -0,0 +1,146 @@
+// Declares the native release queue class.
+#ifndef NativeReleaseQueue_h__
+#define NativeReleaseQueue_h__
+
+#include "NativeMemory.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// A function that deletes a native object.
+    /// </summary>
+    typedef void (*NativeDeleter)(void* handle);
+
+    /// <summary>
+    /// Deletes a native object of the given type.
+    /// </summary>
+    /// <param name="handle">The native object to delete.</param>
+    template<typename T>
+    void DeleteNative(void* handle) {
+        NativeMemory::Remove(static_cast<T*>(handle));
+        static_cast<T*>(handle)->Delete();
+    }
+
+    /// <summary>
+    /// A native object waiting to be deleted by the <see cref="NativeReleaseQueue"/>.
+    /// </summary>
+    private value class NativeHandle {
+    public:
+        System::IntPtr Handle;
+        System::IntPtr Deleter;
+        long long QueuedAt;
+    };
+
+    /// <summary>
+    /// The NativeReleaseQueue class deletes the native objects of finalized wrappers in batches on a dedicated
+    /// thread, so that the finalizer thread only has to queue them.  Wrappers that are disposed delete their native
+    /// objects straight away and are never finalized.
+    /// </summary>
+    public ref class NativeReleaseQueue abstract sealed {
+    public:
+
+        /// <summary>
+        /// Deletes every queued native object before returning.
+        /// </summary>
+        static void Flush();
+
+        /// <summary>
+        /// Gets the average time native objects waited in the queue before being deleted.
+        /// </summary>
+        /// <value>The average release latency.</value>
+        static property System::TimeSpan AverageReleaseLatency {
+        public:
+            System::TimeSpan get();
+        }
+
+        /// <summary>
+        /// Gets or sets the largest number of native objects deleted in a single batch.  Defaults to 1024.
+        /// </summary>
+        /// <value>The maximum batch size.</value>
+        static property int BatchSize {
+        public:
+            int get() { return _batchSize; }
+            void set(int value) { _batchSize = System::Math::Max(value, 1); }
+        }
+
+        /// <summary>
+        /// Gets or sets the longest amount of time, in milliseconds, a native object may wait in the queue before its
+        /// batch is deleted.  Defaults to 100.
+        /// </summary>
+        /// <value>The flush interval in milliseconds.</value>
+        static property int FlushInterval {
+        public:
+            int get() { return _flushInterval; }
+            void set(int value) { _flushInterval = System::Math::Max(value, 1); }
+        }
+
+        /// <summary>
+        /// Gets the longest time a native object has waited in the queue before being deleted.
+        /// </summary>
+        /// <value>The maximum release latency.</value>
+        static property System::TimeSpan MaxReleaseLatency {
+        public:
+            System::TimeSpan get();
+        }
+
+        /// <summary>
+        /// Gets the number of native objects of finalized wrappers waiting to be deleted.
+        /// </summary>
+        /// <value>The number of queued native objects.</value>
+        static property int PendingCount {
+        public:
+            int get() { return _handles->Count; }
+        }
+
+        /// <summary>
+        /// Gets the total number of native objects deleted by the queue.
+        /// </summary>
+        /// <value>The number of released native objects.</value>
+        static property long long ReleasedCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_releasedCount); }
+        }
+
+    internal:
+        static int _batchSize = 1024;
+        static int _flushInterval = 100;
+        static System::Collections::Concurrent::ConcurrentQueue<NativeHandle>^ _handles =
+            gcnew System::Collections::Concurrent::ConcurrentQueue<NativeHandle>();
+        static System::Threading::AutoResetEvent^ _wake = gcnew System::Threading::AutoResetEvent(false);
+        static System::Threading::Thread^ _releaser;
+        static long long _releasedCount;
+        static long long _totalLatency;
+        static long long _maxLatency;
+
+        /// <summary>
+        /// Queues a native object to be deleted.  Called from wrapper finalizers, so it only queues the object and
+        /// wakes the release thread once a full batch is waiting.
+        /// </summary>
+        /// <param name="handle">The native object to delete.</param>
+        template<typename T>
+        static void Release(T* handle) {
+            if (handle == nullptr)
+                return;
+
+            NativeHandle nativeHandle;
+            nativeHandle.Handle = System::IntPtr(static_cast<void*>(handle));
+            nativeHandle.Deleter = System::IntPtr(reinterpret_cast<void*>(static_cast<NativeDeleter>(&DeleteNative<T>)));
+            nativeHandle.QueuedAt = System::Diagnostics::Stopwatch::GetTimestamp();
+            _Queue(nativeHandle);
+        }
+
+        static void _Queue(NativeHandle nativeHandle);
+        static int _ReleaseBatch();
+        static void _RunReleaser();
+
+    private:
+        static NativeReleaseQueue() {
+            // The release thread must not keep the process alive
+            _releaser = gcnew System::Threading::Thread(gcnew System::Threading::ThreadStart(&NativeReleaseQueue::_RunReleaser));
+            _releaser->IsBackground = true;
+            _releaser->Name = "VxSdk native release";
+            _releaser->Start();
+        }
+    };
+}
+#endif // NativeReleaseQueue_h__
@@ -25,7 +25,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Notification() {
-            this->!Notification();
+            NativeMemory::Remove(_notification);
+            _notification->Delete();
+            _notification = nullptr;
         }
 
         /// <summary>
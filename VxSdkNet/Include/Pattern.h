@@ -24,7 +24,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Pattern() {
-            this->!Pattern();
+            NativeMemory::Remove(_pattern);
+            _pattern->Delete();
+            _pattern = nullptr;
         }
 
         /// <summary>
@@ -36,7 +36,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~PixelSearch() {
-            this->!PixelSearch();
+            NativeMemory::Remove(_pixelSearch);
+            _pixelSearch->Delete();
+            _pixelSearch = nullptr;
         }
 
         /// <summary>
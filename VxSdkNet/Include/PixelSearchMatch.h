@@ -0,0 +1,49 @@
+// Declares the pixel search match class.
+#ifndef PixelSearchMatch_h__
+#define PixelSearchMatch_h__
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The PixelSearchMatch class represents a span of time in which a pixel search found a match on a data source.
+    /// Overlapping clips of the same data source are merged into a single match.
+    /// </summary>
+    public ref class PixelSearchMatch {
+    public:
+
+        /// <summary>
+        /// Gets the unique identifier of the data source the match was found on.
+        /// </summary>
+        /// <value>The unique identifier of the data source.</value>
+        property System::String^ DataSourceId {
+        public:
+            System::String^ get() { return _dataSourceId; }
+        }
+
+        /// <summary>
+        /// Gets the end time of the match.
+        /// </summary>
+        /// <value>The end time.</value>
+        property System::DateTime EndTime {
+        public:
+            System::DateTime get() { return _endTime; }
+        }
+
+        /// <summary>
+        /// Gets the start time of the match.
+        /// </summary>
+        /// <value>The start time.</value>
+        property System::DateTime StartTime {
+        public:
+            System::DateTime get() { return _startTime; }
+        }
+
+    internal:
+        PixelSearchMatch(System::String^ dataSourceId, System::DateTime startTime, System::DateTime endTime) :
+            _dataSourceId(dataSourceId), _startTime(startTime), _endTime(endTime) {}
+        System::String^ _dataSourceId;
+        System::DateTime _startTime;
+        System::DateTime _endTime;
+    };
+}
+#endif // PixelSearchMatch_h__
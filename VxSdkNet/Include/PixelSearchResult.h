@@ -0,0 +1,90 @@
+// Declares the pixel search result class.
+#ifndef PixelSearchResult_h__
+#define PixelSearchResult_h__
+
+#include "CoverageIndex.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The PixelSearchResult class represents the outcome of the pixel search of a single data source run by a
+    /// <see cref="MultiPixelSearch"/>.
+    /// </summary>
+    public ref class PixelSearchResult {
+    public:
+
+        /// <summary>
+        /// Values that represent the outcome of a pixel search.
+        /// </summary>
+        enum class States {
+            /// <summary>The search completed.</summary>
+            Complete,
+
+            /// <summary>The search could not be created.</summary>
+            Failed,
+
+            /// <summary>The search did not complete in time; any clips found so far are included.</summary>
+            TimedOut,
+
+            /// <summary>The search was canceled; any clips found so far are included.</summary>
+            Canceled
+        };
+
+        /// <summary>
+        /// Gets the clips found by the search.
+        /// </summary>
+        /// <value>A <c>List</c> of clips found.</value>
+        property System::Collections::Generic::List<Clip^>^ Clips {
+        public:
+            System::Collections::Generic::List<Clip^>^ get() { return _clips; }
+        }
+
+        /// <summary>
+        /// Gets the merged spans of time covered by the clips found by the search.
+        /// </summary>
+        /// <value>The coverage of the clips found.</value>
+        property CoverageIndex^ Coverage {
+        public:
+            CoverageIndex^ get() { return _coverage; }
+        }
+
+        /// <summary>
+        /// Gets the data source that was searched.
+        /// </summary>
+        /// <value>The data source.</value>
+        property VxSdkNet::DataSource^ DataSource {
+        public:
+            VxSdkNet::DataSource^ get() { return _dataSource; }
+        }
+
+        /// <summary>
+        /// Gets the amount of time the search took.
+        /// </summary>
+        /// <value>The search duration.</value>
+        property System::TimeSpan Duration {
+        public:
+            System::TimeSpan get() { return _duration; }
+        }
+
+        /// <summary>
+        /// Gets the outcome of the search.
+        /// </summary>
+        /// <value>The search outcome.</value>
+        property States Status {
+        public:
+            States get() { return _status; }
+        }
+
+    internal:
+        PixelSearchResult(VxSdkNet::DataSource^ dataSource) : _dataSource(dataSource), _status(States::Failed) {
+            _clips = gcnew System::Collections::Generic::List<Clip^>();
+            _coverage = gcnew CoverageIndex(dataSource->Id);
+        }
+        VxSdkNet::DataSource^ _dataSource;
+        States _status;
+        System::Collections::Generic::List<Clip^>^ _clips;
+        CoverageIndex^ _coverage;
+        System::TimeSpan _duration;
+    };
+}
+#endif // PixelSearchResult_h__
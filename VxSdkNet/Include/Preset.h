@@ -23,7 +23,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Preset() {
-            this->!Preset();
+            NativeMemory::Remove(_preset);
+            _preset->Delete();
+            _preset = nullptr;
         }
 
         /// <summary>
@@ -6,8 +6,10 @@
 #include "Utils.h"
 #include "Device.h"
 #include "Drawing.h"
+#include "BulkLink.h"
 
 namespace VxSdkNet {
+    ref class Role;
     ref class User;
 
     /// <summary>
@@ -248,7 +250,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Privilege() {
-            this->!Privilege();
+            NativeMemory::Remove(_privilege);
+            _privilege->Delete();
+            _privilege = nullptr;
         }
 
         /// <summary>
@@ -377,6 +381,51 @@ namespace VxSdkNet {
         /// <returns>The <see cref="Results::Value">Result</see> of updating the properties.</returns>
         Results::Value Refresh();
 
+        /// <summary>
+        /// Links and unlinks data sources so that exactly the given data sources are linked to this privilege.  Only the data sources
+        /// whose link needs to change are sent, and <c>nullptr</c> entries are ignored (see <see cref="BulkLink"/>).  If the current
+        /// links cannot be read, nothing is changed and each given entry reports the result of the read.
+        /// </summary>
+        /// <param name="dataSources">A <c>List</c> containing the data sources that should be linked.</param>
+        /// <returns>The <see cref="Results::Value">Result</see> of each link or unlink made, keyed by data source unique identifier.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ SetLinkedDataSources(System::Collections::Generic::List<DataSource^>^ dataSources);
+
+        /// <summary>
+        /// Links and unlinks devices so that exactly the given devices are linked to this privilege.  Only the devices
+        /// whose link needs to change are sent, and <c>nullptr</c> entries are ignored (see <see cref="BulkLink"/>).  If the current
+        /// links cannot be read, nothing is changed and each given entry reports the result of the read.
+        /// </summary>
+        /// <param name="devices">A <c>List</c> containing the devices that should be linked.</param>
+        /// <returns>The <see cref="Results::Value">Result</see> of each link or unlink made, keyed by device unique identifier.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ SetLinkedDevices(System::Collections::Generic::List<Device^>^ devices);
+
+        /// <summary>
+        /// Links and unlinks drawings so that exactly the given drawings are linked to this privilege.  Only the drawings
+        /// whose link needs to change are sent, and <c>nullptr</c> entries are ignored (see <see cref="BulkLink"/>).  If the current
+        /// links cannot be read, nothing is changed and each given entry reports the result of the read.
+        /// </summary>
+        /// <param name="drawings">A <c>List</c> containing the drawings that should be linked.</param>
+        /// <returns>The <see cref="Results::Value">Result</see> of each link or unlink made, keyed by drawing unique identifier.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ SetLinkedDrawings(System::Collections::Generic::List<Drawing^>^ drawings);
+
+        /// <summary>
+        /// Links and unlinks relay outputs so that exactly the given relay outputs are linked to this privilege.  Only the relay outputs
+        /// whose link needs to change are sent, and <c>nullptr</c> entries are ignored (see <see cref="BulkLink"/>).  If the current
+        /// links cannot be read, nothing is changed and each given entry reports the result of the read.
+        /// </summary>
+        /// <param name="relayOutputs">A <c>List</c> containing the relay outputs that should be linked.</param>
+        /// <returns>The <see cref="Results::Value">Result</see> of each link or unlink made, keyed by relay output unique identifier.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ SetLinkedRelayOutputs(System::Collections::Generic::List<RelayOutput^>^ relayOutputs);
+
+        /// <summary>
+        /// Links and unlinks users so that exactly the given users are linked to this privilege.  Only the users
+        /// whose link needs to change are sent, and <c>nullptr</c> entries are ignored (see <see cref="BulkLink"/>).  If the current
+        /// links cannot be read, nothing is changed and each given entry reports the result of the read.
+        /// </summary>
+        /// <param name="users">A <c>List</c> containing the users that should be linked.</param>
+        /// <returns>The <see cref="Results::Value">Result</see> of each link or unlink made, keyed by user unique identifier.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ SetLinkedUsers(System::Collections::Generic::List<User^>^ users);
+
         /// <summary>
         /// Remove data source associations from this privilege.
         /// </summary>
@@ -571,9 +620,22 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxPrivilege* _privilege;
+        IdentityMap^ _identityMap;
+        Role^ _role;
+        System::Object^ _Fetch();
         VxSdkNet::ResourceLimits^ _GetLimits();
+        System::Collections::Generic::List<DataSource^>^ _GetLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result);
+        System::Collections::Generic::List<Device^>^ _GetLinkedDevices(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result);
+        System::Collections::Generic::List<Drawing^>^ _GetLinkedDrawings(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result);
+        System::Collections::Generic::List<RelayOutput^>^ _GetLinkedRelayOutputs(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result);
+        System::Collections::Generic::List<User^>^ _GetLinkedUsers(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result);
         int _GetPriority();
         bool _GetRestricted();
+        Results::Value _LinkDataSource(System::Object^ item, bool link);
+        Results::Value _LinkDevice(System::Object^ item, bool link);
+        Results::Value _LinkDrawing(System::Object^ item, bool link);
+        Results::Value _LinkRelayOutput(System::Object^ item, bool link);
+        Results::Value _LinkUser(System::Object^ item, bool link);
     };
 }
 #endif // Privilege_h__
@@ -0,0 +1,193 @@
+// Declares the ptz command queue class.
+#ifndef PtzCommandQueue_h__
+#define PtzCommandQueue_h__
+
+#include "PtzController.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// A continuous PTZ command waiting to be sent by a <see cref="PtzCommandQueue"/>.
+    /// </summary>
+    private ref class PtzCommand {
+    public:
+        enum class Kinds {
+            Move,
+            MoveAtSpeed,
+            Focus,
+            FocusAtSpeed,
+            Iris,
+            IrisAtSpeed,
+            Stop
+        };
+
+        PtzCommand(Kinds kind, int x, int y, int z);
+        Kinds Kind;
+        int X;
+        int Y;
+        int Z;
+        long long QueuedAt;
+    };
+
+    /// <summary>
+    /// The PtzCommandQueue class sends continuous PTZ commands to a <see cref="PtzController"/> from its own thread,
+    /// so that the caller never waits on the camera.  It is intended for joystick and mouse-drag control, where new
+    /// commands arrive faster than a camera can accept them.  Move, focus and iris commands that have not yet been
+    /// sent are replaced by newer commands of the same kind, a stop is sent ahead of anything else, and commands are
+    /// sent no more often than <see cref="MinSendInterval"/> allows.
+    /// </summary>
+    public ref class PtzCommandQueue {
+    public:
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="ptzController">The PTZ controller to send the commands to.</param>
+        PtzCommandQueue(PtzController^ ptzController);
+
+        /// <summary>
+        /// Destructor.
+        /// </summary>
+        virtual ~PtzCommandQueue() {
+            this->!PtzCommandQueue();
+        }
+
+        /// <summary>
+        /// Finaliser.
+        /// </summary>
+        !PtzCommandQueue();
+
+        /// <summary>
+        /// Queues a continuous focus in the given direction, replacing any focus command not yet sent.
+        /// </summary>
+        /// <param name="focusDirection">The direction to focus.</param>
+        void ContinuousFocus(PtzController::FocusDirections focusDirection);
+
+        /// <summary>
+        /// Queues a continuous focus at the given speed, replacing any focus command not yet sent.
+        /// </summary>
+        /// <param name="focusSpeed">Focus speed. Negative values focus near, positive values focus far.</param>
+        void ContinuousFocusAtSpeed(int focusSpeed);
+
+        /// <summary>
+        /// Queues a continuous iris change in the given direction, replacing any iris command not yet sent.
+        /// </summary>
+        /// <param name="irisDirection">The direction to change the iris.</param>
+        void ContinuousIris(PtzController::IrisDirections irisDirection);
+
+        /// <summary>
+        /// Queues a continuous iris change at the given speed, replacing any iris command not yet sent.
+        /// </summary>
+        /// <param name="irisSpeed">Iris speed. Negative values close the iris, positive values open the iris.</param>
+        void ContinuousIrisAtSpeed(int irisSpeed);
+
+        /// <summary>
+        /// Queues a continuous move, replacing any move command not yet sent.
+        /// </summary>
+        /// <param name="speedX">Pan speed. Negative values pan left, positive values pan right.</param>
+        /// <param name="speedY">Tilt speed. Negative values tilt downward, positive values tilt upward.</param>
+        /// <param name="inOut">The direction to zoom.</param>
+        void ContinuousMove(int speedX, int speedY, PtzController::ZoomDirections inOut);
+
+        /// <summary>
+        /// Queues a continuous move at the given speeds, replacing any move command not yet sent.
+        /// </summary>
+        /// <param name="speedX">Pan speed. Negative values pan left, positive values pan right.</param>
+        /// <param name="speedY">Tilt speed. Negative values tilt downward, positive values tilt upward.</param>
+        /// <param name="speedZ">Zoom speed. Negative values zoom out, positive values zoom in.</param>
+        void ContinuousMoveAtSpeed(int speedX, int speedY, int speedZ);
+
+        /// <summary>
+        /// Queues a stop.  Any move, focus and iris commands not yet sent are discarded, and the stop is sent as soon
+        /// as the command in progress, if any, returns.
+        /// </summary>
+        void Stop();
+
+        /// <summary>
+        /// Waits until every queued command has been sent.
+        /// </summary>
+        /// <param name="timeout">The maximum amount of time to wait.</param>
+        /// <returns><c>true</c> if every command was sent, <c>false</c> if the timeout elapsed first.</returns>
+        bool WaitAll(System::TimeSpan timeout);
+
+        /// <summary>
+        /// Gets the average time between a command being queued and it being sent.
+        /// </summary>
+        /// <value>The average command latency.</value>
+        property System::TimeSpan AverageLatency {
+        public:
+            System::TimeSpan get();
+        }
+
+        /// <summary>
+        /// Gets the PTZ controller the commands are sent to.
+        /// </summary>
+        /// <value>The PTZ controller.</value>
+        property PtzController^ Controller {
+        public:
+            PtzController^ get() { return _ptzController; }
+        }
+
+        /// <summary>
+        /// Gets the number of commands that were replaced by a newer command or discarded by a stop before being sent.
+        /// </summary>
+        /// <value>The number of dropped commands.</value>
+        property long long DroppedCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_droppedCount); }
+        }
+
+        /// <summary>
+        /// Gets the result of the most recently sent command.
+        /// </summary>
+        /// <value>The <see cref="Results::Value">Result</see> of the last command.</value>
+        property Results::Value LastResult {
+        public:
+            Results::Value get() { return _lastResult; }
+        }
+
+        /// <summary>
+        /// Gets the longest time between a command being queued and it being sent.
+        /// </summary>
+        /// <value>The maximum command latency.</value>
+        property System::TimeSpan MaxLatency {
+        public:
+            System::TimeSpan get();
+        }
+
+        /// <summary>
+        /// Gets or sets the minimum time, in milliseconds, between the start of one move, focus or iris command and the
+        /// start of the next.  Stops are not delayed.  Defaults to 50.
+        /// </summary>
+        /// <value>The minimum send interval.</value>
+        property int MinSendInterval;
+
+        /// <summary>
+        /// Gets the number of commands sent to the camera.
+        /// </summary>
+        /// <value>The number of sent commands.</value>
+        property long long SentCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_sentCount); }
+        }
+
+    internal:
+        PtzController^ _ptzController;
+        array<PtzCommand^>^ _pending;
+        PtzCommand^ _stop;
+        System::Threading::Thread^ _dispatcher;
+        System::Threading::AutoResetEvent^ _wake;
+        System::Threading::ManualResetEvent^ _idle;
+        bool _isDisposed;
+        long long _lastSentAt;
+        long long _droppedCount;
+        long long _sentCount;
+        long long _totalLatency;
+        long long _maxLatency;
+        Results::Value _lastResult;
+        void _Dispatch();
+        void _Enqueue(PtzCommand^ command);
+        Results::Value _Send(PtzCommand^ command);
+    };
+}
+#endif // PtzCommandQueue_h__
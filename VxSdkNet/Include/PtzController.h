@@ -74,7 +74,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~PtzController() {
-            this->!PtzController();
+            NativeMemory::Remove(_ptzController);
+            _ptzController->Delete();
+            _ptzController = nullptr;
         }
 
         /// <summary>
@@ -24,7 +24,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~PtzLock() {
-            this->!PtzLock();
+            NativeMemory::Remove(_ptzLock);
+            _ptzLock->Delete();
+            _ptzLock = nullptr;
         }
 
         /// <summary>
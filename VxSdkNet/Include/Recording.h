@@ -67,7 +67,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Recording() {
-            this->!Recording();
+            NativeMemory::Remove(_recording);
+            _recording->Delete();
+            _recording = nullptr;
         }
 
         /// <summary>
@@ -211,6 +213,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxRecording* _recording;
+        IdentityMap^ _identityMap;
         VxSdkNet::DataSource^ _GetDataSource();
     };
 }
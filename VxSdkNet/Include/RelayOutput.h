@@ -38,7 +38,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~RelayOutput() {
-            this->!RelayOutput();
+            NativeMemory::Remove(_relayOutput);
+            _relayOutput->Delete();
+            _relayOutput = nullptr;
         }
 
         /// <summary>
@@ -137,6 +139,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxRelayOutput* _relayOutput;
+        IdentityMap^ _identityMap;
         VxSdkNet::Device^ _GetHostDevice();
         VxSdkNet::ResourceLimits^ _GetLimits();
         void _SetRelayState(RelayStates state);
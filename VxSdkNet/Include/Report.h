@@ -64,7 +64,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Report() {
-            this->!Report();
+            NativeMemory::Remove(_report);
+            _report->Delete();
+            _report = nullptr;
         }
 
         /// <summary>
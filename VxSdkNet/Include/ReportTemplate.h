@@ -30,7 +30,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~ReportTemplate() {
-            this->!ReportTemplate();
+            NativeMemory::Remove(_reportTemplate);
+            _reportTemplate->Delete();
+            _reportTemplate = nullptr;
         }
 
         /// <summary>
@@ -5,6 +5,7 @@
 #include "VxSdk.h"
 #include "DataSource.h"
 #include "Utils.h"
+#include "NativeReleaseQueue.h"
 
 namespace VxSdkNet {
 
@@ -21,20 +22,23 @@ namespace VxSdkNet {
         /// <param name="vxResourceLock">The vx resource lock.</param>
         ResourceLock(VxSdk::IVxResourceLock* vxResourceLock) {
             _resourceLock = vxResourceLock;
+            NativeMemory::Add(_resourceLock);
         }
 
         /// <summary>
         /// Destructor.
         /// </summary>
         virtual ~ResourceLock() {
-            this->!ResourceLock();
+            NativeMemory::Remove(_resourceLock);
+            _resourceLock->Delete();
+            _resourceLock = nullptr;
         }
 
         /// <summary>
         /// Finaliser.
         /// </summary>
         !ResourceLock() {
-            _resourceLock->Delete();
+            NativeReleaseQueue::Release(_resourceLock);
             _resourceLock = nullptr;
         }
 
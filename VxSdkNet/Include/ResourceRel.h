@@ -25,7 +25,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~ResourceRel() {
-            this->!ResourceRel();
+            NativeMemory::Remove(_resourceRel);
+            _resourceRel->Delete();
+            _resourceRel = nullptr;
         }
 
         /// <summary>
@@ -59,6 +61,7 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxResourceRel* _resourceRel;
+        IdentityMap^ _identityMap;
         DataSource^ _GetResource();
     };
 }
@@ -0,0 +1,112 @@
+// Declares the retention scanner class.
+#ifndef RetentionScanner_h__
+#define RetentionScanner_h__
+
+#include "RetentionSummary.h"
+#include "VXSystem.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The RetentionScanner class checks the recording health of every data source on a VideoXpert system.  The
+    /// retentions of each data storage and the gaps of each data source are read with a limit on how many data sources
+    /// are scanned at once, and are reduced to a small <see cref="RetentionSummary"/> per data source as they are read.
+    /// After the first scan, later scans may revisit only the data sources that have changed since the previous one.
+    /// </summary>
+    public ref class RetentionScanner {
+    public:
+
+        /// <summary>
+        /// The summary callback delegate.
+        /// </summary>
+        /// <param name="summary">The summary of a data source that has been scanned.</param>
+        delegate void SummaryDelegate(RetentionSummary^ summary);
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="system">The system to scan.</param>
+        RetentionScanner(VXSystem^ system);
+
+        /// <summary>
+        /// Removes all summaries, so that the next scan is a full scan.
+        /// </summary>
+        void Clear();
+
+        /// <summary>
+        /// Gets the summary of a data source.
+        /// </summary>
+        /// <param name="dataSourceId">The unique identifier of the data source.</param>
+        /// <returns>The summary, or <c>nullptr</c> if the data source has not been scanned.</returns>
+        RetentionSummary^ GetSummary(System::String^ dataSourceId);
+
+        /// <summary>
+        /// Scans the system.  The oldest recordings of every data source are always refreshed, since they are read
+        /// per data storage.  A full scan reads the gaps of every data source and drops the summaries of data sources
+        /// that no longer exist; an incremental scan reads the gaps of only the data sources modified since the
+        /// previous scan.  Gaps can change without their data source being modified, so full scans should still be
+        /// run from time to time.  This method blocks until the scan is complete.
+        /// </summary>
+        /// <param name="incremental">Whether to scan only the data sources modified since the previous scan.</param>
+        /// <param name="callback">An optional callback to pass each summary to as it is produced.</param>
+        /// <returns>The number of data sources whose gaps were scanned.</returns>
+        int Scan(bool incremental, SummaryDelegate^ callback);
+
+        /// <summary>
+        /// Gets the number of exceptions thrown by the callbacks passed to <see cref="Scan"/>.  They are caught so that
+        /// the remaining data sources are still scanned.
+        /// </summary>
+        /// <value>The number of callback exceptions.</value>
+        property int CallbackErrors {
+        public:
+            int get() { return _callbackErrors; }
+        }
+
+        /// <summary>
+        /// Gets the time the most recent scan started.
+        /// </summary>
+        /// <value>The time of the last scan, or <c>DateTime.MinValue</c> if there has been none.</value>
+        property System::DateTime LastScanned {
+        public:
+            System::DateTime get() { return _lastScanned; }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of data sources that may be scanned at once.  Defaults to 8.
+        /// </summary>
+        /// <value>The maximum number of concurrent scans.</value>
+        property int MaxConcurrentScans;
+
+        /// <summary>
+        /// Gets the summaries of all data sources that have been scanned.
+        /// </summary>
+        /// <value>A <c>List</c> of summaries.</value>
+        property System::Collections::Generic::List<RetentionSummary^>^ Summaries {
+        public:
+            System::Collections::Generic::List<RetentionSummary^>^ get();
+        }
+
+    internal:
+        VXSystem^ _system;
+        int _callbackErrors;
+        System::DateTime _lastScanned;
+        System::Collections::Generic::Dictionary<System::String^, System::DateTime>^ _oldestRecordings;
+        System::Collections::Generic::Dictionary<System::String^, RetentionSummary^>^ _summaries;
+        System::Collections::Generic::Dictionary<System::String^, System::DateTime>^ _GetOldestRecordings();
+        void _RunScans(System::Object^ state);
+        RetentionSummary^ _Scan(DataSource^ dataSource, System::DateTime scanTime);
+    };
+
+    /// <summary>
+    /// The state shared by the workers of a <see cref="RetentionScanner::Scan"/> call.
+    /// </summary>
+    private ref class RetentionScanJob {
+    public:
+        System::Collections::Concurrent::ConcurrentQueue<DataSource^>^ DataSources;
+        System::Threading::CountdownEvent^ Workers;
+        RetentionScanner::SummaryDelegate^ Callback;
+        System::DateTime ScanTime;
+        bool IsShared;
+    };
+}
+#endif // RetentionScanner_h__
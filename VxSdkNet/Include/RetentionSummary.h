@@ -0,0 +1,126 @@
+// Declares the retention summary class.
+#ifndef RetentionSummary_h__
+#define RetentionSummary_h__
+
+#include "Gap.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The RetentionSummary class represents the recording health of a single data source, as produced by a
+    /// <see cref="RetentionScanner"/>.  Only totals are kept so that the summaries of a large system remain small.
+    /// </summary>
+    public ref class RetentionSummary {
+    public:
+
+        /// <summary>
+        /// Gets the total amount of time lost to gaps with the given reason.  A gap present on more than one data
+        /// storage is counted once per data storage.
+        /// </summary>
+        /// <param name="reason">The gap reason.</param>
+        /// <returns>The total gap time for the reason.</returns>
+        System::TimeSpan GetGapTime(Gap::GapReasons reason) {
+            int index = static_cast<int>(reason);
+            return index >= 0 && index < _gapTimeByReason->Length ? System::TimeSpan(_gapTimeByReason[index]) : System::TimeSpan::Zero;
+        }
+
+        /// <summary>
+        /// Gets the unique identifier of the data source.
+        /// </summary>
+        /// <value>The unique identifier of the data source.</value>
+        property System::String^ DataSourceId {
+        public:
+            System::String^ get() { return _dataSourceId; }
+        }
+
+        /// <summary>
+        /// Gets the name of the data source.
+        /// </summary>
+        /// <value>The name of the data source.</value>
+        property System::String^ DataSourceName {
+        public:
+            System::String^ get() { return _dataSourceName; }
+        }
+
+        /// <summary>
+        /// Gets the number of gaps whose filling failed.
+        /// </summary>
+        /// <value>The number of failed gap fills.</value>
+        property int FailedGapFillCount {
+        public:
+            int get() { return _failedGapFillCount; }
+        }
+
+        /// <summary>
+        /// Gets the number of gaps reported for the data source.
+        /// </summary>
+        /// <value>The number of gaps.</value>
+        property int GapCount {
+        public:
+            int get() { return _gapCount; }
+        }
+
+        /// <summary>
+        /// Gets the time the gaps of the data source were last scanned.
+        /// </summary>
+        /// <value>The time of the last gap scan.</value>
+        property System::DateTime LastScanned {
+        public:
+            System::DateTime get() { return _lastScanned; }
+        }
+
+        /// <summary>
+        /// Gets the time of the oldest recording of the data source on any data storage.
+        /// </summary>
+        /// <value>The oldest recording time, or <c>DateTime.MinValue</c> if there is no recording.</value>
+        property System::DateTime OldestRecording {
+        public:
+            System::DateTime get() { return _oldestRecording; }
+        }
+
+        /// <summary>
+        /// Gets the number of gaps that are waiting to be filled.
+        /// </summary>
+        /// <value>The number of pending gap fills.</value>
+        property int PendingGapFillCount {
+        public:
+            int get() { return _pendingGapFillCount; }
+        }
+
+        /// <summary>
+        /// Gets the total amount of time in gaps that are waiting to be filled.
+        /// </summary>
+        /// <value>The pending gap fill time.</value>
+        property System::TimeSpan PendingGapFillTime {
+        public:
+            System::TimeSpan get() { return System::TimeSpan(_pendingGapFillTime); }
+        }
+
+        /// <summary>
+        /// Gets the total amount of time covered by gaps, with gaps that overlap (such as the same gap on more than one
+        /// data storage) counted once.
+        /// </summary>
+        /// <value>The total gap time.</value>
+        property System::TimeSpan TotalGapTime {
+        public:
+            System::TimeSpan get() { return System::TimeSpan(_totalGapTime); }
+        }
+
+    internal:
+        RetentionSummary(System::String^ dataSourceId, System::String^ dataSourceName) :
+            _dataSourceId(dataSourceId), _dataSourceName(dataSourceName), _oldestRecording(System::DateTime::MinValue) {
+            _gapTimeByReason = gcnew array<long long>(static_cast<int>(Gap::GapReasons::WriteError) + 1);
+        }
+        System::String^ _dataSourceId;
+        System::String^ _dataSourceName;
+        int _failedGapFillCount;
+        int _gapCount;
+        array<long long>^ _gapTimeByReason;
+        System::DateTime _lastScanned;
+        System::DateTime _oldestRecording;
+        int _pendingGapFillCount;
+        long long _pendingGapFillTime;
+        long long _totalGapTime;
+    };
+}
+#endif // RetentionSummary_h__
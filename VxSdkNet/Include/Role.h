@@ -24,7 +24,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Role() {
-            this->!Role();
+            NativeMemory::Remove(_role);
+            _role->Delete();
+            _role = nullptr;
         }
 
         /// <summary>
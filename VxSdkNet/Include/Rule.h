@@ -27,7 +27,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Rule() {
-            this->!Rule();
+            NativeMemory::Remove(_rule);
+            _rule->Delete();
+            _rule = nullptr;
         }
 
         /// <summary>
@@ -8,6 +8,7 @@
 #include "NewScheduleTrigger.h"
 #include "ScheduleTrigger.h"
 #include "ResourceLimits.h"
+#include "BulkLink.h"
 
 namespace VxSdkNet {
 
@@ -43,7 +44,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Schedule() {
-            this->!Schedule();
+            NativeMemory::Remove(_schedule);
+            _schedule->Delete();
+            _schedule = nullptr;
         }
 
         /// <summary>
@@ -86,6 +89,15 @@ namespace VxSdkNet {
         /// <returns>The <see cref="Results::Value">Result</see> of updating the properties.</returns>
         Results::Value Refresh();
 
+        /// <summary>
+        /// Links and unlinks data sources so that exactly the given data sources are linked to this schedule.  Only the data sources
+        /// whose link needs to change are sent, and <c>nullptr</c> entries are ignored (see <see cref="BulkLink"/>).  If the current
+        /// links cannot be read, nothing is changed and each given entry reports the result of the read.
+        /// </summary>
+        /// <param name="dataSources">A <c>List</c> containing the data sources that should be linked.</param>
+        /// <returns>The <see cref="Results::Value">Result</see> of each link or unlink made, keyed by data source unique identifier.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ SetLinkedDataSources(System::Collections::Generic::List<DataSource^>^ dataSources);
+
         /// <summary>
         /// Delete existing data sources from the schedule.
         /// </summary>
@@ -165,8 +177,12 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxSchedule* _schedule;
+        IdentityMap^ _identityMap;
+        System::Object^ _Fetch();
         VxSdkNet::ResourceLimits^ _GetLimits();
+        System::Collections::Generic::List<DataSource^>^ _GetLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result);
         System::Collections::Generic::List<ScheduleTrigger^>^ _GetScheduleTriggers();
+        Results::Value _LinkDataSource(System::Object^ item, bool link);
     };
 }
 #endif // Schedule_h__
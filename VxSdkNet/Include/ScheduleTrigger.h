@@ -40,7 +40,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~ScheduleTrigger() {
-            this->!ScheduleTrigger();
+            NativeMemory::Remove(_scheduleTrigger);
+            _scheduleTrigger->Delete();
+            _scheduleTrigger = nullptr;
         }
 
         /// <summary>
@@ -0,0 +1,94 @@
+// Declares the sdk fake class.
+#ifndef SdkFake_h__
+#define SdkFake_h__
+
+#ifdef VXSDKNET_FAKE_SDK
+#include "FakeSdk.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The SdkFake class configures the offline fake of the native VideoXpert SDK that the wrapper is linked against
+    /// when built with <c>VXSDKNET_FAKE_SDK</c>.  Any login succeeds and returns a system serving a generated data set
+    /// of devices, data sources and past events, and notifying synthetic events while notifications are started.  A
+    /// system takes a copy of the settings when it is logged in to.  Combine it with <see cref="SdkFaults"/> to add
+    /// latency and errors.  It is intended for testing only.
+    /// </summary>
+    public ref class SdkFake abstract sealed {
+    public:
+
+        /// <summary>
+        /// Gets or sets the number of data sources on each system.  Defaults to 1000.
+        /// </summary>
+        /// <value>The number of data sources.</value>
+        static property int DataSourceCount {
+        public:
+            int get();
+            void set(int value);
+        }
+
+        /// <summary>
+        /// Gets or sets the number of data sources hosted by each device.  Defaults to 4.
+        /// </summary>
+        /// <value>The number of data sources per device.</value>
+        static property int DataSourcesPerDevice {
+        public:
+            int get();
+            void set(int value);
+        }
+
+        /// <summary>
+        /// Gets or sets the number of past events on each system.  Defaults to 10000.
+        /// </summary>
+        /// <value>The number of past events.</value>
+        static property int EventCount {
+        public:
+            int get();
+            void set(int value);
+        }
+
+        /// <summary>
+        /// Gets or sets the time, in milliseconds, between batches of synthetic events.  Defaults to 0, which notifies
+        /// only the events inserted with <c>InsertEvent</c>.
+        /// </summary>
+        /// <value>The event interval.</value>
+        static property int EventInterval {
+        public:
+            int get();
+            void set(int value);
+        }
+
+        /// <summary>
+        /// Gets or sets the number of synthetic events in each batch.  Defaults to 1.
+        /// </summary>
+        /// <value>The number of events per interval.</value>
+        static property int EventsPerInterval {
+        public:
+            int get();
+            void set(int value);
+        }
+
+        /// <summary>
+        /// Gets or sets the seed of the random numbers used to generate events, so that a run can be repeated.
+        /// Defaults to 0.
+        /// </summary>
+        /// <value>The seed.</value>
+        static property int Seed {
+        public:
+            int get();
+            void set(int value);
+        }
+
+        /// <summary>
+        /// Gets or sets the number of situation types that events are spread over.  Defaults to 8.
+        /// </summary>
+        /// <value>The number of situation types.</value>
+        static property int SituationTypeCount {
+        public:
+            int get();
+            void set(int value);
+        }
+    };
+}
+#endif // VXSDKNET_FAKE_SDK
+#endif // SdkFake_h__
@@ -0,0 +1,81 @@
+// Declares the sdk faults class.
+#ifndef SdkFaults_h__
+#define SdkFaults_h__
+
+#include "VxSdk.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The SdkFaults class injects latency and errors into calls made into the native VideoXpert SDK, so that the
+    /// behaviour of an application against a slow or unreliable system can be reproduced on demand.  Injected errors
+    /// are reported as <c>CommunicationError</c>.  A call chosen to fail is not made, so, like a request lost on the
+    /// network, it makes no change on the system and returns no objects.  Injection is disabled by default and is
+    /// intended for testing only.
+    /// </summary>
+    public ref class SdkFaults abstract sealed {
+    public:
+
+        /// <summary>
+        /// Gets or sets whether latency and errors are injected.  Defaults to <c>false</c>.
+        /// </summary>
+        /// <value><c>true</c> to inject faults, otherwise <c>false</c>.</value>
+        static property bool Enabled {
+        public:
+            bool get() { return _enabled; }
+            void set(bool value) { _enabled = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the fraction of calls that fail with an injected error.  Defaults to 0.
+        /// </summary>
+        /// <value>The error rate, from 0 to 1.</value>
+        static property double ErrorRate;
+
+        /// <summary>
+        /// Gets the number of errors injected.
+        /// </summary>
+        /// <value>The number of injected errors.</value>
+        static property long long InjectedErrorCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_injectedErrorCount); }
+        }
+
+        /// <summary>
+        /// Gets or sets the delay, in milliseconds, added before each call.  Defaults to 0.
+        /// </summary>
+        /// <value>The added latency.</value>
+        static property int Latency;
+
+        /// <summary>
+        /// Gets or sets the largest random delay, in milliseconds, added to <see cref="Latency"/>.  Defaults to 0.
+        /// </summary>
+        /// <value>The latency jitter.</value>
+        static property int LatencyJitter;
+
+        /// <summary>
+        /// Gets or sets the start of the native method names that faults are injected into, such as
+        /// <c>IVxSystem::GetDataSources</c> or <c>IVxDevice::</c>.  Defaults to <c>null</c>, which matches every method.
+        /// </summary>
+        /// <value>The method name prefix.</value>
+        static property System::String^ MethodPrefix;
+
+        /// <summary>
+        /// Sets the seed of the random numbers used to choose the calls that fail and their jitter, so that a run can be
+        /// repeated.
+        /// </summary>
+        /// <param name="seed">The seed.</param>
+        static void SetSeed(int seed);
+
+    internal:
+        static volatile bool _enabled;
+        static long long _injectedErrorCount;
+        static System::Object^ _randomLock = gcnew System::Object();
+        static System::Random^ _random = gcnew System::Random();
+        static void _Delay(const char* method);
+        static VxSdk::VxResult::Value _GetError();
+        static bool _Inject(const char* method);
+        static bool _IsTarget(const char* method);
+    };
+}
+#endif // SdkFaults_h__
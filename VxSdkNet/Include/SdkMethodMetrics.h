@@ -0,0 +1,128 @@
+// Declares the sdk method metrics class.
+#ifndef SdkMethodMetrics_h__
+#define SdkMethodMetrics_h__
+
+#include "Utils.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The SdkMethodMetrics class contains the metrics recorded for a single native SDK method, as of when a
+    /// <see cref="SdkMetricsSnapshot"/> was taken.
+    /// </summary>
+    public ref class SdkMethodMetrics {
+    public:
+
+        /// <summary>
+        /// Gets the latency below which the given percentage of calls completed.  The latency is accurate to within
+        /// 1/8 of its value.
+        /// </summary>
+        /// <param name="percentile">The percentile (0-100).</param>
+        /// <returns>The latency at the percentile.</returns>
+        System::TimeSpan GetLatencyPercentile(double percentile);
+
+        /// <summary>
+        /// Gets the average latency of a call.
+        /// </summary>
+        /// <value>The average latency.</value>
+        property System::TimeSpan AverageLatency {
+        public:
+            System::TimeSpan get() {
+                if (_callCount == 0)
+                    return System::TimeSpan::Zero;
+
+                return _ToTimeSpan(static_cast<double>(_counts[SdkMetrics::LatencySlot]) / _callCount);
+            }
+        }
+
+        /// <summary>
+        /// Gets the average number of items returned by a successful call that returns a collection.
+        /// </summary>
+        /// <value>The average collection size.</value>
+        property double AverageCollectionSize {
+        public:
+            double get() {
+                long long collectionCount = _counts[SdkMetrics::SizeCountSlot];
+                if (collectionCount == 0)
+                    return 0;
+
+                return static_cast<double>(_counts[SdkMetrics::SizeTotalSlot]) / collectionCount;
+            }
+        }
+
+        /// <summary>
+        /// Gets the number of calls made.
+        /// </summary>
+        /// <value>The number of calls.</value>
+        property long long CallCount {
+        public:
+            long long get() { return _callCount; }
+        }
+
+        /// <summary>
+        /// Gets the number of successful calls that returned a collection.
+        /// </summary>
+        /// <value>The number of collections returned.</value>
+        property long long CollectionCount {
+        public:
+            long long get() { return _counts[SdkMetrics::SizeCountSlot]; }
+        }
+
+        /// <summary>
+        /// Gets the number of calls that ended in a particular result.
+        /// </summary>
+        /// <value>The number of calls, keyed by result.</value>
+        property System::Collections::Generic::Dictionary<Results::Value, long long>^ ResultCounts {
+        public:
+            System::Collections::Generic::Dictionary<Results::Value, long long>^ get();
+        }
+
+        /// <summary>
+        /// Gets the highest latency recorded, to within 1/8 of its value.
+        /// </summary>
+        /// <value>The maximum latency.</value>
+        property System::TimeSpan MaxLatency {
+        public:
+            System::TimeSpan get() { return GetLatencyPercentile(100); }
+        }
+
+        /// <summary>
+        /// Gets the largest number of items returned by a call that returns a collection.
+        /// </summary>
+        /// <value>The maximum collection size.</value>
+        property long long MaxCollectionSize {
+        public:
+            long long get() { return _counts[SdkMetrics::SizeMaxSlot]; }
+        }
+
+        /// <summary>
+        /// Gets the name of the method, in the form <c>Class::Method</c>.
+        /// </summary>
+        /// <value>The method name.</value>
+        property System::String^ Name {
+        public:
+            System::String^ get() { return _name; }
+        }
+
+        /// <summary>
+        /// Gets the total time spent in the method.
+        /// </summary>
+        /// <value>The total latency.</value>
+        property System::TimeSpan TotalLatency {
+        public:
+            System::TimeSpan get() { return _ToTimeSpan(static_cast<double>(_counts[SdkMetrics::LatencySlot])); }
+        }
+
+    internal:
+        System::String^ _name;
+        array<long long>^ _counts;
+        long long _callCount;
+        SdkMethodMetrics(System::String^ name, array<long long>^ counts);
+        static System::TimeSpan _ToTimeSpan(double ticks) {
+            // TimeSpan::FromSeconds rounds to the millisecond, which would hide most call latencies
+            double ticksPerTick = static_cast<double>(System::TimeSpan::TicksPerSecond) / System::Diagnostics::Stopwatch::Frequency;
+            return System::TimeSpan(static_cast<long long>(ticks * ticksPerTick));
+        }
+    };
+}
+#endif // SdkMethodMetrics_h__
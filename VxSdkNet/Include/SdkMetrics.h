@@ -0,0 +1,247 @@
+// Declares the sdk metrics class.
+#ifndef SdkMetrics_h__
+#define SdkMetrics_h__
+
+#include "VxSdk.h"
+#include "SdkFaults.h"
+#include "SdkRecorder.h"
+#include "SdkReplay.h"
+
+namespace VxSdkNet {
+    ref class SdkMetricsSnapshot;
+
+    /// <summary>
+    /// The metrics recorded by a single thread.  Only the owning thread writes to it, so no locking is needed.
+    /// </summary>
+    private ref class SdkThreadMetrics {
+    public:
+        System::Threading::Thread^ Owner;
+        int ThreadId;
+        array<array<long long>^>^ Sites;
+        array<long long>^ Trace;
+        long long TraceCount;
+    };
+
+    /// <summary>
+    /// The SdkMetrics class records the latency, result and returned collection size of each call made into the
+    /// native VideoXpert SDK, by method.  Latencies are kept in log-linear histograms, accurate to within 1/8 of the
+    /// value.  Each thread records into its own tables, so recording takes no locks; the tables of every thread are
+    /// only combined when a <see cref="GetSnapshot">snapshot</see> is taken, and the tables of threads that have
+    /// exited are folded into a shared total when the next thread starts recording.  Recording is disabled by default.
+    /// </summary>
+    public ref class SdkMetrics abstract sealed {
+    public:
+
+        /// <summary>
+        /// Takes a snapshot of the metrics recorded so far.
+        /// </summary>
+        /// <returns>The snapshot.</returns>
+        static SdkMetricsSnapshot^ GetSnapshot();
+
+        /// <summary>
+        /// Clears the metrics recorded so far.  Calls being recorded at the same time may be partly cleared.
+        /// </summary>
+        static void Reset();
+
+        /// <summary>
+        /// Writes the most recent calls of each thread in the Chrome trace event format, which can be loaded into
+        /// <c>chrome://tracing</c> or Perfetto.  Nothing is written unless <see cref="TraceCapacity"/> has been set.
+        /// </summary>
+        /// <param name="writer">The writer to write the trace to.</param>
+        static void WriteChromeTrace(System::IO::TextWriter^ writer);
+
+        /// <summary>
+        /// Gets or sets whether calls are recorded.  Defaults to <c>false</c>.
+        /// </summary>
+        /// <value><c>true</c> to record calls, otherwise <c>false</c>.</value>
+        static property bool Enabled {
+        public:
+            bool get() { return _enabled; }
+            void set(bool value) { _enabled = value; }
+        }
+
+        /// <summary>
+        /// Gets or sets the number of recent calls kept by each thread for <see cref="WriteChromeTrace"/>.  Threads
+        /// that have already recorded calls keep their current capacity.  Defaults to 0, which keeps no calls.
+        /// </summary>
+        /// <value>The number of calls kept per thread.</value>
+        static property int TraceCapacity {
+        public:
+            int get() { return _traceCapacity; }
+            void set(int value) { _traceCapacity = System::Math::Max(value, 0); }
+        }
+
+    internal:
+        static const int MaxSites = 2048;
+        static const int OverflowSite = MaxSites;
+        static const int SiteCount = MaxSites + 1;
+        static const int BucketCount = 256;
+        static const int SubBucketCount = 8;
+        static const int ResultSlot = BucketCount;
+        static const int ResultCount = 128;
+        static const int LatencySlot = ResultSlot + ResultCount;
+        static const int SizeCountSlot = LatencySlot + 1;
+        static const int SizeTotalSlot = LatencySlot + 2;
+        static const int SizeMaxSlot = LatencySlot + 3;
+        static const int SlotCount = LatencySlot + 4;
+        static volatile bool _enabled;
+        static int _traceCapacity;
+        static array<System::IntPtr>^ _siteKeys = gcnew array<System::IntPtr>(MaxSites);
+        static array<System::String^>^ _siteNames = gcnew array<System::String^>(SiteCount);
+        static array<array<long long>^>^ _retiredSites = gcnew array<array<long long>^>(SiteCount);
+        static System::Collections::Generic::List<SdkThreadMetrics^>^ _threads = gcnew System::Collections::Generic::List<SdkThreadMetrics^>();
+        [System::ThreadStatic] static SdkThreadMetrics^ _thread;
+
+        /// <summary>
+        /// Gets the histogram bucket of a latency.  Values below twice the sub-bucket count have a bucket each, and
+        /// each doubling above that is split into the same number of sub-buckets.
+        /// </summary>
+        /// <param name="ticks">The latency in <c>Stopwatch</c> ticks.</param>
+        /// <returns>The bucket index.</returns>
+        static int _GetBucket(long long ticks) {
+            int shift = 0;
+            while (ticks >= 2 * SubBucketCount) {
+                ticks >>= 1;
+                shift++;
+            }
+
+            if (shift == 0)
+                return static_cast<int>(ticks);
+
+            int bucket = SubBucketCount + shift * SubBucketCount + static_cast<int>(ticks - SubBucketCount);
+            return bucket < BucketCount ? bucket : BucketCount - 1;
+        }
+
+        /// <summary>
+        /// Gets the smallest latency that falls into a histogram bucket.
+        /// </summary>
+        /// <param name="bucket">The bucket index.</param>
+        /// <returns>The latency in <c>Stopwatch</c> ticks.</returns>
+        static long long _GetBucketStart(int bucket) {
+            if (bucket < 2 * SubBucketCount)
+                return bucket;
+
+            int shift = (bucket - SubBucketCount) / SubBucketCount;
+            return static_cast<long long>(SubBucketCount + (bucket - SubBucketCount) % SubBucketCount) << shift;
+        }
+
+        static int _GetSite(const char* method);
+        static void _Record(const char* method, long long start, int result, const int* count);
+        static void _AddCounts(array<long long>^ counts, array<long long>^ added);
+        static SdkThreadMetrics^ _RegisterThread();
+    };
+
+    /// <summary>
+    /// Times a single call into the native SDK and records it with <see cref="SdkMetrics"/> and
+    /// <see cref="SdkRecorder"/>, injecting any faults set up with <see cref="SdkFaults"/> or replayed with
+    /// <see cref="SdkReplay"/>.  Construct it immediately before the call and pass the call's result through
+    /// <see cref="End"/>, making the call only when the instance is not <see cref="Faulted"/>.  Calls that fill in a
+    /// collection pass the collection, so that its size, filters and items are recorded too.
+    /// </summary>
+    class SdkCall {
+    public:
+        SdkCall(const char* method) {
+            Restart(method);
+        }
+
+        template <typename T>
+        SdkCall(const char* method, VxSdk::VxCollection<T>& collection) {
+            Restart(method, collection);
+        }
+
+        /// <summary>
+        /// Records the call, along with the size, filters and items of its collection, if any.  When a trace is being
+        /// replayed, first waits until the call has taken as long as the recorded call.
+        /// </summary>
+        /// <param name="result">The result of the call.</param>
+        /// <returns>The result of the call.</returns>
+        VxSdk::VxResult::Value End(VxSdk::VxResult::Value result) {
+            if (_replayDuration > 0) {
+                long long remaining = _start + _replayDuration - System::Diagnostics::Stopwatch::GetTimestamp();
+                if (remaining > 0)
+                    System::Threading::Thread::Sleep(System::TimeSpan::FromTicks(remaining * System::TimeSpan::TicksPerSecond / System::Diagnostics::Stopwatch::Frequency));
+            }
+
+            if (_start != 0) {
+                if (SdkMetrics::_enabled)
+                    SdkMetrics::_Record(_method, _start, result, _count);
+
+                if (SdkRecorder::_recording)
+                    SdkRecorder::_Record(_method, _start, result, _count, _filterSize, _filters, _hasItems ? &_items : nullptr);
+            }
+
+            return result;
+        }
+
+        /// <summary>
+        /// Gets the error injected or replayed in place of the call, which is passed to <see cref="End"/> instead of
+        /// making it.
+        /// </summary>
+        /// <returns>The injected error.</returns>
+        VxSdk::VxResult::Value Fault() {
+            return _fault;
+        }
+
+        /// <summary>
+        /// Gets whether an error is injected or replayed in place of the call, in which case the call must not be made.
+        /// </summary>
+        /// <returns><c>true</c> if the call is to fail, otherwise <c>false</c>.</returns>
+        bool Faulted() {
+            return _faulted;
+        }
+
+        /// <summary>
+        /// Starts timing another call, so that one instance can time each of the calls made by a method.
+        /// </summary>
+        /// <param name="method">The name of the native method.</param>
+        void Restart(const char* method) {
+            _hasItems = false;
+            _Start(method, nullptr, nullptr, nullptr);
+        }
+
+        /// <summary>
+        /// Starts timing another call that fills in a collection.
+        /// </summary>
+        /// <param name="method">The name of the native method.</param>
+        /// <param name="collection">The collection filled in by the call.</param>
+        template <typename T>
+        void Restart(const char* method, VxSdk::VxCollection<T>& collection) {
+            _items = SdkCollectionItems::For(collection);
+            _hasItems = true;
+            _Start(method, &collection.collectionSize, &collection.filterSize, &collection.filters);
+        }
+
+    private:
+        const char* _method;
+        const int* _count;
+        const int* _filterSize;
+        VxSdk::VxCollectionFilter* const* _filters;
+        SdkCollectionItems _items;
+        bool _hasItems;
+        long long _start;
+        long long _replayDuration;
+        bool _faulted;
+        VxSdk::VxResult::Value _fault;
+
+        void _Start(const char* method, const int* count, const int* filterSize, VxSdk::VxCollectionFilter* const* filters) {
+            _method = method;
+            _count = count;
+            _filterSize = filterSize;
+            _filters = filters;
+            _start = SdkMetrics::_enabled || SdkRecorder::_recording || SdkReplay::_replaying ? System::Diagnostics::Stopwatch::GetTimestamp() : 0;
+            _replayDuration = 0;
+            _faulted = false;
+            if (SdkFaults::_enabled) {
+                SdkFaults::_Delay(method);
+                _faulted = SdkFaults::_Inject(method);
+                _fault = SdkFaults::_GetError();
+            }
+
+            // Replay a recorded failure in place of the call; other calls are still made, and reach the fake SDK serving the
+            // recorded items when built with it
+            if (!_faulted && _start != 0 && SdkReplay::_replaying && SdkReplay::_Next(method, _replayDuration, _fault))
+                _faulted = _fault != VxSdk::VxResult::kOK && _fault != VxSdk::VxResult::kInsufficientSize;
+        }
+    };
+}
+#endif // SdkMetrics_h__
@@ -0,0 +1,56 @@
+// Declares the sdk metrics snapshot class.
+#ifndef SdkMetricsSnapshot_h__
+#define SdkMetricsSnapshot_h__
+
+#include "SdkMethodMetrics.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The SdkMetricsSnapshot class contains the metrics recorded by <see cref="SdkMetrics"/> for every native SDK
+    /// method called, as of when it was taken.
+    /// </summary>
+    public ref class SdkMetricsSnapshot {
+    public:
+
+        /// <summary>
+        /// Gets the metrics of a single method.
+        /// </summary>
+        /// <param name="name">The method name, in the form <c>Class::Method</c>.</param>
+        /// <returns>The method metrics, or <c>null</c> if the method has not been called.</returns>
+        SdkMethodMetrics^ GetMethod(System::String^ name);
+
+        /// <summary>
+        /// Gets the snapshot as a JSON document, containing an object for each method.
+        /// </summary>
+        /// <returns>The JSON document.</returns>
+        System::String^ ToJson();
+
+        /// <summary>
+        /// Gets the metrics of each method called, ordered by the total time spent in it, highest first.
+        /// </summary>
+        /// <value>A list of method metrics.</value>
+        property System::Collections::Generic::List<SdkMethodMetrics^>^ Methods {
+        public:
+            System::Collections::Generic::List<SdkMethodMetrics^>^ get() {
+                return gcnew System::Collections::Generic::List<SdkMethodMetrics^>(_methods);
+            }
+        }
+
+        /// <summary>
+        /// Gets the time at which the snapshot was taken.
+        /// </summary>
+        /// <value>The time the snapshot was taken.</value>
+        property System::DateTime Taken {
+        public:
+            System::DateTime get() { return _taken; }
+        }
+
+    internal:
+        System::Collections::Generic::List<SdkMethodMetrics^>^ _methods;
+        System::DateTime _taken;
+        SdkMetricsSnapshot(System::Collections::Generic::Dictionary<System::String^, array<long long>^>^ methods);
+        static int _CompareTotalLatency(SdkMethodMetrics^ a, SdkMethodMetrics^ b);
+    };
+}
+#endif // SdkMetricsSnapshot_h__
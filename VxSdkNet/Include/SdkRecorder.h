@@ -0,0 +1,149 @@
+// Declares the sdk recorder class.
+#ifndef SdkRecorder_h__
+#define SdkRecorder_h__
+
+#include "VxSdk.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// Describes the items of a collection filled in by a native call, so that their fields can be recorded.  The fields
+    /// of data sources, devices and events are recorded; the items of other collections are only counted.
+    /// </summary>
+    struct SdkCollectionItems {
+        enum Kind { kNone, kDataSource, kDevice, kEvent };
+
+        const void* Items;
+        Kind ItemKind;
+
+        template <typename T>
+        static SdkCollectionItems For(VxSdk::VxCollection<T>& collection) {
+            SdkCollectionItems items;
+            items.Items = &collection.collection;
+            items.ItemKind = _KindOf(collection.collection);
+            return items;
+        }
+
+        static Kind _KindOf(VxSdk::IVxDataSource**) { return kDataSource; }
+        static Kind _KindOf(VxSdk::IVxDevice**) { return kDevice; }
+        static Kind _KindOf(VxSdk::IVxEvent**) { return kEvent; }
+
+        template <typename T>
+        static Kind _KindOf(T) { return kNone; }
+    };
+
+    /// <summary>
+    /// A single call waiting to be written to the trace file.
+    /// </summary>
+    private ref class SdkRecorderEntry {
+    public:
+        int Site;
+        int ThreadId;
+        long long Start;
+        long long Duration;
+        int Result;
+        int CollectionSize;
+        int ItemKind;
+        array<int>^ FilterKeys;
+        array<System::String^>^ FilterValues;
+        array<array<unsigned char>^>^ Items;
+    };
+
+    /// <summary>
+    /// The SdkRecorder class records every call made into the native VideoXpert SDK to a compact binary trace file: the
+    /// native method, its timing, its result, the filters it was called with and the size of the collection it returned.
+    /// The fields of the data sources, devices and events returned are recorded too, one by one, so that
+    /// <see cref="SdkReplay"/> can serve them again.  Calls are queued and written by a background thread, and the file is flushed regularly, so it can be
+    /// read with <see cref="SdkTraceReader"/> while it is still being recorded.  Only one recording is made at a time.
+    /// </summary>
+    public ref class SdkRecorder abstract sealed {
+    public:
+
+        /// <summary>
+        /// Starts recording to a file, replacing the file if it exists.  Any recording in progress is stopped first.
+        /// </summary>
+        /// <param name="filePath">The path of the trace file.</param>
+        /// <returns><c>true</c> if recording started, or <c>false</c> if the file could not be created.</returns>
+        static bool Start(System::String^ filePath);
+
+        /// <summary>
+        /// Stops recording, waiting for the calls already queued to be written and closing the file.
+        /// </summary>
+        static void Stop();
+
+        /// <summary>
+        /// Gets the number of calls that were not recorded because too many were waiting to be written.
+        /// </summary>
+        /// <value>The number of dropped calls.</value>
+        static property long long DroppedCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_droppedCount); }
+        }
+
+        /// <summary>
+        /// Gets or sets whether the fields of the data sources, devices and events returned in collections are recorded.
+        /// Defaults to <c>true</c>.
+        /// </summary>
+        /// <value><c>true</c> to record collection items, otherwise <c>false</c>.</value>
+        static property bool IncludeItems {
+        public:
+            bool get() { return _includeItems; }
+            void set(bool value) { _includeItems = value; }
+        }
+
+        /// <summary>
+        /// Gets whether calls are being recorded.
+        /// </summary>
+        /// <value><c>true</c> if recording, otherwise <c>false</c>.</value>
+        static property bool IsRecording {
+        public:
+            bool get() { return _recording; }
+        }
+
+        /// <summary>
+        /// Gets or sets the largest number of calls that may wait to be written before further calls are dropped.
+        /// Defaults to 1048576.
+        /// </summary>
+        /// <value>The maximum number of pending calls.</value>
+        static property int MaxPending {
+        public:
+            int get() { return _maxPending; }
+            void set(int value) { _maxPending = value; }
+        }
+
+        /// <summary>
+        /// Gets the number of calls recorded since recording started.
+        /// </summary>
+        /// <value>The number of recorded calls.</value>
+        static property long long RecordedCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_recordedCount); }
+        }
+
+    internal:
+        static const int FileMagic = 0x52545856;
+        static const int FileVersion = 3;
+        static const int FlushInterval = 1000;
+        static const unsigned char MethodRecord = 1;
+        static const unsigned char CallRecord = 2;
+        static volatile bool _recording;
+        static bool _includeItems = true;
+        static int _maxPending = 1048576;
+        static int _pendingCount;
+        static long long _droppedCount;
+        static long long _recordedCount;
+        static long long _startedAt;
+        static System::Object^ _recorderLock = gcnew System::Object();
+        static System::Collections::Concurrent::ConcurrentQueue<SdkRecorderEntry^>^ _entries;
+        static System::IO::BinaryWriter^ _writer;
+        static System::Threading::AutoResetEvent^ _wake = gcnew System::Threading::AutoResetEvent(false);
+        static System::Threading::Thread^ _thread;
+        static void _Record(const char* method, long long start, int result, const int* count, const int* filterSize,
+            VxSdk::VxCollectionFilter* const* filters, const SdkCollectionItems* items);
+        static array<unsigned char>^ _SerializeItem(SdkCollectionItems::Kind kind, const void* item);
+        static void _Write();
+        static void _WriteString(System::IO::BinaryWriter^ writer, System::String^ value);
+        static void _WriteVarint(System::IO::BinaryWriter^ writer, unsigned long long value);
+    };
+}
+#endif // SdkRecorder_h__
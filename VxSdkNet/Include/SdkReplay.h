@@ -0,0 +1,90 @@
+// Declares the sdk replay class.
+#ifndef SdkReplay_h__
+#define SdkReplay_h__
+
+#include "SdkTraceItem.h"
+#include "VxSdk.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The timing and result of a recorded call, waiting to be replayed.
+    /// </summary>
+    private value struct SdkReplayCall {
+    public:
+        long long Duration;
+        int Result;
+    };
+
+    /// <summary>
+    /// The SdkReplay class replays a trace recorded by <see cref="SdkRecorder"/> onto the calls made into the native
+    /// VideoXpert SDK, so that the latency, failures and data seen on a production system can be reproduced in a test.
+    /// Each call is matched to the next recorded call of the same native method and takes at least the recorded time,
+    /// scaled as requested.  A call whose recorded counterpart failed is not made and returns the recorded result.
+    /// Calls left over once the recorded calls of their method run out are made without delay.  Replay is intended for
+    /// testing only.
+    /// <para>When built with <c>VXSDKNET_FAKE_SDK</c>, the data sources, devices and events recorded in the trace are
+    /// served by the fake SDK to systems logged in to after replay starts, so successful calls return the recorded
+    /// data without reaching a live system.  Otherwise only the timing and failures are replayed, and successful calls
+    /// reach the system logged in to.</para>
+    /// </summary>
+    public ref class SdkReplay abstract sealed {
+    public:
+
+        /// <summary>
+        /// Starts replaying a trace file, replacing any replay in progress.  The timing and results of the recorded
+        /// calls are read into memory, along with the recorded items when built with the fake SDK; their filters are
+        /// not.
+        /// </summary>
+        /// <param name="filePath">The path of the trace file.</param>
+        /// <param name="timeScale">The factor applied to the recorded timing; 1 replays at the original pace, 0.5 at
+        /// twice the pace.</param>
+        /// <returns><c>true</c> if replay started, or <c>false</c> if the file could not be read.</returns>
+        static bool Start(System::String^ filePath, double timeScale);
+
+        /// <summary>
+        /// Stops replaying, so that calls are made as usual and systems logged in to from now on no longer serve the
+        /// recorded items.
+        /// </summary>
+        static void Stop();
+
+        /// <summary>
+        /// Gets whether a trace is being replayed.
+        /// </summary>
+        /// <value><c>true</c> if replaying, otherwise <c>false</c>.</value>
+        static property bool IsReplaying {
+        public:
+            bool get() { return _replaying; }
+        }
+
+        /// <summary>
+        /// Gets the number of calls made since replay started that had no recorded call left to match.
+        /// </summary>
+        /// <value>The number of unmatched calls.</value>
+        static property long long MissedCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_missedCount); }
+        }
+
+        /// <summary>
+        /// Gets the number of calls matched to a recorded call since replay started.
+        /// </summary>
+        /// <value>The number of replayed calls.</value>
+        static property long long ReplayedCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_replayedCount); }
+        }
+
+    internal:
+        static volatile bool _replaying;
+        static long long _missedCount;
+        static long long _replayedCount;
+        static System::Object^ _replayLock = gcnew System::Object();
+        static System::Collections::Generic::Dictionary<System::String^, System::Collections::Generic::Queue<SdkReplayCall>^>^ _calls;
+        static bool _Next(const char* method, long long& duration, VxSdk::VxResult::Value& result);
+#ifdef VXSDKNET_FAKE_SDK
+        static void _Serve(System::Collections::Generic::IEnumerable<SdkTraceItem^>^ items);
+#endif
+    };
+}
+#endif // SdkReplay_h__
@@ -0,0 +1,70 @@
+// Declares the sdk trace item class.
+#ifndef SdkTraceItem_h__
+#define SdkTraceItem_h__
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The SdkTraceItem class contains the recorded fields of a data source, device or event returned in the collection
+    /// of a call read from a trace.
+    /// </summary>
+    public ref class SdkTraceItem {
+    public:
+
+        /// <summary>
+        /// Values that represent the types of recorded items.
+        /// </summary>
+        enum class ItemKind {
+            /// <summary>The item is a data source.</summary>
+            DataSource = 1,
+
+            /// <summary>The item is a device.</summary>
+            Device,
+
+            /// <summary>The item is an event.</summary>
+            Event
+        };
+
+        /// <summary>
+        /// Gets the recorded fields of the item, by the name of the native field.  Text fields are held as strings,
+        /// numbers and enumerations as <c>int</c> and flags as <c>bool</c>.  Data sources hold <c>id</c>, <c>name</c>,
+        /// <c>ip</c>, <c>number</c>, <c>type</c>, <c>state</c>, <c>isEnabled</c> and <c>isRecording</c>.  Devices
+        /// hold <c>id</c>, <c>name</c>, <c>ip</c>, <c>hostname</c>, <c>model</c>, <c>serial</c>, <c>vendor</c>,
+        /// <c>version</c>, <c>port</c>, <c>type</c> and <c>state</c>.  Events hold <c>id</c>, <c>situationType</c>,
+        /// <c>situationName</c>, <c>generatorDeviceId</c>, <c>generatorDeviceName</c>, <c>sourceDeviceId</c>,
+        /// <c>sourceDeviceName</c>, <c>time</c> and <c>severity</c>.
+        /// </summary>
+        /// <value>A <c>Dictionary</c> of field names and values.</value>
+        property System::Collections::Generic::Dictionary<System::String^, System::Object^>^ Fields {
+        public:
+            System::Collections::Generic::Dictionary<System::String^, System::Object^>^ get() { return _fields; }
+        }
+
+        /// <summary>
+        /// Gets the id of the item.
+        /// </summary>
+        /// <value>The id of the item.</value>
+        property System::String^ Id {
+        public:
+            System::String^ get() { return safe_cast<System::String^>(_fields["id"]); }
+        }
+
+        /// <summary>
+        /// Gets the type of the item.
+        /// </summary>
+        /// <value>The <see cref="ItemKind"/> of the item.</value>
+        property ItemKind Kind {
+        public:
+            ItemKind get() { return _kind; }
+        }
+
+    internal:
+        SdkTraceItem(ItemKind kind) : _kind(kind) {
+            _fields = gcnew System::Collections::Generic::Dictionary<System::String^, System::Object^>();
+        }
+
+        System::Collections::Generic::Dictionary<System::String^, System::Object^>^ _fields;
+        ItemKind _kind;
+    };
+}
+#endif // SdkTraceItem_h__
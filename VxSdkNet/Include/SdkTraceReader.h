@@ -0,0 +1,72 @@
+// Declares the sdk trace reader class.
+#ifndef SdkTraceReader_h__
+#define SdkTraceReader_h__
+
+#include "SdkTraceRecord.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The SdkTraceReader class reads the calls from a trace file recorded by <see cref="SdkRecorder"/>, in the order
+    /// they were recorded.  The file is memory mapped rather than loaded, so traces larger than the available memory
+    /// can be read, and a trace that is still being recorded can be read up to the last call written.  Calls may be read
+    /// as fast as possible or paced to their recorded timing, so that a benchmark can repeat a recorded workload; to
+    /// replay the recorded timing and failures onto the calls made by the wrapper itself, use <see cref="SdkReplay"/>.
+    /// </summary>
+    public ref class SdkTraceReader {
+    public:
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="filePath">The path of the trace file.</param>
+        /// <exception cref="System::IO::InvalidDataException">The file is not a trace file.</exception>
+        SdkTraceReader(System::String^ filePath);
+
+        /// <summary>
+        /// Destructor.
+        /// </summary>
+        virtual ~SdkTraceReader();
+
+        /// <summary>
+        /// Reads the next call.
+        /// </summary>
+        /// <returns>The call, or <c>null</c> if there are no more calls.</returns>
+        SdkTraceRecord^ ReadNext();
+
+        /// <summary>
+        /// Reads the next call, first waiting until it is due according to the recorded timing.  Timing starts from the
+        /// first call read with this method.
+        /// </summary>
+        /// <param name="timeScale">The factor applied to the recorded timing; 1 replays at the original pace, 0.5 at
+        /// twice the pace.</param>
+        /// <returns>The call, or <c>null</c> if there are no more calls.</returns>
+        SdkTraceRecord^ ReadNext(double timeScale);
+
+        /// <summary>
+        /// Gets the time the recording started.
+        /// </summary>
+        /// <value>The start time, in UTC.</value>
+        property System::DateTime StartTime {
+        public:
+            System::DateTime get() { return _startTime; }
+        }
+
+    internal:
+        System::IO::MemoryMappedFiles::MemoryMappedFile^ _file;
+        System::IO::BinaryReader^ _reader;
+        System::Collections::Generic::Dictionary<int, System::String^>^ _methods;
+        int _version;
+        bool _readItems;
+        System::DateTime _startTime;
+        double _ticksPerSecond;
+        long long _previousStart;
+        long long _paceStartedAt;
+        System::TimeSpan _paceOffset;
+        static SdkTraceItem^ _ParseItem(int kind, array<unsigned char>^ fields);
+        static System::String^ _ReadString(System::IO::BinaryReader^ reader);
+        static unsigned long long _ReadVarint(System::IO::BinaryReader^ reader);
+        System::TimeSpan _ToTimeSpan(long long ticks);
+    };
+}
+#endif // SdkTraceReader_h__
@@ -0,0 +1,102 @@
+// Declares the sdk trace record class.
+#ifndef SdkTraceRecord_h__
+#define SdkTraceRecord_h__
+
+#include "SdkTraceItem.h"
+#include "Utils.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The SdkTraceRecord class contains a single native SDK call read from a trace recorded by
+    /// <see cref="SdkRecorder"/>.
+    /// </summary>
+    public ref class SdkTraceRecord {
+    public:
+
+        /// <summary>
+        /// Gets the collection filters the call was made with.
+        /// </summary>
+        /// <value>A <c>Dictionary</c> of filters, which is empty if the call was not filtered.</value>
+        property System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ CollectionFilters {
+        public:
+            System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ get() { return _filters; }
+        }
+
+        /// <summary>
+        /// Gets the data sources, devices or events returned in the collection by a successful call, if they were
+        /// recorded.  The items of other collections are not recorded.
+        /// </summary>
+        /// <value>A <c>List</c> of the recorded items, empty if none were recorded.</value>
+        property System::Collections::Generic::List<SdkTraceItem^>^ CollectionItems {
+        public:
+            System::Collections::Generic::List<SdkTraceItem^>^ get() { return _items; }
+        }
+
+        /// <summary>
+        /// Gets the size of the collection after the call, for calls that fill in a collection.  When the result is
+        /// <c>InsufficientSize</c> this is the number of items available.
+        /// </summary>
+        /// <value>The collection size, or -1 if the call does not fill in a collection.</value>
+        property int CollectionSize {
+        public:
+            int get() { return _collectionSize; }
+        }
+
+        /// <summary>
+        /// Gets the time taken by the call.
+        /// </summary>
+        /// <value>The call duration.</value>
+        property System::TimeSpan Duration {
+        public:
+            System::TimeSpan get() { return _duration; }
+        }
+
+        /// <summary>
+        /// Gets the name of the native method called, in the form <c>Interface::Method</c>.
+        /// </summary>
+        /// <value>The method name.</value>
+        property System::String^ Method {
+        public:
+            System::String^ get() { return _method; }
+        }
+
+        /// <summary>
+        /// Gets the result of the call.
+        /// </summary>
+        /// <value>The <see cref="Results::Value">Result</see> of the call.</value>
+        property Results::Value Result {
+        public:
+            Results::Value get() { return _result; }
+        }
+
+        /// <summary>
+        /// Gets the time the call started, relative to the start of the recording.
+        /// </summary>
+        /// <value>The call start time.</value>
+        property System::TimeSpan Start {
+        public:
+            System::TimeSpan get() { return _start; }
+        }
+
+        /// <summary>
+        /// Gets the managed thread id of the thread that made the call.
+        /// </summary>
+        /// <value>The thread id.</value>
+        property int ThreadId {
+        public:
+            int get() { return _threadId; }
+        }
+
+    internal:
+        int _collectionSize;
+        System::TimeSpan _duration;
+        System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ _filters;
+        System::Collections::Generic::List<SdkTraceItem^>^ _items;
+        System::String^ _method;
+        Results::Value _result;
+        System::TimeSpan _start;
+        int _threadId;
+    };
+}
+#endif // SdkTraceRecord_h__
@@ -0,0 +1,148 @@
+// Declares the session pool class.
+#ifndef SessionPool_h__
+#define SessionPool_h__
+
+#include "VXSystem.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The SessionPool class shares a single auth token between many <see cref="VXSystem"/> instances, so that they
+    /// can log in with <see cref="VXSystem::Login(System::String^)"/> rather than each performing a full username and
+    /// password authentication.  The token is obtained once, however many logins are waiting for it, and is replaced in
+    /// the background before it expires.  A login that is rejected with <c>AuthExpired</c> obtains a new token and is
+    /// retried once.
+    /// </summary>
+    public ref class SessionPool {
+    public:
+
+        /// <summary>
+        /// The token delegate, which obtains a new auth token, for example from an authentication service.
+        /// </summary>
+        /// <returns>The new auth token, or <c>null</c> if one could not be obtained.</returns>
+        delegate System::String^ TokenDelegate();
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="tokenSource">The delegate used to obtain new auth tokens.</param>
+        SessionPool(TokenDelegate^ tokenSource);
+
+        /// <summary>
+        /// Destructor.  Stops refreshing the token; systems already logged in keep their sessions.
+        /// </summary>
+        virtual ~SessionPool();
+
+        /// <summary>
+        /// Gets the current auth token, obtaining a new one first if there is no token or it is about to expire.
+        /// </summary>
+        /// <returns>The auth token, or <c>null</c> if one could not be obtained.</returns>
+        System::String^ GetToken();
+
+        /// <summary>
+        /// Logs a system in using the shared auth token.
+        /// </summary>
+        /// <param name="system">The system to log in.</param>
+        /// <returns>The <see cref="Results::Value">Result</see> of the login; <c>Unauthenticated</c> if no token could be
+        /// obtained, or <c>UnknownError</c> if the token delegate threw an exception.</returns>
+        Results::Value Login(VXSystem^ system);
+
+        /// <summary>
+        /// Logs each of the given systems in using the shared auth token, several at a time.  This method blocks until
+        /// every system has been logged in or has failed to.
+        /// </summary>
+        /// <param name="systems">The systems to log in.</param>
+        /// <returns>The result of each login, keyed by system.</returns>
+        System::Collections::Generic::Dictionary<VXSystem^, Results::Value>^ Login(System::Collections::Generic::IEnumerable<VXSystem^>^ systems);
+
+        /// <summary>
+        /// Obtains a new auth token, replacing the current one.
+        /// </summary>
+        /// <returns>The <see cref="Results::Value">Result</see> of obtaining the token.</returns>
+        Results::Value Refresh();
+
+        /// <summary>
+        /// Gets the average time taken by a login, from the call until the system is ready to be queried, including
+        /// any wait for a token.
+        /// </summary>
+        /// <value>The average login time.</value>
+        property System::TimeSpan AverageLoginTime {
+        public:
+            System::TimeSpan get();
+        }
+
+        /// <summary>
+        /// Gets the number of logins made.
+        /// </summary>
+        /// <value>The number of logins.</value>
+        property long long LoginCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_loginCount); }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of systems that may be logging in at once.  Defaults to 16.
+        /// </summary>
+        /// <value>The maximum number of concurrent logins.</value>
+        property int MaxConcurrentLogins;
+
+        /// <summary>
+        /// Gets the longest time taken by a login, from the call until the system is ready to be queried.
+        /// </summary>
+        /// <value>The maximum login time.</value>
+        property System::TimeSpan MaxLoginTime {
+        public:
+            System::TimeSpan get();
+        }
+
+        /// <summary>
+        /// Gets or sets how long, in milliseconds, before a token expires that it is replaced.  Defaults to 60000.
+        /// </summary>
+        /// <value>The refresh margin.</value>
+        property int RefreshMargin;
+
+        /// <summary>
+        /// Gets the number of auth tokens obtained.
+        /// </summary>
+        /// <value>The number of tokens obtained.</value>
+        property long long TokenCount {
+        public:
+            long long get() { return System::Threading::Interlocked::Read(_tokenCount); }
+        }
+
+        /// <summary>
+        /// Gets or sets how long, in milliseconds, an auth token remains valid after it is obtained.  This should match
+        /// the session lifetime configured on the system.  Defaults to 3600000.
+        /// </summary>
+        /// <value>The token lifetime.</value>
+        property int TokenLifetime;
+
+    internal:
+        TokenDelegate^ _tokenSource;
+        System::String^ _token;
+        long long _tokenObtainedAt;
+        System::Object^ _fetchLock;
+        System::Threading::Timer^ _refreshTimer;
+        bool _isDisposed;
+        long long _loginCount;
+        long long _tokenCount;
+        long long _totalLoginTime;
+        long long _maxLoginTime;
+        Results::Value _Fetch();
+        System::String^ _GetCurrentToken(int margin);
+        System::String^ _GetToken(Results::Value% result);
+        void _OnRefreshTimer(System::Object^ state);
+        void _RunLogins(System::Object^ state);
+    };
+
+    /// <summary>
+    /// The state shared by the workers of a <see cref="SessionPool::Login"/> call.
+    /// </summary>
+    private ref class SessionPoolJob {
+    public:
+        System::Collections::Concurrent::ConcurrentQueue<VXSystem^>^ Systems;
+        System::Threading::CountdownEvent^ Workers;
+        System::Collections::Generic::Dictionary<VXSystem^, Results::Value>^ SystemResults;
+    };
+}
+#endif // SessionPool_h__
@@ -5,6 +5,7 @@
 #include "VxSdk.h"
 #include "Device.h"
 #include "NewNotification.h"
+#include "BulkLink.h"
 
 namespace VxSdkNet {
 
@@ -25,7 +26,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Situation() {
-            this->!Situation();
+            NativeMemory::Remove(_situation);
+            _situation->Delete();
+            _situation = nullptr;
         }
 
         /// <summary>
@@ -111,6 +114,24 @@ namespace VxSdkNet {
         /// <returns>The <see cref="Results::Value">Result</see> of setting the audio file.</returns>
         Results::Value SetAudioFile(System::String^ audioFilePath);
 
+        /// <summary>
+        /// Links and unlinks data sources so that exactly the given data sources are linked to this situation.  Only the data sources
+        /// whose link needs to change are sent, and <c>nullptr</c> entries are ignored (see <see cref="BulkLink"/>).  If the current
+        /// links cannot be read, nothing is changed and each given entry reports the result of the read.
+        /// </summary>
+        /// <param name="dataSources">A <c>List</c> containing the data sources that should be linked.</param>
+        /// <returns>The <see cref="Results::Value">Result</see> of each link or unlink made, keyed by data source unique identifier.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ SetLinkedDataSources(System::Collections::Generic::List<DataSource^>^ dataSources);
+
+        /// <summary>
+        /// Links and unlinks devices so that exactly the given devices are linked to this situation.  Only the devices
+        /// whose link needs to change are sent, and <c>nullptr</c> entries are ignored (see <see cref="BulkLink"/>).  If the current
+        /// links cannot be read, nothing is changed and each given entry reports the result of the read.
+        /// </summary>
+        /// <param name="devices">A <c>List</c> containing the devices that should be linked.</param>
+        /// <returns>The <see cref="Results::Value">Result</see> of each link or unlink made, keyed by device unique identifier.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ SetLinkedDevices(System::Collections::Generic::List<Device^>^ devices);
+
         /// <summary>
         /// Remove device association from this situation.
         /// </summary>
@@ -354,8 +375,14 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxSituation* _situation;
+        IdentityMap^ _identityMap;
+        System::Object^ _Fetch();
         VxSdkNet::ResourceLimits^ _GetLimits();
+        System::Collections::Generic::List<DataSource^>^ _GetLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result);
+        System::Collections::Generic::List<Device^>^ _GetLinkedDevices(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result);
         System::Collections::Generic::List<int>^ _GetSnoozeIntervals();
+        Results::Value _LinkDataSource(System::Object^ item, bool link);
+        Results::Value _LinkDevice(System::Object^ item, bool link);
     };
 }
 #endif // Situation_h__
@@ -0,0 +1,99 @@
+// Declares the snapshot batch class.
+#ifndef SnapshotBatch_h__
+#define SnapshotBatch_h__
+
+#include "SnapshotResult.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The SnapshotBatch class takes a snapshot of a number of data sources at the same point in time, for example to
+    /// see what every camera in an area recorded at the time of an incident.  The recorded clip covering the time is
+    /// found and its snapshot endpoint resolved for every data source at once, and the images are fetched over a
+    /// bounded number of connections.  The result of each data source is passed to a callback as soon as it is
+    /// available; a data source that fails does not fail the batch.
+    /// </summary>
+    public ref class SnapshotBatch {
+    public:
+
+        /// <summary>
+        /// The snapshot result callback delegate.
+        /// </summary>
+        /// <param name="result">The result of taking the snapshot of a single data source.</param>
+        delegate void ResultDelegate(SnapshotResult^ result);
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        SnapshotBatch();
+
+        /// <summary>
+        /// Takes a snapshot of each of the given data sources at the given time.  If a clip on one data storage cannot
+        /// be read, any other clip covering the time is tried before the data source is reported as failed.  A data
+        /// source with no recorded clip covering the time is reported as <c>CameraUnavailable</c> if it is offline,
+        /// otherwise as <c>OperationFailed</c>.  This method blocks until every data source has been handled.
+        /// </summary>
+        /// <param name="dataSources">The data sources to take snapshots of.</param>
+        /// <param name="time">The time to take the snapshots at.</param>
+        /// <param name="callback">An optional callback to pass the result of each data source to as it finishes.</param>
+        /// <returns>A <c>List</c> of results, in the order the data sources finished.</returns>
+        System::Collections::Generic::List<SnapshotResult^>^ Take(System::Collections::Generic::IEnumerable<DataSource^>^ dataSources,
+            System::DateTime time, ResultDelegate^ callback);
+
+        /// <summary>
+        /// Gets the number of exceptions thrown by the callbacks passed to <see cref="Take"/>.  They are caught so that
+        /// the remaining data sources are still handled.
+        /// </summary>
+        /// <value>The number of callback exceptions.</value>
+        property int CallbackErrors {
+        public:
+            int get() { return _callbackErrors; }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of data sources whose clips and snapshot endpoints may be resolved at once.
+        /// Defaults to 16.
+        /// </summary>
+        /// <value>The maximum number of concurrent resolves.</value>
+        property int MaxConcurrentResolves;
+
+        /// <summary>
+        /// Gets or sets the maximum number of snapshots that may be fetched at once.  Defaults to 8.
+        /// </summary>
+        /// <value>The maximum number of concurrent fetches.</value>
+        property int MaxConcurrentRequests;
+
+        /// <summary>
+        /// Gets or sets the amount of time, in milliseconds, to wait for a snapshot to be fetched.  Defaults to 10000.
+        /// </summary>
+        /// <value>The fetch timeout in milliseconds.</value>
+        property int Timeout;
+
+        /// <summary>
+        /// Gets or sets the width of the snapshots in pixels, maintaining ratio.  Defaults to 0, the recorded size.
+        /// </summary>
+        /// <value>The snapshot width.</value>
+        property int Width;
+
+    internal:
+        int _callbackErrors;
+        Results::Value _Download(System::String^ uri, array<unsigned char>^% imageData);
+        System::Collections::Generic::List<Clip^>^ _GetCoveringClips(DataSource^ dataSource, System::DateTime time);
+        void _RunRequests(System::Object^ state);
+        SnapshotResult^ _Take(DataSource^ dataSource, System::DateTime time, System::Threading::SemaphoreSlim^ fetches);
+    };
+
+    /// <summary>
+    /// The state shared by the workers of a <see cref="SnapshotBatch::Take"/> call.
+    /// </summary>
+    private ref class SnapshotJob {
+    public:
+        System::Collections::Concurrent::ConcurrentQueue<DataSource^>^ DataSources;
+        System::Threading::CountdownEvent^ Workers;
+        System::Threading::SemaphoreSlim^ Fetches;
+        SnapshotBatch::ResultDelegate^ Callback;
+        System::Collections::Generic::List<SnapshotResult^>^ Results;
+        System::DateTime Time;
+    };
+}
+#endif // SnapshotBatch_h__
@@ -0,0 +1,71 @@
+// Declares the snapshot result class.
+#ifndef SnapshotResult_h__
+#define SnapshotResult_h__
+
+#include "DataSource.h"
+#include "Thumbnail.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The SnapshotResult class represents the outcome of taking the snapshot of a single data source as part of a
+    /// <see cref="SnapshotBatch"/>.
+    /// </summary>
+    public ref class SnapshotResult {
+    public:
+
+        /// <summary>
+        /// Gets the clip the snapshot was taken from.
+        /// </summary>
+        /// <value>The clip, or <c>nullptr</c> if no recorded clip covers the requested time.</value>
+        property VxSdkNet::Clip^ Clip {
+        public:
+            VxSdkNet::Clip^ get() { return _clip; }
+        }
+
+        /// <summary>
+        /// Gets the data source the snapshot was taken of.
+        /// </summary>
+        /// <value>The data source.</value>
+        property VxSdkNet::DataSource^ DataSource {
+        public:
+            VxSdkNet::DataSource^ get() { return _dataSource; }
+        }
+
+        /// <summary>
+        /// Gets the amount of time taking the snapshot took.
+        /// </summary>
+        /// <value>The snapshot duration.</value>
+        property System::TimeSpan Duration {
+        public:
+            System::TimeSpan get() { return _duration; }
+        }
+
+        /// <summary>
+        /// Gets the result of taking the snapshot.
+        /// </summary>
+        /// <value>The <see cref="Results::Value">Result</see> of taking the snapshot.</value>
+        property Results::Value Result {
+        public:
+            Results::Value get() { return _result; }
+        }
+
+        /// <summary>
+        /// Gets the snapshot image.
+        /// </summary>
+        /// <value>The snapshot, or <c>nullptr</c> if it could not be taken.</value>
+        property Thumbnail^ Snapshot {
+        public:
+            Thumbnail^ get() { return _snapshot; }
+        }
+
+    internal:
+        SnapshotResult(VxSdkNet::DataSource^ dataSource) : _dataSource(dataSource), _result(Results::Value::UnknownError) {}
+        VxSdkNet::Clip^ _clip;
+        VxSdkNet::DataSource^ _dataSource;
+        System::TimeSpan _duration;
+        Results::Value _result;
+        Thumbnail^ _snapshot;
+    };
+}
+#endif // SnapshotResult_h__
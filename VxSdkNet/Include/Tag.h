@@ -5,6 +5,7 @@
 #include "VxSdk.h"
 #include "Utils.h"
 #include "DataSource.h"
+#include "BulkLink.h"
 
 namespace VxSdkNet {
     ref class User;
@@ -27,7 +28,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Tag() {
-            this->!Tag();
+            NativeMemory::Remove(_tag);
+            _tag->Delete();
+            _tag = nullptr;
         }
 
         /// <summary>
@@ -81,6 +84,24 @@ namespace VxSdkNet {
         /// <returns>The <see cref="Results::Value">Result</see> of updating the properties.</returns>
         Results::Value Refresh();
 
+        /// <summary>
+        /// Links and unlinks data sources so that exactly the given data sources are linked to this tag.  Only the data sources
+        /// whose link needs to change are sent, and <c>nullptr</c> entries are ignored (see <see cref="BulkLink"/>).  If the current
+        /// links cannot be read, nothing is changed and each given entry reports the result of the read.
+        /// </summary>
+        /// <param name="dataSources">A <c>List</c> containing the data sources that should be linked.</param>
+        /// <returns>The <see cref="Results::Value">Result</see> of each link or unlink made, keyed by data source unique identifier.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ SetLinkedDataSources(System::Collections::Generic::List<DataSource^>^ dataSources);
+
+        /// <summary>
+        /// Links and unlinks devices so that exactly the given devices are linked to this tag.  Only the devices
+        /// whose link needs to change are sent, and <c>nullptr</c> entries are ignored (see <see cref="BulkLink"/>).  If the current
+        /// links cannot be read, nothing is changed and each given entry reports the result of the read.
+        /// </summary>
+        /// <param name="devices">A <c>List</c> containing the devices that should be linked.</param>
+        /// <returns>The <see cref="Results::Value">Result</see> of each link or unlink made, keyed by device unique identifier.</returns>
+        System::Collections::Generic::Dictionary<System::String^, Results::Value>^ SetLinkedDevices(System::Collections::Generic::List<Device^>^ devices);
+
         /// <summary>
         /// Remove data source associations from this tag.
         /// </summary>
@@ -193,9 +214,15 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxTag* _tag;
+        IdentityMap^ _identityMap;
+        System::Object^ _Fetch();
         VxSdkNet::ResourceLimits^ _GetLimits();
+        System::Collections::Generic::List<DataSource^>^ _GetLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result);
+        System::Collections::Generic::List<Device^>^ _GetLinkedDevices(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result);
         User^ _GetOwner();
         Tag^ _GetParent();
+        Results::Value _LinkDataSource(System::Object^ item, bool link);
+        Results::Value _LinkDevice(System::Object^ item, bool link);
     };
 }
 #endif // Tag_h__
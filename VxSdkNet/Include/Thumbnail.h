@@ -0,0 +1,60 @@
+// Declares the thumbnail class.
+#ifndef Thumbnail_h__
+#define Thumbnail_h__
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The Thumbnail class represents a snapshot image of a data source at a point in time, as produced by a
+    /// <see cref="ThumbnailStrip"/> or <see cref="SnapshotBatch"/>.
+    /// </summary>
+    public ref class Thumbnail {
+    public:
+
+        /// <summary>
+        /// Gets the unique identifier of the data source the thumbnail was taken from.
+        /// </summary>
+        /// <value>The unique identifier of the data source.</value>
+        property System::String^ DataSourceId {
+        public:
+            System::String^ get() { return _dataSourceId; }
+        }
+
+        /// <summary>
+        /// Gets the decoded thumbnail image.  The image is decoded the first time it is requested and shared by
+        /// every request for the same thumbnail, so it should not be disposed by the caller.
+        /// </summary>
+        /// <value>The thumbnail image.</value>
+        property System::Drawing::Image^ Image {
+        public:
+            System::Drawing::Image^ get();
+        }
+
+        /// <summary>
+        /// Gets the encoded (JPEG) thumbnail image data.
+        /// </summary>
+        /// <value>The image data.</value>
+        property array<unsigned char>^ ImageData {
+        public:
+            array<unsigned char>^ get() { return _imageData; }
+        }
+
+        /// <summary>
+        /// Gets the time the thumbnail represents.
+        /// </summary>
+        /// <value>The thumbnail time.</value>
+        property System::DateTime Time {
+        public:
+            System::DateTime get() { return _time; }
+        }
+
+    internal:
+        Thumbnail(System::String^ dataSourceId, System::DateTime time, array<unsigned char>^ imageData) :
+            _dataSourceId(dataSourceId), _time(time), _imageData(imageData) {}
+        System::String^ _dataSourceId;
+        System::DateTime _time;
+        array<unsigned char>^ _imageData;
+        System::Drawing::Image^ _image;
+    };
+}
+#endif // Thumbnail_h__
@@ -0,0 +1,153 @@
+// Declares the thumbnail strip class.
+#ifndef ThumbnailStrip_h__
+#define ThumbnailStrip_h__
+
+#include "DataSource.h"
+#include "Thumbnail.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// Holds the most recently used thumbnails, keyed by data source and time bucket.
+    /// </summary>
+    private ref class ThumbnailCache {
+    public:
+        ThumbnailCache(int capacity);
+        void Add(System::String^ key, Thumbnail^ thumbnail);
+        void Clear();
+        Thumbnail^ Get(System::String^ key);
+
+        property int Capacity {
+            int get() { return _capacity; }
+            void set(int value);
+        }
+
+    internal:
+        int _capacity;
+        System::Collections::Generic::Dictionary<System::String^, System::Collections::Generic::LinkedListNode<System::Collections::Generic::KeyValuePair<System::String^, Thumbnail^>>^>^ _entries;
+        System::Collections::Generic::LinkedList<System::Collections::Generic::KeyValuePair<System::String^, Thumbnail^>>^ _recent;
+        void _Trim();
+    };
+
+    /// <summary>
+    /// Tracks a thumbnail that is being fetched so that concurrent requests for it share the same fetch.
+    /// </summary>
+    private ref class PendingThumbnail {
+    public:
+        PendingThumbnail() : Completed(gcnew System::Threading::ManualResetEvent(false)) {}
+        System::Threading::ManualResetEvent^ Completed;
+        Thumbnail^ Result;
+    };
+
+    /// <summary>
+    /// A single thumbnail to be fetched as part of a <see cref="ThumbnailStrip::Generate"/> call.
+    /// </summary>
+    private ref class ThumbnailRequest {
+    public:
+        ThumbnailRequest(Clip^ clip, System::DateTime time, System::String^ key) : Clip(clip), Time(time), Key(key) {}
+        VxSdkNet::Clip^ Clip;
+        System::DateTime Time;
+        System::String^ Key;
+    };
+
+    /// <summary>
+    /// The ThumbnailStrip class generates evenly spaced thumbnails across a time range of a data source for use in
+    /// timeline displays.  Clips are resolved once per request, snapshots are fetched concurrently, identical requests
+    /// are coalesced and the results are kept in a cache shared by all thumbnail strips.
+    /// </summary>
+    public ref class ThumbnailStrip {
+    public:
+
+        /// <summary>
+        /// The thumbnail callback delegate.
+        /// </summary>
+        /// <param name="thumbnail">The thumbnail that has been generated.</param>
+        delegate void ThumbnailDelegate(Thumbnail^ thumbnail);
+
+        /// <summary>
+        /// Constructor.
+        /// </summary>
+        /// <param name="dataSource">The data source to generate thumbnails for.</param>
+        ThumbnailStrip(DataSource^ dataSource);
+
+        /// <summary>
+        /// Clears the thumbnail cache shared by all thumbnail strips.
+        /// </summary>
+        static void ClearCache();
+
+        /// <summary>
+        /// Generates a thumbnail every <paramref name="spacing"/> between the start and end time.  Thumbnails are
+        /// passed to the callback one at a time as they become available, which may be out of order and on a worker
+        /// thread.  Times not covered by a recorded clip, or whose snapshot could not be fetched, are skipped.  This
+        /// method blocks until every thumbnail has been handled.
+        /// </summary>
+        /// <param name="startTime">The time of the first thumbnail.</param>
+        /// <param name="endTime">The time at which no further thumbnails should be generated.</param>
+        /// <param name="spacing">The amount of time between thumbnails.</param>
+        /// <param name="callback">The callback to pass each thumbnail to.</param>
+        /// <returns>The number of thumbnails passed to the callback.</returns>
+        int Generate(System::DateTime startTime, System::DateTime endTime, System::TimeSpan spacing, ThumbnailDelegate^ callback);
+
+        /// <summary>
+        /// Gets the number of exceptions thrown by the callbacks passed to <see cref="Generate"/>.  They are caught so
+        /// that the remaining thumbnails are still generated.
+        /// </summary>
+        /// <value>The number of callback exceptions.</value>
+        property int CallbackErrors {
+        public:
+            int get() { return _callbackErrors; }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of thumbnails that may be fetched at once by this strip.  Defaults to 4.
+        /// </summary>
+        /// <value>The maximum number of concurrent fetches.</value>
+        property int MaxConcurrentRequests;
+
+        /// <summary>
+        /// Gets or sets the amount of time, in milliseconds, to wait for a snapshot to be fetched.  Defaults to 10000.
+        /// </summary>
+        /// <value>The fetch timeout in milliseconds.</value>
+        property int Timeout;
+
+        /// <summary>
+        /// Gets or sets the width of the thumbnails in pixels, maintaining ratio.  Defaults to 160.
+        /// </summary>
+        /// <value>The thumbnail width.</value>
+        property int Width;
+
+        /// <summary>
+        /// Gets or sets the maximum number of thumbnails kept in the cache shared by all thumbnail strips.  Defaults
+        /// to 2048.
+        /// </summary>
+        /// <value>The cache capacity.</value>
+        static property int CacheCapacity {
+            int get() { return _cache->Capacity; }
+            void set(int value) { _cache->Capacity = value; }
+        }
+
+    internal:
+        DataSource^ _dataSource;
+        System::String^ _dataSourceId;
+        int _callbackErrors;
+        static ThumbnailCache^ _cache = gcnew ThumbnailCache(2048);
+        static System::Collections::Concurrent::ConcurrentDictionary<System::String^, PendingThumbnail^>^ _pending =
+            gcnew System::Collections::Concurrent::ConcurrentDictionary<System::String^, PendingThumbnail^>();
+        array<unsigned char>^ _Download(System::String^ uri);
+        Thumbnail^ _Fetch(Clip^ clip, System::DateTime time, System::String^ key);
+        System::String^ _GetKey(long long bucket, System::TimeSpan spacing);
+        void _RunRequests(System::Object^ state);
+    };
+
+    /// <summary>
+    /// The state shared by the workers of a <see cref="ThumbnailStrip::Generate"/> call.
+    /// </summary>
+    private ref class ThumbnailJob {
+    public:
+        System::Collections::Concurrent::ConcurrentQueue<ThumbnailRequest^>^ Requests;
+        System::Threading::CountdownEvent^ Workers;
+        ThumbnailStrip::ThumbnailDelegate^ Callback;
+        int Delivered;
+    };
+}
+#endif // ThumbnailStrip_h__
@@ -25,7 +25,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~TimeTable() {
-            this->!TimeTable();
+            NativeMemory::Remove(_timeTable);
+            _timeTable->Delete();
+            _timeTable = nullptr;
         }
 
         /// <summary>
@@ -53,7 +53,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~User() {
-            this->!User();
+            NativeMemory::Remove(_user);
+            _user->Delete();
+            _user = nullptr;
         }
 
         /// <summary>
@@ -24,7 +24,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~UserAccount() {
-            this->!UserAccount();
+            NativeMemory::Remove(_userAccount);
+            _userAccount->Delete();
+            _userAccount = nullptr;
         }
 
         /// <summary>
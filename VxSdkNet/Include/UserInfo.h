@@ -5,6 +5,7 @@
 #include "VxSdk.h"
 #include "Utils.h"
 #include "User.h"
+#include "NativeReleaseQueue.h"
 
 namespace VxSdkNet {
 
@@ -20,20 +21,23 @@ namespace VxSdkNet {
         /// <param name="vxUserInfo">The vx user info.</param>
         UserInfo(VxSdk::IVxUserInfo* vxUserInfo) {
             _userInfo = vxUserInfo;
+            NativeMemory::Add(_userInfo);
         }
 
         /// <summary>
         /// Destructor.
         /// </summary>
         virtual ~UserInfo() {
-            this->!UserInfo();
+            NativeMemory::Remove(_userInfo);
+            _userInfo->Delete();
+            _userInfo = nullptr;
         }
 
         /// <summary>
         /// Finaliser.
         /// </summary>
         !UserInfo() {
-            _userInfo->Delete();
+            NativeReleaseQueue::Release(_userInfo);
             _userInfo = nullptr;
         }
 
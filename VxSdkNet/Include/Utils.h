@@ -6,6 +6,9 @@
 #include <msclr/marshal_cppstd.h>
 #include <string>
 #include "VxSdk.h"
+#include "IdentityMap.h"
+#include "NativeMemory.h"
+#include "SdkMetrics.h"
 
 namespace VxSdkNet {
 
@@ -97,6 +97,7 @@ namespace VxSdkNet {
         /// Virtual destructor.
         /// </summary>
         virtual ~VXSystem() {
+            _identityMap->_system = nullptr;
             this->!VXSystem();
         }
 
@@ -960,6 +961,14 @@ namespace VxSdkNet {
             System::String^ get() { return Utils::ConvertCppString(_system->id); }
         }
 
+        /// <summary>
+        /// Gets the identity map that shares the data source and device wrappers of this system.
+        /// </summary>
+        /// <value>The identity map of this system.</value>
+        property IdentityMap^ Identities {
+            IdentityMap^ get() { return _identityMap; }
+        }
+
         /// <summary>
         /// Gets the LDAP configuration.
         /// </summary>
@@ -1197,12 +1206,17 @@ namespace VxSdkNet {
 
     internal:
         VxSdk::IVxSystem* _system;
+        IdentityMap^ _identityMap;
         EventCallbackDelegate ^ _callback;
         InternalEventCallbackDelegate ^ _internalCallback;
         VxSdk::VxLoginInfo* _loginInfo;
         static EventDelegate ^ _systemEvent;
         static InternalEventDelegate ^ _sdkEvent;
         EventDelegate^ _eventDelegate;
+        System::Collections::Generic::List<EventDelegate^>^ _eventHandlers;
+        EventDelegate^ _siteEvent;
+        System::Object^ _notificationLock;
+        int _notificationUsers;
         static void _FireEvent(VxSdk::IVxEvent* vxEvent);
         static void _FireInternalEvent(VxSdk::VxInternalEvent* vxInternalEvent);
         Configuration::Auth^ _GetAuthConfig();
@@ -1223,6 +1237,11 @@ namespace VxSdkNet {
         Configuration::Snmp^ _GetSnmpConfig();
         Configuration::Time^ _GetTimeConfig();
         Configuration::Twilio^ _GetTwilioConfig();
+        void _OnEvent(VxSdk::IVxEvent* vxEvent);
+        Results::Value _StartNotifications();
+        Results::Value _StartSiteEvents(EventDelegate^ siteEvent);
+        Results::Value _StopNotifications();
+        Results::Value _StopSiteEvents();
     };
 }
 #endif // VXSystem_h__
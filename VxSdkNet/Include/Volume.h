@@ -24,7 +24,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~Volume() {
-            this->!Volume();
+            NativeMemory::Remove(_volume);
+            _volume->Delete();
+            _volume = nullptr;
         }
 
         /// <summary>
@@ -26,7 +26,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~VolumeGroup() {
-            this->!VolumeGroup();
+            NativeMemory::Remove(_volumeGroup);
+            _volumeGroup->Delete();
+            _volumeGroup = nullptr;
         }
 
         /// <summary>
@@ -22,7 +22,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~VxFile() {
-            this->!VxFile();
+            NativeMemory::Remove(_vxFile);
+            _vxFile->Delete();
+            _vxFile = nullptr;
         }
 
         /// <summary>
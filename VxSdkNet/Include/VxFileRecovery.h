@@ -43,7 +43,9 @@ namespace VxSdkNet {
         /// Destructor.
         /// </summary>
         virtual ~VxFileRecovery() {
-            this->!VxFileRecovery();
+            NativeMemory::Remove(_vxFileRecovery);
+            _vxFileRecovery->Delete();
+            _vxFileRecovery = nullptr;
         }
 
         /// <summary>
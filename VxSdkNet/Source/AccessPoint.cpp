@@ -3,15 +3,17 @@
 /// </summary>
 #include "AccessPoint.h"
 #include "Device.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::AccessPoint::AccessPoint(VxSdk::IVxAccessPoint* vxAccessPoint) {
     _accessPoint = vxAccessPoint;
+    NativeMemory::Add(_accessPoint);
 }
 
 VxSdkNet::AccessPoint::!AccessPoint() {
-    _accessPoint->Delete();
+    NativeReleaseQueue::Release(_accessPoint);
     _accessPoint = nullptr;
 }
 
@@ -37,16 +39,18 @@ List<VxSdkNet::ResourceRel^>^ VxSdkNet::AccessPoint::GetRelations(Dictionary<Fil
     }
 
     // Make the GetRelations call, which will return with the total resource count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _accessPoint->GetRelations(resourceRels);
+    SdkCall sdkCall("IVxAccessPoint::GetRelations", resourceRels);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _accessPoint->GetRelations(resourceRels));
     // As long as there are related resources for this access point the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxResourceRel collection
         resourceRels.collection = new VxSdk::IVxResourceRel * [resourceRels.collectionSize];
-        result = _accessPoint->GetRelations(resourceRels);
+        sdkCall.Restart("IVxAccessPoint::GetRelations", resourceRels);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _accessPoint->GetRelations(resourceRels));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < resourceRels.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::ResourceRel(resourceRels.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::ResourceRel>(_identityMap, resourceRels.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] resourceRels.collection;
@@ -55,25 +59,29 @@ List<VxSdkNet::ResourceRel^>^ VxSdkNet::AccessPoint::GetRelations(Dictionary<Fil
 }
 
 VxSdkNet::Results::Value VxSdkNet::AccessPoint::Lock(int seconds) {
-    return (Results::Value)_accessPoint->Lock(seconds);
+    SdkCall sdkCall("IVxAccessPoint::Lock");
+    return (Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _accessPoint->Lock(seconds));
 }
 
 VxSdkNet::Results::Value VxSdkNet::AccessPoint::Refresh() {
-    return (Results::Value)_accessPoint->Refresh();
+    SdkCall sdkCall("IVxAccessPoint::Refresh");
+    return (Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _accessPoint->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::AccessPoint::Unlock(int seconds) {
-    return (Results::Value)_accessPoint->Unlock(seconds);
+    SdkCall sdkCall("IVxAccessPoint::Unlock");
+    return (Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _accessPoint->Unlock(seconds));
 }
 
 VxSdkNet::Device^ VxSdkNet::AccessPoint::_GetHostDevice() {
     // Get the host device
     VxSdk::IVxDevice* device = nullptr;
-    VxSdk::VxResult::Value result = _accessPoint->GetHostDevice(device);
+    SdkCall sdkCall("IVxAccessPoint::GetHostDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _accessPoint->GetHostDevice(device));
 
     // Return the host device if GetHostDevice was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew Device(device);
+        return IdentityMap::Intern<Device>(_identityMap, device);
 
     return nullptr;
 }
@@ -81,7 +89,8 @@ VxSdkNet::Device^ VxSdkNet::AccessPoint::_GetHostDevice() {
 VxSdkNet::ResourceLimits^ VxSdkNet::AccessPoint::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _accessPoint->GetLimits(limits);
+    SdkCall sdkCall("IVxAccessPoint::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _accessPoint->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -3,30 +3,34 @@
 /// </summary>
 #include "AlarmInput.h"
 #include "Device.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::AlarmInput::AlarmInput(VxSdk::IVxAlarmInput* vxAlarmInput) {
     _alarmInput = vxAlarmInput;
+    NativeMemory::Add(_alarmInput);
 }
 
 VxSdkNet::AlarmInput::!AlarmInput() {
-    _alarmInput->Delete();
+    NativeReleaseQueue::Release(_alarmInput);
     _alarmInput = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::AlarmInput::Refresh() {
-    return (VxSdkNet::Results::Value)_alarmInput->Refresh();
+    SdkCall sdkCall("IVxAlarmInput::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _alarmInput->Refresh());
 }
 
 VxSdkNet::Device^ VxSdkNet::AlarmInput::_GetHostDevice() {
     // Get the host device
     VxSdk::IVxDevice* device = nullptr;
-    VxSdk::VxResult::Value result = _alarmInput->GetHostDevice(device);
+    SdkCall sdkCall("IVxAlarmInput::GetHostDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _alarmInput->GetHostDevice(device));
 
     // Return the host device if GetHostDevice was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::Device(device);
+        return IdentityMap::Intern<VxSdkNet::Device>(_identityMap, device);
 
     return nullptr;
 }
@@ -34,7 +38,8 @@ VxSdkNet::Device^ VxSdkNet::AlarmInput::_GetHostDevice() {
 VxSdkNet::ResourceLimits^ VxSdkNet::AlarmInput::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _alarmInput->GetLimits(limits);
+    SdkCall sdkCall("IVxAlarmInput::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _alarmInput->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -11,7 +11,8 @@ VxSdkNet::AnalyticBehavior::AnalyticBehavior(VxSdk::IVxAnalyticBehavior* vxAnaly
 }
 
 VxSdkNet::Results::Value VxSdkNet::AnalyticBehavior::Refresh() {
-    return (VxSdkNet::Results::Value)_analyticBehavior->Refresh();
+    SdkCall sdkCall("IVxAnalyticBehavior::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _analyticBehavior->Refresh());
 }
 
 void VxSdkNet::AnalyticBehavior::_SetObjectLineCounter(VxSdkNet::ObjectLineCounter^ objectLineCounter) {
@@ -4,15 +4,17 @@
 #include "AnalyticConfig.h"
 #include "AnalyticBehavior.h"
 #include "NewAnalyticBehavior.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::AnalyticConfig::AnalyticConfig(VxSdk::IVxAnalyticConfig* vxAnalyticConfig) {
     _analyticConfig = vxAnalyticConfig;
+    NativeMemory::Add(_analyticConfig);
 }
 
 VxSdkNet::AnalyticConfig::!AnalyticConfig() {
-    _analyticConfig->Delete();
+    NativeReleaseQueue::Release(_analyticConfig);
     _analyticConfig = nullptr;
 }
 
@@ -61,7 +63,8 @@ VxSdkNet::Results::Value VxSdkNet::AnalyticConfig::AddAnalyticBehavior(VxSdkNet:
     }
 
     // Make the call to add the analytic behavior
-    VxSdk::VxResult::Value result = _analyticConfig->AddAnalyticBehavior(vxNewAnalyticBehavior);
+    SdkCall sdkCall("IVxAnalyticConfig::AddAnalyticBehavior");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _analyticConfig->AddAnalyticBehavior(vxNewAnalyticBehavior));
     // Unless there was an issue creating the analytic behavior the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -74,7 +77,8 @@ VxSdkNet::Results::Value VxSdkNet::AnalyticConfig::DeleteAnalyticBehavior(VxSdkN
 }
 
 VxSdkNet::Results::Value VxSdkNet::AnalyticConfig::Refresh() {
-    return (VxSdkNet::Results::Value)_analyticConfig->Refresh();
+    SdkCall sdkCall("IVxAnalyticConfig::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _analyticConfig->Refresh());
 }
 
 List<VxSdkNet::AnalyticBehavior^>^ VxSdkNet::AnalyticConfig::_GetAnalyticBehaviors() {
@@ -3,26 +3,30 @@
 /// </summary>
 #include "AnalyticSession.h"
 #include "AnalyticConfig.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::AnalyticSession::AnalyticSession(VxSdk::IVxAnalyticSession* vxAnalyticSession) {
     _analyticSession = vxAnalyticSession;
+    NativeMemory::Add(_analyticSession);
 }
 
 VxSdkNet::AnalyticSession::!AnalyticSession() {
-    _analyticSession->Delete();
+    NativeReleaseQueue::Release(_analyticSession);
     _analyticSession = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::AnalyticSession::Refresh() {
-    return (VxSdkNet::Results::Value)_analyticSession->Refresh();
+    SdkCall sdkCall("IVxAnalyticSession::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _analyticSession->Refresh());
 }
 
 VxSdkNet::AnalyticConfig^ VxSdkNet::AnalyticSession::_GetAnalyticConfig() {
     // Get the analytic config
     VxSdk::IVxAnalyticConfig* analyticConfig = nullptr;
-    VxSdk::VxResult::Value result = _analyticSession->GetAnalyticConfig(analyticConfig);
+    SdkCall sdkCall("IVxAnalyticSession::GetAnalyticConfig");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _analyticSession->GetAnalyticConfig(analyticConfig));
 
     // Return the analytic config if GetAnalyticConfig was successful
     if (result == VxSdk::VxResult::kOK)
@@ -34,11 +38,12 @@ VxSdkNet::AnalyticConfig^ VxSdkNet::AnalyticSession::_GetAnalyticConfig() {
 VxSdkNet::DataSource^ VxSdkNet::AnalyticSession::_GetDataSource() {
     // Get the data source
     VxSdk::IVxDataSource* dataSource = nullptr;
-    VxSdk::VxResult::Value result = _analyticSession->GetDataSource(dataSource);
+    SdkCall sdkCall("IVxAnalyticSession::GetDataSource");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _analyticSession->GetDataSource(dataSource));
 
     // Return the data source if GetDataSource was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::DataSource(dataSource);
+        return IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSource);
 
     return nullptr;
 }
@@ -46,11 +51,12 @@ VxSdkNet::DataSource^ VxSdkNet::AnalyticSession::_GetDataSource() {
 VxSdkNet::Device^ VxSdkNet::AnalyticSession::_GetHostDevice() {
     // Get the device
     VxSdk::IVxDevice* device = nullptr;
-    VxSdk::VxResult::Value result = _analyticSession->GetHostDevice(device);
+    SdkCall sdkCall("IVxAnalyticSession::GetHostDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _analyticSession->GetHostDevice(device));
 
     // Return the device if GetHostDevice was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::Device(device);
+        return IdentityMap::Intern<VxSdkNet::Device>(_identityMap, device);
 
     return nullptr;
 }
@@ -58,7 +64,8 @@ VxSdkNet::Device^ VxSdkNet::AnalyticSession::_GetHostDevice() {
 VxSdkNet::ResourceLimits^ VxSdkNet::AnalyticSession::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _analyticSession->GetLimits(limits);
+    SdkCall sdkCall("IVxAnalyticSession::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _analyticSession->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -2,30 +2,34 @@
 /// Implements the bookmark class.
 /// </summary>
 #include "Bookmark.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Bookmark::Bookmark(VxSdk::IVxBookmark* vxBookmark) {
     _bookmark = vxBookmark;
+    NativeMemory::Add(_bookmark);
 }
 
 VxSdkNet::Bookmark::!Bookmark() {
-    _bookmark->Delete();
+    NativeReleaseQueue::Release(_bookmark);
     _bookmark = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Bookmark::Refresh() {
-    return (VxSdkNet::Results::Value)_bookmark->Refresh();
+    SdkCall sdkCall("IVxBookmark::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _bookmark->Refresh());
 }
 
 VxSdkNet::DataSource^ VxSdkNet::Bookmark::_GetDataSource() {
     // Get the data source
     VxSdk::IVxDataSource* dataSource = nullptr;
-    VxSdk::VxResult::Value result = _bookmark->GetDataSource(dataSource);
+    SdkCall sdkCall("IVxBookmark::GetDataSource");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _bookmark->GetDataSource(dataSource));
 
     // Return the data source if GetDataSource was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::DataSource(dataSource);
+        return IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSource);
 
     return nullptr;
 }
@@ -33,7 +37,8 @@ VxSdkNet::DataSource^ VxSdkNet::Bookmark::_GetDataSource() {
 VxSdkNet::ResourceLimits^ VxSdkNet::Bookmark::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _bookmark->GetLimits(limits);
+    SdkCall sdkCall("IVxBookmark::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _bookmark->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -45,7 +50,8 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Bookmark::_GetLimits() {
 VxSdkNet::BookmarkLock^ VxSdkNet::Bookmark::_GetLock() {
     // Get the bookmark lock
     VxSdk::IVxBookmarkLock* bookmarkLock = nullptr;
-    VxSdk::VxResult::Value result = _bookmark->GetLock(bookmarkLock);
+    SdkCall sdkCall("IVxBookmark::GetLock");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _bookmark->GetLock(bookmarkLock));
 
     // Return the bookmark lock if GetLock was successful
     if (result == VxSdk::VxResult::kOK)
@@ -2,22 +2,25 @@
 /// Implements the bookmark lock class.
 /// </summary>
 #include "BookmarkLock.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::BookmarkLock::BookmarkLock(VxSdk::IVxBookmarkLock* vxBookmarkLock) {
     _bookmarkLock = vxBookmarkLock;
+    NativeMemory::Add(_bookmarkLock);
 }
 
 VxSdkNet::BookmarkLock::!BookmarkLock() {
-    _bookmarkLock->Delete();
+    NativeReleaseQueue::Release(_bookmarkLock);
     _bookmarkLock = nullptr;
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::BookmarkLock::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _bookmarkLock->GetLimits(limits);
+    SdkCall sdkCall("IVxBookmarkLock::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _bookmarkLock->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -27,5 +30,6 @@ VxSdkNet::ResourceLimits^ VxSdkNet::BookmarkLock::_GetLimits() {
 }
 
 VxSdkNet::Results::Value VxSdkNet::BookmarkLock::Refresh() {
-    return (VxSdkNet::Results::Value)_bookmarkLock->Refresh();
+    SdkCall sdkCall("IVxBookmarkLock::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _bookmarkLock->Refresh());
 }
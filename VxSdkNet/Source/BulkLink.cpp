@@ -0,0 +1,109 @@
+/// <summary>
+/// Implements the bulk link class.
+/// </summary>
+#include <msclr/lock.h>
+#include "BulkLink.h"
+
+using namespace System;
+using namespace System::Collections::Concurrent;
+using namespace System::Collections::Generic;
+using namespace System::Runtime::ExceptionServices;
+using namespace System::Threading;
+
+void VxSdkNet::BulkLink::MaxConcurrentObjects::set(int value) {
+    // At least one object must be allowed at a time
+    if (value < 1)
+        value = 1;
+
+    // Calls already holding a slot release it to the semaphore they acquired it from
+    _maxConcurrentObjects = value;
+    _objectSlots = gcnew SemaphoreSlim(value);
+}
+
+Dictionary<String^, VxSdkNet::Results::Value>^ VxSdkNet::BulkLink::_SetLinked(Dictionary<String^, Object^>^ desired,
+    Dictionary<String^, Object^>^ linked, VxSdk::VxResult::Value readResult, LinkDelegate^ linkDelegate,
+    FetchDelegate^ fetchDelegate) {
+    BulkLinkJob^ job = gcnew BulkLinkJob();
+    job->Operations = gcnew ConcurrentQueue<LinkOperation^>();
+    job->ItemResults = gcnew Dictionary<String^, Results::Value>();
+
+    // The changes can't be worked out without knowing what is linked, so report the failed read against every
+    // resource that should be linked rather than linking or unlinking anything
+    if (readResult != VxSdk::VxResult::kOK) {
+        for each (String^ id in desired->Keys)
+            job->ItemResults[id] = Results::Value(readResult);
+
+        return job->ItemResults;
+    }
+
+    // Only send the differences between what should be linked and what already is
+    for each (KeyValuePair<String^, Object^> item in desired) {
+        if (!linked->ContainsKey(item.Key))
+            job->Operations->Enqueue(gcnew LinkOperation(item.Key, item.Value, true));
+    }
+
+    for each (KeyValuePair<String^, Object^> item in linked) {
+        if (!desired->ContainsKey(item.Key))
+            job->Operations->Enqueue(gcnew LinkOperation(item.Key, item.Value, false));
+    }
+
+    // Limit the number of objects being changed at the same time
+    List<Object^>^ handles = gcnew List<Object^>();
+    SemaphoreSlim^ objectSlots = _objectSlots;
+    objectSlots->Wait();
+    try {
+        // Each worker but the first uses a handle of its own, as a native object does not support concurrent calls
+        int workerCount = Math::Min(_maxHandlesPerObject, (job->Operations->Count + ChangesPerHandle - 1) / ChangesPerHandle);
+        List<BulkLinkWorker^>^ workers = gcnew List<BulkLinkWorker^>();
+        workers->Add(gcnew BulkLinkWorker(job, linkDelegate));
+        while (workers->Count < workerCount && fetchDelegate != nullptr) {
+            Object^ handle = fetchDelegate();
+            if (handle == nullptr)
+                break;
+
+            handles->Add(handle);
+            workers->Add(gcnew BulkLinkWorker(job, safe_cast<LinkDelegate^>(
+                Delegate::CreateDelegate(LinkDelegate::typeid, handle, linkDelegate->Method))));
+        }
+
+        // The calling thread is the first worker
+        job->Workers = gcnew CountdownEvent(workers->Count);
+        for (int i = 1; i < workers->Count; i++)
+            ThreadPool::QueueUserWorkItem(gcnew WaitCallback(&VxSdkNet::BulkLink::_RunOperations), workers[i]);
+
+        _RunOperations(workers[0]);
+        job->Workers->Wait();
+    }
+    finally {
+        objectSlots->Release();
+        for each (Object^ handle in handles)
+            delete handle;
+    }
+
+    if (job->Fault != nullptr)
+        ExceptionDispatchInfo::Capture(job->Fault)->Throw();
+
+    return job->ItemResults;
+}
+
+void VxSdkNet::BulkLink::_RunOperations(Object^ state) {
+    BulkLinkWorker^ worker = safe_cast<BulkLinkWorker^>(state);
+    BulkLinkJob^ job = worker->Job;
+    try {
+        LinkOperation^ operation;
+        while (job->Fault == nullptr && job->Operations->TryDequeue(operation)) {
+            Results::Value result = worker->LinkDelegate(operation->Item, operation->Link);
+
+            msclr::lock resultsLock(job->ItemResults);
+            job->ItemResults[operation->Id] = result;
+        }
+    }
+    catch (Exception^ e) {
+        // Stop the other workers and rethrow on the calling thread, as an exception on a pool thread would end the
+        // process
+        Interlocked::CompareExchange<Exception^>(job->Fault, e, nullptr);
+    }
+    finally {
+        job->Workers->Signal();
+    }
+}
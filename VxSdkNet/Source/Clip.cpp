@@ -2,15 +2,17 @@
 /// Implements the clip class.
 /// </summary>
 #include "Clip.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Clip::Clip(VxSdk::IVxClip* vxClip) {
     _clip = vxClip;
+    NativeMemory::Add(_clip);
 }
 
 VxSdkNet::Clip::!Clip() {
-    _clip->Delete();
+    NativeReleaseQueue::Release(_clip);
     _clip = nullptr;
 }
 
@@ -83,7 +85,8 @@ System::String^ VxSdkNet::Clip::GetSnapshotEndpoint(SnapshotFilter^ filter) {
 
     // If the rtsp uri is not available on the datasource the result will return VxSdk::VxResult::kActionUnavailable,
     // otherwise VxSdk::VxResult::kInsufficientSize
-    VxSdk::VxResult::Value result = _clip->GetSnapshotEndpoint(vxFilter, filterSize, snapshotEndpoint, size);
+    SdkCall sdkCall("IVxClip::GetSnapshotEndpoint");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _clip->GetSnapshotEndpoint(vxFilter, filterSize, snapshotEndpoint, size));
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for rtspEndpoint
         snapshotEndpoint = new char[size];
@@ -9,6 +9,7 @@
 #include "SmtpInfo.h"
 #include "Volume.h"
 #include "VolumeGroup.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
@@ -18,21 +19,24 @@ using namespace System::Collections::Generic;
 
 VxSdkNet::Configuration::Auth::Auth(VxSdk::IVxConfiguration::Auth* vxConfigAuth) {
     _configAuth = vxConfigAuth;
+    NativeMemory::Add(_configAuth);
 }
 
 VxSdkNet::Configuration::Auth::!Auth() {
-    _configAuth->Delete();
+    NativeReleaseQueue::Release(_configAuth);
     _configAuth = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Auth::Refresh() {
-    return (VxSdkNet::Results::Value)_configAuth->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Auth::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configAuth->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Auth::SetPassword(System::String^ newPassword, bool mustChangePassword) {
     char password[1024];
     VxSdk::Utilities::StrCopySafe(password, Utils::ConvertCSharpString(newPassword).c_str());
-    VxSdk::VxResult::Value result = _configAuth->SetPassword(password, mustChangePassword);
+    SdkCall sdkCall("IVxConfiguration::Auth::SetPassword");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configAuth->SetPassword(password, mustChangePassword));
 
     return VxSdkNet::Results::Value(result);
 }
@@ -61,7 +65,8 @@ VxSdkNet::Results::Value VxSdkNet::Configuration::Auth::SetUser(NewUser^ user) {
     }
 
     // Make the call to set the user
-    VxSdk::VxResult::Value result = _configAuth->SetUser(vxNewUser);
+    SdkCall sdkCall("IVxConfiguration::Auth::SetUser");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configAuth->SetUser(vxNewUser));
 
     return VxSdkNet::Results::Value(result);
 }
@@ -69,7 +74,8 @@ VxSdkNet::Results::Value VxSdkNet::Configuration::Auth::SetUser(NewUser^ user) {
 VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Auth::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configAuth->GetLimits(limits);
+    SdkCall sdkCall("IVxConfiguration::Auth::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configAuth->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -84,21 +90,24 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Auth::_GetLimits() {
 
 VxSdkNet::Configuration::Bookmark::Bookmark(VxSdk::IVxConfiguration::Bookmark* vxConfigBookmark) {
     _configBookmark = vxConfigBookmark;
+    NativeMemory::Add(_configBookmark);
 }
 
 VxSdkNet::Configuration::Bookmark::!Bookmark() {
-    _configBookmark->Delete();
+    NativeReleaseQueue::Release(_configBookmark);
     _configBookmark = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Bookmark::Refresh() {
-    return (VxSdkNet::Results::Value)_configBookmark->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Bookmark::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configBookmark->Refresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Bookmark::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configBookmark->GetLimits(limits);
+    SdkCall sdkCall("IVxConfiguration::Bookmark::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configBookmark->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -113,15 +122,17 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Bookmark::_GetLimits() {
 
 VxSdkNet::Configuration::Cluster::Cluster(VxSdk::IVxConfiguration::Cluster* vxConfigCluster) {
     _configCluster = vxConfigCluster;
+    NativeMemory::Add(_configCluster);
 }
 
 VxSdkNet::Configuration::Cluster::!Cluster() {
-    _configCluster->Delete();
+    NativeReleaseQueue::Release(_configCluster);
     _configCluster = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Cluster::Refresh() {
-    return (VxSdkNet::Results::Value)_configCluster->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Cluster::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configCluster->Refresh());
 }
 
 bool VxSdkNet::Configuration::Cluster::ValidateExportPath(NetworkStorageInfo^ exportStorageInfo) {   
@@ -141,7 +152,8 @@ bool VxSdkNet::Configuration::Cluster::ValidateExportPath(NetworkStorageInfo^ ex
 VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Cluster::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configCluster->GetLimits(limits);
+    SdkCall sdkCall("IVxConfiguration::Cluster::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configCluster->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -157,12 +169,14 @@ System::Collections::Generic::List<VxSdkNet::Configuration::Node^>^ VxSdkNet::Co
     VxSdk::VxCollection<VxSdk::IVxConfiguration::Node**> nodes;
 
     // Make the GetNodeConfigurations call, which will return with the total count of nodes, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _configCluster->GetNodeConfigurations(nodes);
+    SdkCall sdkCall("IVxConfiguration::Cluster::GetNodeConfigurations", nodes);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configCluster->GetNodeConfigurations(nodes));
     // Unless there are no nodes on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetNodeConfigurations call
         nodes.collection = new VxSdk::IVxConfiguration::Node*[nodes.collectionSize];
-        result = _configCluster->GetNodeConfigurations(nodes);
+        sdkCall.Restart("IVxConfiguration::Cluster::GetNodeConfigurations", nodes);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configCluster->GetNodeConfigurations(nodes));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < nodes.collectionSize; i++)
@@ -177,7 +191,8 @@ System::Collections::Generic::List<VxSdkNet::Configuration::Node^>^ VxSdkNet::Co
 VxSdkNet::Configuration::Time^ VxSdkNet::Configuration::Cluster::_GetTimeConfig() {
     // Get the time config for the cluster
     VxSdk::IVxConfiguration::Time* time = nullptr;
-    VxSdk::VxResult::Value result = _configCluster->GetTimeConfig(time);
+    SdkCall sdkCall("IVxConfiguration::Cluster::GetTimeConfig");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configCluster->GetTimeConfig(time));
 
     // Return the time config if GetTimeConfig was successful
     if (result == VxSdk::VxResult::kOK)
@@ -192,21 +207,24 @@ VxSdkNet::Configuration::Time^ VxSdkNet::Configuration::Cluster::_GetTimeConfig(
 
 VxSdkNet::Configuration::Event::Event(VxSdk::IVxConfiguration::Event* vxConfigEvent) {
     _configEvent = vxConfigEvent;
+    NativeMemory::Add(_configEvent);
 }
 
 VxSdkNet::Configuration::Event::!Event() {
-    _configEvent->Delete();
+    NativeReleaseQueue::Release(_configEvent);
     _configEvent = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Event::Refresh() {
-    return (VxSdkNet::Results::Value)_configEvent->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Event::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configEvent->Refresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Event::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configEvent->GetLimits(limits);
+    SdkCall sdkCall("IVxConfiguration::Event::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configEvent->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -221,28 +239,32 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Event::_GetLimits() {
 
 VxSdkNet::Configuration::Export::Export(VxSdk::IVxConfiguration::Export* vxConfigExport) {
     _configExport = vxConfigExport;
+    NativeMemory::Add(_configExport);
 }
 
 VxSdkNet::Configuration::Export::!Export() {
-    _configExport->Delete();
+    NativeReleaseQueue::Release(_configExport);
     _configExport = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Export::Refresh() {
-    return (VxSdkNet::Results::Value)_configExport->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Export::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configExport->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Export::SetProtectPassword(System::String^ globalPassword) {
     char password[1024];
     VxSdk::Utilities::StrCopySafe(password, Utils::ConvertCSharpString(globalPassword).c_str());
 
-    return (VxSdkNet::Results::Value)_configExport->SetProtectPassword(password);
+    SdkCall sdkCall("IVxConfiguration::Export::SetProtectPassword");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configExport->SetProtectPassword(password));
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Export::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configExport->GetLimits(limits);
+    SdkCall sdkCall("IVxConfiguration::Export::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configExport->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -257,15 +279,17 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Export::_GetLimits() {
 
 VxSdkNet::Configuration::Ldap::Ldap(VxSdk::IVxConfiguration::Ldap* vxConfigLdap) {
     _configLdap = vxConfigLdap;
+    NativeMemory::Add(_configLdap);
 }
 
 VxSdkNet::Configuration::Ldap::!Ldap() {
-    _configLdap->Delete();
+    NativeReleaseQueue::Release(_configLdap);
     _configLdap = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Ldap::Refresh() {
-    return (VxSdkNet::Results::Value)_configLdap->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Ldap::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configLdap->Refresh());
 }
 
 bool VxSdkNet::Configuration::Ldap::ValidateLdapCredentials(LdapValidationCredentials^ ldapCredentials) {
@@ -295,7 +319,8 @@ bool VxSdkNet::Configuration::Ldap::ValidateLdapCredentials(LdapValidationCreden
 VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Ldap::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configLdap->GetLimits(limits);
+    SdkCall sdkCall("IVxConfiguration::Ldap::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configLdap->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -310,21 +335,24 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Ldap::_GetLimits() {
 
 VxSdkNet::Configuration::Motion::Motion(VxSdk::IVxConfiguration::Motion* vxConfigMotion) {
     _configMotion = vxConfigMotion;
+    NativeMemory::Add(_configMotion);
 }
 
 VxSdkNet::Configuration::Motion::!Motion() {
-    _configMotion->Delete();
+    NativeReleaseQueue::Release(_configMotion);
     _configMotion = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Motion::Refresh() {
-    return (VxSdkNet::Results::Value)_configMotion->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Motion::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configMotion->Refresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Motion::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configMotion->GetLimits(limits);
+    SdkCall sdkCall("IVxConfiguration::Motion::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configMotion->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -339,15 +367,17 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Motion::_GetLimits() {
 
 VxSdkNet::Configuration::Node::Node(VxSdk::IVxConfiguration::Node* vxConfigNode) {
     _configNode = vxConfigNode;
+    NativeMemory::Add(_configNode);
 }
 
 VxSdkNet::Configuration::Node::!Node() {
-    _configNode->Delete();
+    NativeReleaseQueue::Release(_configNode);
     _configNode = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Node::Refresh() {
-    return (VxSdkNet::Results::Value)_configNode->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Node::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configNode->Refresh());
 }
 
 // ====================================================================================================================
@@ -356,15 +386,17 @@ VxSdkNet::Results::Value VxSdkNet::Configuration::Node::Refresh() {
 
 VxSdkNet::Configuration::Report::Report(VxSdk::IVxConfiguration::Report* vxConfigReport) {
     _configReport = vxConfigReport;
+    NativeMemory::Add(_configReport);
 }
 
 VxSdkNet::Configuration::Report::!Report() {
-    _configReport->Delete();
+    NativeReleaseQueue::Release(_configReport);
     _configReport = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Report::Refresh() {
-    return (VxSdkNet::Results::Value)_configReport->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Report::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configReport->Refresh());
 }
 
 void VxSdkNet::Configuration::Report::_SetStorageLocation(VxSdkNet::NetworkStorageInfo^ storageInfo) {
@@ -381,25 +413,29 @@ void VxSdkNet::Configuration::Report::_SetStorageLocation(VxSdkNet::NetworkStora
 
 VxSdkNet::Configuration::Server::Server(VxSdk::IVxConfiguration::Server* vxConfigServer) {
     _configServer = vxConfigServer;
+    NativeMemory::Add(_configServer);
 }
 
 VxSdkNet::Configuration::Server::!Server() {
-    _configServer->Delete();
+    NativeReleaseQueue::Release(_configServer);
     _configServer = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Server::Refresh() {
-    return (VxSdkNet::Results::Value)_configServer->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Server::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configServer->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Server::Restart() {
-    return (VxSdkNet::Results::Value)_configServer->Restart();
+    SdkCall sdkCall("IVxConfiguration::Server::Restart");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configServer->Restart());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Server::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configServer->GetLimits(limits);
+    SdkCall sdkCall("IVxConfiguration::Server::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configServer->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -414,15 +450,17 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Server::_GetLimits() {
 
 VxSdkNet::Configuration::Smtp::Smtp(VxSdk::IVxConfiguration::Smtp* vxConfigSmtp) {
     _configSmtp = vxConfigSmtp;
+    NativeMemory::Add(_configSmtp);
 }
 
 VxSdkNet::Configuration::Smtp::!Smtp() {
-    _configSmtp->Delete();
+    NativeReleaseQueue::Release(_configSmtp);
     _configSmtp = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Smtp::Refresh() {
-    return (VxSdkNet::Results::Value)_configSmtp->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Smtp::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configSmtp->Refresh());
 }
 
 bool VxSdkNet::Configuration::Smtp::ValidateSmtpInfo(SmtpInfo^ smtpInfo) {
@@ -444,7 +482,8 @@ bool VxSdkNet::Configuration::Smtp::ValidateSmtpInfo(SmtpInfo^ smtpInfo) {
 VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Smtp::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configSmtp->GetLimits(limits);
+    SdkCall sdkCall("IVxConfiguration::Smtp::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configSmtp->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -459,21 +498,24 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Smtp::_GetLimits() {
 
 VxSdkNet::Configuration::Snmp::Snmp(VxSdk::IVxConfiguration::Snmp* vxConfigSnmp) {
     _configSnmp = vxConfigSnmp;
+    NativeMemory::Add(_configSnmp);
 }
 
 VxSdkNet::Configuration::Snmp::!Snmp() {
-    _configSnmp->Delete();
+    NativeReleaseQueue::Release(_configSnmp);
     _configSnmp = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Snmp::Refresh() {
-    return (VxSdkNet::Results::Value)_configSnmp->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Snmp::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configSnmp->Refresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Snmp::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configSnmp->GetLimits(limits);
+    SdkCall sdkCall("IVxConfiguration::Snmp::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configSnmp->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -488,10 +530,11 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Snmp::_GetLimits() {
 
 VxSdkNet::Configuration::Storage::Storage(VxSdk::IVxConfiguration::Storage* vxConfigStorage) {
     _configStorage = vxConfigStorage;
+    NativeMemory::Add(_configStorage);
 }
 
 VxSdkNet::Configuration::Storage::!Storage() {
-    _configStorage->Delete();
+    NativeReleaseQueue::Release(_configStorage);
     _configStorage = nullptr;
 }
 
@@ -506,7 +549,8 @@ VxSdkNet::Results::Value VxSdkNet::Configuration::Storage::CreateVolume(NewVolum
     vxNewVolume.buffer = newVolume->Buffer;
 
     // Make the call to add the volume to the storage
-    VxSdk::VxResult::Value result = _configStorage->CreateVolume(vxNewVolume);
+    SdkCall sdkCall("IVxConfiguration::Storage::CreateVolume");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configStorage->CreateVolume(vxNewVolume));
 
     return VxSdkNet::Results::Value(result);
 }
@@ -518,7 +562,8 @@ VxSdkNet::Results::Value VxSdkNet::Configuration::Storage::CreateVolumeGroup(New
     vxNewVolumeGroup.isArchiveGroup = newVolumeGroup->IsArchiveGroup;
 
     // Make the call to add the volume group to the storage
-    VxSdk::VxResult::Value result = _configStorage->CreateVolumeGroup(vxNewVolumeGroup);
+    SdkCall sdkCall("IVxConfiguration::Storage::CreateVolumeGroup");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configStorage->CreateVolumeGroup(vxNewVolumeGroup));
 
     return VxSdkNet::Results::Value(result);
 }
@@ -538,11 +583,13 @@ VxSdkNet::Results::Value VxSdkNet::Configuration::Storage::DeleteVolumeGroup(Vol
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Storage::RebuildDatabase() {
-    return (VxSdkNet::Results::Value)_configStorage->RebuildDatabase();
+    SdkCall sdkCall("IVxConfiguration::Storage::RebuildDatabase");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configStorage->RebuildDatabase());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Storage::Refresh() {
-    return (VxSdkNet::Results::Value)_configStorage->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Storage::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configStorage->Refresh());
 }
 
 List<VxSdkNet::VolumeGroup^>^ VxSdkNet::Configuration::Storage::GetVolumeGroups(Dictionary<Filters::Value, System::String^>^ filters) {
@@ -567,12 +614,14 @@ List<VxSdkNet::VolumeGroup^>^ VxSdkNet::Configuration::Storage::GetVolumeGroups(
     }
 
     // Make the GetVolumeGroups call, which will return with the total volume group count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _configStorage->GetVolumeGroups(volumeGroups);
+    SdkCall sdkCall("IVxConfiguration::Storage::GetVolumeGroups", volumeGroups);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configStorage->GetVolumeGroups(volumeGroups));
     // Unless there are no volume groups on the storage, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxVolumeGroup collection
         volumeGroups.collection = new VxSdk::IVxVolumeGroup * [volumeGroups.collectionSize];
-        result = _configStorage->GetVolumeGroups(volumeGroups);
+        sdkCall.Restart("IVxConfiguration::Storage::GetVolumeGroups", volumeGroups);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configStorage->GetVolumeGroups(volumeGroups));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < volumeGroups.collectionSize; i++)
@@ -606,12 +655,14 @@ List<VxSdkNet::Volume^>^ VxSdkNet::Configuration::Storage::GetVolumes(Dictionary
     }
 
     // Make the GetVolumes call, which will return with the total volume count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _configStorage->GetVolumes(volumes);
+    SdkCall sdkCall("IVxConfiguration::Storage::GetVolumes", volumes);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configStorage->GetVolumes(volumes));
     // Unless there are no volumes on the storage, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxVolume collection
         volumes.collection = new VxSdk::IVxVolume * [volumes.collectionSize];
-        result = _configStorage->GetVolumes(volumes);
+        sdkCall.Restart("IVxConfiguration::Storage::GetVolumes", volumes);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configStorage->GetVolumes(volumes));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < volumes.collectionSize; i++)
@@ -636,7 +687,8 @@ System::Collections::Generic::List<System::String^>^ VxSdkNet::Configuration::St
 VxSdkNet::VxFileRecovery^ VxSdkNet::Configuration::Storage::_GetFileRecovery() {
     // Get the file recovery resource for the recorder
     VxSdk::IVxFileRecovery* fileRecovery = nullptr;
-    VxSdk::VxResult::Value result = _configStorage->GetFileRecovery(fileRecovery);
+    SdkCall sdkCall("IVxConfiguration::Storage::GetFileRecovery");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configStorage->GetFileRecovery(fileRecovery));
 
     // Return the file recovery resource if GetFileRecovery was successful
     if (result == VxSdk::VxResult::kOK)
@@ -648,7 +700,8 @@ VxSdkNet::VxFileRecovery^ VxSdkNet::Configuration::Storage::_GetFileRecovery() {
 VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Storage::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configStorage->GetLimits(limits);
+    SdkCall sdkCall("IVxConfiguration::Storage::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configStorage->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -692,15 +745,17 @@ void VxSdkNet::Configuration::Storage::_SetMonitoredDeviceIds(List<System::Strin
 
 VxSdkNet::Configuration::ThermalEtd::ThermalEtd(VxSdk::IVxConfiguration::ThermalEtd* vxConfigThermalEtd) {
     _configThermalEtd = vxConfigThermalEtd;
+    NativeMemory::Add(_configThermalEtd);
 }
 
 VxSdkNet::Configuration::ThermalEtd::!ThermalEtd() {
-    _configThermalEtd->Delete();
+    NativeReleaseQueue::Release(_configThermalEtd);
     _configThermalEtd = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::ThermalEtd::Refresh() {
-    return (VxSdkNet::Results::Value)_configThermalEtd->Refresh();
+    SdkCall sdkCall("IVxConfiguration::ThermalEtd::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configThermalEtd->Refresh());
 }
 
 // ====================================================================================================================
@@ -709,15 +764,17 @@ VxSdkNet::Results::Value VxSdkNet::Configuration::ThermalEtd::Refresh() {
 
 VxSdkNet::Configuration::Time::Time(VxSdk::IVxConfiguration::Time* vxConfigTime) {
     _configTime = vxConfigTime;
+    NativeMemory::Add(_configTime);
 }
 
 VxSdkNet::Configuration::Time::!Time() {
-    _configTime->Delete();
+    NativeReleaseQueue::Release(_configTime);
     _configTime = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Time::Refresh() {
-    return (VxSdkNet::Results::Value)_configTime->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Time::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configTime->Refresh());
 }
 
 System::Collections::Generic::List<System::String^>^ VxSdkNet::Configuration::Time::_GetExternalTimeServers() {
@@ -755,15 +812,17 @@ void VxSdkNet::Configuration::Time::_SetExternalTimeServers(List<System::String^
 
 VxSdkNet::Configuration::Twilio::Twilio(VxSdk::IVxConfiguration::Twilio* vxConfigTwilio) {
     _configTwilio = vxConfigTwilio;
+    NativeMemory::Add(_configTwilio);
 }
 
 VxSdkNet::Configuration::Twilio::!Twilio() {
-    _configTwilio->Delete();
+    NativeReleaseQueue::Release(_configTwilio);
     _configTwilio = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Configuration::Twilio::Refresh() {
-    return (VxSdkNet::Results::Value)_configTwilio->Refresh();
+    SdkCall sdkCall("IVxConfiguration::Twilio::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configTwilio->Refresh());
 }
 
 bool VxSdkNet::Configuration::Twilio::ValidateTwilioInfo(System::String^ accountSid, System::String^ authToken, System::String^ fromNumber, System::String^ toNumber) {
@@ -779,7 +838,8 @@ bool VxSdkNet::Configuration::Twilio::ValidateTwilioInfo(System::String^ account
 VxSdkNet::ResourceLimits^ VxSdkNet::Configuration::Twilio::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configTwilio->GetLimits(limits);
+    SdkCall sdkCall("IVxConfiguration::Twilio::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configTwilio->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
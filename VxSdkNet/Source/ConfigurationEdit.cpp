@@ -0,0 +1,194 @@
+/// <summary>
+/// Implements the configuration edit class.
+/// </summary>
+#include <msclr/lock.h>
+#include "ConfigurationEdit.h"
+
+using namespace System;
+using namespace System::Collections::Concurrent;
+using namespace System::Collections::Generic;
+using namespace System::Reflection;
+using namespace System::Threading;
+
+VxSdkNet::ConfigurationEdit::ConfigurationEdit() {
+    _names = gcnew List<String^>();
+    _values = gcnew Dictionary<String^, Object^>();
+    MaxConcurrentApplies = 8;
+}
+
+Dictionary<String^, VxSdkNet::Results::Value>^ VxSdkNet::ConfigurationEdit::Apply(Object^ configuration) {
+    Dictionary<String^, Results::Value>^ results = gcnew Dictionary<String^, Results::Value>();
+    if (configuration == nullptr)
+        return results;
+
+    // Send only the changes whose values differ from those read by the last refresh
+    Type^ type = configuration->GetType();
+    List<KeyValuePair<PropertyInfo^, Object^>>^ sent = gcnew List<KeyValuePair<PropertyInfo^, Object^>>();
+    for each (KeyValuePair<String^, Object^> change in Changes) {
+        PropertyInfo^ property = type->GetProperty(change.Key);
+        Object^ value = nullptr;
+        if (property == nullptr || !property->CanRead || !property->CanWrite || !_TryConvertValue(change.Value, property->PropertyType, value)) {
+            results[change.Key] = Results::Value::InvalidParameters;
+            continue;
+        }
+
+        // The getters and setters call into the SDK, so an exception they throw fails the change
+        results[change.Key] = Results::Value::OK;
+        try {
+            if (Object::Equals(property->GetValue(configuration, nullptr), value))
+                continue;
+
+            property->SetValue(configuration, value, nullptr);
+            sent->Add(KeyValuePair<PropertyInfo^, Object^>(property, value));
+        }
+        catch (TargetInvocationException^) {
+            results[change.Key] = Results::Value::OperationFailed;
+        }
+    }
+
+    if (sent->Count == 0)
+        return results;
+
+    // The setters do not return a result, so refresh once and check which values took effect; without a refresh the
+    // values read back are only those cached by the setters, so the changes can't be confirmed
+    MethodInfo^ refresh = type->GetMethod("Refresh", Type::EmptyTypes);
+    Results::Value refreshResult = Results::Value::UnknownError;
+    if (refresh != nullptr) {
+        try {
+            refreshResult = safe_cast<Results::Value>(refresh->Invoke(configuration, nullptr));
+        }
+        catch (TargetInvocationException^) {
+            refreshResult = Results::Value::OperationFailed;
+        }
+    }
+
+    for each (KeyValuePair<PropertyInfo^, Object^> change in sent) {
+        String^ name = change.Key->Name;
+        if (refreshResult != Results::Value::OK)
+            results[name] = refreshResult;
+        else if (change.Value != nullptr && !change.Value->GetType()->IsValueType && dynamic_cast<String^>(change.Value) == nullptr)
+            results[name] = Results::Value::UnknownError;
+        else {
+            try {
+                if (!Object::Equals(change.Key->GetValue(configuration, nullptr), change.Value))
+                    results[name] = Results::Value::OperationFailed;
+            }
+            catch (TargetInvocationException^) {
+                results[name] = Results::Value::OperationFailed;
+            }
+        }
+    }
+
+    return results;
+}
+
+int VxSdkNet::ConfigurationEdit::Apply(Collections::IEnumerable^ configurations, ApplyDelegate^ callback) {
+    ConfigurationEditJob^ job = gcnew ConfigurationEditJob();
+    job->Configurations = gcnew ConcurrentQueue<Object^>();
+    job->Callback = callback;
+    for each (Object^ configuration in configurations)
+        job->Configurations->Enqueue(configuration);
+
+    // Apply the changes using a bounded number of workers
+    int workers = Math::Min(Math::Max(MaxConcurrentApplies, 1), job->Configurations->Count);
+    if (workers > 0) {
+        job->Workers = gcnew CountdownEvent(workers);
+        for (int i = 0; i < workers; i++)
+            ThreadPool::QueueUserWorkItem(gcnew WaitCallback(this, &VxSdkNet::ConfigurationEdit::_RunApplies), job);
+
+        job->Workers->Wait();
+    }
+
+    return job->Succeeded;
+}
+
+void VxSdkNet::ConfigurationEdit::Clear() {
+    msclr::lock editLock(this);
+    _names->Clear();
+    _values->Clear();
+}
+
+bool VxSdkNet::ConfigurationEdit::Remove(String^ propertyName) {
+    msclr::lock editLock(this);
+    if (!_values->Remove(propertyName))
+        return false;
+
+    _names->Remove(propertyName);
+    return true;
+}
+
+void VxSdkNet::ConfigurationEdit::Set(String^ propertyName, Object^ value) {
+    msclr::lock editLock(this);
+    if (!_values->ContainsKey(propertyName))
+        _names->Add(propertyName);
+
+    _values[propertyName] = value;
+}
+
+List<KeyValuePair<String^, Object^>>^ VxSdkNet::ConfigurationEdit::Changes::get() {
+    msclr::lock editLock(this);
+    List<KeyValuePair<String^, Object^>>^ mlist = gcnew List<KeyValuePair<String^, Object^>>(_names->Count);
+    for each (String^ name in _names)
+        mlist->Add(KeyValuePair<String^, Object^>(name, _values[name]));
+
+    return mlist;
+}
+
+void VxSdkNet::ConfigurationEdit::_RunApplies(Object^ state) {
+    ConfigurationEditJob^ job = safe_cast<ConfigurationEditJob^>(state);
+    try {
+        Object^ configuration;
+        while (job->Configurations->TryDequeue(configuration)) {
+            Dictionary<String^, Results::Value>^ results = Apply(configuration);
+
+            bool succeeded = true;
+            for each (Results::Value result in results->Values)
+                succeeded &= result == Results::Value::OK;
+
+            if (succeeded)
+                Interlocked::Increment(job->Succeeded);
+
+            // Pass results to the callback one at a time so that it does not need to be thread safe
+            if (job->Callback != nullptr) {
+                msclr::lock jobLock(job);
+                try {
+                    job->Callback(configuration, results);
+                }
+                catch (Exception^) {
+                    // Don't let the callback's exception escape onto the worker thread
+                    Interlocked::Increment(_callbackErrors);
+                }
+            }
+        }
+    }
+    finally {
+        job->Workers->Signal();
+    }
+}
+
+bool VxSdkNet::ConfigurationEdit::_TryConvertValue(Object^ value, Type^ type, Object^% converted) {
+    converted = value;
+    if (value == nullptr)
+        return !type->IsValueType;
+
+    if (type->IsInstanceOfType(value))
+        return true;
+
+    // Allow enum values to be given by name or number, and numbers in any numeric type
+    try {
+        if (type->IsEnum) {
+            String^ name = dynamic_cast<String^>(value);
+            converted = name != nullptr ? Enum::Parse(type, name, true) : Enum::ToObject(type, value);
+        }
+        else
+            converted = Convert::ChangeType(value, type);
+
+        return true;
+    }
+    catch (ArgumentException^) {}
+    catch (InvalidCastException^) {}
+    catch (FormatException^) {}
+    catch (OverflowException^) {}
+
+    return false;
+}
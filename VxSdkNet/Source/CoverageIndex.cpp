@@ -0,0 +1,224 @@
+/// <summary>
+/// Implements the coverage index class.
+/// </summary>
+#include <msclr/lock.h>
+#include "CoverageIndex.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+
+VxSdkNet::CoverageIndex::CoverageIndex(String^ dataSourceId) {
+    _dataSourceId = dataSourceId;
+    _starts = gcnew List<long long>();
+    _ends = gcnew List<long long>();
+    _coveredBefore = gcnew List<long long>();
+}
+
+VxSdkNet::CoverageIndex^ VxSdkNet::CoverageIndex::Create(DataSource^ dataSource, DateTime startTime, DateTime endTime) {
+    Dictionary<Filters::Value, String^>^ filters = gcnew Dictionary<Filters::Value, String^>();
+    filters->Add(Filters::Value::SearchStartTime, Utils::ConvertCppString(Utils::ConvertCSharpDateTime(startTime.ToUniversalTime())));
+    filters->Add(Filters::Value::SearchEndTime, Utils::ConvertCppString(Utils::ConvertCSharpDateTime(endTime.ToUniversalTime())));
+
+    CoverageIndex^ index = gcnew CoverageIndex(dataSource->Id);
+    index->AddClips(dataSource->GetClips(filters));
+    return index;
+}
+
+void VxSdkNet::CoverageIndex::Add(DateTime startTime, DateTime endTime) {
+    msclr::lock indexLock(this);
+    _Add(startTime.ToUniversalTime().Ticks, endTime.ToUniversalTime().Ticks);
+}
+
+void VxSdkNet::CoverageIndex::AddClips(IEnumerable<Clip^>^ clips) {
+    if (clips == nullptr)
+        return;
+
+    msclr::lock indexLock(this);
+    for each (Clip^ clip in clips)
+        _Add(clip->StartTime.Ticks, clip->EndTime.Ticks);
+}
+
+void VxSdkNet::CoverageIndex::Clear() {
+    msclr::lock indexLock(this);
+    _starts->Clear();
+    _ends->Clear();
+    _coveredBefore->Clear();
+}
+
+bool VxSdkNet::CoverageIndex::Contains(DateTime time) {
+    msclr::lock indexLock(this);
+    long long ticks = time.ToUniversalTime().Ticks;
+    int index = _Find(ticks);
+    return index >= 0 && ticks < _ends[index];
+}
+
+double VxSdkNet::CoverageIndex::GetCoverage(DateTime startTime, DateTime endTime) {
+    long long start = startTime.ToUniversalTime().Ticks;
+    long long end = endTime.ToUniversalTime().Ticks;
+    if (end <= start)
+        return 0;
+
+    msclr::lock indexLock(this);
+    return static_cast<double>(_CoveredUntil(end) - _CoveredUntil(start)) / (end - start);
+}
+
+TimeSpan VxSdkNet::CoverageIndex::GetCoveredTime(DateTime startTime, DateTime endTime) {
+    long long start = startTime.ToUniversalTime().Ticks;
+    long long end = endTime.ToUniversalTime().Ticks;
+    if (end <= start)
+        return TimeSpan::Zero;
+
+    msclr::lock indexLock(this);
+    return TimeSpan(_CoveredUntil(end) - _CoveredUntil(start));
+}
+
+List<KeyValuePair<DateTime, DateTime>>^ VxSdkNet::CoverageIndex::GetUncoveredSpans(DateTime startTime, DateTime endTime) {
+    long long start = startTime.ToUniversalTime().Ticks;
+    long long end = endTime.ToUniversalTime().Ticks;
+    List<KeyValuePair<DateTime, DateTime>>^ mlist = gcnew List<KeyValuePair<DateTime, DateTime>>();
+
+    msclr::lock indexLock(this);
+    // Walk the spans from the one containing the start time, collecting the time between them
+    int index = _Find(start);
+    if (index < 0)
+        index = 0;
+
+    long long position = start;
+    for (; index < _starts->Count && position < end; index++) {
+        if (_ends[index] <= position)
+            continue;
+
+        if (_starts[index] > position)
+            mlist->Add(KeyValuePair<DateTime, DateTime>(DateTime(position, DateTimeKind::Utc), DateTime(Math::Min(_starts[index], end), DateTimeKind::Utc)));
+
+        position = _ends[index];
+    }
+
+    if (position < end)
+        mlist->Add(KeyValuePair<DateTime, DateTime>(DateTime(position, DateTimeKind::Utc), DateTime(end, DateTimeKind::Utc)));
+
+    return mlist;
+}
+
+bool VxSdkNet::CoverageIndex::Intersects(DateTime startTime, DateTime endTime) {
+    return GetCoveredTime(startTime, endTime) > TimeSpan::Zero;
+}
+
+void VxSdkNet::CoverageIndex::Remove(DateTime startTime, DateTime endTime) {
+    msclr::lock indexLock(this);
+    _Remove(startTime.ToUniversalTime().Ticks, endTime.ToUniversalTime().Ticks);
+}
+
+void VxSdkNet::CoverageIndex::RemoveGaps(IEnumerable<Gap^>^ gaps) {
+    if (gaps == nullptr)
+        return;
+
+    msclr::lock indexLock(this);
+    for each (Gap^ gap in gaps)
+        _Remove(gap->StartTime.Ticks, gap->EndTime.Ticks);
+}
+
+TimeSpan VxSdkNet::CoverageIndex::TotalCoveredTime::get() {
+    msclr::lock indexLock(this);
+    int last = _starts->Count - 1;
+    if (last < 0)
+        return TimeSpan::Zero;
+
+    return TimeSpan(_coveredBefore[last] + _ends[last] - _starts[last]);
+}
+
+void VxSdkNet::CoverageIndex::_Add(long long start, long long end) {
+    if (end <= start)
+        return;
+
+    // Find the spans that overlap or adjoin the new span
+    int first = _Find(start);
+    if (first < 0 || _ends[first] < start)
+        first++;
+
+    int last = _Find(end);
+
+    // Replace them with a single span covering all of them
+    if (first <= last) {
+        start = Math::Min(start, _starts[first]);
+        end = Math::Max(end, _ends[last]);
+        _starts->RemoveRange(first, last - first + 1);
+        _ends->RemoveRange(first, last - first + 1);
+        _coveredBefore->RemoveRange(first, last - first + 1);
+    }
+
+    _starts->Insert(first, start);
+    _ends->Insert(first, end);
+    _coveredBefore->Insert(first, 0);
+    _UpdateCoveredBefore(first);
+}
+
+long long VxSdkNet::CoverageIndex::_CoveredUntil(long long time) {
+    // The covered time before a point is the time covered by the earlier spans plus any part of the span containing it
+    int index = _Find(time);
+    if (index < 0)
+        return 0;
+
+    return _coveredBefore[index] + Math::Min(time, _ends[index]) - _starts[index];
+}
+
+int VxSdkNet::CoverageIndex::_Find(long long time) {
+    // Get the index of the last span starting at or before the time, or -1 if there is none
+    int index = _starts->BinarySearch(time);
+    return index >= 0 ? index : ~index - 1;
+}
+
+List<KeyValuePair<DateTime, DateTime>>^ VxSdkNet::CoverageIndex::_GetSpans() {
+    msclr::lock indexLock(this);
+    List<KeyValuePair<DateTime, DateTime>>^ mlist = gcnew List<KeyValuePair<DateTime, DateTime>>(_starts->Count);
+    for (int i = 0; i < _starts->Count; i++) {
+        DateTime start(_starts[i], DateTimeKind::Utc);
+        DateTime end(_ends[i], DateTimeKind::Utc);
+        mlist->Add(KeyValuePair<DateTime, DateTime>(start, end));
+    }
+
+    return mlist;
+}
+
+void VxSdkNet::CoverageIndex::_Remove(long long start, long long end) {
+    if (end <= start)
+        return;
+
+    // Find the spans that overlap the removed span
+    int first = _Find(start);
+    if (first < 0 || _ends[first] <= start)
+        first++;
+
+    int last = _Find(end - 1);
+    if (first > last)
+        return;
+
+    // Keep any parts of the first and last spans that lie outside the removed span
+    long long firstStart = _starts[first];
+    long long lastEnd = _ends[last];
+    _starts->RemoveRange(first, last - first + 1);
+    _ends->RemoveRange(first, last - first + 1);
+    _coveredBefore->RemoveRange(first, last - first + 1);
+
+    int insertAt = first;
+    if (firstStart < start) {
+        _starts->Insert(insertAt, firstStart);
+        _ends->Insert(insertAt, start);
+        _coveredBefore->Insert(insertAt, 0);
+        insertAt++;
+    }
+
+    if (lastEnd > end) {
+        _starts->Insert(insertAt, end);
+        _ends->Insert(insertAt, lastEnd);
+        _coveredBefore->Insert(insertAt, 0);
+    }
+
+    _UpdateCoveredBefore(first);
+}
+
+void VxSdkNet::CoverageIndex::_UpdateCoveredBefore(int index) {
+    // Only the spans from the changed one onwards need updating, so appending recent clips is cheap
+    for (int i = index; i < _starts->Count; i++)
+        _coveredBefore[i] = i == 0 ? 0 : _coveredBefore[i - 1] + _ends[i - 1] - _starts[i - 1];
+}
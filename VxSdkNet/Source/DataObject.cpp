@@ -4,20 +4,23 @@
 
 #include "DataObject.h"
 #include "User.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::DataObject::DataObject(VxSdk::IVxDataObject* vxDataObject) {
     _dataObject = vxDataObject;
+    NativeMemory::Add(_dataObject);
 }
 
 VxSdkNet::DataObject::!DataObject() {
-    _dataObject->Delete();
+    NativeReleaseQueue::Release(_dataObject);
     _dataObject = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::DataObject::Refresh() {
-    return (VxSdkNet::Results::Value)_dataObject->Refresh();
+    SdkCall sdkCall("IVxDataObject::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataObject->Refresh());
 }
 
 System::String^ VxSdkNet::DataObject::_GetData() {
@@ -26,7 +29,8 @@ System::String^ VxSdkNet::DataObject::_GetData() {
 
     // If the data is not available on the data object the result will return VxSdk::VxResult::kActionUnavailable,
     // otherwise VxSdk::VxResult::kInsufficientSize
-    VxSdk::VxResult::Value result = _dataObject->GetData(data, size);
+    SdkCall sdkCall("IVxDataObject::GetData");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataObject->GetData(data, size));
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the data
         data = new char[size];
@@ -39,7 +43,8 @@ System::String^ VxSdkNet::DataObject::_GetData() {
 VxSdkNet::ResourceLimits^ VxSdkNet::DataObject::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _dataObject->GetLimits(limits);
+    SdkCall sdkCall("IVxDataObject::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataObject->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -51,7 +56,8 @@ VxSdkNet::ResourceLimits^ VxSdkNet::DataObject::_GetLimits() {
 VxSdkNet::User^ VxSdkNet::DataObject::_GetOwner() {
     // Get the user object
     VxSdk::IVxUser* user = nullptr;
-    VxSdk::VxResult::Value result = _dataObject->GetOwner(user);
+    SdkCall sdkCall("IVxDataObject::GetOwner");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataObject->GetOwner(user));
 
     // Return the user if GetOwner was successful
     if (result == VxSdk::VxResult::kOK)
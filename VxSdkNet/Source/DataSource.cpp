@@ -9,19 +9,40 @@
 #include "ResourceRel.h"
 #include "UserInfo.h"
 #include "Tag.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::DataSource::DataSource(VxSdk::IVxDataSource* vxDataSource) {
     _dataSource = vxDataSource;
+    NativeMemory::Add(_dataSource);
 }
 
-VxSdkNet::DataSource::!DataSource() {
+VxSdkNet::DataSource::~DataSource() {
+    if (_isDisposed)
+        return;
+
+    // Wait for the calls using the native object, so that it is not deleted under them or replaced afterwards
+    if (_nativeLock != nullptr)
+        _nativeLock->EnterWriteLock();
+
+    _isDisposed = true;
+    NativeMemory::Remove(_dataSource);
     _dataSource->Delete();
     _dataSource = nullptr;
+    if (_nativeLock != nullptr) {
+        _nativeLock->ExitWriteLock();
+        delete _nativeLock;
+    }
+}
+
+VxSdkNet::DataSource::!DataSource() {
+    NativeReleaseQueue::Release(_dataSource);
+    _dataSource = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::DataSource::AddAnalyticConfig(VxSdkNet::NewAnalyticConfig^ newAnalyticConfig) {
+    NativeReadLock nativeLock(_nativeLock);
     VxSdk::VxNewAnalyticConfig vxNewAnalyticConfig;
     vxNewAnalyticConfig.minConfidence = newAnalyticConfig->MinConfidence;
     VxSdk::Utilities::StrCopySafe(vxNewAnalyticConfig.ptzPresetName, Utils::ConvertCSharpString(newAnalyticConfig->PtzPresetName).c_str());
@@ -29,10 +50,12 @@ VxSdkNet::Results::Value VxSdkNet::DataSource::AddAnalyticConfig(VxSdkNet::NewAn
     vxNewAnalyticConfig.size.height = newAnalyticConfig->Size->Height;
 
     // Attempt to add the analytic config
-    return VxSdkNet::Results::Value(_dataSource->AddAnalyticConfig(vxNewAnalyticConfig));
+    SdkCall sdkCall("IVxDataSource::AddAnalyticConfig");
+    return VxSdkNet::Results::Value(sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->AddAnalyticConfig(vxNewAnalyticConfig)));
 }
 
 VxSdkNet::Results::Value VxSdkNet::DataSource::AddAnalyticSession(NewAnalyticSession^ newAnalyticSession) {
+    NativeReadLock nativeLock(_nativeLock);
     VxSdk::VxNewAnalyticSession vxNewAnalyticSession;
     VxSdk::Utilities::StrCopySafe(vxNewAnalyticSession.dataEncodingId, Utils::ConvertCSharpString(newAnalyticSession->DataEncodingId).c_str());
     VxSdk::Utilities::StrCopySafe(vxNewAnalyticSession.dataSourceId, Utils::ConvertCSharpString(newAnalyticSession->DataSourceId).c_str());
@@ -41,16 +64,19 @@ VxSdkNet::Results::Value VxSdkNet::DataSource::AddAnalyticSession(NewAnalyticSes
     VxSdk::Utilities::StrCopySafe(vxNewAnalyticSession.source, Utils::ConvertCSharpString(newAnalyticSession->Source).c_str());
 
     // Attempt to add the analytic session
-    return VxSdkNet::Results::Value(_dataSource->AddAnalyticSession(vxNewAnalyticSession));
+    SdkCall sdkCall("IVxDataSource::AddAnalyticSession");
+    return VxSdkNet::Results::Value(sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->AddAnalyticSession(vxNewAnalyticSession)));
 }
 
 VxSdkNet::DataSession^ VxSdkNet::DataSource::CreateMjpegStream() {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a data session object
     VxSdk::IVxDataSession* dataSession;
 
     // If the mjpeg protocol is not available on the datasource the result will return VxSdk::VxResult::kActionUnavailable,
     // otherwise VxSdk::VxResult::kOK
-    VxSdk::VxResult::Value result = _dataSource->CreateMjpegDataSession(dataSession);
+    SdkCall sdkCall("IVxDataSource::CreateMjpegDataSession");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->CreateMjpegDataSession(dataSession));
     if (result == VxSdk::VxResult::kOK)
         return gcnew DataSession(dataSession);
 
@@ -58,6 +84,7 @@ VxSdkNet::DataSession^ VxSdkNet::DataSource::CreateMjpegStream() {
 }
 
 VxSdkNet::PixelSearch^ VxSdkNet::DataSource::CreatePixelSearch(NewPixelSearch^ newPixelSearch) {
+    NativeReadLock nativeLock(_nativeLock);
     VxSdk::VxNewPixelSearch vxNewPixelSearch;
     VxSdk::Utilities::StrCopySafe(vxNewPixelSearch.searchEndTime, Utils::ConvertCSharpDateTime(newPixelSearch->SearchEndTime).c_str());
     VxSdk::Utilities::StrCopySafe(vxNewPixelSearch.searchStartTime, Utils::ConvertCSharpDateTime(newPixelSearch->SearchStartTime).c_str());
@@ -75,7 +102,8 @@ VxSdkNet::PixelSearch^ VxSdkNet::DataSource::CreatePixelSearch(NewPixelSearch^ n
     // Attempt to create the pixel search
     VxSdkNet::PixelSearch^ retPixelSearch = nullptr;
     VxSdk::IVxPixelSearch* pixelSearchItem = nullptr;
-    VxSdk::VxResult::Value result = _dataSource->CreatePixelSearch(vxNewPixelSearch, pixelSearchItem);
+    SdkCall sdkCall("IVxDataSource::CreatePixelSearch");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->CreatePixelSearch(vxNewPixelSearch, pixelSearchItem));
 
     // Unless there was an issue initiating the pixel search the result should be VxSdk::VxResult::kOK
     if (result == VxSdk::VxResult::kOK) {
@@ -116,6 +144,7 @@ VxSdkNet::Results::Value VxSdkNet::DataSource::DeletePixelSearch(PixelSearch^ pi
 }
 
 List<VxSdkNet::DataStorage^>^ VxSdkNet::DataSource::GetAllDataStorages(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed data storages
     List<DataStorage^>^ mlist = gcnew List<DataStorage^>();
     // Create a collection of unmanaged data storages
@@ -137,16 +166,18 @@ List<VxSdkNet::DataStorage^>^ VxSdkNet::DataSource::GetAllDataStorages(System::C
     }
 
     // Make the GetAllDataStorages call, which will return with the total data storage count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetAllDataStorages(dataStorages);
+    SdkCall sdkCall("IVxDataSource::GetAllDataStorages", dataStorages);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetAllDataStorages(dataStorages));
     // As long as there are data storages from this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDataStorage collection
         dataStorages.collection = new VxSdk::IVxDataStorage*[dataStorages.collectionSize];
-        result = _dataSource->GetAllDataStorages(dataStorages);
+        sdkCall.Restart("IVxDataSource::GetAllDataStorages", dataStorages);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetAllDataStorages(dataStorages));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < dataStorages.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::DataStorage(dataStorages.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::DataStorage>(_identityMap, dataStorages.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] dataStorages.collection;
@@ -155,6 +186,7 @@ List<VxSdkNet::DataStorage^>^ VxSdkNet::DataSource::GetAllDataStorages(System::C
 }
 
 List<VxSdkNet::AnalyticSession^>^ VxSdkNet::DataSource::GetAnalyticSessions(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed analytic sessions
     List<AnalyticSession^>^ mlist = gcnew List<AnalyticSession^>();
     // Create a collection of unmanaged analytic sessions
@@ -176,16 +208,18 @@ List<VxSdkNet::AnalyticSession^>^ VxSdkNet::DataSource::GetAnalyticSessions(Syst
     }
 
     // Make the GetAnalyticSessions call, which will return with the total analytic session count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetAnalyticSessions(analyticSessions);
+    SdkCall sdkCall("IVxDataSource::GetAnalyticSessions", analyticSessions);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetAnalyticSessions(analyticSessions));
     // As long as there are analytic sessions for this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxAnalyticSession collection
         analyticSessions.collection = new VxSdk::IVxAnalyticSession*[analyticSessions.collectionSize];
-        result = _dataSource->GetAnalyticSessions(analyticSessions);
+        sdkCall.Restart("IVxDataSource::GetAnalyticSessions", analyticSessions);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetAnalyticSessions(analyticSessions));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < analyticSessions.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::AnalyticSession(analyticSessions.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::AnalyticSession>(_identityMap, analyticSessions.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] analyticSessions.collection;
@@ -194,6 +228,7 @@ List<VxSdkNet::AnalyticSession^>^ VxSdkNet::DataSource::GetAnalyticSessions(Syst
 }
 
 List<VxSdkNet::ResourceRel^>^ VxSdkNet::DataSource::GetAudioRelations(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed related resources
     List<ResourceRel^>^ mlist = gcnew List<ResourceRel^>();
     // Create a collection of unmanaged related resources
@@ -215,16 +250,18 @@ List<VxSdkNet::ResourceRel^>^ VxSdkNet::DataSource::GetAudioRelations(System::Co
     }
 
     // Make the GetAudioRelations call, which will return with the total resource count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetAudioRelations(resourceRels);
+    SdkCall sdkCall("IVxDataSource::GetAudioRelations", resourceRels);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetAudioRelations(resourceRels));
     // As long as there are related resources for this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxResourceRel collection
         resourceRels.collection = new VxSdk::IVxResourceRel*[resourceRels.collectionSize];
-        result = _dataSource->GetAudioRelations(resourceRels);
+        sdkCall.Restart("IVxDataSource::GetAudioRelations", resourceRels);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetAudioRelations(resourceRels));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < resourceRels.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::ResourceRel(resourceRels.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::ResourceRel>(_identityMap, resourceRels.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] resourceRels.collection;
@@ -233,6 +270,7 @@ List<VxSdkNet::ResourceRel^>^ VxSdkNet::DataSource::GetAudioRelations(System::Co
 }
 
 System::Collections::Generic::List<VxSdkNet::Bookmark^>^ VxSdkNet::DataSource::GetBookmarks(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed bookmarks
     List<Bookmark^>^ mlist = gcnew List<Bookmark^>();
     // Create a collection of unmanaged bookmarks
@@ -254,16 +292,18 @@ System::Collections::Generic::List<VxSdkNet::Bookmark^>^ VxSdkNet::DataSource::G
     }
 
     // Make the GetBookmarks call, which will return with the total bookmark count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetBookmarks(bookmarks);
+    SdkCall sdkCall("IVxDataSource::GetBookmarks", bookmarks);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetBookmarks(bookmarks));
     // As long as there are bookmarks from this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxBookmark collection
         bookmarks.collection = new VxSdk::IVxBookmark*[bookmarks.collectionSize];
-        result = _dataSource->GetBookmarks(bookmarks);
+        sdkCall.Restart("IVxDataSource::GetBookmarks", bookmarks);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetBookmarks(bookmarks));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < bookmarks.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::Bookmark(bookmarks.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::Bookmark>(_identityMap, bookmarks.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] bookmarks.collection;
@@ -272,6 +312,7 @@ System::Collections::Generic::List<VxSdkNet::Bookmark^>^ VxSdkNet::DataSource::G
 }
 
 List<VxSdkNet::Clip^>^ VxSdkNet::DataSource::GetClips(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed clips
     List<Clip^>^ mlist = gcnew List<Clip^>();
     // Create a collection of unmanaged clips
@@ -293,12 +334,14 @@ List<VxSdkNet::Clip^>^ VxSdkNet::DataSource::GetClips(System::Collections::Gener
     }
 
     // Make the GetClips call, which will return with the total clip count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetClips(clips);
+    SdkCall sdkCall("IVxDataSource::GetClips", clips);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetClips(clips));
     // As long as there are clips from this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxClip collection
         clips.collection = new VxSdk::IVxClip*[clips.collectionSize];
-        result = _dataSource->GetClips(clips);
+        sdkCall.Restart("IVxDataSource::GetClips", clips);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetClips(clips));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < clips.collectionSize; i++)
@@ -311,6 +354,7 @@ List<VxSdkNet::Clip^>^ VxSdkNet::DataSource::GetClips(System::Collections::Gener
 }
 
 List<VxSdkNet::DataStorage^>^ VxSdkNet::DataSource::GetDataStorages(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed data storages
     List<DataStorage^>^ mlist = gcnew List<DataStorage^>();
     // Create a collection of unmanaged data storages
@@ -332,16 +376,18 @@ List<VxSdkNet::DataStorage^>^ VxSdkNet::DataSource::GetDataStorages(System::Coll
     }
 
     // Make the GetDataStorages call, which will return with the total data storage count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetDataStorages(dataStorages);
+    SdkCall sdkCall("IVxDataSource::GetDataStorages", dataStorages);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetDataStorages(dataStorages));
     // As long as there are data storages from this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDataStorage collection
         dataStorages.collection = new VxSdk::IVxDataStorage*[dataStorages.collectionSize];
-        result = _dataSource->GetDataStorages(dataStorages);
+        sdkCall.Restart("IVxDataSource::GetDataStorages", dataStorages);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetDataStorages(dataStorages));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < dataStorages.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::DataStorage(dataStorages.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::DataStorage>(_identityMap, dataStorages.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] dataStorages.collection;
@@ -350,6 +396,7 @@ List<VxSdkNet::DataStorage^>^ VxSdkNet::DataSource::GetDataStorages(System::Coll
 }
 
 List<VxSdkNet::Clip^>^ VxSdkNet::DataSource::GetEdgeClips(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed clips
     List<Clip^>^ mlist = gcnew List<Clip^>();
     // Create a collection of unmanaged clips
@@ -371,12 +418,14 @@ List<VxSdkNet::Clip^>^ VxSdkNet::DataSource::GetEdgeClips(System::Collections::G
     }
 
     // Make the GetEdgeClips call, which will return with the total clip count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetEdgeClips(clips);
+    SdkCall sdkCall("IVxDataSource::GetEdgeClips", clips);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetEdgeClips(clips));
     // As long as there are clips from this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxClip collection
         clips.collection = new VxSdk::IVxClip*[clips.collectionSize];
-        result = _dataSource->GetEdgeClips(clips);
+        sdkCall.Restart("IVxDataSource::GetEdgeClips", clips);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetEdgeClips(clips));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < clips.collectionSize; i++)
@@ -389,6 +438,7 @@ List<VxSdkNet::Clip^>^ VxSdkNet::DataSource::GetEdgeClips(System::Collections::G
 }
 
 List<VxSdkNet::Gap^>^ VxSdkNet::DataSource::GetGaps(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed gaps
     List<Gap^>^ mlist = gcnew List<Gap^>();
     // Create a collection of unmanaged gaps
@@ -410,16 +460,18 @@ List<VxSdkNet::Gap^>^ VxSdkNet::DataSource::GetGaps(System::Collections::Generic
     }
 
     // Make the GetGaps call, which will return with the total gap count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetGaps(gaps);
+    SdkCall sdkCall("IVxDataSource::GetGaps", gaps);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetGaps(gaps));
     // As long as there are gaps for this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxGap collection
         gaps.collection = new VxSdk::IVxGap*[gaps.collectionSize];
-        result = _dataSource->GetGaps(gaps);
+        sdkCall.Restart("IVxDataSource::GetGaps", gaps);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetGaps(gaps));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < gaps.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::Gap(gaps.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::Gap>(_identityMap, gaps.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] gaps.collection;
@@ -428,6 +480,7 @@ List<VxSdkNet::Gap^>^ VxSdkNet::DataSource::GetGaps(System::Collections::Generic
 }
 
 System::Collections::Generic::List<VxSdkNet::LineCount^>^ VxSdkNet::DataSource::GetLineCounts(VxSdkNet::LineCountingRequest^ lineCountingRequest) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed line counts
     List<LineCount^>^ mlist = gcnew List<LineCount^>();
 
@@ -449,7 +502,8 @@ System::Collections::Generic::List<VxSdkNet::LineCount^>^ VxSdkNet::DataSource::
 
     // Attempt to get the line counts
     VxSdk::VxLineCounts* lineCounts = nullptr;
-    VxSdk::VxResult::Value result = _dataSource->GetLineCounts(vxLineCountingRequest, lineCounts);
+    SdkCall sdkCall("IVxDataSource::GetLineCounts");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetLineCounts(vxLineCountingRequest, lineCounts));
 
     // Unless there was an issue getting the line counts the result should be VxSdk::VxResult::kOK
     if (result == VxSdk::VxResult::kOK && lineCounts->lineCountSize > 0) {
@@ -462,6 +516,7 @@ System::Collections::Generic::List<VxSdkNet::LineCount^>^ VxSdkNet::DataSource::
 }
 
 System::String^ VxSdkNet::DataSource::GetMetadataSnapshotEndpoint(System::DateTime^ time) {
+    NativeReadLock nativeLock(_nativeLock);
     char* snapshotEndpoint = nullptr;
     int size = 0;
     char snapshotTime[64];
@@ -470,7 +525,8 @@ System::String^ VxSdkNet::DataSource::GetMetadataSnapshotEndpoint(System::DateTi
 
     // If the snapshot endpoint is not available on the system the result will return VxSdk::VxResult::kActionUnavailable,
     // otherwise VxSdk::VxResult::kInsufficientSize
-    VxSdk::VxResult::Value result = _dataSource->GetMetadataSnapshotEndpoint(snapshotEndpoint, size, snapshotTime);
+    SdkCall sdkCall("IVxDataSource::GetMetadataSnapshotEndpoint");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetMetadataSnapshotEndpoint(snapshotEndpoint, size, snapshotTime));
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for snapshotEndpoint
         snapshotEndpoint = new char[size];
@@ -481,6 +537,7 @@ System::String^ VxSdkNet::DataSource::GetMetadataSnapshotEndpoint(System::DateTi
 }
 
 System::Collections::Generic::List<VxSdkNet::ResourceRel^>^ VxSdkNet::DataSource::GetMetadataRelations(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed related resources
     List<ResourceRel^>^ mlist = gcnew List<ResourceRel^>();
     // Create a collection of unmanaged related resources
@@ -502,16 +559,18 @@ System::Collections::Generic::List<VxSdkNet::ResourceRel^>^ VxSdkNet::DataSource
     }
 
     // Make the GetMetadataRelations call, which will return with the total resource count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetMetadataRelations(resourceRels);
+    SdkCall sdkCall("IVxDataSource::GetMetadataRelations", resourceRels);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetMetadataRelations(resourceRels));
     // As long as there are related resources for this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxResourceRel collection
         resourceRels.collection = new VxSdk::IVxResourceRel*[resourceRels.collectionSize];
-        result = _dataSource->GetMetadataRelations(resourceRels);
+        sdkCall.Restart("IVxDataSource::GetMetadataRelations", resourceRels);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetMetadataRelations(resourceRels));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < resourceRels.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::ResourceRel(resourceRels.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::ResourceRel>(_identityMap, resourceRels.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] resourceRels.collection;
@@ -520,6 +579,7 @@ System::Collections::Generic::List<VxSdkNet::ResourceRel^>^ VxSdkNet::DataSource
 }
 
 List<VxSdkNet::Tag^>^ VxSdkNet::DataSource::GetTags(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed tags
     List<Tag^>^ mlist = gcnew List<Tag^>();
     // Create a collection of unmanaged tags
@@ -541,16 +601,18 @@ List<VxSdkNet::Tag^>^ VxSdkNet::DataSource::GetTags(System::Collections::Generic
     }
 
     // Make the GetTags call, which will return with the total tag count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetTags(tags);
+    SdkCall sdkCall("IVxDataSource::GetTags", tags);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetTags(tags));
     // As long as there are tags from this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxtag collection
         tags.collection = new VxSdk::IVxTag*[tags.collectionSize];
-        result = _dataSource->GetTags(tags);
+        sdkCall.Restart("IVxDataSource::GetTags", tags);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetTags(tags));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < tags.collectionSize; i++)
-                mlist->Add(gcnew Tag(tags.collection[i]));
+                mlist->Add(IdentityMap::Wrap<Tag>(_identityMap, tags.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] tags.collection;
@@ -559,6 +621,7 @@ List<VxSdkNet::Tag^>^ VxSdkNet::DataSource::GetTags(System::Collections::Generic
 }
 
 List<VxSdkNet::ResourceRel^>^ VxSdkNet::DataSource::GetVideoRelations(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed related resources
     List<ResourceRel^>^ mlist = gcnew List<ResourceRel^>();
     // Create a collection of unmanaged related resources
@@ -580,16 +643,18 @@ List<VxSdkNet::ResourceRel^>^ VxSdkNet::DataSource::GetVideoRelations(System::Co
     }
 
     // Make the GetVideoRelations call, which will return with the total resource count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetVideoRelations(resourceRels);
+    SdkCall sdkCall("IVxDataSource::GetVideoRelations", resourceRels);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetVideoRelations(resourceRels));
     // As long as there are related resources for this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxResourceRel collection
         resourceRels.collection = new VxSdk::IVxResourceRel*[resourceRels.collectionSize];
-        result = _dataSource->GetVideoRelations(resourceRels);
+        sdkCall.Restart("IVxDataSource::GetVideoRelations", resourceRels);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetVideoRelations(resourceRels));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < resourceRels.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::ResourceRel(resourceRels.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::ResourceRel>(_identityMap, resourceRels.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] resourceRels.collection;
@@ -598,22 +663,27 @@ List<VxSdkNet::ResourceRel^>^ VxSdkNet::DataSource::GetVideoRelations(System::Co
 }
 
 VxSdkNet::Results::Value VxSdkNet::DataSource::Refresh() {
-    return (VxSdkNet::Results::Value)_dataSource->Refresh();
+    NativeReadLock nativeLock(_nativeLock);
+    SdkCall sdkCall("IVxDataSource::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->Refresh());
 }
 
 bool VxSdkNet::DataSource::_CanPixelSearch() {
+    NativeReadLock nativeLock(_nativeLock);
     bool result;
     _dataSource->CanPixelSearch(result);
     return result;
 }
 
 bool VxSdkNet::DataSource::_CanPtz() {
+    NativeReadLock nativeLock(_nativeLock);
     bool result;
     _dataSource->CanPtz(result);
     return result;
 }
 
 List<VxSdkNet::AnalyticConfig^>^ VxSdkNet::DataSource::GetAnalyticConfigs(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed analytic configs
     List<AnalyticConfig^>^ mlist = gcnew List<AnalyticConfig^>();
 
@@ -636,12 +706,14 @@ List<VxSdkNet::AnalyticConfig^>^ VxSdkNet::DataSource::GetAnalyticConfigs(System
     }
 
     // Make the GetAnalyticConfigs call, which will return with the total analytic config count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetAnalyticConfigs(analyticConfigs);
+    SdkCall sdkCall("IVxDataSource::GetAnalyticConfigs", analyticConfigs);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetAnalyticConfigs(analyticConfigs));
     // As long as there are analytic configs for this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxAnalyticConfig collection
         analyticConfigs.collection = new VxSdk::IVxAnalyticConfig*[analyticConfigs.collectionSize];
-        result = _dataSource->GetAnalyticConfigs(analyticConfigs);
+        sdkCall.Restart("IVxDataSource::GetAnalyticConfigs", analyticConfigs);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetAnalyticConfigs(analyticConfigs));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < analyticConfigs.collectionSize; i++)
@@ -654,6 +726,7 @@ List<VxSdkNet::AnalyticConfig^>^ VxSdkNet::DataSource::GetAnalyticConfigs(System
 }
 
 System::Collections::Generic::List<VxSdkNet::DataSource::AnalyticCapability>^ VxSdkNet::DataSource::_GetAnalyticCapabilities() {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed analytic capabilities
     List<AnalyticCapability>^ mlist = gcnew List<AnalyticCapability>();
 
@@ -662,13 +735,15 @@ System::Collections::Generic::List<VxSdkNet::DataSource::AnalyticCapability>^ Vx
     int size = 0;
 
     // Make the GetAnalyticCapabilities call, which will return with the total analytic capabilities count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetAnalyticCapabilities(vxAnalyticCapabilities, size);
+    SdkCall sdkCall("IVxDataSource::GetAnalyticCapabilities");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetAnalyticCapabilities(vxAnalyticCapabilities, size));
     // As long as there are analytic capabilities for this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the VxAnalyticCapability array
         vxAnalyticCapabilities = new VxSdk::VxAnalyticCapability::Value[size];
         // The result should now be kOK since we have allocated enough space
-        result = _dataSource->GetAnalyticCapabilities(vxAnalyticCapabilities, size);
+        sdkCall.Restart("IVxDataSource::GetAnalyticCapabilities");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetAnalyticCapabilities(vxAnalyticCapabilities, size));
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < size; i++)
                 mlist->Add((AnalyticCapability)vxAnalyticCapabilities[i]);
@@ -681,6 +756,7 @@ System::Collections::Generic::List<VxSdkNet::DataSource::AnalyticCapability>^ Vx
 }
 
 System::Collections::Generic::List<VxSdkNet::DataSource::AnalyticBehaviorType>^ VxSdkNet::DataSource::_GetAvailableAnalyticBehaviorTypes() {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed analytic behavior types
     List<AnalyticBehaviorType>^ mlist = gcnew List<AnalyticBehaviorType>();
 
@@ -689,13 +765,15 @@ System::Collections::Generic::List<VxSdkNet::DataSource::AnalyticBehaviorType>^
     int size = 0;
 
     // Make the GetAvailableAnalyticBehaviorTypes call, which will return with the total analytic behavior types count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetAvailableAnalyticBehaviorTypes(vxAnalyticBehaviorTypes, size);
+    SdkCall sdkCall("IVxDataSource::GetAvailableAnalyticBehaviorTypes");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetAvailableAnalyticBehaviorTypes(vxAnalyticBehaviorTypes, size));
     // As long as there are analytic behavior types for this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the VxAnalyticBehaviorType array
         vxAnalyticBehaviorTypes = new VxSdk::VxAnalyticBehaviorType::Value[size];
         // The result should now be kOK since we have allocated enough space
-        result = _dataSource->GetAvailableAnalyticBehaviorTypes(vxAnalyticBehaviorTypes, size);
+        sdkCall.Restart("IVxDataSource::GetAvailableAnalyticBehaviorTypes");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetAvailableAnalyticBehaviorTypes(vxAnalyticBehaviorTypes, size));
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < size; i++)
                 mlist->Add((AnalyticBehaviorType)vxAnalyticBehaviorTypes[i]);
@@ -708,6 +786,7 @@ System::Collections::Generic::List<VxSdkNet::DataSource::AnalyticBehaviorType>^
 }
 
 List<VxSdkNet::DataInterface^>^ VxSdkNet::DataSource::_GetDataInterfaces() {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed export objects
     List<DataInterface^>^ mlist = gcnew List<DataInterface^>();
     for (int i = 0; i < _dataSource->dataInterfaceSize; i++)
@@ -717,21 +796,25 @@ List<VxSdkNet::DataInterface^>^ VxSdkNet::DataSource::_GetDataInterfaces() {
 }
 
 VxSdkNet::Device^ VxSdkNet::DataSource::_GetHostDevice() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the device which hosts this data source
     VxSdk::IVxDevice* device = nullptr;
-    VxSdk::VxResult::Value result = _dataSource->GetHostDevice(device);
+    SdkCall sdkCall("IVxDataSource::GetHostDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetHostDevice(device));
 
     // Return the device if GetHostDevice was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew Device(device);
+        return IdentityMap::Intern<Device>(_identityMap, device);
 
     return nullptr;
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::DataSource::_GetLimits() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _dataSource->GetLimits(limits);
+    SdkCall sdkCall("IVxDataSource::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -741,6 +824,7 @@ VxSdkNet::ResourceLimits^ VxSdkNet::DataSource::_GetLimits() {
 }
 
 List<VxSdkNet::LinkedPtzInfo^>^ VxSdkNet::DataSource::_GetLinkedPtzInfo() {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed linked ptz info objects
     List<LinkedPtzInfo^>^ mlist = gcnew List<LinkedPtzInfo^>();
     // Add each linked ptz info to the list
@@ -752,9 +836,11 @@ List<VxSdkNet::LinkedPtzInfo^>^ VxSdkNet::DataSource::_GetLinkedPtzInfo() {
 }
 
 VxSdkNet::Member^ VxSdkNet::DataSource::_GetMember() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the member that this data source resides in.
     VxSdk::IVxMember* member = nullptr;
-    VxSdk::VxResult::Value result = _dataSource->GetMember(member);
+    SdkCall sdkCall("IVxDataSource::GetMember");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetMember(member));
 
     // Return the member if GetMember was successful
     if (result == VxSdk::VxResult::kOK)
@@ -766,9 +852,11 @@ VxSdkNet::Member^ VxSdkNet::DataSource::_GetMember() {
 
 
 VxSdkNet::DataSourceConfig::Motion^ VxSdkNet::DataSource::_GetMotionConfig() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the motion config
     VxSdk::IVxDataSourceConfig::Motion* motionConfig = nullptr;
-    VxSdk::VxResult::Value result = _dataSource->GetMotionConfiguration(motionConfig);
+    SdkCall sdkCall("IVxDataSource::GetMotionConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetMotionConfiguration(motionConfig));
 
     // Return the motion config if GetMotionConfiguration was successful
     if (result == VxSdk::VxResult::kOK)
@@ -778,9 +866,11 @@ VxSdkNet::DataSourceConfig::Motion^ VxSdkNet::DataSource::_GetMotionConfig() {
 }
 
 VxSdkNet::Configuration::Motion^ VxSdkNet::DataSource::_GetMotionConfiguration() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the motion config
     VxSdk::IVxConfiguration::Motion* motionConfig = nullptr;
-    VxSdk::VxResult::Value result = _dataSource->GetMotionConfiguration(motionConfig);
+    SdkCall sdkCall("IVxDataSource::GetMotionConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetMotionConfiguration(motionConfig));
 
     // Return the motion config if GetMotionConfiguration was successful
     if (result == VxSdk::VxResult::kOK)
@@ -790,18 +880,21 @@ VxSdkNet::Configuration::Motion^ VxSdkNet::DataSource::_GetMotionConfiguration()
 }
 
 System::Collections::Generic::List<VxSdkNet::UserInfo^>^ VxSdkNet::DataSource::_GetMultiviewInfo() {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed user info objects
     List<UserInfo^>^ mlist = gcnew List<UserInfo^>();
     // Create a collection of unmanaged user info objects
     VxSdk::VxCollection<VxSdk::IVxUserInfo**> userInfos;
 
     // Make the GetMultiviewInfo call, which will return with the total user info object count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetMultiviewInfo(userInfos);
+    SdkCall sdkCall("IVxDataSource::GetMultiviewInfo", userInfos);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetMultiviewInfo(userInfos));
     // As long as there are user info objects for this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxUserInfo collection
         userInfos.collection = new VxSdk::IVxUserInfo*[userInfos.collectionSize];
-        result = _dataSource->GetMultiviewInfo(userInfos);
+        sdkCall.Restart("IVxDataSource::GetMultiviewInfo", userInfos);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetMultiviewInfo(userInfos));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < userInfos.collectionSize; i++)
@@ -814,9 +907,11 @@ System::Collections::Generic::List<VxSdkNet::UserInfo^>^ VxSdkNet::DataSource::_
 }
 
 VxSdkNet::DataSourceConfig::Ptz^ VxSdkNet::DataSource::_GetPtzConfig() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the ptz config
     VxSdk::IVxDataSourceConfig::Ptz* ptzConfig = nullptr;
-    VxSdk::VxResult::Value result = _dataSource->GetPtzConfiguration(ptzConfig);
+    SdkCall sdkCall("IVxDataSource::GetPtzConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetPtzConfiguration(ptzConfig));
 
     // Return the ptz config if GetPtzConfiguration was successful
     if (result == VxSdk::VxResult::kOK)
@@ -826,14 +921,17 @@ VxSdkNet::DataSourceConfig::Ptz^ VxSdkNet::DataSource::_GetPtzConfig() {
 }
 
 VxSdkNet::PtzController^ VxSdkNet::DataSource::_GetPtzController() {
+    NativeReadLock nativeLock(_nativeLock);
     // Check to ensure this datasource is a ptz camera
     bool isPtz;
-    VxSdk::VxResult::Value result = _dataSource->CanPtz(isPtz);
+    SdkCall sdkCall("IVxDataSource::CanPtz");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->CanPtz(isPtz));
 
     if (isPtz) {
         // Get the ptz controller which allows the client to make ptz calls
         VxSdk::IVxPtzController* ptzController = nullptr;
-        result = _dataSource->GetPtzController(ptzController);
+        sdkCall.Restart("IVxDataSource::GetPtzController");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetPtzController(ptzController));
 
         // Return the ptz controller if GetPtzController was successful
         if (result == VxSdk::VxResult::kOK)
@@ -843,12 +941,14 @@ VxSdkNet::PtzController^ VxSdkNet::DataSource::_GetPtzController() {
 }
 
 System::String^ VxSdkNet::DataSource::_GetRtspEndpoint() {
+    NativeReadLock nativeLock(_nativeLock);
     char* rtspEndpoint = nullptr;
     int size = 0;
 
     // If the rtsp uri is not available on the datasource the result will return VxSdk::VxResult::kActionUnavailable,
     // otherwise VxSdk::VxResult::kInsufficientSize
-    VxSdk::VxResult::Value result = _dataSource->GetRtspEndpoint(rtspEndpoint, size);
+    SdkCall sdkCall("IVxDataSource::GetRtspEndpoint");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetRtspEndpoint(rtspEndpoint, size));
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for rtspEndpoint
         rtspEndpoint = new char[size];
@@ -859,9 +959,11 @@ System::String^ VxSdkNet::DataSource::_GetRtspEndpoint() {
 }
 
 VxSdkNet::DataSourceConfig::SmartCompression^ VxSdkNet::DataSource::_GetSmartCompressionConfig() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the smart compression config
     VxSdk::IVxDataSourceConfig::SmartCompression* smartCompressionConfig = nullptr;
-    VxSdk::VxResult::Value result = _dataSource->GetSmartCompressionConfiguration(smartCompressionConfig);
+    SdkCall sdkCall("IVxDataSource::GetSmartCompressionConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetSmartCompressionConfiguration(smartCompressionConfig));
 
     // Return the smart compression config if GetSmartCompressionConfiguration was successful
     if (result == VxSdk::VxResult::kOK)
@@ -871,18 +973,21 @@ VxSdkNet::DataSourceConfig::SmartCompression^ VxSdkNet::DataSource::_GetSmartCom
 }
 
 List<VxSdkNet::DataSourceConfig::VideoEncoding^>^ VxSdkNet::DataSource::_GetVideoEncodingConfigs() {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed video encodings
     List<DataSourceConfig::VideoEncoding^>^ mlist = gcnew List<DataSourceConfig::VideoEncoding^>();
     // Create a collection of unmanaged video encodings
     VxSdk::VxCollection<VxSdk::IVxDataSourceConfig::VideoEncoding**> videoEncodings;
 
     // Make the GetVideoEncodingsConfiguration call, which will return with the total video encodings count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataSource->GetVideoEncodingsConfiguration(videoEncodings);
+    SdkCall sdkCall("IVxDataSource::GetVideoEncodingsConfiguration", videoEncodings);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetVideoEncodingsConfiguration(videoEncodings));
     // As long as there are video encodings for this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDataSourceConfig::VideoEncoding collection
         videoEncodings.collection = new VxSdk::IVxDataSourceConfig::VideoEncoding*[videoEncodings.collectionSize];
-        result = _dataSource->GetVideoEncodingsConfiguration(videoEncodings);
+        sdkCall.Restart("IVxDataSource::GetVideoEncodingsConfiguration", videoEncodings);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataSource->GetVideoEncodingsConfiguration(videoEncodings));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < videoEncodings.collectionSize; i++)
@@ -893,3 +998,33 @@ List<VxSdkNet::DataSourceConfig::VideoEncoding^>^ VxSdkNet::DataSource::_GetVide
     }
     return mlist;
 }
+
+void VxSdkNet::DataSource::_Replace(VxSdk::IVxDataSource* vxDataSource) {
+    // Take the newly fetched state unless a call is using the current native object, in which case the wrapper
+    // keeps its current state, as does a wrapper that has been disposed; either way the native object not kept is
+    // released through the release queue
+    NativeMemory::Add(vxDataSource);
+    bool isLocked = false;
+    try {
+        isLocked = !_isDisposed && !_nativeLock->IsReadLockHeld && _nativeLock->TryEnterWriteLock(0);
+    }
+    catch (System::ObjectDisposedException^) {
+        // The wrapper was disposed while the object was being fetched
+    }
+
+    if (isLocked && _isDisposed) {
+        _nativeLock->ExitWriteLock();
+        isLocked = false;
+    }
+
+    if (!isLocked) {
+        NativeReleaseQueue::Release(vxDataSource);
+        return;
+    }
+
+    VxSdk::IVxDataSource* previous = _dataSource;
+    _dataSource = vxDataSource;
+    _nativeLock->ExitWriteLock();
+    if (previous != nullptr)
+        NativeReleaseQueue::Release(previous);
+}
@@ -2,6 +2,7 @@
 /// Implements the data source config class.
 /// </summary>
 #include "DataSourceConfig.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
@@ -11,21 +12,24 @@ using namespace System::Collections::Generic;
 
 VxSdkNet::DataSourceConfig::Motion::Motion(VxSdk::IVxDataSourceConfig::Motion* vxConfigMotion) {
     _configMotion = vxConfigMotion;
+    NativeMemory::Add(_configMotion);
 }
 
 VxSdkNet::DataSourceConfig::Motion::!Motion() {
-    _configMotion->Delete();
+    NativeReleaseQueue::Release(_configMotion);
     _configMotion = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::DataSourceConfig::Motion::Refresh() {
-    return (VxSdkNet::Results::Value)_configMotion->Refresh();
+    SdkCall sdkCall("IVxDataSourceConfig::Motion::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configMotion->Refresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::DataSourceConfig::Motion::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configMotion->GetLimits(limits);
+    SdkCall sdkCall("IVxDataSourceConfig::Motion::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configMotion->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -40,15 +44,17 @@ VxSdkNet::ResourceLimits^ VxSdkNet::DataSourceConfig::Motion::_GetLimits() {
 
 VxSdkNet::DataSourceConfig::Ptz::Ptz(VxSdk::IVxDataSourceConfig::Ptz* vxConfigPtz) {
     _configPtz = vxConfigPtz;
+    NativeMemory::Add(_configPtz);
 }
 
 VxSdkNet::DataSourceConfig::Ptz::!Ptz() {
-    _configPtz->Delete();
+    NativeReleaseQueue::Release(_configPtz);
     _configPtz = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::DataSourceConfig::Ptz::Refresh() {
-    return (VxSdkNet::Results::Value)_configPtz->Refresh();
+    SdkCall sdkCall("IVxDataSourceConfig::Ptz::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configPtz->Refresh());
 }
 
 // ====================================================================================================================
@@ -57,21 +63,24 @@ VxSdkNet::Results::Value VxSdkNet::DataSourceConfig::Ptz::Refresh() {
 
 VxSdkNet::DataSourceConfig::SmartCompression::SmartCompression(VxSdk::IVxDataSourceConfig::SmartCompression* vxConfigSmartCompression) {
     _configSmartCompression = vxConfigSmartCompression;
+    NativeMemory::Add(_configSmartCompression);
 }
 
 VxSdkNet::DataSourceConfig::SmartCompression::!SmartCompression() {
-    _configSmartCompression->Delete();
+    NativeReleaseQueue::Release(_configSmartCompression);
     _configSmartCompression = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::DataSourceConfig::SmartCompression::Refresh() {
-    return (VxSdkNet::Results::Value)_configSmartCompression->Refresh();
+    SdkCall sdkCall("IVxDataSourceConfig::SmartCompression::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configSmartCompression->Refresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::DataSourceConfig::SmartCompression::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _configSmartCompression->GetLimits(limits);
+    SdkCall sdkCall("IVxDataSourceConfig::SmartCompression::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _configSmartCompression->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -86,10 +95,11 @@ VxSdkNet::ResourceLimits^ VxSdkNet::DataSourceConfig::SmartCompression::_GetLimi
 
 VxSdkNet::DataSourceConfig::VideoEncoding::VideoEncoding(VxSdk::IVxDataSourceConfig::VideoEncoding* vxConfigVideoEncoding) {
     _configVideoEncoding = vxConfigVideoEncoding;
+    NativeMemory::Add(_configVideoEncoding);
 }
 
 VxSdkNet::DataSourceConfig::VideoEncoding::!VideoEncoding() {
-    _configVideoEncoding->Delete();
+    NativeReleaseQueue::Release(_configVideoEncoding);
     _configVideoEncoding = nullptr;
 }
 
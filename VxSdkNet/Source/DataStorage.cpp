@@ -2,15 +2,17 @@
 /// Implements the data storage class.
 /// </summary>
 #include "DataStorage.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::DataStorage::DataStorage(VxSdk::IVxDataStorage* vxDataStorage) {
     _dataStorage = vxDataStorage;
+    NativeMemory::Add(_dataStorage);
 }
 
 VxSdkNet::DataStorage::!DataStorage() {
-    _dataStorage->Delete();
+    NativeReleaseQueue::Release(_dataStorage);
     _dataStorage = nullptr;
 }
 
@@ -23,7 +25,8 @@ VxSdkNet::Results::Value VxSdkNet::DataStorage::AddClip(VxSdkNet::NewClip^ newCl
     VxSdk::Utilities::StrCopySafe(vxNewClip.endTime, Utils::ConvertCSharpDateTime(newClip->EndTime).c_str());
 
     // Make the call to add the clip to the data storage 
-    VxSdk::VxResult::Value result = _dataStorage->AddClip(vxNewClip);
+    SdkCall sdkCall("IVxDataStorage::AddClip");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataStorage->AddClip(vxNewClip));
     // Unless there was an issue adding the clip the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -44,7 +47,8 @@ VxSdkNet::Results::Value VxSdkNet::DataStorage::AssignDevice(VxSdkNet::NewDevice
     }
 
     // Make the call to add the situation into VideoXpert
-    VxSdk::VxResult::Value result = _dataStorage->AssignDevice(vxNewDeviceAssignment);
+    SdkCall sdkCall("IVxDataStorage::AssignDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataStorage->AssignDevice(vxNewDeviceAssignment));
     // Unless there was an issue adding the situation the result should be VxSdk::VxResult::kOK
     if (result == VxSdk::VxResult::kOK) {
         // Remove the memory we previously allocated
@@ -75,16 +79,18 @@ List<VxSdkNet::DataSource^>^ VxSdkNet::DataStorage::GetDataSources(System::Colle
     }
 
     // Make the GetDataSources call, which will return with the total count of data sources, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataStorage->GetDataSources(dataSources);
+    SdkCall sdkCall("IVxDataStorage::GetDataSources", dataSources);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataStorage->GetDataSources(dataSources));
     // Unless there are no data sources on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetDataSources call
         dataSources.collection = new VxSdk::IVxDataSource*[dataSources.collectionSize];
-        result = _dataStorage->GetDataSources(dataSources);
+        sdkCall.Restart("IVxDataStorage::GetDataSources", dataSources);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataStorage->GetDataSources(dataSources));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < dataSources.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::DataSource(dataSources.collection[i]));
+                mlist->Add(IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSources.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] dataSources.collection;
@@ -114,16 +120,18 @@ List<VxSdkNet::DeviceAssignment^>^ VxSdkNet::DataStorage::GetDeviceAssignments(S
     }
 
     // Make the GetDeviceAssignments call, which will return with the total count of device assignments, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataStorage->GetDeviceAssignments(deviceAssignments);
+    SdkCall sdkCall("IVxDataStorage::GetDeviceAssignments", deviceAssignments);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataStorage->GetDeviceAssignments(deviceAssignments));
     // Unless there are no device assignments on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetDeviceAssignments call
         deviceAssignments.collection = new VxSdk::IVxDeviceAssignment*[deviceAssignments.collectionSize];
-        result = _dataStorage->GetDeviceAssignments(deviceAssignments);
+        sdkCall.Restart("IVxDataStorage::GetDeviceAssignments", deviceAssignments);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataStorage->GetDeviceAssignments(deviceAssignments));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < deviceAssignments.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::DeviceAssignment(deviceAssignments.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::DeviceAssignment>(_identityMap, deviceAssignments.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] deviceAssignments.collection;
@@ -153,12 +161,14 @@ System::Collections::Generic::List<VxSdkNet::Retention^>^ VxSdkNet::DataStorage:
     }
 
     // Make the GetRetentions call, which will return with the total count of retentions, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dataStorage->GetRetentions(retentions);
+    SdkCall sdkCall("IVxDataStorage::GetRetentions", retentions);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataStorage->GetRetentions(retentions));
     // Unless there are no retentions on the data storage, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetRetentions call
         retentions.collection = new VxSdk::VxRetention * [retentions.collectionSize];
-        result = _dataStorage->GetRetentions(retentions);
+        sdkCall.Restart("IVxDataStorage::GetRetentions", retentions);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataStorage->GetRetentions(retentions));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < retentions.collectionSize; i++)
@@ -171,15 +181,18 @@ System::Collections::Generic::List<VxSdkNet::Retention^>^ VxSdkNet::DataStorage:
 }
 
 VxSdkNet::Results::Value VxSdkNet::DataStorage::Refresh() {
-    return (VxSdkNet::Results::Value)_dataStorage->Refresh();
+    SdkCall sdkCall("IVxDataStorage::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataStorage->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::DataStorage::UnassignDevice(VxSdkNet::Device^ device) {
     // Create an IVxDevice object using the device
+    NativeReadLock nativeLock(device->_nativeLock);
     VxSdk::IVxDevice* delDevice = device->_device;
 
     // Call UnassignDevice using the IVxDevice object
-    VxSdk::VxResult::Value result = _dataStorage->UnassignDevice(*delDevice);
+    SdkCall sdkCall("IVxDataStorage::UnassignDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataStorage->UnassignDevice(*delDevice));
     // Unless there was an issue unassigning the device the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -187,11 +200,12 @@ VxSdkNet::Results::Value VxSdkNet::DataStorage::UnassignDevice(VxSdkNet::Device^
 VxSdkNet::Device^ VxSdkNet::DataStorage::_GetHostDevice() {
     // Get the device which hosts this data storage
     VxSdk::IVxDevice* device = nullptr;
-    VxSdk::VxResult::Value result = _dataStorage->GetHostDevice(device);
+    SdkCall sdkCall("IVxDataStorage::GetHostDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataStorage->GetHostDevice(device));
 
     // Return the device if GetHostDevice was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew Device(device);
+        return IdentityMap::Intern<Device>(_identityMap, device);
 
     return nullptr;
 }
@@ -199,7 +213,8 @@ VxSdkNet::Device^ VxSdkNet::DataStorage::_GetHostDevice() {
 VxSdkNet::ResourceLimits^ VxSdkNet::DataStorage::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _dataStorage->GetLimits(limits);
+    SdkCall sdkCall("IVxDataStorage::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataStorage->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -211,7 +226,8 @@ VxSdkNet::ResourceLimits^ VxSdkNet::DataStorage::_GetLimits() {
 VxSdkNet::Configuration::Storage^ VxSdkNet::DataStorage::_GetStorageConfig() {
     // Get the storage config
     VxSdk::IVxConfiguration::Storage* storageConfig = nullptr;
-    VxSdk::VxResult::Value result = _dataStorage->GetStorageConfiguration(storageConfig);
+    SdkCall sdkCall("IVxDataStorage::GetStorageConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dataStorage->GetStorageConfiguration(storageConfig));
 
     // Return the storage config if GetStorageConfiguration was successful
     if (result == VxSdk::VxResult::kOK)
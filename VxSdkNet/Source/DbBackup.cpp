@@ -2,28 +2,33 @@
 /// Implements the database backup class.
 /// </summary>
 #include "DbBackup.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::DbBackup::DbBackup(VxSdk::IVxDbBackup* vxDbBackup) {
     _dbBackup = vxDbBackup;
+    NativeMemory::Add(_dbBackup);
 }
 
 VxSdkNet::DbBackup::!DbBackup() {
-    _dbBackup->Delete();
+    NativeReleaseQueue::Release(_dbBackup);
     _dbBackup = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::DbBackup::Halt() {
     // Call Halt and return the result
-    return (Results::Value)_dbBackup->Halt();
+    SdkCall sdkCall("IVxDbBackup::Halt");
+    return (Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dbBackup->Halt());
 }
 
 VxSdkNet::Results::Value VxSdkNet::DbBackup::Refresh() {
-    return (Results::Value)_dbBackup->Refresh();
+    SdkCall sdkCall("IVxDbBackup::Refresh");
+    return (Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dbBackup->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::DbBackup::Restore() {
     // Call Halt and return the result
-    return (Results::Value)_dbBackup->Restore();
+    SdkCall sdkCall("IVxDbBackup::Restore");
+    return (Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dbBackup->Restore());
 }
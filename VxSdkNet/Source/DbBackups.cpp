@@ -2,15 +2,17 @@
 /// Implements the database backups class.
 /// </summary>
 #include "DbBackups.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::DbBackups::DbBackups(VxSdk::IVxDbBackups* vxDbBackups) {
     _dbBackups = vxDbBackups;
+    NativeMemory::Add(_dbBackups);
 }
 
 VxSdkNet::DbBackups::!DbBackups() {
-    _dbBackups->Delete();
+    NativeReleaseQueue::Release(_dbBackups);
     _dbBackups = nullptr;
 }
 
@@ -25,7 +27,8 @@ VxSdkNet::Results::Value VxSdkNet::DbBackups::DeleteDatabaseBackup(DbBackup^ dbB
 }
 
 VxSdkNet::Results::Value VxSdkNet::DbBackups::TriggerBackup() {
-    return (Results::Value)_dbBackups->TriggerBackup();
+    SdkCall sdkCall("IVxDbBackups::TriggerBackup");
+    return (Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dbBackups->TriggerBackup());
 }
 
 bool VxSdkNet::DbBackups::ValidateBackupPath(System::String^ backupPath, System::String^ backupPathUsername, System::String^ backupPathPassword) {
@@ -41,12 +44,14 @@ List<VxSdkNet::DbBackup^>^ VxSdkNet::DbBackups::_GetDatabaseBackups() {
     VxSdk::VxCollection<VxSdk::IVxDbBackup**> databaseBackups;
 
     // Make the GetDatabaseBackups call, which will return with the total database backup count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _dbBackups->GetDatabaseBackups(databaseBackups);
+    SdkCall sdkCall("IVxDbBackups::GetDatabaseBackups", databaseBackups);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dbBackups->GetDatabaseBackups(databaseBackups));
     // As long as there are database backups the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDbBackup collection
         databaseBackups.collection = new VxSdk::IVxDbBackup*[databaseBackups.collectionSize];
-        result = _dbBackups->GetDatabaseBackups(databaseBackups);
+        sdkCall.Restart("IVxDbBackups::GetDatabaseBackups", databaseBackups);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dbBackups->GetDatabaseBackups(databaseBackups));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < databaseBackups.collectionSize; i++)
@@ -61,7 +66,8 @@ List<VxSdkNet::DbBackup^>^ VxSdkNet::DbBackups::_GetDatabaseBackups() {
 VxSdkNet::ResourceLimits^ VxSdkNet::DbBackups::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _dbBackups->GetLimits(limits);
+    SdkCall sdkCall("IVxDbBackups::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _dbBackups->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
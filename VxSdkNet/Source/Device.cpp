@@ -6,19 +6,40 @@
 #include "Device.h"
 #include "Monitor.h"
 #include "NewAnalyticSession.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Device::Device(VxSdk::IVxDevice* vxDevice) {
     _device = vxDevice;
+    NativeMemory::Add(_device);
 }
 
-VxSdkNet::Device::!Device() {
+VxSdkNet::Device::~Device() {
+    if (_isDisposed)
+        return;
+
+    // Wait for the calls using the native object, so that it is not deleted under them or replaced afterwards
+    if (_nativeLock != nullptr)
+        _nativeLock->EnterWriteLock();
+
+    _isDisposed = true;
+    NativeMemory::Remove(_device);
     _device->Delete();
     _device = nullptr;
+    if (_nativeLock != nullptr) {
+        _nativeLock->ExitWriteLock();
+        delete _nativeLock;
+    }
+}
+
+VxSdkNet::Device::!Device() {
+    NativeReleaseQueue::Release(_device);
+    _device = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Device::AddAnalyticSession(NewAnalyticSession^ newAnalyticSession) {
+    NativeReadLock nativeLock(_nativeLock);
     VxSdk::VxNewAnalyticSession vxNewAnalyticSession;
     VxSdk::Utilities::StrCopySafe(vxNewAnalyticSession.dataEncodingId, Utils::ConvertCSharpString(newAnalyticSession->DataEncodingId).c_str());
     VxSdk::Utilities::StrCopySafe(vxNewAnalyticSession.dataSourceId, Utils::ConvertCSharpString(newAnalyticSession->DataSourceId).c_str());
@@ -27,12 +48,15 @@ VxSdkNet::Results::Value VxSdkNet::Device::AddAnalyticSession(NewAnalyticSession
     VxSdk::Utilities::StrCopySafe(vxNewAnalyticSession.source, Utils::ConvertCSharpString(newAnalyticSession->Source).c_str());
 
     // Attempt to add the analytic session
-    return VxSdkNet::Results::Value(_device->AddAnalyticSession(vxNewAnalyticSession));
+    SdkCall sdkCall("IVxDevice::AddAnalyticSession");
+    return VxSdkNet::Results::Value(sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->AddAnalyticSession(vxNewAnalyticSession)));
 }
 
 VxSdkNet::Results::Value VxSdkNet::Device::CreateLog() {
+    NativeReadLock nativeLock(_nativeLock);
     // Make the call to create a new log on the device
-    VxSdk::VxResult::Value result = _device->CreateLog();
+    SdkCall sdkCall("IVxDevice::CreateLog");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->CreateLog());
     // Unless there was an issue creating the log the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -58,6 +82,7 @@ VxSdkNet::Results::Value VxSdkNet::Device::DeleteLog(VxSdkNet::Log^ logItem) {
 }
 
 List<VxSdkNet::AccessPoint^>^ VxSdkNet::Device::GetAccessPoints(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed access point objects
     List<AccessPoint^>^ mlist = gcnew List<AccessPoint^>();
     // Create a collection of unmanaged access point objects
@@ -79,16 +104,18 @@ List<VxSdkNet::AccessPoint^>^ VxSdkNet::Device::GetAccessPoints(System::Collecti
     }
 
     // Make the GetAccessPoints call, which will return with the total count of access points, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _device->GetAccessPoints(accessPoints);
+    SdkCall sdkCall("IVxDevice::GetAccessPoints", accessPoints);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetAccessPoints(accessPoints));
     // Unless there are no access points on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetAccessPoints call
         accessPoints.collection = new VxSdk::IVxAccessPoint * [accessPoints.collectionSize];
-        result = _device->GetAccessPoints(accessPoints);
+        sdkCall.Restart("IVxDevice::GetAccessPoints", accessPoints);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetAccessPoints(accessPoints));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < accessPoints.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::AccessPoint(accessPoints.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::AccessPoint>(_identityMap, accessPoints.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] accessPoints.collection;
@@ -97,6 +124,7 @@ List<VxSdkNet::AccessPoint^>^ VxSdkNet::Device::GetAccessPoints(System::Collecti
 }
 
 List<VxSdkNet::AlarmInput^>^ VxSdkNet::Device::GetAlarmInputs(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed alarm input objects
     List<AlarmInput^>^ mlist = gcnew List<AlarmInput^>();
     // Create a collection of unmanaged alarm input objects
@@ -118,16 +146,18 @@ List<VxSdkNet::AlarmInput^>^ VxSdkNet::Device::GetAlarmInputs(System::Collection
     }
 
     // Make the GetAlarmInputs call, which will return with the total count of alarm inputs, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _device->GetAlarmInputs(alarmInputs);
+    SdkCall sdkCall("IVxDevice::GetAlarmInputs", alarmInputs);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetAlarmInputs(alarmInputs));
     // Unless there are no alarm inputs hosted on the device, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetAlarmInputs call
         alarmInputs.collection = new VxSdk::IVxAlarmInput*[alarmInputs.collectionSize];
-        result = _device->GetAlarmInputs(alarmInputs);
+        sdkCall.Restart("IVxDevice::GetAlarmInputs", alarmInputs);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetAlarmInputs(alarmInputs));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < alarmInputs.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::AlarmInput(alarmInputs.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::AlarmInput>(_identityMap, alarmInputs.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] alarmInputs.collection;
@@ -136,6 +166,7 @@ List<VxSdkNet::AlarmInput^>^ VxSdkNet::Device::GetAlarmInputs(System::Collection
 }
 
 List<VxSdkNet::AnalyticSession^>^ VxSdkNet::Device::GetAnalyticSessions(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed analytic sessions
     List<AnalyticSession^>^ mlist = gcnew List<AnalyticSession^>();
     // Create a collection of unmanaged analytic sessions
@@ -157,16 +188,18 @@ List<VxSdkNet::AnalyticSession^>^ VxSdkNet::Device::GetAnalyticSessions(System::
     }
 
     // Make the GetAnalyticSessions call, which will return with the total analytic session count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _device->GetAnalyticSessions(analyticSessions);
+    SdkCall sdkCall("IVxDevice::GetAnalyticSessions", analyticSessions);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetAnalyticSessions(analyticSessions));
     // As long as there are analytic sessions for this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxAnalyticSession collection
         analyticSessions.collection = new VxSdk::IVxAnalyticSession * [analyticSessions.collectionSize];
-        result = _device->GetAnalyticSessions(analyticSessions);
+        sdkCall.Restart("IVxDevice::GetAnalyticSessions", analyticSessions);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetAnalyticSessions(analyticSessions));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < analyticSessions.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::AnalyticSession(analyticSessions.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::AnalyticSession>(_identityMap, analyticSessions.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] analyticSessions.collection;
@@ -175,12 +208,14 @@ List<VxSdkNet::AnalyticSession^>^ VxSdkNet::Device::GetAnalyticSessions(System::
 }
 
 System::String^ VxSdkNet::Device::GetBackupUri() {
+    NativeReadLock nativeLock(_nativeLock);
     char* backupEndpoint = nullptr;
     int size = 0;
 
     // If the backup uri is not available on the device the result will return VxSdk::VxResult::kActionUnavailable,
     // otherwise VxSdk::VxResult::kInsufficientSize
-    VxSdk::VxResult::Value result = _device->GetBackup(backupEndpoint, size);
+    SdkCall sdkCall("IVxDevice::GetBackup");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetBackup(backupEndpoint, size));
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for backupEndpoint
         backupEndpoint = new char[size];
@@ -191,6 +226,7 @@ System::String^ VxSdkNet::Device::GetBackupUri() {
 }
 
 List<VxSdkNet::DataSource^>^ VxSdkNet::Device::GetDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed data source objects
     List<DataSource^>^ mlist = gcnew List<DataSource^>();
     // Create a collection of unmanaged data source objects
@@ -212,16 +248,18 @@ List<VxSdkNet::DataSource^>^ VxSdkNet::Device::GetDataSources(System::Collection
     }
 
     // Make the GetDataSources call, which will return with the total count of data sources, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _device->GetDataSources(dataSources);
+    SdkCall sdkCall("IVxDevice::GetDataSources", dataSources);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetDataSources(dataSources));
     // Unless there are no data sources hosted on the device, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetDataSources call
         dataSources.collection = new VxSdk::IVxDataSource*[dataSources.collectionSize];
-        result = _device->GetDataSources(dataSources);
+        sdkCall.Restart("IVxDevice::GetDataSources", dataSources);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetDataSources(dataSources));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < dataSources.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::DataSource(dataSources.collection[i]));
+                mlist->Add(IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSources.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] dataSources.collection;
@@ -230,6 +268,7 @@ List<VxSdkNet::DataSource^>^ VxSdkNet::Device::GetDataSources(System::Collection
 }
 
 List<VxSdkNet::DeviceAssignment^>^ VxSdkNet::Device::GetDeviceAssignments(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed device assignment objects
     List<DeviceAssignment^>^ mlist = gcnew List<DeviceAssignment^>();
     // Create a collection of unmanaged device assignment objects
@@ -251,16 +290,18 @@ List<VxSdkNet::DeviceAssignment^>^ VxSdkNet::Device::GetDeviceAssignments(System
     }
 
     // Make the GetDeviceAssignments call, which will return with the total count of device assignments, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _device->GetDeviceAssignments(deviceAssignments);
+    SdkCall sdkCall("IVxDevice::GetDeviceAssignments", deviceAssignments);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetDeviceAssignments(deviceAssignments));
     // Unless there are no device assignments hosted on the device, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetDeviceAssignments call
         deviceAssignments.collection = new VxSdk::IVxDeviceAssignment*[deviceAssignments.collectionSize];
-        result = _device->GetDeviceAssignments(deviceAssignments);
+        sdkCall.Restart("IVxDevice::GetDeviceAssignments", deviceAssignments);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetDeviceAssignments(deviceAssignments));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < deviceAssignments.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::DeviceAssignment(deviceAssignments.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::DeviceAssignment>(_identityMap, deviceAssignments.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] deviceAssignments.collection;
@@ -269,6 +310,7 @@ List<VxSdkNet::DeviceAssignment^>^ VxSdkNet::Device::GetDeviceAssignments(System
 }
 
 List<VxSdkNet::Log^>^ VxSdkNet::Device::GetLogs(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed log objects
     List<Log^>^ mlist = gcnew List<Log^>();
     // Create a collection of unmanaged log objects
@@ -290,12 +332,14 @@ List<VxSdkNet::Log^>^ VxSdkNet::Device::GetLogs(System::Collections::Generic::Di
     }
 
     // Make the GetLogs call, which will return with the total count of logs, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _device->GetLogs(logs);
+    SdkCall sdkCall("IVxDevice::GetLogs", logs);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetLogs(logs));
     // Unless there are no logs on the device, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetLogs call
         logs.collection = new VxSdk::IVxLog*[logs.collectionSize];
-        result = _device->GetLogs(logs);
+        sdkCall.Restart("IVxDevice::GetLogs", logs);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetLogs(logs));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < logs.collectionSize; i++)
@@ -308,6 +352,7 @@ List<VxSdkNet::Log^>^ VxSdkNet::Device::GetLogs(System::Collections::Generic::Di
 }
 
 System::Collections::Generic::List<VxSdkNet::Monitor^>^ VxSdkNet::Device::GetMonitors(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed monitor objects
     List<Monitor^>^ mlist = gcnew List<Monitor^>();
     // Create a collection of unmanaged monitor objects
@@ -329,16 +374,18 @@ System::Collections::Generic::List<VxSdkNet::Monitor^>^ VxSdkNet::Device::GetMon
     }
 
     // Make the GetMonitors call, which will return with the total count of monitors, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _device->GetMonitors(monitors);
+    SdkCall sdkCall("IVxDevice::GetMonitors", monitors);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetMonitors(monitors));
     // Unless there are no monitors hosted by the device, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetMonitors call
         monitors.collection = new VxSdk::IVxMonitor*[monitors.collectionSize];
-        result = _device->GetMonitors(monitors);
+        sdkCall.Restart("IVxDevice::GetMonitors", monitors);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetMonitors(monitors));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < monitors.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::Monitor(monitors.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::Monitor>(_identityMap, monitors.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] monitors.collection;
@@ -347,6 +394,7 @@ System::Collections::Generic::List<VxSdkNet::Monitor^>^ VxSdkNet::Device::GetMon
 }
 
 List<VxSdkNet::RelayOutput^>^ VxSdkNet::Device::GetRelayOutputs(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of managed relay output objects
     List<RelayOutput^>^ mlist = gcnew List<RelayOutput^>();
     // Create a collection of unmanaged relay output objects
@@ -368,16 +416,18 @@ List<VxSdkNet::RelayOutput^>^ VxSdkNet::Device::GetRelayOutputs(System::Collecti
     }
 
     // Make the GetRelayOutputs call, which will return with the total count of relay outputs, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _device->GetRelayOutputs(relayOutputs);
+    SdkCall sdkCall("IVxDevice::GetRelayOutputs", relayOutputs);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetRelayOutputs(relayOutputs));
     // Unless there are no relay outputs hosted on the device, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetRelayOutputs call
         relayOutputs.collection = new VxSdk::IVxRelayOutput*[relayOutputs.collectionSize];
-        result = _device->GetRelayOutputs(relayOutputs);
+        sdkCall.Restart("IVxDevice::GetRelayOutputs", relayOutputs);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetRelayOutputs(relayOutputs));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < relayOutputs.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::RelayOutput(relayOutputs.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::RelayOutput>(_identityMap, relayOutputs.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] relayOutputs.collection;
@@ -386,48 +436,63 @@ List<VxSdkNet::RelayOutput^>^ VxSdkNet::Device::GetRelayOutputs(System::Collecti
 }
 
 VxSdkNet::Results::Value VxSdkNet::Device::Refresh() {
-    return (VxSdkNet::Results::Value)_device->Refresh();
+    NativeReadLock nativeLock(_nativeLock);
+    SdkCall sdkCall("IVxDevice::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Device::Replace(System::String^ replacementDeviceId) {
+    NativeReadLock nativeLock(_nativeLock);
     // Make the call to replace this device
-    VxSdk::VxResult::Value result = _device->Replace(Utils::ConvertCSharpString(replacementDeviceId).c_str());
+    SdkCall sdkCall("IVxDevice::Replace");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->Replace(Utils::ConvertCSharpString(replacementDeviceId).c_str()));
     // Unless there was an issue replacing the device the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::Device::RestoreBackup(System::String^ backupPath) {
+    NativeReadLock nativeLock(_nativeLock);
     // Copy the backup file path to a new char
     int len = backupPath->Length + 1;
     char* backupFile = new char[len];
     VxSdk::Utilities::StrCopySafe(backupFile, Utils::ConvertCSharpString(backupPath).c_str(), len);
 
     // Restore the backup
-    return (VxSdkNet::Results::Value)_device->RestoreBackup(backupFile);
+    SdkCall sdkCall("IVxDevice::RestoreBackup");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->RestoreBackup(backupFile));
 }
 
 VxSdkNet::Results::Value VxSdkNet::Device::Silence() {
-    return (VxSdkNet::Results::Value)_device->Silence();
+    NativeReadLock nativeLock(_nativeLock);
+    SdkCall sdkCall("IVxDevice::Silence");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->Silence());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Device::TriggerRefresh() {
-    return (VxSdkNet::Results::Value)_device->TriggerRefresh();
+    NativeReadLock nativeLock(_nativeLock);
+    SdkCall sdkCall("IVxDevice::TriggerRefresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->TriggerRefresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Device::UpdateSoftware(VxSdkNet::VxFile^ updateFile) {
-    return (VxSdkNet::Results::Value)_device->UpdateSoftware(*updateFile->_vxFile);
+    NativeReadLock nativeLock(_nativeLock);
+    SdkCall sdkCall("IVxDevice::UpdateSoftware");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->UpdateSoftware(*updateFile->_vxFile));
 }
 
 bool VxSdkNet::Device::_CanCreateLogs() {
+    NativeReadLock nativeLock(_nativeLock);
     bool result;
     _device->CanCreateLogs(result);
     return result;
 }
 
 VxSdkNet::Configuration::Auth^ VxSdkNet::Device::_GetAuthConfig() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the auth configuration
     VxSdk::IVxConfiguration::Auth* authConfig = nullptr;
-    VxSdk::VxResult::Value result = _device->GetAuthenticationConfiguration(authConfig);
+    SdkCall sdkCall("IVxDevice::GetAuthenticationConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetAuthenticationConfiguration(authConfig));
 
     // Return the auth configuration if GetAuthenticationConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -442,21 +507,25 @@ VxSdkNet::Configuration::Auth^ VxSdkNet::Device::_GetAuthConfig() {
 }
 
 VxSdkNet::DataStorage^ VxSdkNet::Device::_GetDataStorage() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the data storage hosted by this device
     VxSdk::IVxDataStorage* dataStorage = nullptr;
-    VxSdk::VxResult::Value result = _device->GetDataStorage(dataStorage);
+    SdkCall sdkCall("IVxDevice::GetDataStorage");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetDataStorage(dataStorage));
 
     // Return the driver if GetDataStorage was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::DataStorage(dataStorage);
+        return IdentityMap::Wrap<VxSdkNet::DataStorage>(_identityMap, dataStorage);
 
     return nullptr;
 }
 
 VxSdkNet::DbBackups^ VxSdkNet::Device::_GetDatabaseBackups() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the database backups for this this device
     VxSdk::IVxDbBackups* dbBackups = nullptr;
-    VxSdk::VxResult::Value result = _device->GetDatabaseBackups(dbBackups);
+    SdkCall sdkCall("IVxDevice::GetDatabaseBackups");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetDatabaseBackups(dbBackups));
 
     // Return the database backups if GetDatabaseBackups was successful
     if (result == VxSdk::VxResult::kOK)
@@ -466,9 +535,11 @@ VxSdkNet::DbBackups^ VxSdkNet::Device::_GetDatabaseBackups() {
 }
 
 VxSdkNet::Diagnostics^ VxSdkNet::Device::_GetDiagnostics() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the diagnostics from the device
     VxSdk::VxDiagnostics* diagnostics = nullptr;
-    VxSdk::VxResult::Value result = _device->GetDiagnostics(diagnostics);
+    SdkCall sdkCall("IVxDevice::GetDiagnostics");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetDiagnostics(diagnostics));
 
     // Return the diagnostics if GetDiagnostics was successful
     if (result == VxSdk::VxResult::kOK)
@@ -478,6 +549,7 @@ VxSdkNet::Diagnostics^ VxSdkNet::Device::_GetDiagnostics() {
 }
 
 List<System::String^>^ VxSdkNet::Device::_GetEndpoints() {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of strings
     List<System::String^>^ mlist = gcnew List<System::String^>();
     // Add each endpoint to the string list
@@ -488,6 +560,7 @@ List<System::String^>^ VxSdkNet::Device::_GetEndpoints() {
 }
 
 List<System::String^>^ VxSdkNet::Device::_GetLicensableFeatures() {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of strings
     List<System::String^>^ mlist = gcnew List<System::String^>();
     // Add each licensable feature to the string list
@@ -498,6 +571,7 @@ List<System::String^>^ VxSdkNet::Device::_GetLicensableFeatures() {
 }
 
 List<System::String^>^ VxSdkNet::Device::_GetLicensedFeatures() {
+    NativeReadLock nativeLock(_nativeLock);
     // Create a list of strings
     List<System::String^>^ mlist = gcnew List<System::String^>();
     // Add each licensed feature to the string list
@@ -508,9 +582,11 @@ List<System::String^>^ VxSdkNet::Device::_GetLicensedFeatures() {
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::Device::_GetLimits() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _device->GetLimits(limits);
+    SdkCall sdkCall("IVxDevice::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -520,9 +596,11 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Device::_GetLimits() {
 }
 
 VxSdkNet::Configuration::ThermalEtd^ VxSdkNet::Device::_GetThermalEtdConfig() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the thermal etd configuration
     VxSdk::IVxConfiguration::ThermalEtd* thermalEtdConfig = nullptr;
-    VxSdk::VxResult::Value result = _device->GetThermalEtdConfiguration(thermalEtdConfig);
+    SdkCall sdkCall("IVxDevice::GetThermalEtdConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetThermalEtdConfiguration(thermalEtdConfig));
 
     // Return the thermal etd configuration if GetThermalEtdConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -537,9 +615,11 @@ VxSdkNet::Configuration::ThermalEtd^ VxSdkNet::Device::_GetThermalEtdConfig() {
 }
 
 VxSdkNet::Configuration::Time^ VxSdkNet::Device::_GetTimeConfig() {
+    NativeReadLock nativeLock(_nativeLock);
     // Get the time configuration
     VxSdk::IVxConfiguration::Time* timeConfig = nullptr;
-    VxSdk::VxResult::Value result = _device->GetTimeConfiguration(timeConfig);
+    SdkCall sdkCall("IVxDevice::GetTimeConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _device->GetTimeConfiguration(timeConfig));
 
     // Return the time configuration if GetTimeConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -554,13 +634,45 @@ VxSdkNet::Configuration::Time^ VxSdkNet::Device::_GetTimeConfig() {
 }
 
 bool VxSdkNet::Device::_HasDiagnostics() {
+    NativeReadLock nativeLock(_nativeLock);
     bool result;
     _device->HasDiagnostics(result);
     return result;
 }
 
+void VxSdkNet::Device::_Replace(VxSdk::IVxDevice* vxDevice) {
+    // Take the newly fetched state unless a call is using the current native object, in which case the wrapper
+    // keeps its current state, as does a wrapper that has been disposed; either way the native object not kept is
+    // released through the release queue
+    NativeMemory::Add(vxDevice);
+    bool isLocked = false;
+    try {
+        isLocked = !_isDisposed && !_nativeLock->IsReadLockHeld && _nativeLock->TryEnterWriteLock(0);
+    }
+    catch (System::ObjectDisposedException^) {
+        // The wrapper was disposed while the object was being fetched
+    }
+
+    if (isLocked && _isDisposed) {
+        _nativeLock->ExitWriteLock();
+        isLocked = false;
+    }
+
+    if (!isLocked) {
+        NativeReleaseQueue::Release(vxDevice);
+        return;
+    }
+
+    VxSdk::IVxDevice* previous = _device;
+    _device = vxDevice;
+    _nativeLock->ExitWriteLock();
+    if (previous != nullptr)
+        NativeReleaseQueue::Release(previous);
+}
+
 void VxSdkNet::Device::_SetEndpoints(List<System::String^>^ endpoints)
 {
+    NativeReadLock nativeLock(_nativeLock);
     int size = endpoints->Count;
     char** endpointUris = new char* [size];
     for (int i = 0; i < size; i++) {
@@ -3,15 +3,17 @@
 /// </summary>
 #include "Device.h"
 #include "DataStorage.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::DeviceAssignment::DeviceAssignment(VxSdk::IVxDeviceAssignment* vxDeviceAssignment) {
     _deviceAssignment = vxDeviceAssignment;
+    NativeMemory::Add(_deviceAssignment);
 }
 
 VxSdkNet::DeviceAssignment::!DeviceAssignment() {
-    _deviceAssignment->Delete();
+    NativeReleaseQueue::Release(_deviceAssignment);
     _deviceAssignment = nullptr;
 }
 
@@ -37,16 +39,18 @@ List<VxSdkNet::DataSource^>^ VxSdkNet::DeviceAssignment::GetDataSources(System::
     }
 
     // Make the GetDataSources call, which will return with the total count of data sources, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _deviceAssignment->GetDataSources(dataSources);
+    SdkCall sdkCall("IVxDeviceAssignment::GetDataSources", dataSources);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _deviceAssignment->GetDataSources(dataSources));
     // Unless there are no data sources on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetDataSources call
         dataSources.collection = new VxSdk::IVxDataSource*[dataSources.collectionSize];
-        result = _deviceAssignment->GetDataSources(dataSources);
+        sdkCall.Restart("IVxDeviceAssignment::GetDataSources", dataSources);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _deviceAssignment->GetDataSources(dataSources));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < dataSources.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::DataSource(dataSources.collection[i]));
+                mlist->Add(IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSources.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] dataSources.collection;
@@ -55,17 +59,19 @@ List<VxSdkNet::DataSource^>^ VxSdkNet::DeviceAssignment::GetDataSources(System::
 }
 
 VxSdkNet::Results::Value VxSdkNet::DeviceAssignment::Refresh() {
-    return (VxSdkNet::Results::Value)_deviceAssignment->Refresh();
+    SdkCall sdkCall("IVxDeviceAssignment::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _deviceAssignment->Refresh());
 }
 
 VxSdkNet::DataStorage^ VxSdkNet::DeviceAssignment::_GetDataStorage() {
     // Get the data storage object
     VxSdk::IVxDataStorage* dataStorage = nullptr;
-    VxSdk::VxResult::Value result = _deviceAssignment->GetDataStorage(dataStorage);
+    SdkCall sdkCall("IVxDeviceAssignment::GetDataStorage");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _deviceAssignment->GetDataStorage(dataStorage));
 
     // Return the data storage if GetDataStorage was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::DataStorage(dataStorage);
+        return IdentityMap::Wrap<VxSdkNet::DataStorage>(_identityMap, dataStorage);
 
     // Return nullptr if GetDataStorage is unsuccessful
     return nullptr;
@@ -74,11 +80,12 @@ VxSdkNet::DataStorage^ VxSdkNet::DeviceAssignment::_GetDataStorage() {
 VxSdkNet::Device^ VxSdkNet::DeviceAssignment::_GetDevice() {
     // Get the device object
     VxSdk::IVxDevice* device = nullptr;
-    VxSdk::VxResult::Value result = _deviceAssignment->GetDevice(device);
+    SdkCall sdkCall("IVxDeviceAssignment::GetDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _deviceAssignment->GetDevice(device));
 
     // Return the device if GetDevice was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::Device(device);
+        return IdentityMap::Intern<VxSdkNet::Device>(_identityMap, device);
 
     // Return nullptr if GetDevice is unsuccessful
     return nullptr;
@@ -87,7 +94,8 @@ VxSdkNet::Device^ VxSdkNet::DeviceAssignment::_GetDevice() {
 VxSdkNet::ResourceLimits^ VxSdkNet::DeviceAssignment::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _deviceAssignment->GetLimits(limits);
+    SdkCall sdkCall("IVxDeviceAssignment::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _deviceAssignment->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -4,20 +4,23 @@
 ///
 #include "Discovery.h"
 #include "DiscoveryRequest.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Discovery::Discovery(VxSdk::IVxDiscovery* vxDiscovery) {
     _discovery = vxDiscovery;
+    NativeMemory::Add(_discovery);
 }
 
 VxSdkNet::Discovery::!Discovery() {
-    _discovery->Delete();
+    NativeReleaseQueue::Release(_discovery);
     _discovery = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Discovery::Refresh() {
-    return (VxSdkNet::Results::Value)_discovery->Refresh();
+    SdkCall sdkCall("IVxDiscovery::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _discovery->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Discovery::TriggerDiscovery(DiscoveryRequest^ discoveryRequest) {
@@ -49,7 +52,8 @@ VxSdkNet::Results::Value VxSdkNet::Discovery::TriggerDiscovery(DiscoveryRequest^
         }
     }
 
-    VxSdk::VxResult::Value result = _discovery->TriggerDiscovery(request);
+    SdkCall sdkCall("IVxDiscovery::TriggerDiscovery");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _discovery->TriggerDiscovery(request));
 
     return (VxSdkNet::Results::Value)result;
 }
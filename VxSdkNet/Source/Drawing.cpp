@@ -2,15 +2,17 @@
 /// Implements the Drawing class.
 /// </summary>
 #include "Drawing.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Drawing::Drawing(VxSdk::IVxDrawing* vxDrawing) {
     _drawing = vxDrawing;
+    NativeMemory::Add(_drawing);
 }
 
 VxSdkNet::Drawing::!Drawing() {
-    _drawing->Delete();
+    NativeReleaseQueue::Release(_drawing);
     _drawing = nullptr;
 }
 
@@ -25,19 +27,22 @@ VxSdkNet::Results::Value VxSdkNet::Drawing::AddMarker(NewMarker^ newMarker) {
     vxNewMarker.y = newMarker->Y;
 
     // Make the call to add the marker to the drawing
-    VxSdk::VxResult::Value result = _drawing->AddMarker(vxNewMarker);
+    SdkCall sdkCall("IVxDrawing::AddMarker");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _drawing->AddMarker(vxNewMarker));
     // Unless there was an issue creating the marker the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::Drawing::DeleteImage() {
-    return (VxSdkNet::Results::Value)_drawing->DeleteImage();
+    SdkCall sdkCall("IVxDrawing::DeleteImage");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _drawing->DeleteImage());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Drawing::DeleteLock() {
     // Get the lock for this drawing
     VxSdk::IVxResourceLock* lock = nullptr;
-    VxSdk::VxResult::Value result = _drawing->GetLock(lock);
+    SdkCall sdkCall("IVxDrawing::GetLock");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _drawing->GetLock(lock));
 
     // Delete the lock if present
     if (result == VxSdk::VxResult::kOK && lock != nullptr)
@@ -56,7 +61,8 @@ System::String^ VxSdkNet::Drawing::GetImageUri() {
 
     // If the rtsp uri is not available on the datasource the result will return VxSdk::VxResult::kActionUnavailable,
     // otherwise VxSdk::VxResult::kInsufficientSize
-    VxSdk::VxResult::Value result = _drawing->GetImage(imageEndpoint, size);
+    SdkCall sdkCall("IVxDrawing::GetImage");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _drawing->GetImage(imageEndpoint, size));
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for rtspEndpoint
         imageEndpoint = new char[size];
@@ -69,7 +75,8 @@ System::String^ VxSdkNet::Drawing::GetImageUri() {
 VxSdkNet::ResourceLock^ VxSdkNet::Drawing::GetLock() {
     // Get the lock for this drawing
     VxSdk::IVxResourceLock* lock = nullptr;
-    VxSdk::VxResult::Value result = _drawing->GetLock(lock);
+    SdkCall sdkCall("IVxDrawing::GetLock");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _drawing->GetLock(lock));
 
     // Return the lock if present
     if (result == VxSdk::VxResult::kOK && lock != nullptr)
@@ -100,12 +107,14 @@ System::Collections::Generic::List<VxSdkNet::Marker^>^ VxSdkNet::Drawing::GetMar
     }
 
     // Make the GetMarkers call, which will return with the total marker count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _drawing->GetMarkers(markers);
+    SdkCall sdkCall("IVxDrawing::GetMarkers", markers);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _drawing->GetMarkers(markers));
     // Unless there are no markers on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxMarker collection
         markers.collection = new VxSdk::IVxMarker*[markers.collectionSize];
-        result = _drawing->GetMarkers(markers);
+        sdkCall.Restart("IVxDrawing::GetMarkers", markers);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _drawing->GetMarkers(markers));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < markers.collectionSize; i++)
@@ -139,7 +148,8 @@ bool VxSdkNet::Drawing::HasMarkerWithResource(System::String^ resourceId) {
 }
 
 VxSdkNet::Results::Value VxSdkNet::Drawing::Refresh() {
-    return (VxSdkNet::Results::Value)_drawing->Refresh();
+    SdkCall sdkCall("IVxDrawing::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _drawing->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Drawing::SetImage(System::String^ imagePath) {
@@ -149,17 +159,20 @@ VxSdkNet::Results::Value VxSdkNet::Drawing::SetImage(System::String^ imagePath)
     VxSdk::Utilities::StrCopySafe(image, Utils::ConvertCSharpString(imagePath).c_str(), len);
 
     // Set the image path
-    return (VxSdkNet::Results::Value)_drawing->SetImage(image);
+    SdkCall sdkCall("IVxDrawing::SetImage");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _drawing->SetImage(image));
 }
 
 VxSdkNet::Results::Value VxSdkNet::Drawing::SetLock() {
-    return (VxSdkNet::Results::Value)_drawing->SetLock();
+    SdkCall sdkCall("IVxDrawing::SetLock");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _drawing->SetLock());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::Drawing::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _drawing->GetLimits(limits);
+    SdkCall sdkCall("IVxDrawing::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _drawing->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
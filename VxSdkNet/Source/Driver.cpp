@@ -3,18 +3,21 @@
 /// </summary>
 #include "Driver.h"
 #include "DataStorage.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Driver::Driver(VxSdk::IVxDriver* vxDriver) {
     _driver = vxDriver;
+    NativeMemory::Add(_driver);
 }
 
 VxSdkNet::Driver::!Driver() {
-    _driver->Delete();
+    NativeReleaseQueue::Release(_driver);
     _driver = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Driver::Refresh() {
-    return (VxSdkNet::Results::Value)_driver->Refresh();
+    SdkCall sdkCall("IVxDriver::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _driver->Refresh());
 }
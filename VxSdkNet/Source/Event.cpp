@@ -4,24 +4,27 @@
 #include "Event.h"
 #include <iterator>
 #include <map>
+#include "NativeReleaseQueue.h"
 
 VxSdkNet::Event::Event(VxSdk::IVxEvent* vxEvent) {
     _event = vxEvent;
+    NativeMemory::Add(_event);
 }
 
 VxSdkNet::Event::!Event() {
-    _event->Delete();
+    NativeReleaseQueue::Release(_event);
     _event = nullptr;
 }
 
 VxSdkNet::Device^ VxSdkNet::Event::_GetGeneratorDevice() {
     // Get the generator device for this event
     VxSdk::IVxDevice* device = nullptr;
-    VxSdk::VxResult::Value result = _event->GetGeneratorDevice(device);
+    SdkCall sdkCall("IVxEvent::GetGeneratorDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _event->GetGeneratorDevice(device));
 
     // Return the device if GetGeneratorDevice was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew Device(device);
+        return IdentityMap::Intern<Device>(_identityMap, device);
 
     // Return nullptr if GetGeneratorDevice is unsuccessful
     return nullptr;
@@ -46,11 +49,12 @@ System::Collections::Generic::List<System::Collections::Generic::KeyValuePair<Sy
 VxSdkNet::Situation^ VxSdkNet::Event::_GetSituation() {
     // Get the situation associated with this event
     VxSdk::IVxSituation* situation = nullptr;
-    VxSdk::VxResult::Value result = _event->GetSituation(situation);
+    SdkCall sdkCall("IVxEvent::GetSituation");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _event->GetSituation(situation));
 
     // Return the situation if GetSituation was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::Situation(situation);
+        return IdentityMap::Wrap<VxSdkNet::Situation>(_identityMap, situation);
 
     // Return nullptr if GetSituation is unsuccessful
     return nullptr;
@@ -59,11 +63,12 @@ VxSdkNet::Situation^ VxSdkNet::Event::_GetSituation() {
 VxSdkNet::Device^ VxSdkNet::Event::_GetSourceDevice() {
     // Get the source device for this event
     VxSdk::IVxDevice* device = nullptr;
-    VxSdk::VxResult::Value result = _event->GetSourceDevice(device);
+    SdkCall sdkCall("IVxEvent::GetSourceDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _event->GetSourceDevice(device));
 
     // Return the device if GetSourceDevice was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew Device(device);
+        return IdentityMap::Intern<Device>(_identityMap, device);
 
     // Return nullptr if GetSourceDevice is unsuccessful
     return nullptr;
@@ -72,7 +77,8 @@ VxSdkNet::Device^ VxSdkNet::Event::_GetSourceDevice() {
 VxSdkNet::User^ VxSdkNet::Event::_GetSourceUser() {
     // Get the source user associated with this event
     VxSdk::IVxUser* user = nullptr;
-    VxSdk::VxResult::Value result = _event->GetUser(user);
+    SdkCall sdkCall("IVxEvent::GetUser");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _event->GetUser(user));
 
     // Return the user if GetUser was successful
     if (result == VxSdk::VxResult::kOK)
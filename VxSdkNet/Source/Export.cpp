@@ -2,28 +2,33 @@
 /// Implements the export class.
 /// </summary>
 #include "Export.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Export::Export(VxSdk::IVxExport* vxExport) {
     _export = vxExport;
+    NativeMemory::Add(_export);
 }
 
 VxSdkNet::Export::!Export() {
-    _export->Delete();
+    NativeReleaseQueue::Release(_export);
     _export = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Export::Refresh() {
-    return (VxSdkNet::Results::Value)_export->Refresh();
+    SdkCall sdkCall("IVxExport::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _export->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Export::RestoreExport() {
-    return (VxSdkNet::Results::Value)_export->RestoreExport();
+    SdkCall sdkCall("IVxExport::RestoreExport");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _export->RestoreExport());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Export::TrashExport() {
-    return (VxSdkNet::Results::Value)_export->TrashExport();
+    SdkCall sdkCall("IVxExport::TrashExport");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _export->TrashExport());
 }
 
 List<VxSdkNet::ExportClip^>^ VxSdkNet::Export::_GetClips() {
@@ -39,7 +44,8 @@ List<VxSdkNet::ExportClip^>^ VxSdkNet::Export::_GetClips() {
 VxSdkNet::ExportStream^ VxSdkNet::Export::_GetExportStream() {
     // Get the export stream for this export
     VxSdk::IVxExportStream* exportStream = nullptr;
-    VxSdk::VxResult::Value result = _export->GetExportStream(exportStream);
+    SdkCall sdkCall("IVxExport::GetExportStream");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _export->GetExportStream(exportStream));
 
     // Return the export stream if GetExportStream was successful
     if (result == VxSdk::VxResult::kOK)
@@ -51,7 +57,8 @@ VxSdkNet::ExportStream^ VxSdkNet::Export::_GetExportStream() {
 VxSdkNet::User^ VxSdkNet::Export::_GetOwner() {
     // Get the user that owns this export
     VxSdk::IVxUser* user = nullptr;
-    VxSdk::VxResult::Value result = _export->GetOwner(user);
+    SdkCall sdkCall("IVxExport::GetOwner");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _export->GetOwner(user));
 
     // Return the user if GetOwner was successful
     if (result == VxSdk::VxResult::kOK)
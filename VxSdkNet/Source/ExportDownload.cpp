@@ -0,0 +1,402 @@
+/// <summary>
+/// Implements the export download class.
+/// </summary>
+#include <msclr/lock.h>
+#include "ExportDownload.h"
+
+using namespace System;
+using namespace System::IO;
+using namespace System::Net;
+using namespace System::Security::Cryptography;
+using namespace System::Threading;
+
+namespace {
+    // The size of the buffer each worker reads into before writing to the file
+    const int kBufferSize = 1024 * 1024;
+
+    // The smallest chunk size allowed
+    const long long kMinChunkSize = 64 * 1024;
+}
+
+VxSdkNet::ExportDownload::ExportDownload(Export^ exportItem, String^ filePath) {
+    _export = exportItem;
+    _filePath = filePath;
+    _partPath = filePath + ".part";
+    _checkpointPath = filePath + ".checkpoint";
+    _headers = gcnew WebHeaderCollection();
+    _elapsed = gcnew System::Diagnostics::Stopwatch();
+    _completedChunks = gcnew System::Collections::Generic::Dictionary<int, String^>();
+    _totalBytes = -1;
+    ChunkSize = 8 * 1024 * 1024;
+    MaxConcurrentChunks = 4;
+    MaxRetries = 5;
+    Timeout = 30000;
+}
+
+void VxSdkNet::ExportDownload::Cancel() {
+    _isCanceled = true;
+}
+
+VxSdkNet::Results::Value VxSdkNet::ExportDownload::Download() {
+    _isCanceled = false;
+    _bytesDownloaded = 0;
+    _downloadedThisRun = 0;
+    _elapsed->Restart();
+
+    // Only completed exports have data to download
+    _uri = _export->DataUri;
+    if (_export->Status != Export::States::Successful || String::IsNullOrEmpty(_uri))
+        return Results::Value::NotReady;
+
+    if (!_Probe())
+        return Results::Value::CommunicationError;
+
+    // Without range support the data can only be fetched as a single stream
+    _chunkSize = _acceptsRanges && _totalBytes > 0 ? Math::Max(static_cast<long long>(ChunkSize), kMinChunkSize) : Math::Max(_totalBytes, 1LL);
+    _chunkCount = _totalBytes < 0 ? 1 : static_cast<int>((_totalBytes + _chunkSize - 1) / _chunkSize);
+
+    ExportDownloadJob^ job = gcnew ExportDownloadJob();
+    try {
+        _ReadCheckpoint();
+
+        // Preallocate the file so that chunks can be written in place as they arrive
+        FileStream^ part = gcnew FileStream(_partPath, FileMode::OpenOrCreate, FileAccess::Write, FileShare::ReadWrite);
+        if (part->Length != Math::Max(_totalBytes, 0LL))
+            part->SetLength(Math::Max(_totalBytes, 0LL));
+
+        delete part;
+
+        // Start a new checkpoint unless resuming from an existing one
+        bool isResuming = _completedChunks->Count > 0;
+        job->Checkpoint = gcnew StreamWriter(_checkpointPath, isResuming);
+        job->Checkpoint->AutoFlush = true;
+        if (!isResuming)
+            job->Checkpoint->WriteLine("{0} {1} {2}", _totalBytes, _chunkSize, _uri);
+
+        job->Chunks = gcnew System::Collections::Concurrent::ConcurrentQueue<int>();
+        for (int i = 0; i < _chunkCount; i++) {
+            if (_completedChunks->ContainsKey(i))
+                _bytesDownloaded += _GetChunkLength(i);
+            else
+                job->Chunks->Enqueue(i);
+        }
+
+        // Fetch the remaining chunks using a bounded number of workers
+        int workers = Math::Min(_acceptsRanges ? Math::Max(MaxConcurrentChunks, 1) : 1, job->Chunks->Count);
+        if (workers > 0) {
+            job->Workers = gcnew CountdownEvent(workers);
+            for (int i = 0; i < workers; i++)
+                ThreadPool::QueueUserWorkItem(gcnew WaitCallback(this, &VxSdkNet::ExportDownload::_RunChunks), job);
+
+            job->Workers->Wait();
+        }
+
+        delete job->Checkpoint;
+        job->Checkpoint = nullptr;
+        _elapsed->Stop();
+
+        if (_isCanceled)
+            return Results::Value::OperationFailed;
+
+        if (job->IsFailed)
+            return Results::Value::CommunicationError;
+
+        // Verify the complete file if its checksum is known; start over next time if it does not match
+        if (!String::IsNullOrEmpty(ExpectedChecksum)) {
+            String^ checksum = _HashFile(0, _totalBytes, gcnew array<unsigned char>(kBufferSize));
+            if (!String::Equals(checksum, ExpectedChecksum, StringComparison::OrdinalIgnoreCase)) {
+                File::Delete(_checkpointPath);
+                File::Delete(_partPath);
+                return Results::Value::OperationFailed;
+            }
+        }
+
+        if (File::Exists(_filePath))
+            File::Delete(_filePath);
+
+        File::Move(_partPath, _filePath);
+        File::Delete(_checkpointPath);
+    }
+    catch (IOException^) {
+        return Results::Value::CommunicationError;
+    }
+    catch (UnauthorizedAccessException^) {
+        return Results::Value::CommunicationError;
+    }
+    finally {
+        if (job->Checkpoint != nullptr)
+            delete job->Checkpoint;
+
+        _elapsed->Stop();
+    }
+
+    return Results::Value::OK;
+}
+
+double VxSdkNet::ExportDownload::Throughput::get() {
+    double seconds = _elapsed->Elapsed.TotalSeconds;
+    return seconds > 0 ? Interlocked::Read(_downloadedThisRun) / seconds : 0;
+}
+
+HttpWebRequest^ VxSdkNet::ExportDownload::_CreateRequest() {
+    HttpWebRequest^ request = safe_cast<HttpWebRequest^>(WebRequest::Create(_uri));
+    request->Timeout = Timeout;
+    request->ReadWriteTimeout = Timeout;
+    request->KeepAlive = true;
+    request->Headers->Add(_headers);
+
+    // Allow a persistent connection to the server for each worker
+    if (request->ServicePoint->ConnectionLimit < MaxConcurrentChunks)
+        request->ServicePoint->ConnectionLimit = MaxConcurrentChunks;
+
+    return request;
+}
+
+bool VxSdkNet::ExportDownload::_FetchChunk(int chunk, array<unsigned char>^ buffer, String^% checksum) {
+    long long offset = chunk * _chunkSize;
+    long long length = _GetChunkLength(chunk);
+    HttpWebRequest^ request = _CreateRequest();
+    if (_acceptsRanges)
+        request->AddRange(offset, offset + length - 1);
+
+    HttpWebResponse^ response = nullptr;
+    FileStream^ file = nullptr;
+    SHA256^ hash = SHA256::Create();
+    try {
+        response = safe_cast<HttpWebResponse^>(request->GetResponse());
+        if (_acceptsRanges && response->StatusCode != HttpStatusCode::PartialContent)
+            return false;
+
+        Stream^ body = response->GetResponseStream();
+        file = gcnew FileStream(_partPath, FileMode::Open, FileAccess::Write, FileShare::ReadWrite, 1);
+        file->Seek(offset, SeekOrigin::Begin);
+
+        long long received = 0;
+        while (!_isCanceled) {
+            // Fill the buffer before writing so that the file is written in large sequential blocks
+            int filled = 0;
+            while (filled < buffer->Length && (length < 0 || received + filled < length)) {
+                long long wanted = buffer->Length - filled;
+                if (length >= 0)
+                    wanted = Math::Min(wanted, length - received - filled);
+
+                int read = body->Read(buffer, filled, static_cast<int>(wanted));
+                if (read == 0)
+                    break;
+
+                filled += read;
+            }
+
+            if (filled == 0)
+                break;
+
+            hash->TransformBlock(buffer, 0, filled, nullptr, 0);
+            file->Write(buffer, 0, filled);
+            received += filled;
+        }
+
+        // A short chunk means the connection was closed early
+        if (_isCanceled || (length >= 0 && received != length))
+            return false;
+
+        hash->TransformFinalBlock(buffer, 0, 0);
+        checksum = _ToHex(hash->Hash);
+        if (length < 0)
+            _totalBytes = received;
+
+        Interlocked::Add(_bytesDownloaded, received);
+        Interlocked::Add(_downloadedThisRun, received);
+        return true;
+    }
+    catch (WebException^) {
+        return false;
+    }
+    catch (IOException^) {
+        return false;
+    }
+    finally {
+        delete hash;
+        if (file != nullptr)
+            delete file;
+
+        if (response != nullptr)
+            delete response;
+    }
+}
+
+long long VxSdkNet::ExportDownload::_GetChunkLength(int chunk) {
+    if (_totalBytes < 0)
+        return -1;
+
+    return Math::Min(_chunkSize, _totalBytes - chunk * _chunkSize);
+}
+
+String^ VxSdkNet::ExportDownload::_HashFile(long long offset, long long length, array<unsigned char>^ buffer) {
+    FileStream^ file = nullptr;
+    SHA256^ hash = SHA256::Create();
+    try {
+        file = gcnew FileStream(_partPath, FileMode::Open, FileAccess::Read, FileShare::ReadWrite, 1, FileOptions::SequentialScan);
+        file->Seek(offset, SeekOrigin::Begin);
+        while (length > 0) {
+            int read = file->Read(buffer, 0, static_cast<int>(Math::Min(static_cast<long long>(buffer->Length), length)));
+            if (read == 0)
+                return nullptr;
+
+            hash->TransformBlock(buffer, 0, read, nullptr, 0);
+            length -= read;
+        }
+
+        hash->TransformFinalBlock(buffer, 0, 0);
+        return _ToHex(hash->Hash);
+    }
+    catch (IOException^) {
+        return nullptr;
+    }
+    finally {
+        delete hash;
+        if (file != nullptr)
+            delete file;
+    }
+}
+
+bool VxSdkNet::ExportDownload::_Probe() {
+    // Request the first byte to find the size of the data and whether ranged requests are supported
+    HttpWebRequest^ request = _CreateRequest();
+    request->AddRange(0LL, 0LL);
+
+    HttpWebResponse^ response = nullptr;
+    try {
+        response = safe_cast<HttpWebResponse^>(request->GetResponse());
+        _acceptsRanges = false;
+        _totalBytes = response->ContentLength;
+        if (response->StatusCode == HttpStatusCode::PartialContent) {
+            // The total size follows the slash in a content range of the form "bytes 0-0/12345"
+            String^ contentRange = response->Headers[HttpResponseHeader::ContentRange];
+            int slash = contentRange != nullptr ? contentRange->LastIndexOf('/') : -1;
+            long long totalBytes;
+            if (slash >= 0 && Int64::TryParse(contentRange->Substring(slash + 1), totalBytes)) {
+                _acceptsRanges = true;
+                _totalBytes = totalBytes;
+            }
+            else
+                _totalBytes = -1;
+        }
+
+        // Only the headers are needed
+        request->Abort();
+        return true;
+    }
+    catch (WebException^ e) {
+        // There is no first byte to return for empty data, so the range is refused with a size of 0, as in "bytes */0"
+        HttpWebResponse^ refused = dynamic_cast<HttpWebResponse^>(e->Response);
+        if (refused == nullptr)
+            return false;
+
+        String^ contentRange = refused->Headers[HttpResponseHeader::ContentRange];
+        bool isEmpty = refused->StatusCode == HttpStatusCode::RequestedRangeNotSatisfiable && contentRange != nullptr &&
+            contentRange->Substring(contentRange->LastIndexOf('/') + 1)->Trim() == "0";
+        delete refused;
+        if (!isEmpty)
+            return false;
+
+        _acceptsRanges = false;
+        _totalBytes = 0;
+        return true;
+    }
+    finally {
+        if (response != nullptr)
+            delete response;
+    }
+}
+
+void VxSdkNet::ExportDownload::_ReadCheckpoint() {
+    _completedChunks->Clear();
+    if (!File::Exists(_checkpointPath))
+        return;
+
+    array<String^>^ lines = File::ReadAllLines(_checkpointPath);
+    String^ header = String::Format("{0} {1} {2}", _totalBytes, _chunkSize, _uri);
+
+    // The checkpoint only applies to the same data fetched with the same chunk size
+    if (!_acceptsRanges || lines->Length == 0 || lines[0] != header || !File::Exists(_partPath)) {
+        File::Delete(_checkpointPath);
+        return;
+    }
+
+    // Keep the chunks whose data still matches the checksum recorded when they were downloaded
+    array<unsigned char>^ buffer = gcnew array<unsigned char>(kBufferSize);
+    for (int i = 1; i < lines->Length; i++) {
+        array<String^>^ fields = lines[i]->Split(' ');
+        int chunk;
+        if (fields->Length != 2 || !Int32::TryParse(fields[0], chunk) || chunk < 0 || chunk >= _chunkCount)
+            continue;
+
+        if (String::Equals(_HashFile(chunk * _chunkSize, _GetChunkLength(chunk), buffer), fields[1]))
+            _completedChunks[chunk] = fields[1];
+    }
+
+    // Rewrite the checkpoint without the chunks that failed verification
+    if (_completedChunks->Count > 0) {
+        StreamWriter^ checkpoint = gcnew StreamWriter(_checkpointPath, false);
+        checkpoint->WriteLine(header);
+        for each (System::Collections::Generic::KeyValuePair<int, String^> entry in _completedChunks)
+            checkpoint->WriteLine("{0} {1}", entry.Key, entry.Value);
+
+        delete checkpoint;
+    }
+    else
+        File::Delete(_checkpointPath);
+}
+
+void VxSdkNet::ExportDownload::_RunChunks(Object^ state) {
+    ExportDownloadJob^ job = safe_cast<ExportDownloadJob^>(state);
+    array<unsigned char>^ buffer = gcnew array<unsigned char>(kBufferSize);
+    try {
+        int chunk;
+        while (!_isCanceled && !job->IsFailed && job->Chunks->TryDequeue(chunk)) {
+            String^ checksum = nullptr;
+            bool isFetched = false;
+            for (int attempt = 0; attempt <= MaxRetries && !_isCanceled; attempt++) {
+                // Back off before retrying an interrupted chunk
+                if (attempt > 0)
+                    Thread::Sleep(Math::Min(1000 << Math::Min(attempt - 1, 5), 30000));
+
+                if (_FetchChunk(chunk, buffer, checksum)) {
+                    isFetched = true;
+                    break;
+                }
+            }
+
+            if (!isFetched) {
+                if (!_isCanceled)
+                    job->IsFailed = true;
+
+                break;
+            }
+
+            // Record the chunk so that it is not fetched again if the download is resumed
+            {
+                msclr::lock checkpointLock(job->Checkpoint);
+                job->Checkpoint->WriteLine("{0} {1}", chunk, checksum);
+            }
+
+            ProgressDelegate^ progress = _progressEvent;
+            if (progress != nullptr) {
+                try {
+                    progress(this);
+                }
+                catch (Exception^) {
+                    // Don't let the handler's exception escape onto the worker thread
+                    Interlocked::Increment(_handlerErrors);
+                }
+            }
+        }
+    }
+    finally {
+        job->Workers->Signal();
+    }
+}
+
+String^ VxSdkNet::ExportDownload::_ToHex(array<unsigned char>^ hash) {
+    return BitConverter::ToString(hash)->Replace("-", String::Empty)->ToLowerInvariant();
+}
@@ -0,0 +1,288 @@
+/// <summary>
+/// Implements the export queue class.
+/// </summary>
+#include <msclr/lock.h>
+#include "ExportQueue.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Threading;
+
+VxSdkNet::ExportQueue::ExportQueue(VXSystem^ system) {
+    _system = system;
+    _pending = gcnew List<ExportJob^>();
+    _active = gcnew List<ExportJob^>();
+    _wake = gcnew AutoResetEvent(false);
+    _idle = gcnew ManualResetEvent(true);
+    _elapsed = gcnew System::Diagnostics::Stopwatch();
+    MaxConcurrentExports = 2;
+    MaxEstimatedSizeKb = 0;
+    MaxPollInterval = 30000;
+    MaxRetries = 3;
+    MinPollInterval = 1000;
+    RetryDelay = 30000;
+}
+
+VxSdkNet::ExportQueue::~ExportQueue() {
+    Thread^ dispatcher;
+    {
+        msclr::lock queueLock(this);
+        if (_isDisposed)
+            return;
+
+        _isDisposed = true;
+        dispatcher = _dispatcher;
+    }
+
+    // Wait for the dispatcher to stop, unless it is a handler on the dispatcher that is disposing the queue
+    _wake->Set();
+    if (dispatcher != nullptr && dispatcher != Thread::CurrentThread)
+        dispatcher->Join();
+
+    CancelPending();
+}
+
+int VxSdkNet::ExportQueue::CancelPending() {
+    List<ExportJob^>^ canceled;
+    {
+        msclr::lock queueLock(this);
+        canceled = gcnew List<ExportJob^>(_pending);
+        _pending->Clear();
+    }
+
+    for each (ExportJob^ job in canceled)
+        _Finish(job, ExportJob::States::Canceled);
+
+    _wake->Set();
+    return canceled->Count;
+}
+
+VxSdkNet::ExportJob^ VxSdkNet::ExportQueue::Enqueue(NewExport^ newExport) {
+    ExportJob^ job = gcnew ExportJob(newExport);
+
+    msclr::lock queueLock(this);
+    if (_isDisposed)
+        throw gcnew ObjectDisposedException("ExportQueue");
+
+    _pending->Add(job);
+    _idle->Reset();
+    _elapsed->Start();
+
+    // Start the dispatcher if it is not already running
+    if (_dispatcher == nullptr) {
+        _dispatcher = gcnew Thread(gcnew ThreadStart(this, &VxSdkNet::ExportQueue::_Dispatch));
+        _dispatcher->IsBackground = true;
+        _dispatcher->Name = "ExportQueue";
+        _dispatcher->Start();
+    }
+
+    _wake->Set();
+    return job;
+}
+
+bool VxSdkNet::ExportQueue::WaitAll(TimeSpan timeout) {
+    return _idle->WaitOne(timeout);
+}
+
+int VxSdkNet::ExportQueue::PendingCount::get() {
+    msclr::lock queueLock(this);
+    return _pending->Count;
+}
+
+double VxSdkNet::ExportQueue::Throughput::get() {
+    double seconds = _elapsed->Elapsed.TotalSeconds;
+    return seconds > 0 ? Interlocked::Read(_exportedKb) / seconds : 0;
+}
+
+void VxSdkNet::ExportQueue::_Dispatch() {
+    List<ExportJob^>^ submit = gcnew List<ExportJob^>();
+    List<ExportJob^>^ poll = gcnew List<ExportJob^>();
+    while (true) {
+        DateTime now = DateTime::UtcNow;
+        DateTime nextWake = now.AddMilliseconds(MaxPollInterval);
+        submit->Clear();
+        poll->Clear();
+        {
+            msclr::lock queueLock(this);
+            // Exit once there is nothing left to do; a new dispatcher is started by the next Enqueue
+            if (_isDisposed || (_pending->Count == 0 && _active->Count == 0)) {
+                _dispatcher = nullptr;
+                _elapsed->Stop();
+                _idle->Set();
+                return;
+            }
+
+            // Submit the jobs that are due, up to the concurrency limit
+            int maxActive = Math::Max(MaxConcurrentExports, 1);
+            for (int i = 0; i < _pending->Count && _active->Count < maxActive;) {
+                ExportJob^ job = _pending[i];
+                if (job->_nextPoll <= now) {
+                    _pending->RemoveAt(i);
+                    _active->Add(job);
+                    submit->Add(job);
+                }
+                else {
+                    if (job->_nextPoll < nextWake)
+                        nextWake = job->_nextPoll;
+                    i++;
+                }
+            }
+
+            _activeCount = _active->Count;
+
+            // Check the progress of the active exports that are due
+            for each (ExportJob^ job in _active) {
+                if (submit->Contains(job))
+                    continue;
+
+                if (job->_nextPoll <= now)
+                    poll->Add(job);
+                else if (job->_nextPoll < nextWake)
+                    nextWake = job->_nextPoll;
+            }
+        }
+
+        for each (ExportJob^ job in submit)
+            _Submit(job);
+
+        for each (ExportJob^ job in poll)
+            _Poll(job);
+
+        // Sleep until the next job is due or the queue changes
+        if (submit->Count == 0 && poll->Count == 0) {
+            TimeSpan wait = nextWake - DateTime::UtcNow;
+            _wake->WaitOne(wait > TimeSpan::Zero ? wait : TimeSpan::Zero);
+        }
+    }
+}
+
+void VxSdkNet::ExportQueue::_Finish(ExportJob^ job, ExportJob::States status) {
+    {
+        msclr::lock queueLock(this);
+        _active->Remove(job);
+        _activeCount = _active->Count;
+    }
+
+    job->_status = status;
+    job->_completed = DateTime::UtcNow;
+    if (status == ExportJob::States::Successful)
+        Interlocked::Increment(_completedCount);
+    else if (status != ExportJob::States::Canceled)
+        Interlocked::Increment(_failedCount);
+
+    _Raise(_jobProgress, job);
+    _Raise(_jobCompleted, job);
+}
+
+void VxSdkNet::ExportQueue::_Poll(ExportJob^ job) {
+    Interlocked::Increment(_refreshCount);
+    Export^ exportItem = job->_export;
+    if (exportItem->Refresh() != Results::Value::OK) {
+        // Back off while the system cannot be reached
+        job->_pollInterval = Math::Min(job->_pollInterval * 2, MaxPollInterval);
+        job->_nextPoll = DateTime::UtcNow.AddMilliseconds(job->_pollInterval);
+        return;
+    }
+
+    Export::States status = exportItem->Status;
+    if (status == Export::States::Successful) {
+        job->_percentComplete = 100;
+        Interlocked::Add(_exportedKb, exportItem->FileSizeKb);
+        _Finish(job, ExportJob::States::Successful);
+        return;
+    }
+
+    if (status == Export::States::Failed) {
+        job->_statusReason = exportItem->StatusReason;
+        bool canRetry = job->_statusReason == Export::StateReasons::ExportStorageFull ||
+            job->_statusReason == Export::StateReasons::ExportStorageUnavailable;
+        if (!canRetry || !_Retry(job))
+            _Finish(job, ExportJob::States::Failed);
+
+        return;
+    }
+
+    // Poll again about halfway through the estimated time remaining while the export is progressing, otherwise back off
+    long long interval;
+    float percentComplete = exportItem->PercentComplete;
+    if (percentComplete != job->_percentComplete) {
+        job->_percentComplete = percentComplete;
+        interval = exportItem->SecondsRemaining > 0 ? exportItem->SecondsRemaining * 500LL : MinPollInterval;
+        _Raise(_jobProgress, job);
+    }
+    else
+        interval = job->_pollInterval * 2LL;
+
+    job->_pollInterval = static_cast<int>(Math::Max(Math::Min(interval, static_cast<long long>(MaxPollInterval)),
+        static_cast<long long>(MinPollInterval)));
+    job->_nextPoll = DateTime::UtcNow.AddMilliseconds(job->_pollInterval);
+}
+
+void VxSdkNet::ExportQueue::_Raise(ExportJobDelegate^ handler, ExportJob^ job) {
+    if (handler == nullptr)
+        return;
+
+    try {
+        handler(job);
+    }
+    catch (Exception^) {
+        // Don't let the handler's exception escape onto the dispatcher thread
+        Interlocked::Increment(_handlerErrors);
+    }
+}
+
+bool VxSdkNet::ExportQueue::_Retry(ExportJob^ job) {
+    if (job->_attempts > MaxRetries)
+        return false;
+
+    // Give the export storage time to recover, doubling the delay for each further retry
+    job->_status = ExportJob::States::Retrying;
+    job->_nextPoll = DateTime::UtcNow.AddMilliseconds(static_cast<double>(RetryDelay) * (1 << Math::Min(job->_attempts - 1, 16)));
+    {
+        msclr::lock queueLock(this);
+        _active->Remove(job);
+        _pending->Add(job);
+        _activeCount = _active->Count;
+    }
+
+    Interlocked::Increment(_retryCount);
+    _Raise(_jobProgress, job);
+
+    return true;
+}
+
+void VxSdkNet::ExportQueue::_Submit(ExportJob^ job) {
+    // Check the estimate before the first submission so oversized exports are not started
+    if (job->_attempts == 0) {
+        ExportEstimate^ estimate = _system->GetExportEstimate(job->_newExport);
+        if (estimate != nullptr) {
+            job->_estimatedSizeKb = estimate->Size;
+            if (MaxEstimatedSizeKb > 0 && estimate->Size > MaxEstimatedSizeKb) {
+                _Finish(job, ExportJob::States::Rejected);
+                return;
+            }
+        }
+    }
+
+    job->_attempts++;
+    Export^ exportItem = _system->AddExport(job->_newExport);
+    if (exportItem == nullptr) {
+        // The reason for the failure is not reported, so record it as unknown; it is still retried like a failure of
+        // the export storage, as that is the most likely cause
+        job->_statusReason = Export::StateReasons::Unknown;
+        if (!_Retry(job))
+            _Finish(job, ExportJob::States::Failed);
+
+        return;
+    }
+
+    if (job->_attempts == 1)
+        job->_submitted = DateTime::UtcNow;
+
+    job->_export = exportItem;
+    job->_status = ExportJob::States::Exporting;
+    job->_percentComplete = 0;
+    job->_pollInterval = MinPollInterval;
+    job->_nextPoll = DateTime::UtcNow.AddMilliseconds(MinPollInterval);
+    _Raise(_jobProgress, job);
+}
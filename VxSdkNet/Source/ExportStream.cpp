@@ -2,28 +2,33 @@
 /// Implements the export stream class.
 /// </summary>
 #include "ExportStream.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::ExportStream::ExportStream(VxSdk::IVxExportStream* vxExportStream) {
     _exportStream = vxExportStream;
+    NativeMemory::Add(_exportStream);
 }
 
 VxSdkNet::ExportStream::!ExportStream() {
-    _exportStream->Delete();
+    NativeReleaseQueue::Release(_exportStream);
     _exportStream = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::ExportStream::Halt() {
-    return (VxSdkNet::Results::Value)_exportStream->Halt();
+    SdkCall sdkCall("IVxExportStream::Halt");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _exportStream->Halt());
 }
 
 VxSdkNet::Results::Value VxSdkNet::ExportStream::Prepare() {
-    return (VxSdkNet::Results::Value)_exportStream->Prepare();
+    SdkCall sdkCall("IVxExportStream::Prepare");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _exportStream->Prepare());
 }
 
 VxSdkNet::Results::Value VxSdkNet::ExportStream::Refresh() {
-    return (VxSdkNet::Results::Value)_exportStream->Refresh();
+    SdkCall sdkCall("IVxExportStream::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _exportStream->Refresh());
 }
 
 List<VxSdkNet::ExportStreamClip^>^ VxSdkNet::ExportStream::_GetStreamClips() {
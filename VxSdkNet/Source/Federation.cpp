@@ -0,0 +1,233 @@
+/// <summary>
+/// Implements the federation class.
+/// </summary>
+#include <msclr/lock.h>
+#include "Federation.h"
+
+using namespace System;
+using namespace System::Collections::Concurrent;
+using namespace System::Collections::Generic;
+using namespace System::Threading;
+
+VxSdkNet::Federation::Federation() {
+    _sites = gcnew List<FederationSite^>();
+    _events = gcnew ConcurrentQueue<FederatedItem^>();
+    _wake = gcnew AutoResetEvent(false);
+    MaxPendingEvents = 65536;
+    SiteTimeout = 30000;
+}
+
+VxSdkNet::Federation::!Federation() {
+    // Stop the dispatcher; the sites and their systems belong to the caller
+    msclr::lock federationLock(this);
+    _isSubscribed = false;
+    _wake->Set();
+}
+
+VxSdkNet::FederationSite^ VxSdkNet::Federation::AddSite(String^ name, VXSystem^ system, String^ username, String^ password) {
+    FederationSite^ site = gcnew FederationSite(this, name, system, username, password);
+    msclr::lock sitesLock(_sites);
+    _sites->Add(site);
+    return site;
+}
+
+List<VxSdkNet::FederatedItem^>^ VxSdkNet::Federation::GetDataSources(Dictionary<Filters::Value, String^>^ filters) {
+    FederatedGet^ get = gcnew FederatedGet(filters);
+    Query(gcnew QueryDelegate(get, &VxSdkNet::FederatedGet::GetDataSources), gcnew ItemDelegate(get, &VxSdkNet::FederatedGet::Add));
+    return get->Items;
+}
+
+List<VxSdkNet::FederatedItem^>^ VxSdkNet::Federation::GetEvents(Dictionary<Filters::Value, String^>^ filters) {
+    FederatedGet^ get = gcnew FederatedGet(filters);
+    Query(gcnew QueryDelegate(get, &VxSdkNet::FederatedGet::GetEvents), gcnew ItemDelegate(get, &VxSdkNet::FederatedGet::Add));
+    return get->Items;
+}
+
+List<VxSdkNet::FederatedItem^>^ VxSdkNet::Federation::GetSituations(Dictionary<Filters::Value, String^>^ filters) {
+    FederatedGet^ get = gcnew FederatedGet(filters);
+    Query(gcnew QueryDelegate(get, &VxSdkNet::FederatedGet::GetSituations), gcnew ItemDelegate(get, &VxSdkNet::FederatedGet::Add));
+    return get->Items;
+}
+
+Dictionary<String^, VxSdkNet::Results::Value>^ VxSdkNet::Federation::Login() {
+    FederatedQuery^ job = gcnew FederatedQuery();
+    job->Operation = gcnew SiteOperation(this, &VxSdkNet::Federation::_LoginSite);
+    return _FanOut(job);
+}
+
+Dictionary<String^, VxSdkNet::Results::Value>^ VxSdkNet::Federation::Query(QueryDelegate^ query, ItemDelegate^ callback) {
+    FederatedQuery^ job = gcnew FederatedQuery();
+    job->Operation = gcnew SiteOperation(this, &VxSdkNet::Federation::_QuerySite);
+    job->Query = query;
+    job->Callback = callback;
+    return _FanOut(job);
+}
+
+Dictionary<String^, VxSdkNet::Results::Value>^ VxSdkNet::Federation::SubscribeToEvents() {
+    {
+        msclr::lock federationLock(this);
+        _isSubscribed = true;
+
+        // Start the dispatcher if it is not already running
+        if (_dispatcher == nullptr) {
+            _dispatcher = gcnew Thread(gcnew ThreadStart(this, &VxSdkNet::Federation::_Dispatch));
+            _dispatcher->IsBackground = true;
+            _dispatcher->Name = "Federation";
+            _dispatcher->Start();
+        }
+    }
+
+    FederatedQuery^ job = gcnew FederatedQuery();
+    job->Operation = gcnew SiteOperation(this, &VxSdkNet::Federation::_SubscribeSite);
+    return _FanOut(job);
+}
+
+Dictionary<String^, VxSdkNet::Results::Value>^ VxSdkNet::Federation::UnsubscribeFromEvents() {
+    FederatedQuery^ job = gcnew FederatedQuery();
+    job->Operation = gcnew SiteOperation(this, &VxSdkNet::Federation::_UnsubscribeSite);
+    Dictionary<String^, Results::Value>^ results = _FanOut(job);
+
+    msclr::lock federationLock(this);
+    _isSubscribed = false;
+    _wake->Set();
+    return results;
+}
+
+List<VxSdkNet::FederationSite^>^ VxSdkNet::Federation::Sites::get() {
+    msclr::lock sitesLock(_sites);
+    return gcnew List<FederationSite^>(_sites);
+}
+
+void VxSdkNet::Federation::_Dispatch() {
+    while (true) {
+        // Raise the events in the order they were received, whichever site they came from
+        FederatedItem^ item;
+        while (_events->TryDequeue(item)) {
+            Interlocked::Decrement(_pendingEventCount);
+            FederatedEventDelegate^ systemEvent = _systemEvent;
+            if (systemEvent != nullptr) {
+                try {
+                    systemEvent(item->Site, safe_cast<Event^>(item->Item));
+                }
+                catch (Exception^) {
+                    // Don't let the handler's exception escape onto the dispatcher thread
+                    Interlocked::Increment(_handlerErrors);
+                }
+            }
+
+            Interlocked::Increment(_dispatchedEventCount);
+        }
+
+        {
+            // Exit once unsubscribed and every event received has been raised
+            msclr::lock federationLock(this);
+            if (!_isSubscribed && _events->IsEmpty) {
+                _dispatcher = nullptr;
+                return;
+            }
+        }
+
+        _wake->WaitOne();
+    }
+}
+
+Dictionary<String^, VxSdkNet::Results::Value>^ VxSdkNet::Federation::_FanOut(FederatedQuery^ job) {
+    List<FederationSite^>^ sites = Sites;
+    job->SiteResults = gcnew Dictionary<String^, Results::Value>();
+    if (sites->Count == 0)
+        return job->SiteResults;
+
+    // Every site gets its own thread, so that a site that does not respond cannot hold up the others or tie up a
+    // thread pool thread for as long as it takes to time out
+    job->Pending = gcnew CountdownEvent(sites->Count);
+    for each (FederationSite^ site in sites) {
+        Thread^ worker = gcnew Thread(gcnew ParameterizedThreadStart(this, &VxSdkNet::Federation::_RunSite));
+        worker->IsBackground = true;
+        worker->Name = "Federation site";
+        worker->Start(gcnew FederatedSiteTask(job, site));
+    }
+
+    job->Pending->Wait(Math::Max(SiteTimeout, 0));
+
+    // Report the sites that did not finish in time and ignore anything they return later
+    msclr::lock jobLock(job);
+    job->IsClosed = true;
+    for each (FederationSite^ site in sites) {
+        if (!job->SiteResults->ContainsKey(site->Name)) {
+            job->SiteResults[site->Name] = Results::Value::CommunicationError;
+            site->_lastResult = Results::Value::CommunicationError;
+        }
+    }
+
+    return gcnew Dictionary<String^, Results::Value>(job->SiteResults);
+}
+
+VxSdkNet::Results::Value VxSdkNet::Federation::_LoginSite(FederationSite^ site, FederatedQuery^ job) {
+    return site->_Login();
+}
+
+VxSdkNet::Results::Value VxSdkNet::Federation::_QuerySite(FederationSite^ site, FederatedQuery^ job) {
+    if (site->_loginResult != Results::Value::OK)
+        return Results::Value::Unauthenticated;
+
+    Collections::IEnumerable^ items = job->Query(site->_system);
+    if (items == nullptr || job->Callback == nullptr)
+        return Results::Value::OK;
+
+    // Pass items to the callback one at a time so that it does not need to be thread safe
+    msclr::lock jobLock(job);
+    if (!job->IsClosed) {
+        for each (Object^ item in items)
+            job->Callback(gcnew FederatedItem(site, item));
+    }
+
+    return Results::Value::OK;
+}
+
+void VxSdkNet::Federation::_QueueEvent(FederatedItem^ vxEvent) {
+    // Drop the event rather than let the queue grow without bound when the subscribers cannot keep up
+    if (Interlocked::Increment(_pendingEventCount) > MaxPendingEvents) {
+        Interlocked::Decrement(_pendingEventCount);
+        Interlocked::Increment(_droppedEventCount);
+        return;
+    }
+
+    _events->Enqueue(vxEvent);
+    _wake->Set();
+}
+
+void VxSdkNet::Federation::_RunSite(Object^ state) {
+    FederatedSiteTask^ task = safe_cast<FederatedSiteTask^>(state);
+    FederatedQuery^ job = task->Job;
+    Results::Value result = Results::Value::UnknownError;
+    try {
+        result = job->Operation(task->Site, job);
+    }
+    catch (Exception^) {
+        // A failing site is reported in the results rather than failing the whole operation
+        result = Results::Value::UnknownError;
+    }
+    finally {
+        msclr::lock jobLock(job);
+        if (!job->IsClosed) {
+            job->SiteResults[task->Site->Name] = result;
+            task->Site->_lastResult = result;
+        }
+
+        job->Pending->Signal();
+    }
+}
+
+VxSdkNet::Results::Value VxSdkNet::Federation::_SubscribeSite(FederationSite^ site, FederatedQuery^ job) {
+    if (site->_loginResult != Results::Value::OK)
+        return Results::Value::Unauthenticated;
+
+    return site->_system->_StartSiteEvents(gcnew VXSystem::EventDelegate(site, &VxSdkNet::FederationSite::_OnEvent));
+}
+
+VxSdkNet::Results::Value VxSdkNet::Federation::_UnsubscribeSite(FederationSite^ site, FederatedQuery^ job) {
+    if (site->_loginResult != Results::Value::OK)
+        return Results::Value::Unauthenticated;
+
+    return site->_system->_StopSiteEvents();
+}
@@ -0,0 +1,27 @@
+/// <summary>
+/// Implements the federation site class.
+/// </summary>
+#include "Federation.h"
+
+using namespace System;
+
+VxSdkNet::FederationSite::FederationSite(Federation^ federation, String^ name, VXSystem^ system, String^ username, String^ password) {
+    _federation = federation;
+    _name = name;
+    _system = system;
+    _username = username;
+    _password = password;
+    _lastResult = Results::Value::OK;
+    _loginResult = Results::Value::Unauthenticated;
+}
+
+VxSdkNet::Results::Value VxSdkNet::FederationSite::_Login() {
+    // The grace period result still leaves the system logged in
+    Results::Value result = _system->Login(_username, _password);
+    _loginResult = result == Results::Value::SdkLicenseGracePeriodActive ? Results::Value::OK : result;
+    return _loginResult;
+}
+
+void VxSdkNet::FederationSite::_OnEvent(Event^ vxEvent) {
+    _federation->_QueueEvent(gcnew FederatedItem(this, vxEvent));
+}
@@ -3,26 +3,29 @@
 /// </summary>
 
 #include "Gap.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Gap::Gap(VxSdk::IVxGap* vxGap) {
     _gap = vxGap;
+    NativeMemory::Add(_gap);
 }
 
 VxSdkNet::Gap::!Gap() {
-    _gap->Delete();
+    NativeReleaseQueue::Release(_gap);
     _gap = nullptr;
 }
 
 VxSdkNet::DataSource^ VxSdkNet::Gap::_GetDataSource() {
     // Get the data source
     VxSdk::IVxDataSource* dataSource = nullptr;
-    VxSdk::VxResult::Value result = _gap->GetDataSource(dataSource);
+    SdkCall sdkCall("IVxGap::GetDataSource");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _gap->GetDataSource(dataSource));
 
     // Return the data source if GetDataSource was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::DataSource(dataSource);
+        return IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSource);
 
     return nullptr;
 }
@@ -30,11 +33,12 @@ VxSdkNet::DataSource^ VxSdkNet::Gap::_GetDataSource() {
 VxSdkNet::DataStorage^ VxSdkNet::Gap::_GetDataStorage() {
     // Get the data storage
     VxSdk::IVxDataStorage* dataStorage = nullptr;
-    VxSdk::VxResult::Value result = _gap->GetDataStorage(dataStorage);
+    SdkCall sdkCall("IVxGap::GetDataStorage");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _gap->GetDataStorage(dataStorage));
 
     // Return the data storage if GetDataStorage was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::DataStorage(dataStorage);
+        return IdentityMap::Wrap<VxSdkNet::DataStorage>(_identityMap, dataStorage);
 
     return nullptr;
 }
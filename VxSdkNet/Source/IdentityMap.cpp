@@ -0,0 +1,91 @@
+/// <summary>
+/// Implements the identity map class.
+/// </summary>
+#include <msclr/lock.h>
+#include "IdentityMap.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Threading;
+
+VxSdkNet::IdentityMap::IdentityMap() {
+    _wrappers = gcnew Dictionary<String^, WeakReference^>();
+    _pruneCount = MinPruneCount;
+    _system = nullptr;
+}
+
+void VxSdkNet::IdentityMap::Clear() {
+    msclr::lock mapLock(_wrappers);
+    _wrappers->Clear();
+    _pruneCount = MinPruneCount;
+}
+
+Dictionary<String^, int>^ VxSdkNet::IdentityMap::GetLiveCounts() {
+    Dictionary<String^, int>^ liveCounts = gcnew Dictionary<String^, int>();
+    msclr::lock mapLock(_wrappers);
+    for each (WeakReference^ reference in _wrappers->Values) {
+        Object^ wrapper = reference->Target;
+        if (wrapper == nullptr)
+            continue;
+
+        String^ typeName = wrapper->GetType()->Name;
+        int count = 0;
+        liveCounts->TryGetValue(typeName, count);
+        liveCounts[typeName] = count + 1;
+    }
+
+    return liveCounts;
+}
+
+double VxSdkNet::IdentityMap::HitRate::get() {
+    long long hitCount = Interlocked::Read(_hitCount);
+    long long fetchCount = hitCount + Interlocked::Read(_missCount);
+    return fetchCount > 0 ? static_cast<double>(hitCount) / fetchCount : 0;
+}
+
+int VxSdkNet::IdentityMap::LiveCount::get() {
+    int liveCount = 0;
+    msclr::lock mapLock(_wrappers);
+    for each (WeakReference^ reference in _wrappers->Values) {
+        if (reference->IsAlive)
+            liveCount++;
+    }
+
+    return liveCount;
+}
+
+void VxSdkNet::IdentityMap::_Add(String^ key, Object^ wrapper) {
+    msclr::lock mapLock(_wrappers);
+    _wrappers[key] = gcnew WeakReference(wrapper);
+    if (_wrappers->Count < _pruneCount)
+        return;
+
+    // Drop the entries whose wrappers have been collected once the map has doubled in size
+    List<String^>^ deadKeys = gcnew List<String^>();
+    for each (KeyValuePair<String^, WeakReference^> entry in _wrappers) {
+        if (!entry.Value->IsAlive)
+            deadKeys->Add(entry.Key);
+    }
+
+    for each (String^ deadKey in deadKeys)
+        _wrappers->Remove(deadKey);
+
+    _pruneCount = Math::Max(_wrappers->Count * 2, static_cast<int>(MinPruneCount));
+}
+
+Object^ VxSdkNet::IdentityMap::_Find(String^ key) {
+    Object^ wrapper = nullptr;
+    {
+        msclr::lock mapLock(_wrappers);
+        WeakReference^ reference;
+        if (_wrappers->TryGetValue(key, reference))
+            wrapper = reference->Target;
+    }
+
+    if (wrapper != nullptr)
+        Interlocked::Increment(_hitCount);
+    else
+        Interlocked::Increment(_missCount);
+
+    return wrapper;
+}
@@ -2,15 +2,17 @@
 /// Implements the license class.
 /// </summary>
 #include "License.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::License::License(VxSdk::IVxLicense* vxLicense) {
     _license = vxLicense;
+    NativeMemory::Add(_license);
 }
 
 VxSdkNet::License::!License() {
-    _license->Delete();
+    NativeReleaseQueue::Release(_license);
     _license = nullptr;
 }
 
@@ -29,12 +31,14 @@ List<VxSdkNet::LicenseFeature^>^ VxSdkNet::License::_GetLicenseFeatures() {
     VxSdk::VxCollection<VxSdk::IVxLicenseFeature**> licenseFeatures;
 
     // Make the GetLicenseFeatures call, which will return with the total count of license features, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _license->GetLicenseFeatures(licenseFeatures);
+    SdkCall sdkCall("IVxLicense::GetLicenseFeatures", licenseFeatures);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _license->GetLicenseFeatures(licenseFeatures));
     // Unless there are no license features on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetLicenseFeatures call
         licenseFeatures.collection = new VxSdk::IVxLicenseFeature*[licenseFeatures.collectionSize];
-        result = _license->GetLicenseFeatures(licenseFeatures);
+        sdkCall.Restart("IVxLicense::GetLicenseFeatures", licenseFeatures);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _license->GetLicenseFeatures(licenseFeatures));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < licenseFeatures.collectionSize; i++)
@@ -49,7 +53,8 @@ List<VxSdkNet::LicenseFeature^>^ VxSdkNet::License::_GetLicenseFeatures() {
 VxSdkNet::LicenseSup^ VxSdkNet::License::_GetLicenseSup() {
     // Get the license sup info
     VxSdk::VxLicenseSup* licenseSup = nullptr;
-    VxSdk::VxResult::Value result = _license->GetLicenseSup(licenseSup);
+    SdkCall sdkCall("IVxLicense::GetLicenseSup");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _license->GetLicenseSup(licenseSup));
 
     // Return the license sup info if GetLicenseSup was successful
     if (result == VxSdk::VxResult::kOK)
@@ -2,15 +2,17 @@
 /// Implements the license feature class.
 /// </summary>
 #include "LicenseFeature.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::LicenseFeature::LicenseFeature(VxSdk::IVxLicenseFeature* vxLicenseFeature) {
     _licenseFeature = vxLicenseFeature;
+    NativeMemory::Add(_licenseFeature);
 }
 
 VxSdkNet::LicenseFeature::!LicenseFeature() {
-    _licenseFeature->Delete();
+    NativeReleaseQueue::Release(_licenseFeature);
     _licenseFeature = nullptr;
 }
 
@@ -36,16 +38,18 @@ List<VxSdkNet::Device^>^ VxSdkNet::LicenseFeature::GetCommissionedDevices(System
     }
 
     // Make the GetCommissionedDevices call, which will return with the total count of devices, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _licenseFeature->GetCommissionedDevices(devices);
+    SdkCall sdkCall("IVxLicenseFeature::GetCommissionedDevices", devices);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _licenseFeature->GetCommissionedDevices(devices));
     // Unless there are no devices on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetCommissionedDevices call
         devices.collection = new VxSdk::IVxDevice*[devices.collectionSize];
-        result = _licenseFeature->GetCommissionedDevices(devices);
+        sdkCall.Restart("IVxLicenseFeature::GetCommissionedDevices", devices);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _licenseFeature->GetCommissionedDevices(devices));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < devices.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::Device(devices.collection[i]));
+                mlist->Add(IdentityMap::Intern<VxSdkNet::Device>(_identityMap, devices.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] devices.collection;
@@ -55,18 +59,23 @@ List<VxSdkNet::Device^>^ VxSdkNet::LicenseFeature::GetCommissionedDevices(System
 
 VxSdkNet::Results::Value VxSdkNet::LicenseFeature::Link(VxSdkNet::Device^ device) {
     // Link a device to this license feature
-    VxSdk::VxResult::Value result = _licenseFeature->Link(*device->_device);
+    NativeReadLock nativeLock(device->_nativeLock);
+    SdkCall sdkCall("IVxLicenseFeature::Link");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _licenseFeature->Link(*device->_device));
     // Unless there was an issue linking the device the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::LicenseFeature::Refresh() {
-    return (VxSdkNet::Results::Value)_licenseFeature->Refresh();
+    SdkCall sdkCall("IVxLicenseFeature::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _licenseFeature->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::LicenseFeature::UnLink(VxSdkNet::Device^ device) {
     // Unlink a device from this license feature
-    VxSdk::VxResult::Value result = _licenseFeature->UnLink(*device->_device);
+    NativeReadLock nativeLock(device->_nativeLock);
+    SdkCall sdkCall("IVxLicenseFeature::UnLink");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _licenseFeature->UnLink(*device->_device));
     // Unless there was an issue unlinking the device the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -77,7 +86,8 @@ System::String^ VxSdkNet::LicenseFeature::_GetCapabilityRequest() {
 
     // If the capability request uri is not available the result will return VxSdk::VxResult::kActionUnavailable,
     // otherwise VxSdk::VxResult::kInsufficientSize
-    VxSdk::VxResult::Value result = _licenseFeature->GetCapabilityRequest(capRequestEndpoint, size);
+    SdkCall sdkCall("IVxLicenseFeature::GetCapabilityRequest");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _licenseFeature->GetCapabilityRequest(capRequestEndpoint, size));
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for capRequestEndpoint
         capRequestEndpoint = new char[size];
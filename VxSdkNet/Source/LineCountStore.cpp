@@ -0,0 +1,569 @@
+/// <summary>
+/// Implements the line count store class.
+/// </summary>
+#include <msclr/lock.h>
+#include "LineCountStore.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::IO;
+using namespace System::IO::MemoryMappedFiles;
+using namespace System::Threading;
+
+namespace {
+    // Identifies a line count store file ("VXLC") and its format version
+    const int kFileMagic = 0x434C5856;
+    const int kFileVersion = 2;
+
+    // The magic, the version and the offset of the directory of series
+    const int kHeaderSize = 16;
+}
+
+VxSdkNet::LineCountSeries::LineCountSeries(String^ dataSourceId, String^ analyticBehaviorId) {
+    DataSourceId = dataSourceId;
+    AnalyticBehaviorId = analyticBehaviorId;
+    Fetched = gcnew CoverageIndex(dataSourceId);
+    Blocks = gcnew List<LineCountBlock^>();
+}
+
+VxSdkNet::LineCountBlock^ VxSdkNet::LineCountSeries::Decode(int blockIndex) {
+    LineCountBlock^ block = Blocks[blockIndex];
+    if (block->Hours != nullptr)
+        return block;
+
+    List<int>^ hours = gcnew List<int>(block->RowCount);
+    array<List<int>^>^ columns = gcnew array<List<int>^>(ColumnCount);
+    try {
+        if (View == nullptr)
+            throw gcnew InvalidDataException("The line count store file is not mapped.");
+
+        array<unsigned char>^ data = gcnew array<unsigned char>(block->Length);
+        if (View->ReadArray<unsigned char>(block->Offset, data, 0, block->Length) != block->Length)
+            throw gcnew InvalidDataException("The line count block is truncated.");
+
+        // Hours are the difference from the previous hour and counters are zigzag encoded, a column at a time
+        BinaryReader^ reader = gcnew BinaryReader(gcnew MemoryStream(data));
+        int hour = block->FirstHour;
+        for (int i = 0; i < block->RowCount; i++) {
+            hour += static_cast<int>(LineCountStore::_ReadVarint(reader));
+            hours->Add(hour);
+        }
+
+        for (int column = 0; column < ColumnCount; column++) {
+            columns[column] = gcnew List<int>(block->RowCount);
+            for (int i = 0; i < block->RowCount; i++) {
+                unsigned int value = static_cast<unsigned int>(LineCountStore::_ReadVarint(reader));
+                columns[column]->Add(static_cast<int>(value >> 1) ^ -static_cast<int>(value & 1));
+            }
+        }
+    }
+    catch (IOException^) {
+        // A damaged block discards the series, so that its line counts are fetched again
+        Blocks->Clear();
+        Fetched->Clear();
+        return nullptr;
+    }
+    catch (InvalidDataException^) {
+        Blocks->Clear();
+        Fetched->Clear();
+        return nullptr;
+    }
+
+    block->Hours = hours;
+    block->Columns = columns;
+    return block;
+}
+
+int VxSdkNet::LineCountSeries::FindBlock(int hour) {
+    // Get the index of the last block starting at or before the hour, or the first block if there is none
+    int low = 0;
+    int high = Blocks->Count - 1;
+    while (low < high) {
+        int middle = (low + high + 1) / 2;
+        if (Blocks[middle]->FirstHour <= hour)
+            low = middle;
+        else
+            high = middle - 1;
+    }
+
+    return low;
+}
+
+int VxSdkNet::LineCountSeries::GetRowCount() {
+    int rowCount = 0;
+    for each (LineCountBlock^ block in Blocks)
+        rowCount += block->RowCount;
+
+    return rowCount;
+}
+
+void VxSdkNet::LineCountSeries::Set(int hour, LineCount^ lineCount) {
+    int blockIndex = FindBlock(hour);
+    LineCountBlock^ block = Blocks->Count > 0 ? Decode(blockIndex) : nullptr;
+    if (block == nullptr) {
+        blockIndex = 0;
+        block = _CreateBlock();
+        Blocks->Add(block);
+    }
+
+    int index = block->Hours->BinarySearch(hour);
+    if (index < 0) {
+        index = ~index;
+        block->Hours->Insert(index, hour);
+        for (int i = 0; i < ColumnCount; i++)
+            block->Columns[i]->Insert(index, 0);
+
+        block->FirstHour = block->Hours[0];
+        block->RowCount++;
+    }
+
+    block->Columns[0][index] = lineCount->Count;
+    block->Columns[1][index] = lineCount->CountCorrection;
+    block->Columns[2][index] = lineCount->InCount;
+    block->Columns[3][index] = lineCount->InCountCorrection;
+    block->Columns[4][index] = lineCount->OutCount;
+    block->Columns[5][index] = lineCount->OutCountCorrection;
+
+    // Split full blocks in two so that inserts stay cheap
+    if (block->RowCount >= 2 * LineCountBlock::MaxRows) {
+        LineCountBlock^ next = _CreateBlock();
+        int split = LineCountBlock::MaxRows;
+        int moved = block->RowCount - split;
+        next->Hours->AddRange(block->Hours->GetRange(split, moved));
+        block->Hours->RemoveRange(split, moved);
+        for (int i = 0; i < ColumnCount; i++) {
+            next->Columns[i]->AddRange(block->Columns[i]->GetRange(split, moved));
+            block->Columns[i]->RemoveRange(split, moved);
+        }
+
+        next->FirstHour = next->Hours[0];
+        next->RowCount = moved;
+        block->RowCount = split;
+        Blocks->Insert(blockIndex + 1, next);
+    }
+}
+
+VxSdkNet::LineCountBlock^ VxSdkNet::LineCountSeries::_CreateBlock() {
+    LineCountBlock^ block = gcnew LineCountBlock();
+    block->Hours = gcnew List<int>();
+    block->Columns = gcnew array<List<int>^>(ColumnCount);
+    for (int i = 0; i < ColumnCount; i++)
+        block->Columns[i] = gcnew List<int>();
+
+    return block;
+}
+
+VxSdkNet::LineCountStore::LineCountStore() {
+    _series = gcnew Dictionary<String^, LineCountSeries^>();
+    TimeZone = TimeZoneInfo::Local;
+}
+
+VxSdkNet::LineCountStore::LineCountStore(String^ filePath) {
+    _filePath = filePath;
+    _series = gcnew Dictionary<String^, LineCountSeries^>();
+    TimeZone = TimeZoneInfo::Local;
+    _Load();
+}
+
+VxSdkNet::LineCountStore::~LineCountStore() {
+    msclr::lock storeLock(this);
+    for each (LineCountSeries^ series in _series->Values) {
+        msclr::lock seriesLock(series);
+        series->View = nullptr;
+    }
+
+    _Unmap();
+}
+
+void VxSdkNet::LineCountStore::Clear() {
+    msclr::lock storeLock(this);
+    _series->Clear();
+}
+
+List<VxSdkNet::LineCount^>^ VxSdkNet::LineCountStore::GetLineCounts(DataSource^ dataSource, String^ analyticBehaviorId,
+    DateTime startTime, DateTime endTime, Intervals interval) {
+    // Align the range to whole hours; only hours that have ended are complete and may be cached
+    long long hourTicks = TimeSpan::TicksPerHour;
+    long long start = startTime.ToUniversalTime().Ticks / hourTicks * hourTicks;
+    long long end = (endTime.ToUniversalTime().Ticks + hourTicks - 1) / hourTicks * hourTicks;
+    long long completeEnd = DateTime::UtcNow.Ticks / hourTicks * hourTicks;
+
+    List<LineCount^>^ mlist = gcnew List<LineCount^>();
+    if (end <= start)
+        return mlist;
+
+    LineCountSeries^ series = _GetSeries(dataSource->Id, analyticBehaviorId);
+
+    // Fetch the hours that are missing from the store
+    DateTime rangeStart(start, DateTimeKind::Utc);
+    DateTime rangeEnd(end, DateTimeKind::Utc);
+    for each (KeyValuePair<DateTime, DateTime> span in series->Fetched->GetUncoveredSpans(rangeStart, rangeEnd)) {
+        LineCountingRequest^ request = gcnew LineCountingRequest();
+        request->AnalyticBehaviorIds->Add(analyticBehaviorId);
+        request->StartTime = span.Key;
+        request->EndTime = span.Value;
+        request->Interval = LineCountingRequest::TimeInterval::Hour;
+        List<LineCount^>^ lineCounts = dataSource->GetLineCounts(request);
+
+        msclr::lock seriesLock(series);
+        for each (LineCount^ lineCount in lineCounts) {
+            if (lineCount->AnalyticBehaviorId == analyticBehaviorId)
+                series->Set(static_cast<int>(lineCount->StartTime.ToUniversalTime().Ticks / hourTicks), lineCount);
+        }
+
+        if (span.Key.Ticks < completeEnd)
+            series->Fetched->Add(span.Key, DateTime(Math::Min(span.Value.Ticks, completeEnd), DateTimeKind::Utc));
+    }
+
+    // Total the hourly counts over the requested interval, decoding only the blocks that overlap it
+    msclr::lock seriesLock(series);
+    LineCount^ bucket = nullptr;
+    int startHour = static_cast<int>(start / hourTicks);
+    int endHour = static_cast<int>(end / hourTicks);
+    for (int b = series->FindBlock(startHour); b < series->Blocks->Count && series->Blocks[b]->FirstHour < endHour; b++) {
+        LineCountBlock^ block = series->Decode(b);
+        if (block == nullptr)
+            break;
+
+        int i = block->Hours->BinarySearch(startHour);
+        for (i = i >= 0 ? i : ~i; i < block->Hours->Count && block->Hours[i] < endHour; i++) {
+            DateTime bucketStart = _GetBucketStart(DateTime(block->Hours[i] * hourTicks, DateTimeKind::Utc), interval);
+            if (bucket == nullptr || bucket->StartTime != bucketStart) {
+                bucket = gcnew LineCount();
+                bucket->AnalyticBehaviorId = analyticBehaviorId;
+                bucket->StartTime = bucketStart;
+                bucket->EndTime = _GetBucketEnd(bucketStart, interval);
+                mlist->Add(bucket);
+            }
+
+            bucket->Count += block->Columns[0][i];
+            bucket->CountCorrection += block->Columns[1][i];
+            bucket->InCount += block->Columns[2][i];
+            bucket->InCountCorrection += block->Columns[3][i];
+            bucket->OutCount += block->Columns[4][i];
+            bucket->OutCountCorrection += block->Columns[5][i];
+        }
+    }
+
+    return mlist;
+}
+
+VxSdkNet::Results::Value VxSdkNet::LineCountStore::Save() {
+    if (String::IsNullOrEmpty(_filePath))
+        return Results::Value::InvalidParameters;
+
+    // Hold every series until the new file is mapped, as blocks that have not been decoded are copied from the old one
+    msclr::lock storeLock(this);
+    List<LineCountSeries^>^ lockedSeries = gcnew List<LineCountSeries^>(_series->Count);
+    try {
+        for each (LineCountSeries^ series in _series->Values) {
+            Monitor::Enter(series);
+            lockedSeries->Add(series);
+        }
+
+        // Write to a temporary file first so that a failed save does not lose the previous one
+        String^ tempPath = _filePath + ".tmp";
+        List<long long>^ offsets = gcnew List<long long>();
+        List<int>^ lengths = gcnew List<int>();
+        BinaryWriter^ writer = gcnew BinaryWriter(gcnew BufferedStream(gcnew FileStream(tempPath, FileMode::Create, FileAccess::ReadWrite), 65536));
+        try {
+            writer->Write(kFileMagic);
+            writer->Write(kFileVersion);
+            writer->Write(0LL);
+
+            // Blocks come first, each either encoded afresh or copied as it is from the mapped file
+            for each (LineCountSeries^ series in lockedSeries) {
+                // Should the old file have been lost, decoding discards the series so that it is fetched again
+                for (int i = 0; series->View == nullptr && i < series->Blocks->Count; i++)
+                    series->Decode(i);
+
+                for each (LineCountBlock^ block in series->Blocks) {
+                    array<unsigned char>^ data;
+                    if (block->Hours != nullptr)
+                        data = _EncodeBlock(block);
+                    else {
+                        data = gcnew array<unsigned char>(block->Length);
+                        series->View->ReadArray<unsigned char>(block->Offset, data, 0, block->Length);
+                    }
+
+                    offsets->Add(writer->BaseStream->Position);
+                    lengths->Add(data->Length);
+                    writer->Write(data);
+                }
+            }
+
+            // The directory follows, with the fetched spans of each series and a fixed-width index of its blocks
+            long long directoryOffset = writer->BaseStream->Position;
+            writer->Write(lockedSeries->Count);
+            int blockNumber = 0;
+            for each (LineCountSeries^ series in lockedSeries) {
+                writer->Write(series->DataSourceId);
+                writer->Write(series->AnalyticBehaviorId);
+
+                // Fetched spans are whole hours, written as the gap since the previous span and the span length
+                List<KeyValuePair<DateTime, DateTime>>^ spans = series->Fetched->Spans;
+                _WriteVarint(writer, spans->Count);
+                long long previous = 0;
+                for each (KeyValuePair<DateTime, DateTime> span in spans) {
+                    long long spanStart = span.Key.Ticks / TimeSpan::TicksPerHour;
+                    long long spanEnd = span.Value.Ticks / TimeSpan::TicksPerHour;
+                    _WriteVarint(writer, spanStart - previous);
+                    _WriteVarint(writer, spanEnd - spanStart);
+                    previous = spanEnd;
+                }
+
+                writer->Write(series->Blocks->Count);
+                for each (LineCountBlock^ block in series->Blocks) {
+                    writer->Write(block->FirstHour);
+                    writer->Write(block->RowCount);
+                    writer->Write(offsets[blockNumber]);
+                    writer->Write(lengths[blockNumber]);
+                    blockNumber++;
+                }
+            }
+
+            writer->Seek(8, SeekOrigin::Begin);
+            writer->Write(directoryOffset);
+        }
+        finally {
+            delete writer;
+        }
+
+        // Replace the old file, then map whichever file is in place; blocks only move to the new file once it has
+        // replaced the old one
+        bool isReplaced = false;
+        _Unmap();
+        try {
+            if (File::Exists(_filePath))
+                File::Replace(tempPath, _filePath, nullptr);
+            else
+                File::Move(tempPath, _filePath);
+
+            isReplaced = true;
+        }
+        finally {
+            _Map();
+            int blockNumber = 0;
+            for each (LineCountSeries^ series in lockedSeries) {
+                series->View = _view;
+                for each (LineCountBlock^ block in series->Blocks) {
+                    if (isReplaced) {
+                        // Release the decoded rows; the block is decoded again from the new file when next queried
+                        block->Offset = offsets[blockNumber];
+                        block->Length = lengths[blockNumber];
+                        block->Hours = nullptr;
+                        block->Columns = nullptr;
+                    }
+
+                    blockNumber++;
+                }
+            }
+        }
+    }
+    catch (IOException^) {
+        return Results::Value::OperationFailed;
+    }
+    catch (UnauthorizedAccessException^) {
+        return Results::Value::OperationFailed;
+    }
+    finally {
+        for each (LineCountSeries^ series in lockedSeries)
+            Monitor::Exit(series);
+    }
+
+    return Results::Value::OK;
+}
+
+int VxSdkNet::LineCountStore::RowCount::get() {
+    msclr::lock storeLock(this);
+    int rowCount = 0;
+    for each (LineCountSeries^ series in _series->Values) {
+        msclr::lock seriesLock(series);
+        rowCount += series->GetRowCount();
+    }
+
+    return rowCount;
+}
+
+array<unsigned char>^ VxSdkNet::LineCountStore::_EncodeBlock(LineCountBlock^ block) {
+    // Hours are written as the difference from the previous hour and counters zigzag encoded, a column at a time, so
+    // that small negative corrections stay small
+    MemoryStream^ stream = gcnew MemoryStream();
+    BinaryWriter^ writer = gcnew BinaryWriter(stream);
+    int previousHour = block->FirstHour;
+    for each (int hour in block->Hours) {
+        _WriteVarint(writer, hour - previousHour);
+        previousHour = hour;
+    }
+
+    for each (List<int>^ column in block->Columns) {
+        for each (int value in column)
+            _WriteVarint(writer, static_cast<unsigned int>((value << 1) ^ (value >> 31)));
+    }
+
+    writer->Flush();
+    return stream->ToArray();
+}
+
+DateTime VxSdkNet::LineCountStore::_GetBucketStart(DateTime hour, Intervals interval) {
+    if (interval == Intervals::Hour)
+        return hour;
+
+    DateTime local = TimeZoneInfo::ConvertTimeFromUtc(hour, TimeZone);
+    if (interval == Intervals::Day)
+        return _ToUtc(local.Date);
+
+    if (interval == Intervals::Week)
+        return _ToUtc(local.Date.AddDays(-((static_cast<int>(local.DayOfWeek) + 6) % 7)));
+
+    return _ToUtc(DateTime(local.Year, local.Month, 1));
+}
+
+DateTime VxSdkNet::LineCountStore::_GetBucketEnd(DateTime bucketStart, Intervals interval) {
+    if (interval == Intervals::Hour)
+        return bucketStart.AddHours(1);
+
+    DateTime local = TimeZoneInfo::ConvertTimeFromUtc(bucketStart, TimeZone);
+    if (interval == Intervals::Day)
+        return _ToUtc(local.Date.AddDays(1));
+
+    if (interval == Intervals::Week)
+        return _ToUtc(local.Date.AddDays(7));
+
+    return _ToUtc(DateTime(local.Year, local.Month, 1).AddMonths(1));
+}
+
+VxSdkNet::LineCountSeries^ VxSdkNet::LineCountStore::_GetSeries(String^ dataSourceId, String^ analyticBehaviorId) {
+    String^ key = dataSourceId + "|" + analyticBehaviorId;
+
+    msclr::lock storeLock(this);
+    LineCountSeries^ series;
+    if (!_series->TryGetValue(key, series)) {
+        series = gcnew LineCountSeries(dataSourceId, analyticBehaviorId);
+        _series->Add(key, series);
+    }
+
+    return series;
+}
+
+void VxSdkNet::LineCountStore::_Load() {
+    BinaryReader^ reader = nullptr;
+    try {
+        // Stores in an earlier format are discarded; the line counts will be fetched again
+        _Map();
+        if (_view == nullptr || _view->ReadInt32(0) != kFileMagic || _view->ReadInt32(4) != kFileVersion) {
+            _Unmap();
+            return;
+        }
+
+        // Only the directory is read up front; the blocks are decoded from the mapped file as they are queried
+        long long directoryOffset = _view->ReadInt64(8);
+        if (directoryOffset < kHeaderSize || directoryOffset >= _view->Capacity)
+            throw gcnew InvalidDataException("Invalid line count store directory.");
+
+        reader = gcnew BinaryReader(_file->CreateViewStream(directoryOffset, 0, MemoryMappedFileAccess::Read));
+        int seriesCount = reader->ReadInt32();
+        for (int i = 0; i < seriesCount; i++) {
+            String^ dataSourceId = reader->ReadString();
+            String^ analyticBehaviorId = reader->ReadString();
+            LineCountSeries^ series = _GetSeries(dataSourceId, analyticBehaviorId);
+            series->View = _view;
+
+            int spanCount = static_cast<int>(_ReadVarint(reader));
+            long long previous = 0;
+            for (int j = 0; j < spanCount; j++) {
+                long long spanStart = previous + static_cast<long long>(_ReadVarint(reader));
+                long long spanEnd = spanStart + static_cast<long long>(_ReadVarint(reader));
+                series->Fetched->Add(DateTime(spanStart * TimeSpan::TicksPerHour, DateTimeKind::Utc),
+                    DateTime(spanEnd * TimeSpan::TicksPerHour, DateTimeKind::Utc));
+                previous = spanEnd;
+            }
+
+            int blockCount = reader->ReadInt32();
+            series->Blocks->Capacity = blockCount;
+            for (int j = 0; j < blockCount; j++) {
+                LineCountBlock^ block = gcnew LineCountBlock();
+                block->FirstHour = reader->ReadInt32();
+                block->RowCount = reader->ReadInt32();
+                block->Offset = reader->ReadInt64();
+                block->Length = reader->ReadInt32();
+                if (block->RowCount < 0 || block->Offset < kHeaderSize || block->Length < 0 || block->Offset + block->Length > directoryOffset)
+                    throw gcnew InvalidDataException("Invalid line count block.");
+
+                series->Blocks->Add(block);
+            }
+        }
+    }
+    catch (IOException^) {
+        // A damaged store is discarded; the line counts will be fetched again
+        _series->Clear();
+        _Unmap();
+    }
+    catch (InvalidDataException^) {
+        _series->Clear();
+        _Unmap();
+    }
+    finally {
+        if (reader != nullptr)
+            delete reader;
+    }
+}
+
+void VxSdkNet::LineCountStore::_Map() {
+    if (String::IsNullOrEmpty(_filePath) || !File::Exists(_filePath))
+        return;
+
+    // The stream is owned by the mapping and closed along with it
+    FileStream^ stream = gcnew FileStream(_filePath, FileMode::Open, FileAccess::Read, FileShare::Read);
+    if (stream->Length < kHeaderSize) {
+        delete stream;
+        return;
+    }
+
+    _file = MemoryMappedFile::CreateFromFile(stream, nullptr, 0, MemoryMappedFileAccess::Read, nullptr, HandleInheritability::None, false);
+    _view = _file->CreateViewAccessor(0, 0, MemoryMappedFileAccess::Read);
+}
+
+DateTime VxSdkNet::LineCountStore::_ToUtc(DateTime localTime) {
+    localTime = DateTime::SpecifyKind(localTime, DateTimeKind::Unspecified);
+
+    // A local midnight that is skipped by a daylight saving change is treated as standard time
+    if (TimeZone->IsInvalidTime(localTime))
+        return DateTime::SpecifyKind(localTime - TimeZone->BaseUtcOffset, DateTimeKind::Utc);
+
+    return TimeZoneInfo::ConvertTimeToUtc(localTime, TimeZone);
+}
+
+void VxSdkNet::LineCountStore::_Unmap() {
+    if (_view != nullptr) {
+        delete _view;
+        _view = nullptr;
+    }
+
+    if (_file != nullptr) {
+        delete _file;
+        _file = nullptr;
+    }
+}
+
+unsigned long long VxSdkNet::LineCountStore::_ReadVarint(BinaryReader^ reader) {
+    unsigned long long value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        unsigned char byte = reader->ReadByte();
+        value |= static_cast<unsigned long long>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+            return value;
+    }
+
+    throw gcnew InvalidDataException("Invalid variable length integer.");
+}
+
+void VxSdkNet::LineCountStore::_WriteVarint(BinaryWriter^ writer, unsigned long long value) {
+    // Write seven bits at a time, with the high bit set on every byte but the last
+    while (value >= 0x80) {
+        writer->Write(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+
+    writer->Write(static_cast<unsigned char>(value));
+}
@@ -2,18 +2,21 @@
 /// Implements the log class.
 /// </summary>
 #include "Log.h"
+#include "NativeReleaseQueue.h"
 
 VxSdkNet::Log::Log(VxSdk::IVxLog* vxLog) {
     _log = vxLog;
+    NativeMemory::Add(_log);
 }
 
 VxSdkNet::Log::!Log() {
-    _log->Delete();
+    NativeReleaseQueue::Release(_log);
     _log = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Log::Refresh() {
-    return (VxSdkNet::Results::Value)_log->Refresh();
+    SdkCall sdkCall("IVxLog::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _log->Refresh());
 }
 
 System::String^ VxSdkNet::Log::_GetLogEndpoint() {
@@ -22,7 +25,8 @@ System::String^ VxSdkNet::Log::_GetLogEndpoint() {
 
     // If the log endpoint is not available on the system the result will return VxSdk::VxResult::kActionUnavailable,
     // otherwise VxSdk::VxResult::kInsufficientSize
-    VxSdk::VxResult::Value result = _log->GetLogEndpoint(logEndpoint, size);
+    SdkCall sdkCall("IVxLog::GetLogEndpoint");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _log->GetLogEndpoint(logEndpoint, size));
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for logEndpoint
         logEndpoint = new char[size];
@@ -2,34 +2,39 @@
 /// Implements the manual recording class.
 /// </summary>
 #include "ManualRecording.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::ManualRecording::ManualRecording(VxSdk::IVxManualRecording* vxManualRecording) {
     _manualRecording = vxManualRecording;
+    NativeMemory::Add(_manualRecording);
 }
 
 VxSdkNet::ManualRecording::!ManualRecording() {
-    _manualRecording->Delete();
+    NativeReleaseQueue::Release(_manualRecording);
     _manualRecording = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::ManualRecording::Refresh() {
-    return (VxSdkNet::Results::Value)_manualRecording->Refresh();
+    SdkCall sdkCall("IVxManualRecording::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _manualRecording->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::ManualRecording::ResetExpirationTimers() {
-    return (VxSdkNet::Results::Value)_manualRecording->ResetExpirationTimers();
+    SdkCall sdkCall("IVxManualRecording::ResetExpirationTimers");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _manualRecording->ResetExpirationTimers());
 }
 
 VxSdkNet::DataSource^ VxSdkNet::ManualRecording::_GetDataSource() {
     // Get the data source
     VxSdk::IVxDataSource* dataSource = nullptr;
-    VxSdk::VxResult::Value result = _manualRecording->GetDataSource(dataSource);
+    SdkCall sdkCall("IVxManualRecording::GetDataSource");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _manualRecording->GetDataSource(dataSource));
 
     // Return the data source if GetDataSource was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::DataSource(dataSource);
+        return IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSource);
 
     return nullptr;
 }
@@ -3,52 +3,61 @@
 /// </summary>
 #include "Marker.h"
 #include "Drawing.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Marker::Marker(VxSdk::IVxMarker* vxMarker) {
     _marker = vxMarker;
+    NativeMemory::Add(_marker);
 }
 
 VxSdkNet::Marker::!Marker() {
-    _marker->Delete();
+    NativeReleaseQueue::Release(_marker);
     _marker = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Marker::Refresh() {
-    return (VxSdkNet::Results::Value)_marker->Refresh();
+    SdkCall sdkCall("IVxMarker::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _marker->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Marker::RemoveAssociation() {
-    return (VxSdkNet::Results::Value)_marker->DeleteAssociation();
+    SdkCall sdkCall("IVxMarker::DeleteAssociation");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _marker->DeleteAssociation());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Marker::SetAssociation(DataSource^ dataSource) {
     // Make the call to set the associated data source
-    VxSdk::VxResult::Value result = _marker->SetAssociation(*dataSource->_dataSource);
+    NativeReadLock nativeLock(dataSource->_nativeLock);
+    SdkCall sdkCall("IVxMarker::SetAssociation");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _marker->SetAssociation(*dataSource->_dataSource));
     // Unless there was an issue associating the data source the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::Marker::SetAssociation(VxSdkNet::Drawing^ drawing) {
     // Make the call to set the associated drawing
-    VxSdk::VxResult::Value result = _marker->SetAssociation(*drawing->_drawing);
+    SdkCall sdkCall("IVxMarker::SetAssociation");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _marker->SetAssociation(*drawing->_drawing));
     // Unless there was an issue associating the drawing the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::Marker::SetCoordinates(float x, float y) {
-    return (VxSdkNet::Results::Value)_marker->SetCoordinates(x, y);
+    SdkCall sdkCall("IVxMarker::SetCoordinates");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _marker->SetCoordinates(x, y));
 }
 
 VxSdkNet::DataSource^ VxSdkNet::Marker::_GetAssociatedDataSource() {
     // Get the data source
     VxSdk::IVxDataSource* dataSource = nullptr;
-    VxSdk::VxResult::Value result = _marker->GetAssociation(dataSource);
+    SdkCall sdkCall("IVxMarker::GetAssociation");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _marker->GetAssociation(dataSource));
 
     // Return the data source if GetAssociation was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::DataSource(dataSource);
+        return IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSource);
 
     return nullptr;
 }
@@ -56,7 +65,8 @@ VxSdkNet::DataSource^ VxSdkNet::Marker::_GetAssociatedDataSource() {
 VxSdkNet::Drawing^ VxSdkNet::Marker::_GetAssociatedDrawing() {
     // Get the drawing
     VxSdk::IVxDrawing* drawing = nullptr;
-    VxSdk::VxResult::Value result = _marker->GetAssociation(drawing);
+    SdkCall sdkCall("IVxMarker::GetAssociation");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _marker->GetAssociation(drawing));
 
     // Return the drawing if GetAssociation was successful
     if (result == VxSdk::VxResult::kOK)
@@ -68,7 +78,8 @@ VxSdkNet::Drawing^ VxSdkNet::Marker::_GetAssociatedDrawing() {
 VxSdkNet::Drawing^ VxSdkNet::Marker::_GetDrawing() {
     // Get the drawing
     VxSdk::IVxDrawing* drawing = nullptr;
-    VxSdk::VxResult::Value result = _marker->GetDrawing(drawing);
+    SdkCall sdkCall("IVxMarker::GetDrawing");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _marker->GetDrawing(drawing));
 
     // Return the drawing if GetDrawing was successful
     if (result == VxSdk::VxResult::kOK)
@@ -80,7 +91,8 @@ VxSdkNet::Drawing^ VxSdkNet::Marker::_GetDrawing() {
 VxSdkNet::ResourceLimits^ VxSdkNet::Marker::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _marker->GetLimits(limits);
+    SdkCall sdkCall("IVxMarker::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _marker->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
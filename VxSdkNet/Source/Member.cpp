@@ -2,30 +2,35 @@
 /// Implements the member class.
 /// </summary>
 #include "Member.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Member::Member(VxSdk::IVxMember* vxMember) {
     _member = vxMember;
+    NativeMemory::Add(_member);
 }
 
 VxSdkNet::Member::!Member() {
-    _member->Delete();
+    NativeReleaseQueue::Release(_member);
     _member = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Member::Refresh() {
-    return (VxSdkNet::Results::Value)_member->Refresh();
+    SdkCall sdkCall("IVxMember::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _member->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Member::TriggerRefresh() {
-    return (VxSdkNet::Results::Value)_member->TriggerRefresh();
+    SdkCall sdkCall("IVxMember::TriggerRefresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _member->TriggerRefresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::Member::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _member->GetLimits(limits);
+    SdkCall sdkCall("IVxMember::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _member->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
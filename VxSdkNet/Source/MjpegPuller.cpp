@@ -0,0 +1,80 @@
+/// <summary>
+/// Implements the MJPEG puller class.
+/// </summary>
+#include <msclr/lock.h>
+#include "MjpegPuller.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+
+namespace {
+    // The smallest buffer handed out by the pool
+    const int kMinBufferSize = 64 * 1024;
+
+    // The most buffers held by the pool while idle
+    const int kMaxPooledBuffers = 64;
+}
+
+VxSdkNet::MjpegPuller::MjpegPuller() {
+    _streams = gcnew List<MjpegStream^>();
+    _buffers = gcnew System::Collections::Concurrent::ConcurrentBag<array<unsigned char>^>();
+    KeepAliveInterval = 10000;
+    MaxFrameRate = 30;
+    MinFrameRate = 1;
+    PipelineDepth = 2;
+    Timeout = 5000;
+}
+
+VxSdkNet::MjpegPuller::~MjpegPuller() {
+    msclr::lock pullerLock(this);
+    for each (MjpegStream^ stream in _streams)
+        stream->_Stop();
+
+    _streams->Clear();
+}
+
+VxSdkNet::MjpegStream^ VxSdkNet::MjpegPuller::Add(DataSession^ session, MjpegStream::FrameDelegate^ callback) {
+    if (session == nullptr || callback == nullptr || String::IsNullOrEmpty(session->JpegUri))
+        return nullptr;
+
+    MjpegStream^ stream = gcnew MjpegStream(this, session, callback);
+    {
+        msclr::lock pullerLock(this);
+        _streams->Add(stream);
+    }
+
+    stream->_Start();
+    return stream;
+}
+
+void VxSdkNet::MjpegPuller::Remove(MjpegStream^ stream) {
+    if (stream == nullptr)
+        return;
+
+    stream->_Stop();
+    msclr::lock pullerLock(this);
+    _streams->Remove(stream);
+}
+
+List<VxSdkNet::MjpegStream^>^ VxSdkNet::MjpegPuller::Streams::get() {
+    msclr::lock pullerLock(this);
+    return gcnew List<MjpegStream^>(_streams);
+}
+
+array<unsigned char>^ VxSdkNet::MjpegPuller::_RentBuffer(int size) {
+    // Reuse a pooled buffer if it is large enough; smaller ones are left for the garbage collector
+    array<unsigned char>^ buffer;
+    if (_buffers->TryTake(buffer) && buffer->Length >= size)
+        return buffer;
+
+    int length = kMinBufferSize;
+    while (length < size)
+        length *= 2;
+
+    return gcnew array<unsigned char>(length);
+}
+
+void VxSdkNet::MjpegPuller::_ReturnBuffer(array<unsigned char>^ buffer) {
+    if (buffer != nullptr && _buffers->Count < kMaxPooledBuffers)
+        _buffers->Add(buffer);
+}
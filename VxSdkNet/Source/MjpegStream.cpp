@@ -0,0 +1,231 @@
+/// <summary>
+/// Implements the MJPEG stream class.
+/// </summary>
+#include "MjpegPuller.h"
+
+using namespace System;
+using namespace System::Net;
+using namespace System::Threading;
+
+VxSdkNet::MjpegStream::MjpegStream(MjpegPuller^ puller, DataSession^ session, FrameDelegate^ callback) {
+    _puller = puller;
+    _session = session;
+    _uri = session->JpegUri;
+    _callback = callback;
+    _deliveryLock = gcnew Object();
+    _sinceKeepAlive = gcnew System::Diagnostics::Stopwatch();
+    _interval = 1000 / Math::Max(puller->MaxFrameRate, 1);
+}
+
+void VxSdkNet::MjpegStream::_Adapt(bool isError) {
+    int minInterval = 1000 / Math::Max(_puller->MaxFrameRate, 1);
+    int maxInterval = 1000 / Math::Max(_puller->MinFrameRate, 1);
+
+    // Back off while requests are failing, otherwise request frames slightly slower than the callback consumes them
+    int interval = isError ? _interval * 2 : static_cast<int>(_consumerTime * 1.25);
+    interval = Math::Min(Math::Max(interval, minInterval), maxInterval);
+
+    // Avoid resetting the timer for small changes
+    if (Math::Abs(interval - _interval) * 10 > _interval) {
+        _interval = interval;
+        Timer^ timer = _timer;
+        if (timer != nullptr && !_isStopped)
+            timer->Change(_interval, _interval);
+    }
+}
+
+void VxSdkNet::MjpegStream::_Complete(MjpegRequest^ pending, bool isError) {
+    if (pending->Response != nullptr)
+        delete pending->Response;
+
+    Interlocked::Decrement(_inFlight);
+    if (isError) {
+        Interlocked::Increment(_errors);
+        _Adapt(true);
+    }
+    else
+        _Deliver(pending->Buffer, pending->Length, pending->Sequence);
+
+    _puller->_ReturnBuffer(pending->Buffer);
+}
+
+void VxSdkNet::MjpegStream::_Deliver(array<unsigned char>^ buffer, int length, long long sequence) {
+    // Drop frames older than the last one delivered, and frames that arrive while the callback is busy
+    if (sequence <= Interlocked::Read(_lastDelivered) || !Monitor::TryEnter(_deliveryLock)) {
+        Interlocked::Increment(_framesDropped);
+        return;
+    }
+
+    try {
+        if (sequence <= _lastDelivered || _isStopped) {
+            Interlocked::Increment(_framesDropped);
+            return;
+        }
+
+        _lastDelivered = sequence;
+        long long started = System::Diagnostics::Stopwatch::GetTimestamp();
+        try {
+            _callback(gcnew MjpegFrame(this, buffer, length, sequence));
+        }
+        catch (Exception^) {
+            // Don't let the callback's exception escape onto the worker thread
+            Interlocked::Increment(_errors);
+        }
+
+        long long finished = System::Diagnostics::Stopwatch::GetTimestamp();
+
+        // Track how long the callback takes and how often frames are delivered, weighting recent frames by 1/8
+        double consumerTime = (finished - started) * 1000.0 / System::Diagnostics::Stopwatch::Frequency;
+        _consumerTime += (consumerTime - _consumerTime) / 8;
+        if (_lastDeliveryTicks != 0) {
+            double frameInterval = (finished - _lastDeliveryTicks) * 1000.0 / System::Diagnostics::Stopwatch::Frequency;
+            _frameInterval = _frameInterval == 0 ? frameInterval : _frameInterval + (frameInterval - _frameInterval) / 8;
+        }
+
+        _lastDeliveryTicks = finished;
+        Interlocked::Increment(_framesDelivered);
+    }
+    finally {
+        Monitor::Exit(_deliveryLock);
+    }
+
+    _Adapt(false);
+}
+
+bool VxSdkNet::MjpegStream::_EndRead(MjpegRequest^ pending, IAsyncResult^ result) {
+    try {
+        int read = pending->Body->EndRead(result);
+        if (read > 0) {
+            pending->Length += read;
+            return true;
+        }
+    }
+    catch (WebException^) {
+        _Complete(pending, true);
+        return false;
+    }
+    catch (IO::IOException^) {
+        _Complete(pending, true);
+        return false;
+    }
+
+    // The body has been read in full
+    _Complete(pending, pending->Length == 0 || (pending->ContentLength > 0 && pending->Length != pending->ContentLength));
+    return false;
+}
+
+void VxSdkNet::MjpegStream::_Issue() {
+    HttpWebRequest^ request = safe_cast<HttpWebRequest^>(WebRequest::Create(_uri));
+    request->Timeout = _puller->Timeout;
+    request->ReadWriteTimeout = _puller->Timeout;
+    request->KeepAlive = true;
+    request->Pipelined = true;
+
+    // Allow a persistent connection for each request in flight
+    int connections = Math::Max(_puller->PipelineDepth, 1) * Math::Max(_puller->_streams->Count, 1);
+    if (request->ServicePoint->ConnectionLimit < connections)
+        request->ServicePoint->ConnectionLimit = connections;
+
+    MjpegRequest^ pending = gcnew MjpegRequest(request, Interlocked::Increment(_nextSequence));
+    try {
+        request->BeginGetResponse(gcnew AsyncCallback(this, &VxSdkNet::MjpegStream::_OnResponse), pending);
+    }
+    catch (WebException^) {
+        Interlocked::Decrement(_inFlight);
+        Interlocked::Increment(_errors);
+    }
+}
+
+void VxSdkNet::MjpegStream::_OnRead(IAsyncResult^ result) {
+    // Reads that complete synchronously are handled by _Read
+    if (result->CompletedSynchronously)
+        return;
+
+    MjpegRequest^ pending = safe_cast<MjpegRequest^>(result->AsyncState);
+    if (_EndRead(pending, result))
+        _Read(pending);
+}
+
+void VxSdkNet::MjpegStream::_OnResponse(IAsyncResult^ result) {
+    MjpegRequest^ pending = safe_cast<MjpegRequest^>(result->AsyncState);
+    try {
+        pending->Response = pending->Request->EndGetResponse(result);
+        pending->Body = pending->Response->GetResponseStream();
+
+        // Read the frame into a pooled buffer, sized for the frame when its length is known
+        pending->ContentLength = pending->Response->ContentLength;
+        pending->Buffer = _puller->_RentBuffer(pending->ContentLength > 0 ? static_cast<int>(pending->ContentLength) : 0);
+    }
+    catch (WebException^) {
+        _Complete(pending, true);
+        return;
+    }
+    catch (IO::IOException^) {
+        _Complete(pending, true);
+        return;
+    }
+
+    _Read(pending);
+}
+
+void VxSdkNet::MjpegStream::_Read(MjpegRequest^ pending) {
+    // Keep reading on this thread while reads complete synchronously, rather than recursing through _OnRead
+    while (true) {
+        IAsyncResult^ result;
+        try {
+            // Grow the buffer if the frame is larger than expected
+            if (pending->Length == pending->Buffer->Length) {
+                array<unsigned char>^ larger = _puller->_RentBuffer(pending->Buffer->Length * 2);
+                Buffer::BlockCopy(pending->Buffer, 0, larger, 0, pending->Length);
+                _puller->_ReturnBuffer(pending->Buffer);
+                pending->Buffer = larger;
+            }
+
+            result = pending->Body->BeginRead(pending->Buffer, pending->Length, pending->Buffer->Length - pending->Length,
+                gcnew AsyncCallback(this, &VxSdkNet::MjpegStream::_OnRead), pending);
+        }
+        catch (WebException^) {
+            _Complete(pending, true);
+            return;
+        }
+        catch (IO::IOException^) {
+            _Complete(pending, true);
+            return;
+        }
+
+        if (!result->CompletedSynchronously || !_EndRead(pending, result))
+            return;
+    }
+}
+
+void VxSdkNet::MjpegStream::_Start() {
+    _sinceKeepAlive->Start();
+    _timer = gcnew Timer(gcnew TimerCallback(this, &VxSdkNet::MjpegStream::_Tick), nullptr, 0, _interval);
+}
+
+void VxSdkNet::MjpegStream::_Stop() {
+    _isStopped = true;
+    Timer^ timer = _timer;
+    _timer = nullptr;
+    if (timer != nullptr)
+        delete timer;
+}
+
+void VxSdkNet::MjpegStream::_Tick(Object^ state) {
+    if (_isStopped)
+        return;
+
+    // Keep the data session alive
+    if (_sinceKeepAlive->ElapsedMilliseconds >= _puller->KeepAliveInterval) {
+        _sinceKeepAlive->Restart();
+        _session->Update();
+    }
+
+    // Request the next frame unless the pipeline is already full
+    if (Interlocked::Increment(_inFlight) > Math::Max(_puller->PipelineDepth, 1)) {
+        Interlocked::Decrement(_inFlight);
+        return;
+    }
+
+    _Issue();
+}
@@ -4,34 +4,39 @@
 #include "Device.h"
 #include "Monitor.h"
 #include "MonitorCell.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Monitor::Monitor(VxSdk::IVxMonitor* vxMonitor) {
     _monitor = vxMonitor;
+    NativeMemory::Add(_monitor);
 }
 
 VxSdkNet::Monitor::!Monitor() {
-    _monitor->Delete();
+    NativeReleaseQueue::Release(_monitor);
     _monitor = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Monitor::Refresh() {
-    return (VxSdkNet::Results::Value)_monitor->Refresh();
+    SdkCall sdkCall("IVxMonitor::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitor->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Monitor::SetResolution(int resolutionX, int resolutionY) {
-    return (VxSdkNet::Results::Value)_monitor->SetResolution(resolutionX, resolutionY);
+    SdkCall sdkCall("IVxMonitor::SetResolution");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitor->SetResolution(resolutionX, resolutionY));
 }
 
 VxSdkNet::Device^ VxSdkNet::Monitor::_GetHostDevice() {
     // Get the device which hosts this monitor
     VxSdk::IVxDevice* device = nullptr;
-    VxSdk::VxResult::Value result = _monitor->GetHostDevice(device);
+    SdkCall sdkCall("IVxMonitor::GetHostDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitor->GetHostDevice(device));
 
     // Return the device if GetHostDevice was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew Device(device);
+        return IdentityMap::Intern<Device>(_identityMap, device);
 
     return nullptr;
 }
@@ -39,7 +44,8 @@ VxSdkNet::Device^ VxSdkNet::Monitor::_GetHostDevice() {
 VxSdkNet::ResourceLimits^ VxSdkNet::Monitor::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _monitor->GetLimits(limits);
+    SdkCall sdkCall("IVxMonitor::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitor->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -55,12 +61,14 @@ List<VxSdkNet::MonitorCell^>^ VxSdkNet::Monitor::_GetMonitorCells() {
     VxSdk::VxCollection<VxSdk::IVxMonitorCell**> monitorCells;
 
     // Make the call, which will return with the total count of monitor cells, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _monitor->GetMonitorCells(monitorCells);
+    SdkCall sdkCall("IVxMonitor::GetMonitorCells", monitorCells);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitor->GetMonitorCells(monitorCells));
     // Unless there are no monitor cells on the monitor, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetMonitorCells call
         monitorCells.collection = new VxSdk::IVxMonitorCell*[monitorCells.collectionSize];
-        result = _monitor->GetMonitorCells(monitorCells);
+        sdkCall.Restart("IVxMonitor::GetMonitorCells", monitorCells);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitor->GetMonitorCells(monitorCells));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < monitorCells.collectionSize; i++)
@@ -79,12 +87,14 @@ List<VxSdkNet::Monitor::Layouts>^ VxSdkNet::Monitor::_GetAvailableLayouts() {
     VxSdk::VxCollection<VxSdk::VxCellLayout::Value*> availableLayouts;
 
     // Make the call, which will return with the total count of available layouts, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _monitor->GetAvailableLayouts(availableLayouts);
+    SdkCall sdkCall("IVxMonitor::GetAvailableLayouts", availableLayouts);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitor->GetAvailableLayouts(availableLayouts));
     // Unless there are no available layouts for the monitor, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetAvailableLayouts call
         availableLayouts.collection = new VxSdk::VxCellLayout::Value[availableLayouts.collectionSize];
-        result = _monitor->GetAvailableLayouts(availableLayouts);
+        sdkCall.Restart("IVxMonitor::GetAvailableLayouts", availableLayouts);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitor->GetAvailableLayouts(availableLayouts));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < availableLayouts.collectionSize; i++)
@@ -2,42 +2,50 @@
 /// Implements the MonitorCell class.
 /// </summary>
 #include "MonitorCell.h"
+#include "NativeReleaseQueue.h"
 
 VxSdkNet::MonitorCell::MonitorCell(VxSdk::IVxMonitorCell* vxMonitorCell) {
     _monitorCell = vxMonitorCell;
+    NativeMemory::Add(_monitorCell);
 }
 
 VxSdkNet::MonitorCell::!MonitorCell() {
-    _monitorCell->Delete();
+    NativeReleaseQueue::Release(_monitorCell);
     _monitorCell = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::MonitorCell::Disconnect() {
     // Call SetDataSource with a nullptr to remove the current data source
-    return (VxSdkNet::Results::Value)_monitorCell->SetDataSource(nullptr);
+    SdkCall sdkCall("IVxMonitorCell::SetDataSource");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorCell->SetDataSource(nullptr));
 }
 
 VxSdkNet::Results::Value VxSdkNet::MonitorCell::GoToLive() {
     // Call SetTime with a nullptr to move the playback position to live
-    return (VxSdkNet::Results::Value)_monitorCell->SetTime(nullptr);
+    SdkCall sdkCall("IVxMonitorCell::SetTime");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorCell->SetTime(nullptr));
 }
 
 VxSdkNet::Results::Value VxSdkNet::MonitorCell::Refresh() {
-    return (VxSdkNet::Results::Value)_monitorCell->Refresh();
+    SdkCall sdkCall("IVxMonitorCell::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorCell->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::MonitorCell::SetCropBounds(float height, float width) {
-    return (VxSdkNet::Results::Value)_monitorCell->SetCropBounds(height, width);
+    SdkCall sdkCall("IVxMonitorCell::SetCropBounds");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorCell->SetCropBounds(height, width));
 }
 
 VxSdkNet::Results::Value VxSdkNet::MonitorCell::SetLocation(int x, int y, int z) {
-    return (VxSdkNet::Results::Value)_monitorCell->SetLocation(x, y, z);
+    SdkCall sdkCall("IVxMonitorCell::SetLocation");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorCell->SetLocation(x, y, z));
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::MonitorCell::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _monitorCell->GetLimits(limits);
+    SdkCall sdkCall("IVxMonitorCell::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorCell->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -3,20 +3,23 @@
 /// </summary>
 #include "Device.h"
 #include "MonitorWall.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::MonitorWall::MonitorWall(VxSdk::IVxMonitorWall* vxMonitorWall) {
     _monitorWall = vxMonitorWall;
+    NativeMemory::Add(_monitorWall);
 }
 
 VxSdkNet::MonitorWall::!MonitorWall() {
-    _monitorWall->Delete();
+    NativeReleaseQueue::Release(_monitorWall);
     _monitorWall = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::MonitorWall::ClearMonitorSelection() {
-    return (VxSdkNet::Results::Value)_monitorWall->ClearMonitorSelection();
+    SdkCall sdkCall("IVxMonitorWall::ClearMonitorSelection");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorWall->ClearMonitorSelection());
 }
 
 List<VxSdkNet::Monitor^>^ VxSdkNet::MonitorWall::GetMonitors(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
@@ -41,12 +44,14 @@ List<VxSdkNet::Monitor^>^ VxSdkNet::MonitorWall::GetMonitors(System::Collections
     }
 
     // Make the GetExports call, which will return with the total export count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _monitorWall->GetMonitors(monitors);
+    SdkCall sdkCall("IVxMonitorWall::GetMonitors", monitors);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorWall->GetMonitors(monitors));
     // Unless there are no exports on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxExport collection
         monitors.collection = new VxSdk::IVxMonitor*[monitors.collectionSize];
-        result = _monitorWall->GetMonitors(monitors);
+        sdkCall.Restart("IVxMonitorWall::GetMonitors", monitors);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorWall->GetMonitors(monitors));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < monitors.collectionSize; i++)
@@ -65,12 +70,14 @@ System::Collections::Generic::List<VxSdkNet::MonitorSelection^>^ VxSdkNet::Monit
     VxSdk::VxCollection<VxSdk::VxMonitorSelection**> monitorSelections;
 
     // Make the GetMonitorSelections call, which will return with the total monitor selection count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _monitorWall->GetMonitorSelections(monitorSelections);
+    SdkCall sdkCall("IVxMonitorWall::GetMonitorSelections", monitorSelections);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorWall->GetMonitorSelections(monitorSelections));
     // Unless there are no monitor selections for the monitor wall, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the VxMonitorSelection collection
         monitorSelections.collection = new VxSdk::VxMonitorSelection*[monitorSelections.collectionSize];
-        result = _monitorWall->GetMonitorSelections(monitorSelections);
+        sdkCall.Restart("IVxMonitorWall::GetMonitorSelections", monitorSelections);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorWall->GetMonitorSelections(monitorSelections));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < monitorSelections.collectionSize; i++)
@@ -83,17 +90,20 @@ System::Collections::Generic::List<VxSdkNet::MonitorSelection^>^ VxSdkNet::Monit
 }
 
 VxSdkNet::Results::Value VxSdkNet::MonitorWall::Refresh() {
-    return (VxSdkNet::Results::Value)_monitorWall->Refresh();
+    SdkCall sdkCall("IVxMonitorWall::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorWall->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::MonitorWall::SetMonitorSelection(int cellIndex, int monitorIndex, MonitorSelection::CellInputMode inputMode) {
-    return (VxSdkNet::Results::Value)_monitorWall->SetMonitorSelection(cellIndex, monitorIndex, (VxSdk::VxCellInputMode::Value)inputMode);
+    SdkCall sdkCall("IVxMonitorWall::SetMonitorSelection");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorWall->SetMonitorSelection(cellIndex, monitorIndex, (VxSdk::VxCellInputMode::Value)inputMode));
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::MonitorWall::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _monitorWall->GetLimits(limits);
+    SdkCall sdkCall("IVxMonitorWall::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _monitorWall->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -0,0 +1,235 @@
+/// <summary>
+/// Implements the monitor wall layout class.
+/// </summary>
+#include <msclr/lock.h>
+#include "MonitorWallLayout.h"
+
+using namespace System;
+using namespace System::Collections::Concurrent;
+using namespace System::Collections::Generic;
+using namespace System::Threading;
+
+VxSdkNet::MonitorWallLayout::MonitorWallLayout() {
+    _layouts = gcnew Dictionary<int, Monitor::Layouts>();
+    _cells = gcnew Dictionary<int, SortedDictionary<int, MonitorCellLayout^>^>();
+    MaxConcurrentUpdates = 48;
+}
+
+Dictionary<String^, VxSdkNet::Results::Value>^ VxSdkNet::MonitorWallLayout::Apply(MonitorWall^ monitorWall) {
+    MonitorWallLayoutJob^ job = gcnew MonitorWallLayoutJob();
+    job->Monitors = gcnew ConcurrentQueue<Monitor^>();
+    job->Cells = gcnew ConcurrentQueue<Queue<MonitorCellChange^>^>();
+    job->ItemResults = gcnew Dictionary<String^, Results::Value>();
+
+    // Only the monitors that are part of the layout need to be updated
+    HashSet<int>^ numbers = gcnew HashSet<int>(_layouts->Keys);
+    numbers->UnionWith(_cells->Keys);
+    for each (Monitor^ monitor in monitorWall->GetMonitors(nullptr)) {
+        if (numbers->Remove(monitor->Number))
+            job->Monitors->Enqueue(monitor);
+    }
+
+    for each (int number in numbers)
+        job->ItemResults[number.ToString()] = Results::Value::InvalidParameters;
+
+    // Change the monitor layouts first, since the cells of a monitor depend on its layout
+    int maxWorkers = Math::Max(MaxConcurrentUpdates, 1);
+    int workers = Math::Min(maxWorkers, job->Monitors->Count);
+    if (workers > 0) {
+        job->Workers = gcnew CountdownEvent(workers);
+        for (int i = 0; i < workers; i++)
+            ThreadPool::QueueUserWorkItem(gcnew WaitCallback(this, &VxSdkNet::MonitorWallLayout::_RunMonitors), job);
+    }
+
+    // Make the monitor selection while the monitors are being updated
+    if (_hasSelection) {
+        Results::Value result = _ApplySelection(monitorWall);
+        msclr::lock resultsLock(job->ItemResults);
+        job->ItemResults["Selection"] = result;
+    }
+
+    if (workers > 0)
+        job->Workers->Wait();
+
+    // Then update the cells of every monitor at once, each monitor's cells in order
+    workers = Math::Min(maxWorkers, job->Cells->Count);
+    if (workers > 0) {
+        job->Workers = gcnew CountdownEvent(workers);
+        for (int i = 0; i < workers; i++)
+            ThreadPool::QueueUserWorkItem(gcnew WaitCallback(this, &VxSdkNet::MonitorWallLayout::_RunCells), job);
+
+        job->Workers->Wait();
+    }
+
+    return job->ItemResults;
+}
+
+VxSdkNet::MonitorCellLayout^ VxSdkNet::MonitorWallLayout::GetCell(int monitorNumber, int cellIndex) {
+    SortedDictionary<int, MonitorCellLayout^>^ cells;
+    if (!_cells->TryGetValue(monitorNumber, cells)) {
+        cells = gcnew SortedDictionary<int, MonitorCellLayout^>();
+        _cells[monitorNumber] = cells;
+    }
+
+    MonitorCellLayout^ cell;
+    if (!cells->TryGetValue(cellIndex, cell)) {
+        cell = gcnew MonitorCellLayout();
+        cells[cellIndex] = cell;
+    }
+
+    return cell;
+}
+
+void VxSdkNet::MonitorWallLayout::SetMonitorLayout(int monitorNumber, Monitor::Layouts layout) {
+    _layouts[monitorNumber] = layout;
+}
+
+void VxSdkNet::MonitorWallLayout::SetMonitorSelection(int cellIndex, int monitorIndex, MonitorSelection::CellInputMode inputMode) {
+    _hasSelection = true;
+    _selectionCell = cellIndex;
+    _selectionMonitor = monitorIndex;
+    _selectionInputMode = inputMode;
+}
+
+void VxSdkNet::MonitorWallLayout::_ApplyCell(String^ key, MonitorCell^ cell, MonitorCellLayout^ target, Dictionary<String^, Results::Value>^ results) {
+    // Change the data source first, since the crop bounds and location apply to the video being displayed
+    if (target->DataSourceId != nullptr) {
+        Results::Value result = Results::Value::OK;
+        if (String::IsNullOrEmpty(target->DataSourceId)) {
+            if (!String::IsNullOrEmpty(cell->DataSourceId))
+                result = cell->Disconnect();
+        }
+        else if (!String::Equals(target->DataSourceId, cell->DataSourceId)) {
+            char id[64];
+            VxSdk::Utilities::StrCopySafe(id, Utils::ConvertCSharpString(target->DataSourceId).c_str());
+            SdkCall sdkCall("IVxMonitorCell::SetDataSource");
+            result = Results::Value(sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : cell->_monitorCell->SetDataSource(id)));
+        }
+
+        results[String::Concat(key, ".DataSourceId")] = result;
+    }
+
+    if (target->CropHeight.HasValue || target->CropWidth.HasValue) {
+        float height = target->CropHeight.HasValue ? target->CropHeight.Value : cell->CropHeight;
+        float width = target->CropWidth.HasValue ? target->CropWidth.Value : cell->CropWidth;
+        Results::Value result = Results::Value::OK;
+        if (height != cell->CropHeight || width != cell->CropWidth)
+            result = cell->SetCropBounds(height, width);
+
+        results[String::Concat(key, ".CropBounds")] = result;
+    }
+
+    if (target->LocationX.HasValue || target->LocationY.HasValue || target->LocationZ.HasValue) {
+        int x = target->LocationX.HasValue ? target->LocationX.Value : cell->LocationX;
+        int y = target->LocationY.HasValue ? target->LocationY.Value : cell->LocationY;
+        int z = target->LocationZ.HasValue ? target->LocationZ.Value : cell->LocationZ;
+        Results::Value result = Results::Value::OK;
+        if (x != cell->LocationX || y != cell->LocationY || z != cell->LocationZ)
+            result = cell->SetLocation(x, y, z);
+
+        results[String::Concat(key, ".Location")] = result;
+    }
+
+    if (target->IsInSync.HasValue) {
+        Results::Value result = Results::Value::OK;
+        if (target->IsInSync.Value != cell->IsInSync) {
+            VxSdk::VxResult::Value vxResult;
+            if (target->IsInSync.Value) {
+                SdkCall sdkCall("IVxMonitorCell::JoinSyncGroup");
+                vxResult = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : cell->_monitorCell->JoinSyncGroup());
+            }
+            else {
+                SdkCall sdkCall("IVxMonitorCell::LeaveSyncGroup");
+                vxResult = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : cell->_monitorCell->LeaveSyncGroup());
+            }
+
+            result = Results::Value(vxResult);
+        }
+
+        results[String::Concat(key, ".IsInSync")] = result;
+    }
+}
+
+VxSdkNet::Results::Value VxSdkNet::MonitorWallLayout::_ApplySelection(MonitorWall^ monitorWall) {
+    // The selections of every user are returned, so only the owner's own selection can be compared
+    if (SelectionOwner != nullptr) {
+        for each (MonitorSelection^ selection in monitorWall->GetMonitorSelections()) {
+            if (String::Equals(selection->Owner, SelectionOwner) && selection->Cell == _selectionCell && selection->Monitor == _selectionMonitor &&
+                (_selectionInputMode == MonitorSelection::CellInputMode::Unknown || selection->InputMode == _selectionInputMode))
+                return Results::Value::OK;
+        }
+    }
+
+    return monitorWall->SetMonitorSelection(_selectionCell, _selectionMonitor, _selectionInputMode);
+}
+
+void VxSdkNet::MonitorWallLayout::_RunCells(Object^ state) {
+    MonitorWallLayoutJob^ job = safe_cast<MonitorWallLayoutJob^>(state);
+    try {
+        // Each worker takes all of a monitor's cells, so that they are not updated out of order by other workers
+        Queue<MonitorCellChange^>^ changes;
+        while (job->Cells->TryDequeue(changes)) {
+            while (changes->Count > 0) {
+                MonitorCellChange^ change = changes->Dequeue();
+                Dictionary<String^, Results::Value>^ results = gcnew Dictionary<String^, Results::Value>();
+                _ApplyCell(change->Key, change->Cell, change->Target, results);
+
+                msclr::lock resultsLock(job->ItemResults);
+                for each (KeyValuePair<String^, Results::Value> result in results)
+                    job->ItemResults[result.Key] = result.Value;
+            }
+        }
+    }
+    finally {
+        job->Workers->Signal();
+    }
+}
+
+void VxSdkNet::MonitorWallLayout::_RunMonitors(Object^ state) {
+    MonitorWallLayoutJob^ job = safe_cast<MonitorWallLayoutJob^>(state);
+    try {
+        Monitor^ monitor;
+        while (job->Monitors->TryDequeue(monitor)) {
+            int number = monitor->Number;
+            Monitor::Layouts layout;
+            if (_layouts->TryGetValue(number, layout)) {
+                Results::Value result = Results::Value::OK;
+                if (monitor->Layout != layout) {
+                    SdkCall sdkCall("IVxMonitor::SetLayout");
+                    result = Results::Value(sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : monitor->_monitor->SetLayout((VxSdk::VxCellLayout::Value)layout)));
+                }
+
+                msclr::lock resultsLock(job->ItemResults);
+                job->ItemResults[String::Format("{0}.Layout", number)] = result;
+            }
+
+            SortedDictionary<int, MonitorCellLayout^>^ targets;
+            if (!_cells->TryGetValue(number, targets))
+                continue;
+
+            // Read the cells after any layout change so that their indexes match the new layout
+            Dictionary<int, MonitorCell^>^ cells = gcnew Dictionary<int, MonitorCell^>();
+            for each (MonitorCell^ cell in monitor->MonitorCells)
+                cells[cell->Index] = cell;
+
+            Queue<MonitorCellChange^>^ changes = gcnew Queue<MonitorCellChange^>();
+            for each (KeyValuePair<int, MonitorCellLayout^> target in targets) {
+                String^ key = String::Format("{0}.{1}", number, target.Key);
+                MonitorCell^ cell;
+                if (cells->TryGetValue(target.Key, cell))
+                    changes->Enqueue(gcnew MonitorCellChange(key, cell, target.Value));
+                else {
+                    msclr::lock resultsLock(job->ItemResults);
+                    job->ItemResults[key] = Results::Value::InvalidParameters;
+                }
+            }
+
+            // Queue the monitor's cells together once they are all known
+            if (changes->Count > 0)
+                job->Cells->Enqueue(changes);
+        }
+    }
+    finally {
+        job->Workers->Signal();
+    }
+}
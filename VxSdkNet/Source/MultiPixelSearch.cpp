@@ -0,0 +1,131 @@
+/// <summary>
+/// Implements the multi pixel search class.
+/// </summary>
+#include <msclr/lock.h>
+#include "MultiPixelSearch.h"
+
+using namespace System;
+using namespace System::Collections::Concurrent;
+using namespace System::Collections::Generic;
+using namespace System::Threading;
+
+VxSdkNet::MultiPixelSearch::MultiPixelSearch() {
+    _results = gcnew List<PixelSearchResult^>();
+    MaxConcurrentSearches = 4;
+    MaxPollInterval = 5000;
+    MinPollInterval = 250;
+    Timeout = 300000;
+}
+
+void VxSdkNet::MultiPixelSearch::Cancel() {
+    _isCanceled = true;
+}
+
+List<VxSdkNet::PixelSearchMatch^>^ VxSdkNet::MultiPixelSearch::Run(IEnumerable<DataSource^>^ dataSources,
+    NewPixelSearch^ newPixelSearch, ResultDelegate^ callback) {
+    List<KeyValuePair<DataSource^, NewPixelSearch^>>^ searches = gcnew List<KeyValuePair<DataSource^, NewPixelSearch^>>();
+    for each (DataSource^ dataSource in dataSources)
+        searches->Add(KeyValuePair<DataSource^, NewPixelSearch^>(dataSource, newPixelSearch));
+
+    return Run(searches, callback);
+}
+
+List<VxSdkNet::PixelSearchMatch^>^ VxSdkNet::MultiPixelSearch::Run(IEnumerable<KeyValuePair<DataSource^, NewPixelSearch^>>^ searches,
+    ResultDelegate^ callback) {
+    _isCanceled = false;
+
+    MultiPixelSearchJob^ job = gcnew MultiPixelSearchJob();
+    job->Searches = gcnew ConcurrentQueue<KeyValuePair<DataSource^, NewPixelSearch^>>(searches);
+    job->Callback = callback;
+    job->Results = gcnew List<PixelSearchResult^>();
+
+    // Run the searches using a bounded number of workers
+    int workers = Math::Min(Math::Max(MaxConcurrentSearches, 1), job->Searches->Count);
+    if (workers > 0) {
+        job->Workers = gcnew CountdownEvent(workers);
+        for (int i = 0; i < workers; i++)
+            ThreadPool::QueueUserWorkItem(gcnew WaitCallback(this, &VxSdkNet::MultiPixelSearch::_RunSearches), job);
+
+        job->Workers->Wait();
+    }
+
+    _results = job->Results;
+
+    // Merge the spans found on every data source into a single timeline
+    List<PixelSearchMatch^>^ mlist = gcnew List<PixelSearchMatch^>();
+    for each (PixelSearchResult^ result in _results) {
+        for each (KeyValuePair<DateTime, DateTime> span in result->Coverage->Spans)
+            mlist->Add(gcnew PixelSearchMatch(result->Coverage->DataSourceId, span.Key, span.Value));
+    }
+
+    mlist->Sort(gcnew Comparison<PixelSearchMatch^>(&VxSdkNet::MultiPixelSearch::_CompareMatches));
+    return mlist;
+}
+
+int VxSdkNet::MultiPixelSearch::_CompareMatches(PixelSearchMatch^ left, PixelSearchMatch^ right) {
+    // Order matches by start time, then by data source
+    int result = left->StartTime.CompareTo(right->StartTime);
+    return result != 0 ? result : String::CompareOrdinal(left->DataSourceId, right->DataSourceId);
+}
+
+void VxSdkNet::MultiPixelSearch::_RunSearches(Object^ state) {
+    MultiPixelSearchJob^ job = safe_cast<MultiPixelSearchJob^>(state);
+    try {
+        KeyValuePair<DataSource^, NewPixelSearch^> search;
+        while (!_isCanceled && job->Searches->TryDequeue(search)) {
+            PixelSearchResult^ result = _Search(search.Key, search.Value);
+
+            // Pass results to the callback one at a time so that it does not need to be thread safe
+            msclr::lock resultsLock(job->Results);
+            job->Results->Add(result);
+            if (job->Callback != nullptr) {
+                try {
+                    job->Callback(result);
+                }
+                catch (Exception^) {
+                    // Don't let the callback's exception escape onto the worker thread
+                    Interlocked::Increment(_callbackErrors);
+                }
+            }
+        }
+    }
+    finally {
+        job->Workers->Signal();
+    }
+}
+
+VxSdkNet::PixelSearchResult^ VxSdkNet::MultiPixelSearch::_Search(DataSource^ dataSource, NewPixelSearch^ newPixelSearch) {
+    PixelSearchResult^ result = gcnew PixelSearchResult(dataSource);
+    System::Diagnostics::Stopwatch^ elapsed = System::Diagnostics::Stopwatch::StartNew();
+
+    PixelSearch^ pixelSearch = dataSource->CreatePixelSearch(newPixelSearch);
+    if (pixelSearch == nullptr) {
+        result->_duration = elapsed->Elapsed;
+        return result;
+    }
+
+    // Poll the search with an increasing interval until it completes, times out or is canceled
+    int interval = Math::Max(MinPollInterval, 1);
+    result->_status = PixelSearchResult::States::TimedOut;
+    while (elapsed->ElapsedMilliseconds < Timeout) {
+        if (_isCanceled) {
+            result->_status = PixelSearchResult::States::Canceled;
+            break;
+        }
+
+        if (pixelSearch->Status == PixelSearch::SearchStatus::Complete) {
+            result->_status = PixelSearchResult::States::Complete;
+            break;
+        }
+
+        Thread::Sleep(static_cast<int>(Math::Min(static_cast<long long>(interval), Math::Max(Timeout - elapsed->ElapsedMilliseconds, 0LL))));
+        interval = Math::Min(interval * 2, Math::Max(MaxPollInterval, interval));
+    }
+
+    // Read the clips found so far, then remove the search from the data source
+    result->_clips = pixelSearch->Clips;
+    result->_coverage->AddClips(result->_clips);
+    dataSource->DeletePixelSearch(pixelSearch);
+    result->_duration = elapsed->Elapsed;
+    return result;
+}
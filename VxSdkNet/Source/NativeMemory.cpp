@@ -0,0 +1,52 @@
+/// <summary>
+/// Implements the native memory class.
+/// </summary>
+#include <msclr/lock.h>
+#include "NativeMemory.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Threading;
+
+Dictionary<String^, long long>^ VxSdkNet::NativeMemory::GetLiveCounts() {
+    Dictionary<String^, long long>^ liveCounts = gcnew Dictionary<String^, long long>();
+    int typeCount = Math::Min(Thread::VolatileRead(_typeCount), MaxTypes);
+    for (int i = 0; i < typeCount; i++)
+        liveCounts[_typeNames[i]] = Interlocked::Read(_liveCounts[i]);
+
+    return liveCounts;
+}
+
+void VxSdkNet::NativeMemory::_Add(int typeIndex, long long size) {
+    Interlocked::Add(_liveCounts[typeIndex], size < 0 ? -1 : 1);
+    Interlocked::Add(_liveCount, size < 0 ? -1 : 1);
+    Interlocked::Add(_liveBytes, size);
+
+    // Report pressure to the garbage collector in larger steps rather than for every object
+    long long unreported = Interlocked::Add(_unreportedPressure, size);
+    if (unreported >= PressureThreshold || unreported <= -PressureThreshold) {
+        unreported = Interlocked::Exchange(_unreportedPressure, 0);
+        if (unreported > 0)
+            GC::AddMemoryPressure(unreported);
+        else if (unreported < 0)
+            GC::RemoveMemoryPressure(-unreported);
+    }
+}
+
+int VxSdkNet::NativeMemory::_RegisterType(const char* typeName) {
+    msclr::lock typesLock(_typeNames);
+    String^ name = gcnew String(typeName);
+    int typeCount = Math::Min(_typeCount, MaxTypes);
+    for (int i = 0; i < typeCount; i++) {
+        if (String::Equals(_typeNames[i], name))
+            return i;
+    }
+
+    // Should the table ever fill, further types are counted under the last one
+    if (_typeCount == MaxTypes)
+        return MaxTypes - 1;
+
+    _typeNames[_typeCount] = name;
+    Thread::VolatileWrite(_typeCount, _typeCount + 1);
+    return _typeCount - 1;
+}
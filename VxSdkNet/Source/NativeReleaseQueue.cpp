@@ -0,0 +1,71 @@
+/// <summary>
+/// Implements the native release queue class.
+/// </summary>
+#include "NativeReleaseQueue.h"
+
+using namespace System;
+using namespace System::Diagnostics;
+using namespace System::Threading;
+
+void VxSdkNet::NativeReleaseQueue::Flush() {
+    while (_ReleaseBatch() > 0);
+}
+
+TimeSpan VxSdkNet::NativeReleaseQueue::AverageReleaseLatency::get() {
+    long long releasedCount = Interlocked::Read(_releasedCount);
+    if (releasedCount == 0)
+        return TimeSpan::Zero;
+
+    return TimeSpan::FromSeconds(static_cast<double>(Interlocked::Read(_totalLatency)) / releasedCount / Stopwatch::Frequency);
+}
+
+TimeSpan VxSdkNet::NativeReleaseQueue::MaxReleaseLatency::get() {
+    return TimeSpan::FromSeconds(static_cast<double>(Interlocked::Read(_maxLatency)) / Stopwatch::Frequency);
+}
+
+void VxSdkNet::NativeReleaseQueue::_Queue(NativeHandle nativeHandle) {
+    _handles->Enqueue(nativeHandle);
+
+    // Smaller batches are picked up when the flush interval elapses
+    if (_handles->Count >= _batchSize)
+        _wake->Set();
+}
+
+int VxSdkNet::NativeReleaseQueue::_ReleaseBatch() {
+    int released = 0;
+    long long totalLatency = 0;
+    long long maxLatency = 0;
+    NativeHandle nativeHandle;
+    while (released < _batchSize && _handles->TryDequeue(nativeHandle)) {
+        NativeDeleter deleter = reinterpret_cast<NativeDeleter>(nativeHandle.Deleter.ToPointer());
+        deleter(nativeHandle.Handle.ToPointer());
+
+        long long latency = Stopwatch::GetTimestamp() - nativeHandle.QueuedAt;
+        totalLatency += latency;
+        maxLatency = Math::Max(maxLatency, latency);
+        released++;
+    }
+
+    // Update the statistics once per batch rather than once per object
+    if (released > 0) {
+        Interlocked::Add(_releasedCount, released);
+        Interlocked::Add(_totalLatency, totalLatency);
+        long long currentMax = Interlocked::Read(_maxLatency);
+        while (maxLatency > currentMax) {
+            long long previous = Interlocked::CompareExchange(_maxLatency, maxLatency, currentMax);
+            if (previous == currentMax)
+                break;
+
+            currentMax = previous;
+        }
+    }
+
+    return released;
+}
+
+void VxSdkNet::NativeReleaseQueue::_RunReleaser() {
+    while (true) {
+        _wake->WaitOne(_flushInterval);
+        while (_ReleaseBatch() == _batchSize);
+    }
+}
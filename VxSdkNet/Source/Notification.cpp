@@ -2,28 +2,32 @@
 /// Implements the notification class.
 /// </summary>
 #include "Notification.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Notification::Notification(VxSdk::IVxNotification* vxNotification) {
     _notification = vxNotification;
+    NativeMemory::Add(_notification);
 }
 
 VxSdkNet::Notification::!Notification() {
-    _notification->Delete();
+    NativeReleaseQueue::Release(_notification);
     _notification = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Notification::AddRole(VxSdkNet::Role^ role) {
     // Make the call to add the role to the notification
-    VxSdk::VxResult::Value result = _notification->AddRole(*role->_role);
+    SdkCall sdkCall("IVxNotification::AddRole");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _notification->AddRole(*role->_role));
     // Unless there was an issue adding the role the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::Notification::AddUser(VxSdkNet::User^ user) {
     // Make the call to add the user to the notification
-    VxSdk::VxResult::Value result = _notification->AddUser(*user->_user);
+    SdkCall sdkCall("IVxNotification::AddUser");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _notification->AddUser(*user->_user));
     // Unless there was an issue adding the user the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -51,12 +55,14 @@ System::Collections::Generic::List<VxSdkNet::Role^>^ VxSdkNet::Notification::Get
 
     // Make the GetRoles call, which will return with the total role count, this
     // allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _notification->GetRoles(roles);
+    SdkCall sdkCall("IVxNotification::GetRoles", roles);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _notification->GetRoles(roles));
     // As long as there are roles linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxRole collection
         roles.collection = new VxSdk::IVxRole*[roles.collectionSize];
-        result = _notification->GetRoles(roles);
+        sdkCall.Restart("IVxNotification::GetRoles", roles);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _notification->GetRoles(roles));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < roles.collectionSize; i++)
@@ -91,12 +97,14 @@ System::Collections::Generic::List<VxSdkNet::User^>^ VxSdkNet::Notification::Get
 
     // Make the GetUsers call, which will return with the total user count, this
     // allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _notification->GetUsers(users);
+    SdkCall sdkCall("IVxNotification::GetUsers", users);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _notification->GetUsers(users));
     // As long as there are users linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxUser collection
         users.collection = new VxSdk::IVxUser * [users.collectionSize];
-        result = _notification->GetUsers(users);
+        sdkCall.Restart("IVxNotification::GetUsers", users);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _notification->GetUsers(users));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < users.collectionSize; i++)
@@ -109,19 +117,22 @@ System::Collections::Generic::List<VxSdkNet::User^>^ VxSdkNet::Notification::Get
 }
 
 VxSdkNet::Results::Value VxSdkNet::Notification::Refresh() {
-    return (VxSdkNet::Results::Value)_notification->Refresh();
+    SdkCall sdkCall("IVxNotification::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _notification->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Notification::RemoveRole(VxSdkNet::Role^ role) {
     // Make the call to remove the role from the notification
-    VxSdk::VxResult::Value result = _notification->RemoveRole(*role->_role);
+    SdkCall sdkCall("IVxNotification::RemoveRole");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _notification->RemoveRole(*role->_role));
     // Unless there was an issue removing the role the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::Notification::RemoveUser(VxSdkNet::User^ user) {
     // Make the call to remove the user from the notification
-    VxSdk::VxResult::Value result = _notification->RemoveUser(*user->_user);
+    SdkCall sdkCall("IVxNotification::RemoveUser");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _notification->RemoveUser(*user->_user));
     // Unless there was an issue removing the user the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
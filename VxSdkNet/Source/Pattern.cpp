@@ -2,12 +2,14 @@
 /// Implements the pattern class.
 /// </summary>
 #include "Pattern.h"
+#include "NativeReleaseQueue.h"
 
 VxSdkNet::Pattern::Pattern(VxSdk::IVxPattern* vxPattern) {
     _pattern = vxPattern;
+    NativeMemory::Add(_pattern);
 }
 
 VxSdkNet::Pattern::!Pattern() {
-    _pattern->Delete();
+    NativeReleaseQueue::Release(_pattern);
     _pattern = nullptr;
 }
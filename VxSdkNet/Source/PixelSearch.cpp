@@ -3,15 +3,17 @@
 /// </summary>
 #include "PixelSearch.h"
 #include "Clip.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::PixelSearch::PixelSearch(VxSdk::IVxPixelSearch* vxPixelSearch) {
     _pixelSearch = vxPixelSearch;
+    NativeMemory::Add(_pixelSearch);
 }
 
 VxSdkNet::PixelSearch::!PixelSearch() {
-    _pixelSearch->Delete();
+    NativeReleaseQueue::Release(_pixelSearch);
     _pixelSearch = nullptr;
 }
 
@@ -37,12 +39,14 @@ System::Collections::Generic::List<VxSdkNet::Clip^>^ VxSdkNet::PixelSearch::GetC
     }
 
     // Make the GetClips call, which will return with the total clip count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _pixelSearch->GetClips(clips);
+    SdkCall sdkCall("IVxPixelSearch::GetClips", clips);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _pixelSearch->GetClips(clips));
     // As long as there are clip results from this pixel search the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxClip collection
         clips.collection = new VxSdk::IVxClip*[clips.collectionSize];
-        result = _pixelSearch->GetClips(clips);
+        sdkCall.Restart("IVxPixelSearch::GetClips", clips);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _pixelSearch->GetClips(clips));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < clips.collectionSize; i++)
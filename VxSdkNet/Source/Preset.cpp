@@ -2,12 +2,14 @@
 /// Implements the preset class.
 /// </summary>
 #include "Preset.h"
+#include "NativeReleaseQueue.h"
 
 VxSdkNet::Preset::Preset(VxSdk::IVxPreset* vxPreset) {
     _preset = vxPreset;
+    NativeMemory::Add(_preset);
 }
 
 VxSdkNet::Preset::!Preset() {
-    _preset->Delete();
+    NativeReleaseQueue::Release(_preset);
     _preset = nullptr;
 }
@@ -3,20 +3,48 @@
 /// </summary>
 
 #include "Privilege.h"
+#include "Role.h"
 #include "User.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Privilege::Privilege(VxSdk::IVxPrivilege* vxPrivilege) {
     _privilege = vxPrivilege;
+    NativeMemory::Add(_privilege);
 }
 
 VxSdkNet::Privilege::!Privilege() {
-    _privilege->Delete();
+    NativeReleaseQueue::Release(_privilege);
     _privilege = nullptr;
 }
 
 System::Collections::Generic::List<VxSdkNet::DataSource^>^ VxSdkNet::Privilege::GetLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    VxSdk::VxResult::Value result;
+    return _GetLinkedDataSources(filters, result);
+}
+
+System::Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::Privilege::GetLinkedDevices(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    VxSdk::VxResult::Value result;
+    return _GetLinkedDevices(filters, result);
+}
+
+System::Collections::Generic::List<VxSdkNet::Drawing^>^ VxSdkNet::Privilege::GetLinkedDrawings(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    VxSdk::VxResult::Value result;
+    return _GetLinkedDrawings(filters, result);
+}
+
+System::Collections::Generic::List<VxSdkNet::RelayOutput^>^ VxSdkNet::Privilege::GetLinkedRelayOutputs(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    VxSdk::VxResult::Value result;
+    return _GetLinkedRelayOutputs(filters, result);
+}
+
+System::Collections::Generic::List<VxSdkNet::User^>^ VxSdkNet::Privilege::GetLinkedUsers(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+    VxSdk::VxResult::Value result;
+    return _GetLinkedUsers(filters, result);
+}
+
+System::Collections::Generic::List<VxSdkNet::DataSource^>^ VxSdkNet::Privilege::GetUnLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
     // Create a list of managed data sources
     List<VxSdkNet::DataSource^>^ mlist = gcnew List<VxSdkNet::DataSource^>();
     // Create a collection of unmanaged data sources
@@ -37,18 +65,20 @@ System::Collections::Generic::List<VxSdkNet::DataSource^>^ VxSdkNet::Privilege::
         dataSources.filters = collFilters;
     }
 
-    // Make the GetLinks call, which will return with the total data source count, this
+    // Make the GetUnLinked call, which will return with the total data source count, this
     // allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _privilege->GetLinks(dataSources);
+    SdkCall sdkCall("IVxPrivilege::GetUnLinked", dataSources);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetUnLinked(dataSources));
     // As long as there are data sources linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDataSource collection
         dataSources.collection = new VxSdk::IVxDataSource*[dataSources.collectionSize];
-        result = _privilege->GetLinks(dataSources);
+        sdkCall.Restart("IVxPrivilege::GetUnLinked", dataSources);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetUnLinked(dataSources));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < dataSources.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::DataSource(dataSources.collection[i]));
+                mlist->Add(IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSources.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] dataSources.collection;
@@ -56,7 +86,7 @@ System::Collections::Generic::List<VxSdkNet::DataSource^>^ VxSdkNet::Privilege::
     return mlist;
 }
 
-System::Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::Privilege::GetLinkedDevices(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+System::Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::Privilege::GetUnLinkedDevices(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
     // Create a list of managed devices
     List<VxSdkNet::Device^>^ mlist = gcnew List<VxSdkNet::Device^>();
     // Create a collection of unmanaged devices
@@ -77,18 +107,20 @@ System::Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::Privilege::GetL
         devices.filters = collFilters;
     }
 
-    // Make the GetLinks call, which will return with the total device count, this allows the
+    // Make the GetUnLinked call, which will return with the total device count, this allows the
     // client to allocate memory.
-    VxSdk::VxResult::Value result = _privilege->GetLinks(devices);
+    SdkCall sdkCall("IVxPrivilege::GetUnLinked", devices);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetUnLinked(devices));
     // As long as there are devices linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDevice collection
         devices.collection = new VxSdk::IVxDevice*[devices.collectionSize];
-        result = _privilege->GetLinks(devices);
+        sdkCall.Restart("IVxPrivilege::GetUnLinked", devices);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetUnLinked(devices));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < devices.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::Device(devices.collection[i]));
+                mlist->Add(IdentityMap::Intern<VxSdkNet::Device>(_identityMap, devices.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] devices.collection;
@@ -96,7 +128,7 @@ System::Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::Privilege::GetL
     return mlist;
 }
 
-System::Collections::Generic::List<VxSdkNet::Drawing^>^ VxSdkNet::Privilege::GetLinkedDrawings(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+System::Collections::Generic::List<VxSdkNet::Drawing^>^ VxSdkNet::Privilege::GetUnLinkedDrawings(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
     // Create a list of managed drawings
     List<VxSdkNet::Drawing^>^ mlist = gcnew List<VxSdkNet::Drawing^>();
     // Create a collection of unmanaged drawings
@@ -119,12 +151,14 @@ System::Collections::Generic::List<VxSdkNet::Drawing^>^ VxSdkNet::Privilege::Get
 
     // Make the GetLinks call, which will return with the total drawing count, this allows the
     // client to allocate memory.
-    VxSdk::VxResult::Value result = _privilege->GetLinks(drawings);
+    SdkCall sdkCall("IVxPrivilege::GetUnLinked", drawings);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetUnLinked(drawings));
     // As long as there are drawings linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDrawing collection
         drawings.collection = new VxSdk::IVxDrawing*[drawings.collectionSize];
-        result = _privilege->GetLinks(drawings);
+        sdkCall.Restart("IVxPrivilege::GetUnLinked", drawings);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetUnLinked(drawings));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < drawings.collectionSize; i++)
@@ -136,7 +170,7 @@ System::Collections::Generic::List<VxSdkNet::Drawing^>^ VxSdkNet::Privilege::Get
     return mlist;
 }
 
-System::Collections::Generic::List<VxSdkNet::RelayOutput^>^ VxSdkNet::Privilege::GetLinkedRelayOutputs(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+System::Collections::Generic::List<VxSdkNet::RelayOutput^>^ VxSdkNet::Privilege::GetUnLinkedRelayOutputs(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
     // Create a list of managed relay outputs
     List<VxSdkNet::RelayOutput^>^ mlist = gcnew List<VxSdkNet::RelayOutput^>();
     // Create a collection of unmanaged relay outputs
@@ -159,16 +193,18 @@ System::Collections::Generic::List<VxSdkNet::RelayOutput^>^ VxSdkNet::Privilege:
 
     // Make the GetLinks call, which will return with the total relay output count, this allows the
     // client to allocate memory.
-    VxSdk::VxResult::Value result = _privilege->GetLinks(relayOutputs);
+    SdkCall sdkCall("IVxPrivilege::GetUnLinked", relayOutputs);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetUnLinked(relayOutputs));
     // As long as there are relay outputs linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxRelayOutput collection
         relayOutputs.collection = new VxSdk::IVxRelayOutput*[relayOutputs.collectionSize];
-        result = _privilege->GetLinks(relayOutputs);
+        sdkCall.Restart("IVxPrivilege::GetUnLinked", relayOutputs);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetUnLinked(relayOutputs));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < relayOutputs.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::RelayOutput(relayOutputs.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::RelayOutput>(_identityMap, relayOutputs.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] relayOutputs.collection;
@@ -176,7 +212,7 @@ System::Collections::Generic::List<VxSdkNet::RelayOutput^>^ VxSdkNet::Privilege:
     return mlist;
 }
 
-System::Collections::Generic::List<VxSdkNet::User^>^ VxSdkNet::Privilege::GetLinkedUsers(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+System::Collections::Generic::List<VxSdkNet::User^>^ VxSdkNet::Privilege::GetUnLinkedUsers(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
     // Create a list of managed users
     List<VxSdkNet::User^>^ mlist = gcnew List<VxSdkNet::User^>();
     // Create a collection of unmanaged users
@@ -197,14 +233,16 @@ System::Collections::Generic::List<VxSdkNet::User^>^ VxSdkNet::Privilege::GetLin
         users.filters = collFilters;
     }
 
-    // Make the GetLinks call, which will return with the total user count, this
+    // Make the GetUnLinked call, which will return with the total user count, this
     // allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _privilege->GetLinks(users);
+    SdkCall sdkCall("IVxPrivilege::GetUnLinked", users);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetUnLinked(users));
     // As long as there are users linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxUser collection
         users.collection = new VxSdk::IVxUser*[users.collectionSize];
-        result = _privilege->GetLinks(users);
+        sdkCall.Restart("IVxPrivilege::GetUnLinked", users);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetUnLinked(users));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < users.collectionSize; i++)
@@ -216,7 +254,219 @@ System::Collections::Generic::List<VxSdkNet::User^>^ VxSdkNet::Privilege::GetLin
     return mlist;
 }
 
-System::Collections::Generic::List<VxSdkNet::DataSource^>^ VxSdkNet::Privilege::GetUnLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+VxSdkNet::Results::Value VxSdkNet::Privilege::Link(List<VxSdkNet::DataSource^>^ dataSources) {
+    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
+
+    // Iterate the managed list of data sources
+    for (int i = 0; i < dataSources->Count; i++) {
+        // Link the data sources to the privilege
+        NativeReadLock nativeLock(dataSources[i]->_nativeLock);
+        SdkCall sdkCall("IVxPrivilege::Link");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->Link(*dataSources[i]->_dataSource));
+    }
+
+    // Unless there was an issue linking the data sources the result should be VxSdk::VxResult::kOK
+    return VxSdkNet::Results::Value(result);
+}
+
+VxSdkNet::Results::Value VxSdkNet::Privilege::Link(List<VxSdkNet::Device^>^ devices) {
+    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
+
+    // Iterate the managed list of devices
+    for (int i = 0; i < devices->Count; i++) {
+        // Link the devices to the privilege
+        NativeReadLock nativeLock(devices[i]->_nativeLock);
+        SdkCall sdkCall("IVxPrivilege::Link");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->Link(*devices[i]->_device));
+    }
+
+    // Unless there was an issue linking the devices the result should be VxSdk::VxResult::kOK
+    return VxSdkNet::Results::Value(result);
+}
+
+VxSdkNet::Results::Value VxSdkNet::Privilege::Link(List<VxSdkNet::Drawing^>^ drawings) {
+    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
+
+    // Iterate the managed list of drawings
+    for (int i = 0; i < drawings->Count; i++) {
+        // Link the drawings to the privilege
+        SdkCall sdkCall("IVxPrivilege::Link");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->Link(*drawings[i]->_drawing));
+    }
+
+    // Unless there was an issue linking the drawings the result should be VxSdk::VxResult::kOK
+    return VxSdkNet::Results::Value(result);
+}
+
+VxSdkNet::Results::Value VxSdkNet::Privilege::Link(List<VxSdkNet::RelayOutput^>^ relayOutputs) {
+    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
+
+    // Iterate the managed list of relay outputs
+    for (int i = 0; i < relayOutputs->Count; i++) {
+        // Link the relay outputs to the privilege
+        SdkCall sdkCall("IVxPrivilege::Link");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->Link(*relayOutputs[i]->_relayOutput));
+    }
+
+    // Unless there was an issue linking the relay outputs the result should be VxSdk::VxResult::kOK
+    return VxSdkNet::Results::Value(result);
+}
+
+VxSdkNet::Results::Value VxSdkNet::Privilege::Link(List<VxSdkNet::User^>^ users) {
+    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
+
+    // Iterate the managed list of users
+    for (int i = 0; i < users->Count; i++) {
+        // Link the users to the privilege
+        SdkCall sdkCall("IVxPrivilege::Link");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->Link(*users[i]->_user));
+    }
+
+    // Unless there was an issue linking the users the result should be VxSdk::VxResult::kOK
+    return VxSdkNet::Results::Value(result);
+}
+
+VxSdkNet::Results::Value VxSdkNet::Privilege::Refresh() {
+    SdkCall sdkCall("IVxPrivilege::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->Refresh());
+}
+
+Dictionary<System::String^, VxSdkNet::Results::Value>^ VxSdkNet::Privilege::SetLinkedDataSources(List<VxSdkNet::DataSource^>^ dataSources) {
+    VxSdk::VxResult::Value readResult;
+    List<VxSdkNet::DataSource^>^ linked = _GetLinkedDataSources(nullptr, readResult);
+    return BulkLink::SetLinked<DataSource>(dataSources, linked, readResult, gcnew BulkLink::LinkDelegate(this, &VxSdkNet::Privilege::_LinkDataSource),
+        gcnew BulkLink::FetchDelegate(this, &VxSdkNet::Privilege::_Fetch));
+}
+
+Dictionary<System::String^, VxSdkNet::Results::Value>^ VxSdkNet::Privilege::SetLinkedDevices(List<VxSdkNet::Device^>^ devices) {
+    VxSdk::VxResult::Value readResult;
+    List<VxSdkNet::Device^>^ linked = _GetLinkedDevices(nullptr, readResult);
+    return BulkLink::SetLinked<Device>(devices, linked, readResult, gcnew BulkLink::LinkDelegate(this, &VxSdkNet::Privilege::_LinkDevice),
+        gcnew BulkLink::FetchDelegate(this, &VxSdkNet::Privilege::_Fetch));
+}
+
+Dictionary<System::String^, VxSdkNet::Results::Value>^ VxSdkNet::Privilege::SetLinkedDrawings(List<VxSdkNet::Drawing^>^ drawings) {
+    VxSdk::VxResult::Value readResult;
+    List<VxSdkNet::Drawing^>^ linked = _GetLinkedDrawings(nullptr, readResult);
+    return BulkLink::SetLinked<Drawing>(drawings, linked, readResult, gcnew BulkLink::LinkDelegate(this, &VxSdkNet::Privilege::_LinkDrawing),
+        gcnew BulkLink::FetchDelegate(this, &VxSdkNet::Privilege::_Fetch));
+}
+
+Dictionary<System::String^, VxSdkNet::Results::Value>^ VxSdkNet::Privilege::SetLinkedRelayOutputs(List<VxSdkNet::RelayOutput^>^ relayOutputs) {
+    VxSdk::VxResult::Value readResult;
+    List<VxSdkNet::RelayOutput^>^ linked = _GetLinkedRelayOutputs(nullptr, readResult);
+    return BulkLink::SetLinked<RelayOutput>(relayOutputs, linked, readResult, gcnew BulkLink::LinkDelegate(this, &VxSdkNet::Privilege::_LinkRelayOutput),
+        gcnew BulkLink::FetchDelegate(this, &VxSdkNet::Privilege::_Fetch));
+}
+
+Dictionary<System::String^, VxSdkNet::Results::Value>^ VxSdkNet::Privilege::SetLinkedUsers(List<VxSdkNet::User^>^ users) {
+    VxSdk::VxResult::Value readResult;
+    List<VxSdkNet::User^>^ linked = _GetLinkedUsers(nullptr, readResult);
+    return BulkLink::SetLinked<User>(users, linked, readResult, gcnew BulkLink::LinkDelegate(this, &VxSdkNet::Privilege::_LinkUser),
+        gcnew BulkLink::FetchDelegate(this, &VxSdkNet::Privilege::_Fetch));
+}
+
+VxSdkNet::Results::Value VxSdkNet::Privilege::Unlink(List<VxSdkNet::DataSource^>^ dataSources) {
+    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
+
+    // Iterate the managed list of data sources
+    for (int i = 0; i < dataSources->Count; i++) {
+        // UnLink the data sources to the privilege
+        NativeReadLock nativeLock(dataSources[i]->_nativeLock);
+        SdkCall sdkCall("IVxPrivilege::UnLink");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->UnLink(*dataSources[i]->_dataSource));
+    }
+
+    // Unless there was an issue unlinking the data sources the result should be VxSdk::VxResult::kOK
+    return VxSdkNet::Results::Value(result);
+}
+
+VxSdkNet::Results::Value VxSdkNet::Privilege::Unlink(List<VxSdkNet::Device^>^ devices) {
+    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
+
+    // Iterate the managed list of devices
+    for (int i = 0; i < devices->Count; i++) {
+        // UnLink the devices to the privilege
+        NativeReadLock nativeLock(devices[i]->_nativeLock);
+        SdkCall sdkCall("IVxPrivilege::UnLink");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->UnLink(*devices[i]->_device));
+    }
+
+    // Unless there was an issue unlinking the devices the result should be VxSdk::VxResult::kOK
+    return VxSdkNet::Results::Value(result);
+}
+
+VxSdkNet::Results::Value VxSdkNet::Privilege::Unlink(List<VxSdkNet::Drawing^>^ drawings) {
+    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
+
+    // Iterate the managed list of drawings
+    for (int i = 0; i < drawings->Count; i++) {
+        // Unlink the drawings to the privilege
+        SdkCall sdkCall("IVxPrivilege::UnLink");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->UnLink(*drawings[i]->_drawing));
+    }
+
+    // Unless there was an issue unlinking the drawings the result should be VxSdk::VxResult::kOK
+    return VxSdkNet::Results::Value(result);
+}
+
+VxSdkNet::Results::Value VxSdkNet::Privilege::Unlink(List<VxSdkNet::RelayOutput^>^ relayOutputs) {
+    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
+
+    // Iterate the managed list of relay outputs
+    for (int i = 0; i < relayOutputs->Count; i++) {
+        // Unlink the relay outputs to the privilege
+        SdkCall sdkCall("IVxPrivilege::UnLink");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->UnLink(*relayOutputs[i]->_relayOutput));
+    }
+
+    // Unless there was an issue unlinking the relay outputs the result should be VxSdk::VxResult::kOK
+    return VxSdkNet::Results::Value(result);
+}
+
+VxSdkNet::Results::Value VxSdkNet::Privilege::Unlink(List<VxSdkNet::User^>^ users) {
+    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
+
+    // Iterate the managed list of users
+    for (int i = 0; i < users->Count; i++) {
+        // UnLink the data sources to the privilege
+        SdkCall sdkCall("IVxPrivilege::UnLink");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->UnLink(*users[i]->_user));
+    }
+
+    // Unless there was an issue unlinking the users the result should be VxSdk::VxResult::kOK
+    return VxSdkNet::Results::Value(result);
+}
+
+System::Object^ VxSdkNet::Privilege::_Fetch() {
+    // Privileges are only listed by their role
+    if (_role == nullptr)
+        return nullptr;
+
+    VxSdk::IVxPrivilege* vxPrivilege = BulkLink::_FetchHandle("IVxRole::GetPrivileges", _role->_role, &VxSdk::IVxRole::GetPrivileges,
+        VxSdk::VxCollectionFilterItem::kId, Id);
+    if (vxPrivilege == nullptr)
+        return nullptr;
+
+    Privilege^ privilege = IdentityMap::Wrap<VxSdkNet::Privilege>(_identityMap, vxPrivilege);
+    privilege->_role = _role;
+    return privilege;
+}
+
+VxSdkNet::ResourceLimits^ VxSdkNet::Privilege::_GetLimits() {
+    // Get the limits for this resource
+    VxSdk::VxLimits* limits = nullptr;
+    SdkCall sdkCall("IVxPrivilege::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetLimits(limits));
+
+    // Return the limits if GetLimits was successful
+    if (result == VxSdk::VxResult::kOK)
+        return gcnew ResourceLimits(limits);
+
+    return nullptr;
+}
+
+System::Collections::Generic::List<VxSdkNet::DataSource^>^ VxSdkNet::Privilege::_GetLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result) {
     // Create a list of managed data sources
     List<VxSdkNet::DataSource^>^ mlist = gcnew List<VxSdkNet::DataSource^>();
     // Create a collection of unmanaged data sources
@@ -237,18 +487,20 @@ System::Collections::Generic::List<VxSdkNet::DataSource^>^ VxSdkNet::Privilege::
         dataSources.filters = collFilters;
     }
 
-    // Make the GetUnLinked call, which will return with the total data source count, this
+    // Make the GetLinks call, which will return with the total data source count, this
     // allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _privilege->GetUnLinked(dataSources);
+    SdkCall sdkCall("IVxPrivilege::GetLinks", dataSources);
+    result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetLinks(dataSources));
     // As long as there are data sources linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDataSource collection
         dataSources.collection = new VxSdk::IVxDataSource*[dataSources.collectionSize];
-        result = _privilege->GetUnLinked(dataSources);
+        sdkCall.Restart("IVxPrivilege::GetLinks", dataSources);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetLinks(dataSources));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < dataSources.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::DataSource(dataSources.collection[i]));
+                mlist->Add(IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSources.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] dataSources.collection;
@@ -256,7 +508,7 @@ System::Collections::Generic::List<VxSdkNet::DataSource^>^ VxSdkNet::Privilege::
     return mlist;
 }
 
-System::Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::Privilege::GetUnLinkedDevices(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+System::Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::Privilege::_GetLinkedDevices(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result) {
     // Create a list of managed devices
     List<VxSdkNet::Device^>^ mlist = gcnew List<VxSdkNet::Device^>();
     // Create a collection of unmanaged devices
@@ -277,18 +529,20 @@ System::Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::Privilege::GetU
         devices.filters = collFilters;
     }
 
-    // Make the GetUnLinked call, which will return with the total device count, this allows the
+    // Make the GetLinks call, which will return with the total device count, this allows the
     // client to allocate memory.
-    VxSdk::VxResult::Value result = _privilege->GetUnLinked(devices);
+    SdkCall sdkCall("IVxPrivilege::GetLinks", devices);
+    result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetLinks(devices));
     // As long as there are devices linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDevice collection
         devices.collection = new VxSdk::IVxDevice*[devices.collectionSize];
-        result = _privilege->GetUnLinked(devices);
+        sdkCall.Restart("IVxPrivilege::GetLinks", devices);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetLinks(devices));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < devices.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::Device(devices.collection[i]));
+                mlist->Add(IdentityMap::Intern<VxSdkNet::Device>(_identityMap, devices.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] devices.collection;
@@ -296,7 +550,7 @@ System::Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::Privilege::GetU
     return mlist;
 }
 
-System::Collections::Generic::List<VxSdkNet::Drawing^>^ VxSdkNet::Privilege::GetUnLinkedDrawings(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+System::Collections::Generic::List<VxSdkNet::Drawing^>^ VxSdkNet::Privilege::_GetLinkedDrawings(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result) {
     // Create a list of managed drawings
     List<VxSdkNet::Drawing^>^ mlist = gcnew List<VxSdkNet::Drawing^>();
     // Create a collection of unmanaged drawings
@@ -319,12 +573,14 @@ System::Collections::Generic::List<VxSdkNet::Drawing^>^ VxSdkNet::Privilege::Get
 
     // Make the GetLinks call, which will return with the total drawing count, this allows the
     // client to allocate memory.
-    VxSdk::VxResult::Value result = _privilege->GetUnLinked(drawings);
+    SdkCall sdkCall("IVxPrivilege::GetLinks", drawings);
+    result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetLinks(drawings));
     // As long as there are drawings linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDrawing collection
         drawings.collection = new VxSdk::IVxDrawing*[drawings.collectionSize];
-        result = _privilege->GetUnLinked(drawings);
+        sdkCall.Restart("IVxPrivilege::GetLinks", drawings);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetLinks(drawings));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < drawings.collectionSize; i++)
@@ -336,7 +592,7 @@ System::Collections::Generic::List<VxSdkNet::Drawing^>^ VxSdkNet::Privilege::Get
     return mlist;
 }
 
-System::Collections::Generic::List<VxSdkNet::RelayOutput^>^ VxSdkNet::Privilege::GetUnLinkedRelayOutputs(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+System::Collections::Generic::List<VxSdkNet::RelayOutput^>^ VxSdkNet::Privilege::_GetLinkedRelayOutputs(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result) {
     // Create a list of managed relay outputs
     List<VxSdkNet::RelayOutput^>^ mlist = gcnew List<VxSdkNet::RelayOutput^>();
     // Create a collection of unmanaged relay outputs
@@ -359,16 +615,18 @@ System::Collections::Generic::List<VxSdkNet::RelayOutput^>^ VxSdkNet::Privilege:
 
     // Make the GetLinks call, which will return with the total relay output count, this allows the
     // client to allocate memory.
-    VxSdk::VxResult::Value result = _privilege->GetUnLinked(relayOutputs);
+    SdkCall sdkCall("IVxPrivilege::GetLinks", relayOutputs);
+    result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetLinks(relayOutputs));
     // As long as there are relay outputs linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxRelayOutput collection
         relayOutputs.collection = new VxSdk::IVxRelayOutput*[relayOutputs.collectionSize];
-        result = _privilege->GetUnLinked(relayOutputs);
+        sdkCall.Restart("IVxPrivilege::GetLinks", relayOutputs);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetLinks(relayOutputs));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < relayOutputs.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::RelayOutput(relayOutputs.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::RelayOutput>(_identityMap, relayOutputs.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] relayOutputs.collection;
@@ -376,7 +634,7 @@ System::Collections::Generic::List<VxSdkNet::RelayOutput^>^ VxSdkNet::Privilege:
     return mlist;
 }
 
-System::Collections::Generic::List<VxSdkNet::User^>^ VxSdkNet::Privilege::GetUnLinkedUsers(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
+System::Collections::Generic::List<VxSdkNet::User^>^ VxSdkNet::Privilege::_GetLinkedUsers(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result) {
     // Create a list of managed users
     List<VxSdkNet::User^>^ mlist = gcnew List<VxSdkNet::User^>();
     // Create a collection of unmanaged users
@@ -397,14 +655,16 @@ System::Collections::Generic::List<VxSdkNet::User^>^ VxSdkNet::Privilege::GetUnL
         users.filters = collFilters;
     }
 
-    // Make the GetUnLinked call, which will return with the total user count, this
+    // Make the GetLinks call, which will return with the total user count, this
     // allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _privilege->GetUnLinked(users);
+    SdkCall sdkCall("IVxPrivilege::GetLinks", users);
+    result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetLinks(users));
     // As long as there are users linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxUser collection
         users.collection = new VxSdk::IVxUser*[users.collectionSize];
-        result = _privilege->GetUnLinked(users);
+        sdkCall.Restart("IVxPrivilege::GetLinks", users);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _privilege->GetLinks(users));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < users.collectionSize; i++)
@@ -416,162 +676,48 @@ System::Collections::Generic::List<VxSdkNet::User^>^ VxSdkNet::Privilege::GetUnL
     return mlist;
 }
 
-VxSdkNet::Results::Value VxSdkNet::Privilege::Link(List<VxSdkNet::DataSource^>^ dataSources) {
-    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
-
-    // Iterate the managed list of data sources
-    for (int i = 0; i < dataSources->Count; i++) {
-        // Link the data sources to the privilege
-        result = _privilege->Link(*dataSources[i]->_dataSource);
-    }
-
-    // Unless there was an issue linking the data sources the result should be VxSdk::VxResult::kOK
-    return VxSdkNet::Results::Value(result);
-}
-
-VxSdkNet::Results::Value VxSdkNet::Privilege::Link(List<VxSdkNet::Device^>^ devices) {
-    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
-
-    // Iterate the managed list of devices
-    for (int i = 0; i < devices->Count; i++) {
-        // Link the devices to the privilege
-        result = _privilege->Link(*devices[i]->_device);
-    }
-
-    // Unless there was an issue linking the devices the result should be VxSdk::VxResult::kOK
-    return VxSdkNet::Results::Value(result);
-}
-
-VxSdkNet::Results::Value VxSdkNet::Privilege::Link(List<VxSdkNet::Drawing^>^ drawings) {
-    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
-
-    // Iterate the managed list of drawings
-    for (int i = 0; i < drawings->Count; i++) {
-        // Link the drawings to the privilege
-        result = _privilege->Link(*drawings[i]->_drawing);
-    }
-
-    // Unless there was an issue linking the drawings the result should be VxSdk::VxResult::kOK
-    return VxSdkNet::Results::Value(result);
-}
-
-VxSdkNet::Results::Value VxSdkNet::Privilege::Link(List<VxSdkNet::RelayOutput^>^ relayOutputs) {
-    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
-
-    // Iterate the managed list of relay outputs
-    for (int i = 0; i < relayOutputs->Count; i++) {
-        // Link the relay outputs to the privilege
-        result = _privilege->Link(*relayOutputs[i]->_relayOutput);
-    }
-
-    // Unless there was an issue linking the relay outputs the result should be VxSdk::VxResult::kOK
-    return VxSdkNet::Results::Value(result);
-}
-
-VxSdkNet::Results::Value VxSdkNet::Privilege::Link(List<VxSdkNet::User^>^ users) {
-    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
-
-    // Iterate the managed list of users
-    for (int i = 0; i < users->Count; i++) {
-        // Link the users to the privilege
-        result = _privilege->Link(*users[i]->_user);
-    }
-
-    // Unless there was an issue linking the users the result should be VxSdk::VxResult::kOK
-    return VxSdkNet::Results::Value(result);
+int VxSdkNet::Privilege::_GetPriority() {
+    // Get and return the priority
+    int priority;
+    _privilege->GetPriority(priority);
+    return priority;
 }
 
-VxSdkNet::Results::Value VxSdkNet::Privilege::Refresh() {
-    return (VxSdkNet::Results::Value)_privilege->Refresh();
+bool VxSdkNet::Privilege::_GetRestricted() {
+    // Get and return the restriction state
+    bool isRestricted;
+    _privilege->GetRestricted(isRestricted);
+    return isRestricted;
 }
 
-VxSdkNet::Results::Value VxSdkNet::Privilege::Unlink(List<VxSdkNet::DataSource^>^ dataSources) {
-    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
-
-    // Iterate the managed list of data sources
-    for (int i = 0; i < dataSources->Count; i++) {
-        // UnLink the data sources to the privilege
-        result = _privilege->UnLink(*dataSources[i]->_dataSource);
-    }
-
-    // Unless there was an issue unlinking the data sources the result should be VxSdk::VxResult::kOK
+VxSdkNet::Results::Value VxSdkNet::Privilege::_LinkDataSource(System::Object^ item, bool link) {
+    DataSource^ dataSource = safe_cast<DataSource^>(item);
+    NativeReadLock nativeLock(dataSource->_nativeLock);
+    VxSdk::VxResult::Value result = link ? _privilege->Link(*dataSource->_dataSource) : _privilege->UnLink(*dataSource->_dataSource);
     return VxSdkNet::Results::Value(result);
 }
 
-VxSdkNet::Results::Value VxSdkNet::Privilege::Unlink(List<VxSdkNet::Device^>^ devices) {
-    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
-
-    // Iterate the managed list of devices
-    for (int i = 0; i < devices->Count; i++) {
-        // UnLink the devices to the privilege
-        result = _privilege->UnLink(*devices[i]->_device);
-    }
-
-    // Unless there was an issue unlinking the devices the result should be VxSdk::VxResult::kOK
+VxSdkNet::Results::Value VxSdkNet::Privilege::_LinkDevice(System::Object^ item, bool link) {
+    Device^ device = safe_cast<Device^>(item);
+    NativeReadLock nativeLock(device->_nativeLock);
+    VxSdk::VxResult::Value result = link ? _privilege->Link(*device->_device) : _privilege->UnLink(*device->_device);
     return VxSdkNet::Results::Value(result);
 }
 
-VxSdkNet::Results::Value VxSdkNet::Privilege::Unlink(List<VxSdkNet::Drawing^>^ drawings) {
-    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
-
-    // Iterate the managed list of drawings
-    for (int i = 0; i < drawings->Count; i++) {
-        // Unlink the drawings to the privilege
-        result = _privilege->UnLink(*drawings[i]->_drawing);
-    }
-
-    // Unless there was an issue unlinking the drawings the result should be VxSdk::VxResult::kOK
+VxSdkNet::Results::Value VxSdkNet::Privilege::_LinkDrawing(System::Object^ item, bool link) {
+    Drawing^ drawing = safe_cast<Drawing^>(item);
+    VxSdk::VxResult::Value result = link ? _privilege->Link(*drawing->_drawing) : _privilege->UnLink(*drawing->_drawing);
     return VxSdkNet::Results::Value(result);
 }
 
-VxSdkNet::Results::Value VxSdkNet::Privilege::Unlink(List<VxSdkNet::RelayOutput^>^ relayOutputs) {
-    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
-
-    // Iterate the managed list of relay outputs
-    for (int i = 0; i < relayOutputs->Count; i++) {
-        // Unlink the relay outputs to the privilege
-        result = _privilege->UnLink(*relayOutputs[i]->_relayOutput);
-    }
-
-    // Unless there was an issue unlinking the relay outputs the result should be VxSdk::VxResult::kOK
+VxSdkNet::Results::Value VxSdkNet::Privilege::_LinkRelayOutput(System::Object^ item, bool link) {
+    RelayOutput^ relayOutput = safe_cast<RelayOutput^>(item);
+    VxSdk::VxResult::Value result = link ? _privilege->Link(*relayOutput->_relayOutput) : _privilege->UnLink(*relayOutput->_relayOutput);
     return VxSdkNet::Results::Value(result);
 }
 
-VxSdkNet::Results::Value VxSdkNet::Privilege::Unlink(List<VxSdkNet::User^>^ users) {
-    VxSdk::VxResult::Value result = VxSdk::VxResult::kUnknownError;
-
-    // Iterate the managed list of users
-    for (int i = 0; i < users->Count; i++) {
-        // UnLink the data sources to the privilege
-        result = _privilege->UnLink(*users[i]->_user);
-    }
-
-    // Unless there was an issue unlinking the users the result should be VxSdk::VxResult::kOK
+VxSdkNet::Results::Value VxSdkNet::Privilege::_LinkUser(System::Object^ item, bool link) {
+    User^ user = safe_cast<User^>(item);
+    VxSdk::VxResult::Value result = link ? _privilege->Link(*user->_user) : _privilege->UnLink(*user->_user);
     return VxSdkNet::Results::Value(result);
 }
-
-VxSdkNet::ResourceLimits^ VxSdkNet::Privilege::_GetLimits() {
-    // Get the limits for this resource
-    VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _privilege->GetLimits(limits);
-
-    // Return the limits if GetLimits was successful
-    if (result == VxSdk::VxResult::kOK)
-        return gcnew ResourceLimits(limits);
-
-    return nullptr;
-}
-
-int VxSdkNet::Privilege::_GetPriority() {
-    // Get and return the priority
-    int priority;
-    _privilege->GetPriority(priority);
-    return priority;
-}
-
-bool VxSdkNet::Privilege::_GetRestricted() {
-    // Get and return the restriction state
-    bool isRestricted;
-    _privilege->GetRestricted(isRestricted);
-    return isRestricted;
-}
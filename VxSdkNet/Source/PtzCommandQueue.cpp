@@ -0,0 +1,200 @@
+/// <summary>
+/// Implements the ptz command queue class.
+/// </summary>
+#include <msclr/lock.h>
+#include "PtzCommandQueue.h"
+
+using namespace System;
+using namespace System::Diagnostics;
+using namespace System::Threading;
+
+VxSdkNet::PtzCommand::PtzCommand(Kinds kind, int x, int y, int z) {
+    Kind = kind;
+    X = x;
+    Y = y;
+    Z = z;
+    QueuedAt = Stopwatch::GetTimestamp();
+}
+
+VxSdkNet::PtzCommandQueue::PtzCommandQueue(PtzController^ ptzController) {
+    _ptzController = ptzController;
+    _pending = gcnew array<PtzCommand^>(3);
+    _wake = gcnew AutoResetEvent(false);
+    _idle = gcnew ManualResetEvent(true);
+    _lastResult = Results::Value::OK;
+    MinSendInterval = 50;
+}
+
+VxSdkNet::PtzCommandQueue::!PtzCommandQueue() {
+    // Stop the dispatcher; move, focus and iris commands not yet sent are discarded
+    msclr::lock queueLock(this);
+    _isDisposed = true;
+    _wake->Set();
+}
+
+void VxSdkNet::PtzCommandQueue::ContinuousFocus(PtzController::FocusDirections focusDirection) {
+    _Enqueue(gcnew PtzCommand(PtzCommand::Kinds::Focus, int(focusDirection), 0, 0));
+}
+
+void VxSdkNet::PtzCommandQueue::ContinuousFocusAtSpeed(int focusSpeed) {
+    _Enqueue(gcnew PtzCommand(PtzCommand::Kinds::FocusAtSpeed, focusSpeed, 0, 0));
+}
+
+void VxSdkNet::PtzCommandQueue::ContinuousIris(PtzController::IrisDirections irisDirection) {
+    _Enqueue(gcnew PtzCommand(PtzCommand::Kinds::Iris, int(irisDirection), 0, 0));
+}
+
+void VxSdkNet::PtzCommandQueue::ContinuousIrisAtSpeed(int irisSpeed) {
+    _Enqueue(gcnew PtzCommand(PtzCommand::Kinds::IrisAtSpeed, irisSpeed, 0, 0));
+}
+
+void VxSdkNet::PtzCommandQueue::ContinuousMove(int speedX, int speedY, PtzController::ZoomDirections inOut) {
+    _Enqueue(gcnew PtzCommand(PtzCommand::Kinds::Move, speedX, speedY, int(inOut)));
+}
+
+void VxSdkNet::PtzCommandQueue::ContinuousMoveAtSpeed(int speedX, int speedY, int speedZ) {
+    _Enqueue(gcnew PtzCommand(PtzCommand::Kinds::MoveAtSpeed, speedX, speedY, speedZ));
+}
+
+void VxSdkNet::PtzCommandQueue::Stop() {
+    _Enqueue(gcnew PtzCommand(PtzCommand::Kinds::Stop, 0, 0, 0));
+}
+
+bool VxSdkNet::PtzCommandQueue::WaitAll(TimeSpan timeout) {
+    return _idle->WaitOne(timeout);
+}
+
+TimeSpan VxSdkNet::PtzCommandQueue::AverageLatency::get() {
+    long long sentCount = Interlocked::Read(_sentCount);
+    if (sentCount == 0)
+        return TimeSpan::Zero;
+
+    return TimeSpan::FromSeconds(static_cast<double>(Interlocked::Read(_totalLatency)) / sentCount / Stopwatch::Frequency);
+}
+
+TimeSpan VxSdkNet::PtzCommandQueue::MaxLatency::get() {
+    return TimeSpan::FromSeconds(static_cast<double>(Interlocked::Read(_maxLatency)) / Stopwatch::Frequency);
+}
+
+void VxSdkNet::PtzCommandQueue::_Dispatch() {
+    while (true) {
+        PtzCommand^ command = nullptr;
+        int delay = 0;
+        {
+            msclr::lock queueLock(this);
+            // Once disposed only a stop that is still waiting is sent, so the camera is not left moving
+            if (_isDisposed)
+                Array::Clear(_pending, 0, _pending->Length);
+
+            // A stop goes ahead of everything else and is not held back by the send interval
+            if (_stop != nullptr) {
+                command = _stop;
+                _stop = nullptr;
+            }
+            else {
+                // Send the longest waiting command once the send interval has elapsed
+                int slot = -1;
+                for (int i = 0; i < _pending->Length; i++) {
+                    if (_pending[i] != nullptr && (slot < 0 || _pending[i]->QueuedAt < _pending[slot]->QueuedAt))
+                        slot = i;
+                }
+
+                // Exit once there is nothing left to send; a new dispatcher is started by the next command
+                if (slot < 0) {
+                    _dispatcher = nullptr;
+                    _idle->Set();
+                    return;
+                }
+
+                long long elapsed = (Stopwatch::GetTimestamp() - _lastSentAt) * 1000 / Stopwatch::Frequency;
+                if (elapsed < MinSendInterval)
+                    delay = static_cast<int>(MinSendInterval - elapsed);
+                else {
+                    command = _pending[slot];
+                    _pending[slot] = nullptr;
+                }
+            }
+        }
+
+        // Wait outside the lock so that newer commands can still replace the pending ones
+        if (command == nullptr) {
+            _wake->WaitOne(delay);
+            continue;
+        }
+
+        long long sentAt = Stopwatch::GetTimestamp();
+        long long latency = sentAt - command->QueuedAt;
+        Interlocked::Add(_totalLatency, latency);
+        long long currentMax = Interlocked::Read(_maxLatency);
+        while (latency > currentMax) {
+            long long previous = Interlocked::CompareExchange(_maxLatency, latency, currentMax);
+            if (previous == currentMax)
+                break;
+
+            currentMax = previous;
+        }
+
+        _lastSentAt = sentAt;
+        _lastResult = _Send(command);
+        Interlocked::Increment(_sentCount);
+    }
+}
+
+void VxSdkNet::PtzCommandQueue::_Enqueue(PtzCommand^ command) {
+    msclr::lock queueLock(this);
+    if (_isDisposed)
+        return;
+
+    // A stop discards every command not yet sent, and any other command replaces the one of the same kind
+    if (command->Kind == PtzCommand::Kinds::Stop) {
+        for (int i = 0; i < _pending->Length; i++) {
+            if (_pending[i] != nullptr)
+                Interlocked::Increment(_droppedCount);
+
+            _pending[i] = nullptr;
+        }
+
+        if (_stop != nullptr)
+            Interlocked::Increment(_droppedCount);
+
+        _stop = command;
+    }
+    else {
+        int slot = static_cast<int>(command->Kind) / 2;
+        if (_pending[slot] != nullptr)
+            Interlocked::Increment(_droppedCount);
+
+        _pending[slot] = command;
+    }
+
+    _idle->Reset();
+
+    // Start the dispatcher if it is not already running
+    if (_dispatcher == nullptr) {
+        _dispatcher = gcnew Thread(gcnew ThreadStart(this, &VxSdkNet::PtzCommandQueue::_Dispatch));
+        _dispatcher->IsBackground = true;
+        _dispatcher->Name = "PtzCommandQueue";
+        _dispatcher->Start();
+    }
+
+    _wake->Set();
+}
+
+VxSdkNet::Results::Value VxSdkNet::PtzCommandQueue::_Send(PtzCommand^ command) {
+    switch (command->Kind) {
+    case PtzCommand::Kinds::Move:
+        return _ptzController->ContinuousMove(command->X, command->Y, PtzController::ZoomDirections(command->Z));
+    case PtzCommand::Kinds::MoveAtSpeed:
+        return _ptzController->ContinuousMoveAtSpeed(command->X, command->Y, command->Z);
+    case PtzCommand::Kinds::Focus:
+        return _ptzController->ContinuousFocus(PtzController::FocusDirections(command->X));
+    case PtzCommand::Kinds::FocusAtSpeed:
+        return _ptzController->ContinuousFocusAtSpeed(command->X);
+    case PtzCommand::Kinds::Iris:
+        return _ptzController->ContinuousIris(PtzController::IrisDirections(command->X));
+    case PtzCommand::Kinds::IrisAtSpeed:
+        return _ptzController->ContinuousIrisAtSpeed(command->X);
+    default:
+        return _ptzController->Stop();
+    }
+}
@@ -3,45 +3,52 @@
 /// </summary>
 #include "PtzController.h"
 #include "NewDigitalPtzPreset.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::PtzController::PtzController(VxSdk::IVxPtzController* ptzController) {
     _ptzController = ptzController;
+    NativeMemory::Add(_ptzController);
 }
 
 VxSdkNet::PtzController::!PtzController() {
-    _ptzController->Delete();
+    NativeReleaseQueue::Release(_ptzController);
     _ptzController = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::AbsoluteMove(int positionX, int positionY) {
     // Call AbsoluteMove and return the result
-    VxSdk::VxResult::Value result = _ptzController->AbsoluteMove(positionX, positionY);
+    SdkCall sdkCall("IVxPtzController::AbsoluteMove");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->AbsoluteMove(positionX, positionY));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::AbsoluteMove(int positionX, int positionY, int positionZ) {
     // Call AbsoluteMove and return the result
-    VxSdk::VxResult::Value result = _ptzController->AbsoluteMove(positionX, positionY, positionZ);
+    SdkCall sdkCall("IVxPtzController::AbsoluteMove");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->AbsoluteMove(positionX, positionY, positionZ));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::AbsolutePan(int positionX) {
     // Call AbsolutePan and return the result
-    VxSdk::VxResult::Value result = _ptzController->AbsolutePan(positionX);
+    SdkCall sdkCall("IVxPtzController::AbsolutePan");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->AbsolutePan(positionX));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::AbsoluteTilt(int positionY) {
     // Call AbsoluteTilt and return the result
-    VxSdk::VxResult::Value result = _ptzController->AbsoluteTilt(positionY);
+    SdkCall sdkCall("IVxPtzController::AbsoluteTilt");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->AbsoluteTilt(positionY));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::AbsoluteZoom(int positionZ) {
     // Call AbsoluteZoom and return the result
-    VxSdk::VxResult::Value result = _ptzController->AbsoluteZoom(positionZ);
+    SdkCall sdkCall("IVxPtzController::AbsoluteZoom");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->AbsoluteZoom(positionZ));
     return VxSdkNet::Results::Value(result);
 }
 
@@ -54,56 +61,65 @@ VxSdkNet::Results::Value VxSdkNet::PtzController::AddDigitalPreset(VxSdkNet::New
     vxNewDigitalPtzPreset.z = newDigitalPtzPreset->Z;
 
     // Make the call to add the digital PTZ preset
-    VxSdk::VxResult::Value result = _ptzController->AddDigitalPreset(vxNewDigitalPtzPreset);
+    SdkCall sdkCall("IVxPtzController::AddDigitalPreset");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->AddDigitalPreset(vxNewDigitalPtzPreset));
     // Unless there was an issue creating the digital PTZ preset the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::AddPreset(int index) {
     // Call AddPreset and return the result
-    VxSdk::VxResult::Value result = _ptzController->AddPreset(index);
+    SdkCall sdkCall("IVxPtzController::AddPreset");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->AddPreset(index));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::ContinuousFocus(VxSdkNet::PtzController::FocusDirections nearFar) {
     // Call ContinuousFocus and return the result
-    VxSdk::VxResult::Value result = _ptzController->ContinuousFocus((VxSdk::VxFocusDirection::Value)nearFar);
+    SdkCall sdkCall("IVxPtzController::ContinuousFocus");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->ContinuousFocus((VxSdk::VxFocusDirection::Value)nearFar));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::ContinuousFocusAtSpeed(int focusSpeed) {
     // Call ContinuousFocusAtSpeed and return the result
-    VxSdk::VxResult::Value result = _ptzController->ContinuousFocusAtSpeed(focusSpeed);
+    SdkCall sdkCall("IVxPtzController::ContinuousFocusAtSpeed");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->ContinuousFocusAtSpeed(focusSpeed));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::ContinuousIris(VxSdkNet::PtzController::IrisDirections openClose) {
     // Call ContinuousIris and return the result
-    VxSdk::VxResult::Value result = _ptzController->ContinuousIris((VxSdk::VxIrisDirection::Value)openClose);
+    SdkCall sdkCall("IVxPtzController::ContinuousIris");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->ContinuousIris((VxSdk::VxIrisDirection::Value)openClose));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::ContinuousIrisAtSpeed(int irisSpeed) {
     // Call ContinuousIrisAtSpeed and return the result
-    VxSdk::VxResult::Value result = _ptzController->ContinuousIrisAtSpeed(irisSpeed);
+    SdkCall sdkCall("IVxPtzController::ContinuousIrisAtSpeed");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->ContinuousIrisAtSpeed(irisSpeed));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::ContinuousMove(int speedX, int speedY, VxSdkNet::PtzController::ZoomDirections inOut) {
     // Call ContinuousMove and return the result
-    VxSdk::VxResult::Value result = _ptzController->ContinuousMove(speedX, speedY, (VxSdk::VxZoomDirection::Value)inOut);
+    SdkCall sdkCall("IVxPtzController::ContinuousMove");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->ContinuousMove(speedX, speedY, (VxSdk::VxZoomDirection::Value)inOut));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::ContinuousMoveAtSpeed(int speedX, int speedY, int speedZ) {
     // Call ContinuousMoveAtSpeed and return the result
-    VxSdk::VxResult::Value result = _ptzController->ContinuousMoveAtSpeed(speedX, speedY, speedZ);
+    SdkCall sdkCall("IVxPtzController::ContinuousMoveAtSpeed");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->ContinuousMoveAtSpeed(speedX, speedY, speedZ));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::DeletePreset(Preset^ preset) {
     // Call DeletePreset and return the result
-    VxSdk::VxResult::Value result = _ptzController->DeletePreset(*preset->_preset);
+    SdkCall sdkCall("IVxPtzController::DeletePreset");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->DeletePreset(*preset->_preset));
     return VxSdkNet::Results::Value(result);
 }
 
@@ -129,12 +145,14 @@ List<VxSdkNet::Pattern^>^ VxSdkNet::PtzController::GetPatterns(System::Collectio
     }
 
     // Make the GetPatterns call, which will return with the total pattern count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _ptzController->GetPatterns(patterns);
+    SdkCall sdkCall("IVxPtzController::GetPatterns", patterns);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->GetPatterns(patterns));
     // As long as the datasource has at least one pattern the GetPatterns call should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Fill the array of pointers to the proper size as determined by the previous GetPatterns call
         patterns.collection = new VxSdk::IVxPattern*[patterns.collectionSize];
-        result = _ptzController->GetPatterns(patterns);
+        sdkCall.Restart("IVxPtzController::GetPatterns", patterns);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->GetPatterns(patterns));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < patterns.collectionSize; i++)
@@ -168,12 +186,14 @@ List<VxSdkNet::Preset^>^ VxSdkNet::PtzController::GetPresets(System::Collections
     }
 
     // Make the GetPresets call, which will return with the total preset count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _ptzController->GetPresets(presets);
+    SdkCall sdkCall("IVxPtzController::GetPresets", presets);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->GetPresets(presets));
     // As long as the datasource has at least one preset the GetPresets call should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Fill the array of pointers to the proper size as determined by the previous GetPresets call
         presets.collection = new VxSdk::IVxPreset*[presets.collectionSize];
-        result = _ptzController->GetPresets(presets);
+        sdkCall.Restart("IVxPtzController::GetPresets", presets);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->GetPresets(presets));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < presets.collectionSize; i++)
@@ -186,67 +206,78 @@ List<VxSdkNet::Preset^>^ VxSdkNet::PtzController::GetPresets(System::Collections
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::Refresh() {
-    return (VxSdkNet::Results::Value)_ptzController->Refresh();
+    SdkCall sdkCall("IVxPtzController::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::RelativeMove(int deltaX, int deltaY, int deltaZ) {
     // Call RelativeMove and return the result
-    VxSdk::VxResult::Value result = _ptzController->RelativeMove(deltaX, deltaY, deltaZ);
+    SdkCall sdkCall("IVxPtzController::RelativeMove");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->RelativeMove(deltaX, deltaY, deltaZ));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::RelativePercentageMove(int percentageX, int percentageY) {
     // Call RelativePercentageMove and return the result
-    VxSdk::VxResult::Value result = _ptzController->RelativePercentageMove(percentageX, percentageY);
+    SdkCall sdkCall("IVxPtzController::RelativePercentageMove");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->RelativePercentageMove(percentageX, percentageY));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::RelativePercentageMove(int percentageX, int percentageY, int percentageZ) {
     // Call RelativePercentageMove and return the result
-    VxSdk::VxResult::Value result = _ptzController->RelativePercentageMove(percentageX, percentageY, percentageZ);
+    SdkCall sdkCall("IVxPtzController::RelativePercentageMove");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->RelativePercentageMove(percentageX, percentageY, percentageZ));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::RepositionPreset(Preset^ preset) {
     // Call RepositionPreset and return the result
-    VxSdk::VxResult::Value result = _ptzController->RepositionPreset(*preset->_preset);
+    SdkCall sdkCall("IVxPtzController::RepositionPreset");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->RepositionPreset(*preset->_preset));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::Stop() {
     // Call PtzStop and return the result
-    VxSdk::VxResult::Value result = _ptzController->PtzStop();
+    SdkCall sdkCall("IVxPtzController::PtzStop");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->PtzStop());
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::TriggerPattern(Pattern^ pattern) {
     // Call TriggerPattern and return the result
-    VxSdk::VxResult::Value result = _ptzController->TriggerPattern(*pattern->_pattern);
+    SdkCall sdkCall("IVxPtzController::TriggerPattern");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->TriggerPattern(*pattern->_pattern));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::TriggerPreset(int index) {
     // Call TriggerPreset and return the result
-    VxSdk::VxResult::Value result = _ptzController->TriggerPreset(index);
+    SdkCall sdkCall("IVxPtzController::TriggerPreset");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->TriggerPreset(index));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::TriggerPreset(Preset^ preset) {
     // Call TriggerPreset and return the result
-    VxSdk::VxResult::Value result = _ptzController->TriggerPreset(*preset->_preset);
+    SdkCall sdkCall("IVxPtzController::TriggerPreset");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->TriggerPreset(*preset->_preset));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzController::TriggerRefresh() {
     // Call TriggerRefresh and return the result
-    VxSdk::VxResult::Value result = _ptzController->TriggerRefresh();
+    SdkCall sdkCall("IVxPtzController::TriggerRefresh");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->TriggerRefresh());
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::PtzController::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _ptzController->GetLimits(limits);
+    SdkCall sdkCall("IVxPtzController::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -258,7 +289,8 @@ VxSdkNet::ResourceLimits^ VxSdkNet::PtzController::_GetLimits() {
 VxSdkNet::PtzLimits^ VxSdkNet::PtzController::_GetPtzLimits() {
     // Get the ptz limit values from the ptz controller
     VxSdk::VxPtzLimits* ptzLimits = nullptr;
-    VxSdk::VxResult::Value result = _ptzController->GetPtzLimits(ptzLimits);
+    SdkCall sdkCall("IVxPtzController::GetPtzLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->GetPtzLimits(ptzLimits));
 
     // Return the ptz limits if GetPtzLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -270,7 +302,8 @@ VxSdkNet::PtzLimits^ VxSdkNet::PtzController::_GetPtzLimits() {
 VxSdkNet::PtzLock^ VxSdkNet::PtzController::_GetPtzLock() {
     // Get the ptz lock which allows the client to make lock the ptz controller
     VxSdk::IVxPtzLock* ptzLock = nullptr;
-    VxSdk::VxResult::Value result = _ptzController->GetPtzLock(ptzLock);
+    SdkCall sdkCall("IVxPtzController::GetPtzLock");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzController->GetPtzLock(ptzLock));
 
     // Return the ptz lock if GetPtzLock was successful
     if (result == VxSdk::VxResult::kOK)
@@ -2,29 +2,34 @@
 /// Implements the ptz lock class.
 /// </summary>
 #include "PtzLock.h"
+#include "NativeReleaseQueue.h"
 
 VxSdkNet::PtzLock::PtzLock(VxSdk::IVxPtzLock* vxPtzLock) {
     _ptzLock = vxPtzLock;
+    NativeMemory::Add(_ptzLock);
 }
 
 VxSdkNet::PtzLock::!PtzLock() {
-    _ptzLock->Delete();
+    NativeReleaseQueue::Release(_ptzLock);
     _ptzLock = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzLock::Lock(int expireTime) {
     // Call Lock and return the result
-    VxSdk::VxResult::Value result = _ptzLock->Lock(expireTime);
+    SdkCall sdkCall("IVxPtzLock::Lock");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzLock->Lock(expireTime));
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzLock::Refresh() {
-    return (VxSdkNet::Results::Value)_ptzLock->Refresh();
+    SdkCall sdkCall("IVxPtzLock::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzLock->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::PtzLock::Unlock() {
     // Call Unlock and return the result
-    VxSdk::VxResult::Value result = _ptzLock->Unlock();
+    SdkCall sdkCall("IVxPtzLock::Unlock");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzLock->Unlock());
     return VxSdkNet::Results::Value(result);
 }
 
@@ -38,7 +43,8 @@ int VxSdkNet::PtzLock::_GetExpireTime() {
 VxSdkNet::ResourceLimits^ VxSdkNet::PtzLock::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _ptzLock->GetLimits(limits);
+    SdkCall sdkCall("IVxPtzLock::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzLock->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -61,7 +67,8 @@ System::String^ VxSdkNet::PtzLock::_GetOwner() {
     // The owner can be empty if the ptz controller is not currently locked. If that is the case then the result
     // returned will be VxSdk::VxResult::kOk and owner will remain a nullptr. Otherwise the return is
     // VxSdk::VxResult::kInsufficientSize
-    VxSdk::VxResult::Value result = _ptzLock->GetOwner(owner, size);
+    SdkCall sdkCall("IVxPtzLock::GetOwner");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _ptzLock->GetOwner(owner, size));
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for owner
         owner = new char[size];
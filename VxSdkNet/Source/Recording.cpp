@@ -2,30 +2,34 @@
 /// Implements the recording class.
 /// </summary>
 #include "Recording.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Recording::Recording(VxSdk::IVxRecording* vxRecording) {
     _recording = vxRecording;
+    NativeMemory::Add(_recording);
 }
 
 VxSdkNet::Recording::!Recording() {
-    _recording->Delete();
+    NativeReleaseQueue::Release(_recording);
     _recording = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Recording::Refresh() {
-    return (VxSdkNet::Results::Value)_recording->Refresh();
+    SdkCall sdkCall("IVxRecording::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _recording->Refresh());
 }
 
 VxSdkNet::DataSource^ VxSdkNet::Recording::_GetDataSource() {
     // Get the data source
     VxSdk::IVxDataSource* dataSource = nullptr;
-    VxSdk::VxResult::Value result = _recording->GetDataSource(dataSource);
+    SdkCall sdkCall("IVxRecording::GetDataSource");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _recording->GetDataSource(dataSource));
 
     // Return the data source if GetDataSource was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::DataSource(dataSource);
+        return IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSource);
 
     return nullptr;
 }
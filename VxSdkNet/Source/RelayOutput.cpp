@@ -3,30 +3,34 @@
 /// </summary>
 #include "Device.h"
 #include "RelayOutput.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::RelayOutput::RelayOutput(VxSdk::IVxRelayOutput* vxRelayOutput) {
     _relayOutput = vxRelayOutput;
+    NativeMemory::Add(_relayOutput);
 }
 
 VxSdkNet::RelayOutput::!RelayOutput() {
-    _relayOutput->Delete();
+    NativeReleaseQueue::Release(_relayOutput);
     _relayOutput = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::RelayOutput::Refresh() {
-    return (VxSdkNet::Results::Value)_relayOutput->Refresh();
+    SdkCall sdkCall("IVxRelayOutput::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _relayOutput->Refresh());
 }
 
 VxSdkNet::Device^ VxSdkNet::RelayOutput::_GetHostDevice() {
     // Get the host device
     VxSdk::IVxDevice* device = nullptr;
-    VxSdk::VxResult::Value result = _relayOutput->GetHostDevice(device);
+    SdkCall sdkCall("IVxRelayOutput::GetHostDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _relayOutput->GetHostDevice(device));
 
     // Return the host device if GetHostDevice was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::Device(device);
+        return IdentityMap::Intern<VxSdkNet::Device>(_identityMap, device);
 
     return nullptr;
 }
@@ -34,7 +38,8 @@ VxSdkNet::Device^ VxSdkNet::RelayOutput::_GetHostDevice() {
 VxSdkNet::ResourceLimits^ VxSdkNet::RelayOutput::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _relayOutput->GetLimits(limits);
+    SdkCall sdkCall("IVxRelayOutput::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _relayOutput->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
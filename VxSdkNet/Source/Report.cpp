@@ -2,20 +2,23 @@
 /// Implements the bookmark class.
 /// </summary>
 #include "Report.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Report::Report(VxSdk::IVxReport* vxReport) {
     _report = vxReport;
+    NativeMemory::Add(_report);
 }
 
 VxSdkNet::Report::!Report() {
-    _report->Delete();
+    NativeReleaseQueue::Release(_report);
     _report = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Report::Refresh() {
-    return (VxSdkNet::Results::Value)_report->Refresh();
+    SdkCall sdkCall("IVxReport::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _report->Refresh());
 }
 
 
@@ -25,7 +28,8 @@ System::String^ VxSdkNet::Report::_GetReportEndpoint() {
 
     // If the report uri is not available the result will return VxSdk::VxResult::kActionUnavailable,
     // otherwise VxSdk::VxResult::kInsufficientSize
-    VxSdk::VxResult::Value result = _report->GetReportEndpoint(reportEndpoint, size);
+    SdkCall sdkCall("IVxReport::GetReportEndpoint");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _report->GetReportEndpoint(reportEndpoint, size));
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for reportEndpoint
         reportEndpoint = new char[size];
@@ -38,7 +42,8 @@ System::String^ VxSdkNet::Report::_GetReportEndpoint() {
 VxSdkNet::ReportTemplate^ VxSdkNet::Report::_GetReportTemplate() {
     // Get the report template
     VxSdk::IVxReportTemplate* reportTemplate = nullptr;
-    VxSdk::VxResult::Value result = _report->GetReportTemplate(reportTemplate);
+    SdkCall sdkCall("IVxReport::GetReportTemplate");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _report->GetReportTemplate(reportTemplate));
 
     // Return the report template if GetReportTemplate was successful
     if (result == VxSdk::VxResult::kOK)
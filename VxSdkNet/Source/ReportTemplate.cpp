@@ -3,26 +3,30 @@
 /// </summary>
 #include "ReportTemplate.h"
 #include "IVxReportTemplate.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::ReportTemplate::ReportTemplate(VxSdk::IVxReportTemplate* vxReportTemplate) {
     _reportTemplate = vxReportTemplate;
+    NativeMemory::Add(_reportTemplate);
 }
 
 VxSdkNet::ReportTemplate::!ReportTemplate() {
-    _reportTemplate->Delete();
+    NativeReleaseQueue::Release(_reportTemplate);
     _reportTemplate = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::ReportTemplate::Refresh() {
-    return (VxSdkNet::Results::Value)_reportTemplate->Refresh();
+    SdkCall sdkCall("IVxReportTemplate::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _reportTemplate->Refresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::ReportTemplate::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _reportTemplate->GetLimits(limits);
+    SdkCall sdkCall("IVxReportTemplate::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _reportTemplate->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -36,7 +40,8 @@ VxSdkNet::Results::Value VxSdkNet::ReportTemplate::_SetStorageLocation(NetworkSt
     VxSdk::Utilities::StrCopySafe(vxNetworkStorageInfo.password, Utils::ConvertCSharpString(storageInfo->Password).c_str());
     VxSdk::Utilities::StrCopySafe(vxNetworkStorageInfo.path, Utils::ConvertCSharpString(storageInfo->Path).c_str());
     VxSdk::Utilities::StrCopySafe(vxNetworkStorageInfo.username, Utils::ConvertCSharpString(storageInfo->Username).c_str());
-    return (VxSdkNet::Results::Value)_reportTemplate->SetStorageLocation(vxNetworkStorageInfo);
+    SdkCall sdkCall("IVxReportTemplate::SetStorageLocation");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _reportTemplate->SetStorageLocation(vxNetworkStorageInfo));
 }
 
 List<VxSdkNet::TimeRange::DayOfWeek>^ VxSdkNet::ReportTemplate::_GetRecurrence() {
@@ -59,7 +64,8 @@ VxSdkNet::Results::Value VxSdkNet::ReportTemplate::_SetRecurrence(List<TimeRange
     }
 
     // Attempt to set the recurrence and return the result
-    VxSdk::VxResult::Value result = _reportTemplate->SetRecurrence(items, recurrenceSize);
+    SdkCall sdkCall("IVxReportTemplate::SetRecurrence");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _reportTemplate->SetRecurrence(items, recurrenceSize));
 
     delete[] items;
     items = nullptr;
@@ -101,7 +107,8 @@ VxSdkNet::Results::Value VxSdkNet::ReportTemplate::_SetFields(List<ReportField^>
     }
 
     // Attempt to set the fields and return the result
-    VxSdk::VxResult::Value result = _reportTemplate->SetFields(vxReportFields, fieldsSize);
+    SdkCall sdkCall("IVxReportTemplate::SetFields");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _reportTemplate->SetFields(vxReportFields, fieldsSize));
 
     delete[] vxReportFields;
     vxReportFields = nullptr;
@@ -140,7 +147,8 @@ VxSdkNet::Results::Value VxSdkNet::ReportTemplate::_SetFilters(List<ReportFilter
     }
 
     // Attempt to set the filters and return the result
-    VxSdk::VxResult::Value result = _reportTemplate->SetFilters(vxReportFilters, filtersSize);
+    SdkCall sdkCall("IVxReportTemplate::SetFilters");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _reportTemplate->SetFilters(vxReportFilters, filtersSize));
 
     delete[] vxReportFilters;
     vxReportFilters = nullptr;
@@ -3,31 +3,35 @@
 /// </summary>
 
 #include "ResourceRel.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::ResourceRel::ResourceRel(VxSdk::IVxResourceRel* vxResourceRel) {
     _resourceRel = vxResourceRel;
+    NativeMemory::Add(_resourceRel);
 }
 
 VxSdkNet::ResourceRel::!ResourceRel() {
-    _resourceRel->Delete();
+    NativeReleaseQueue::Release(_resourceRel);
     _resourceRel = nullptr;
 }
 
 
 VxSdkNet::Results::Value VxSdkNet::ResourceRel::Refresh() {
-    return (VxSdkNet::Results::Value)_resourceRel->Refresh();
+    SdkCall sdkCall("IVxResourceRel::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _resourceRel->Refresh());
 }
 
 VxSdkNet::DataSource^ VxSdkNet::ResourceRel::_GetResource() {
     // Get the data source object
     VxSdk::IVxDataSource* dataSource = nullptr;
-    VxSdk::VxResult::Value result = _resourceRel->GetResource(dataSource);
+    SdkCall sdkCall("IVxResourceRel::GetResource");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _resourceRel->GetResource(dataSource));
 
     // Return the data source if GetResource was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::DataSource(dataSource);
+        return IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSource);
 
     return nullptr;
 }
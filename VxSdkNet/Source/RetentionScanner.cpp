@@ -0,0 +1,188 @@
+/// <summary>
+/// Implements the retention scanner class.
+/// </summary>
+#include <msclr/lock.h>
+#include "CoverageIndex.h"
+#include "RetentionScanner.h"
+
+using namespace System;
+using namespace System::Collections::Concurrent;
+using namespace System::Collections::Generic;
+using namespace System::Threading;
+
+VxSdkNet::RetentionScanner::RetentionScanner(VXSystem^ system) {
+    _system = system;
+    _lastScanned = DateTime::MinValue;
+    _oldestRecordings = gcnew Dictionary<String^, DateTime>();
+    _summaries = gcnew Dictionary<String^, RetentionSummary^>();
+    MaxConcurrentScans = 8;
+}
+
+void VxSdkNet::RetentionScanner::Clear() {
+    msclr::lock scannerLock(this);
+    _summaries->Clear();
+    _lastScanned = DateTime::MinValue;
+}
+
+VxSdkNet::RetentionSummary^ VxSdkNet::RetentionScanner::GetSummary(String^ dataSourceId) {
+    msclr::lock scannerLock(this);
+    RetentionSummary^ summary;
+    return _summaries->TryGetValue(dataSourceId, summary) ? summary : nullptr;
+}
+
+int VxSdkNet::RetentionScanner::Scan(bool incremental, SummaryDelegate^ callback) {
+    DateTime scanTime = DateTime::UtcNow;
+    bool isFullScan = !incremental || _lastScanned == DateTime::MinValue;
+
+    // Refresh the oldest recordings of every data source, including those whose gaps will not be rescanned
+    Dictionary<String^, DateTime>^ oldestRecordings = _GetOldestRecordings();
+    {
+        msclr::lock scannerLock(this);
+        _oldestRecordings = oldestRecordings;
+        for each (RetentionSummary^ summary in _summaries->Values) {
+            DateTime oldestRecording;
+            summary->_oldestRecording = oldestRecordings->TryGetValue(summary->_dataSourceId, oldestRecording) ? oldestRecording : DateTime::MinValue;
+        }
+    }
+
+    Dictionary<Filters::Value, String^>^ filters = nullptr;
+    if (!isFullScan) {
+        filters = gcnew Dictionary<Filters::Value, String^>();
+        filters->Add(Filters::Value::ModifiedSince, Utils::ConvertCppString(Utils::ConvertCSharpDateTime(_lastScanned)));
+    }
+
+    // Data sources fetched while the identity map is enabled may be shared with the application, so are not released
+    RetentionScanJob^ job = gcnew RetentionScanJob();
+    job->IsShared = _system->Identities->Enabled;
+    job->DataSources = gcnew ConcurrentQueue<DataSource^>(_system->GetDataSources(filters));
+    job->IsShared |= _system->Identities->Enabled;
+    job->Callback = callback;
+    job->ScanTime = scanTime;
+    int scanned = job->DataSources->Count;
+
+    // Scan the data sources using a bounded number of workers
+    int workers = Math::Min(Math::Max(MaxConcurrentScans, 1), scanned);
+    if (workers > 0) {
+        job->Workers = gcnew CountdownEvent(workers);
+        for (int i = 0; i < workers; i++)
+            ThreadPool::QueueUserWorkItem(gcnew WaitCallback(this, &VxSdkNet::RetentionScanner::_RunScans), job);
+
+        job->Workers->Wait();
+    }
+
+    msclr::lock scannerLock(this);
+    if (isFullScan) {
+        // Every data source on the system was scanned, so any summary that was not has been deleted
+        List<String^>^ removed = gcnew List<String^>();
+        for each (RetentionSummary^ summary in _summaries->Values) {
+            if (summary->_lastScanned != scanTime)
+                removed->Add(summary->_dataSourceId);
+        }
+
+        for each (String^ dataSourceId in removed)
+            _summaries->Remove(dataSourceId);
+    }
+
+    _lastScanned = scanTime;
+    return scanned;
+}
+
+List<VxSdkNet::RetentionSummary^>^ VxSdkNet::RetentionScanner::Summaries::get() {
+    msclr::lock scannerLock(this);
+    return gcnew List<RetentionSummary^>(_summaries->Values);
+}
+
+Dictionary<String^, DateTime>^ VxSdkNet::RetentionScanner::_GetOldestRecordings() {
+    Dictionary<String^, DateTime>^ oldestRecordings = gcnew Dictionary<String^, DateTime>();
+    for each (DataStorage^ dataStorage in _system->DataStorages) {
+        // A data source recorded on more than one data storage takes its oldest recording on any of them
+        for each (Retention^ retention in dataStorage->Retentions) {
+            if (retention->Resource == nullptr || retention->Resource->Type != ResourceRef::ResourceType::DataSource)
+                continue;
+
+            DateTime oldestRecording;
+            if (!oldestRecordings->TryGetValue(retention->Resource->Id, oldestRecording) || retention->OldestRecording < oldestRecording)
+                oldestRecordings[retention->Resource->Id] = retention->OldestRecording;
+        }
+
+        delete dataStorage;
+    }
+
+    return oldestRecordings;
+}
+
+void VxSdkNet::RetentionScanner::_RunScans(Object^ state) {
+    RetentionScanJob^ job = safe_cast<RetentionScanJob^>(state);
+    try {
+        DataSource^ dataSource;
+        while (job->DataSources->TryDequeue(dataSource)) {
+            RetentionSummary^ summary;
+            try {
+                summary = _Scan(dataSource, job->ScanTime);
+            }
+            finally {
+                // Release each data source as soon as it is scanned so that a large system is not held in memory
+                if (!job->IsShared)
+                    delete dataSource;
+            }
+
+            {
+                msclr::lock scannerLock(this);
+                _summaries[summary->_dataSourceId] = summary;
+            }
+
+            // Pass summaries to the callback one at a time so that it does not need to be thread safe
+            if (job->Callback != nullptr) {
+                msclr::lock jobLock(job);
+                try {
+                    job->Callback(summary);
+                }
+                catch (Exception^) {
+                    // Don't let the callback's exception escape onto the worker thread
+                    Interlocked::Increment(_callbackErrors);
+                }
+            }
+        }
+    }
+    finally {
+        job->Workers->Signal();
+    }
+}
+
+VxSdkNet::RetentionSummary^ VxSdkNet::RetentionScanner::_Scan(DataSource^ dataSource, DateTime scanTime) {
+    RetentionSummary^ summary = gcnew RetentionSummary(dataSource->Id, dataSource->Name);
+    summary->_lastScanned = scanTime;
+    {
+        msclr::lock scannerLock(this);
+        DateTime oldestRecording;
+        if (_oldestRecordings->TryGetValue(summary->_dataSourceId, oldestRecording))
+            summary->_oldestRecording = oldestRecording;
+    }
+
+    // Reduce the gaps to totals as they are read, releasing each one once it has been counted
+    CoverageIndex^ gapTime = gcnew CoverageIndex(summary->_dataSourceId);
+    for each (Gap^ gap in dataSource->GetGaps(nullptr)) {
+        DateTime startTime = gap->StartTime;
+        DateTime endTime = gap->EndTime;
+        long long duration = Math::Max((endTime - startTime).Ticks, 0LL);
+
+        summary->_gapCount++;
+        int reason = static_cast<int>(gap->Reason);
+        if (reason >= 0 && reason < summary->_gapTimeByReason->Length)
+            summary->_gapTimeByReason[reason] += duration;
+
+        Gap::GapFillerStatus status = gap->GapFillingStatus;
+        if (status == Gap::GapFillerStatus::Pending) {
+            summary->_pendingGapFillCount++;
+            summary->_pendingGapFillTime += duration;
+        }
+        else if (status == Gap::GapFillerStatus::Failed)
+            summary->_failedGapFillCount++;
+
+        gapTime->Add(startTime, endTime);
+        delete gap;
+    }
+
+    summary->_totalGapTime = gapTime->TotalCoveredTime.Ticks;
+    return summary;
+}
@@ -4,15 +4,17 @@
 
 #include "Role.h"
 #include "User.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Role::Role(VxSdk::IVxRole* vxRole) {
     _role = vxRole;
+    NativeMemory::Add(_role);
 }
 
 VxSdkNet::Role::!Role() {
-    _role->Delete();
+    NativeReleaseQueue::Release(_role);
     _role = nullptr;
 }
 
@@ -22,7 +24,8 @@ VxSdkNet::Results::Value VxSdkNet::Role::AddPrivilege(VxSdkNet::NewPrivilege^ ne
     vxNewPrivilege.priority = newPrivilege->Priority;
 
     // Make the call to add the privilege to the role
-    VxSdk::VxResult::Value result = _role->AddPrivilege(vxNewPrivilege);
+    SdkCall sdkCall("IVxRole::AddPrivilege");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _role->AddPrivilege(vxNewPrivilege));
     // Unless there was an issue merging tags the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -50,12 +53,14 @@ System::Collections::Generic::List<VxSdkNet::User^>^ VxSdkNet::Role::GetUsers(Sy
 
     // Make the GetUsers call, which will return with the total user count, this
     // allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _role->GetUsers(users);
+    SdkCall sdkCall("IVxRole::GetUsers", users);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _role->GetUsers(users));
     // As long as there are users linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxUser collection
         users.collection = new VxSdk::IVxUser*[users.collectionSize];
-        result = _role->GetUsers(users);
+        sdkCall.Restart("IVxRole::GetUsers", users);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _role->GetUsers(users));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < users.collectionSize; i++)
@@ -68,7 +73,8 @@ System::Collections::Generic::List<VxSdkNet::User^>^ VxSdkNet::Role::GetUsers(Sy
 }
 
 VxSdkNet::Results::Value VxSdkNet::Role::Refresh() {
-    return (VxSdkNet::Results::Value)_role->Refresh();
+    SdkCall sdkCall("IVxRole::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _role->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Role::RemovePrivilege(VxSdkNet::Privilege^ privilegeItem) {
@@ -84,7 +90,8 @@ VxSdkNet::Results::Value VxSdkNet::Role::RemovePrivilege(VxSdkNet::Privilege^ pr
 VxSdkNet::ResourceLimits^ VxSdkNet::Role::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _role->GetLimits(limits);
+    SdkCall sdkCall("IVxRole::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _role->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -101,16 +108,22 @@ System::Collections::Generic::List<VxSdkNet::Privilege^>^ VxSdkNet::Role::_GetPr
 
     // Make the GetPrivileges call, which will return with the total privilege count, this allows the
     // client to allocate memory.
-    VxSdk::VxResult::Value result = _role->GetPrivileges(privileges);
+    SdkCall sdkCall("IVxRole::GetPrivileges", privileges);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _role->GetPrivileges(privileges));
     // As long as there are privileges linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxPrivilege collection
         privileges.collection = new VxSdk::IVxPrivilege*[privileges.collectionSize];
-        result = _role->GetPrivileges(privileges);
+        sdkCall.Restart("IVxRole::GetPrivileges", privileges);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _role->GetPrivileges(privileges));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
-            for (int i = 0; i < privileges.collectionSize; i++)
-                mlist->Add(gcnew Privilege(privileges.collection[i]));
+            for (int i = 0; i < privileges.collectionSize; i++) {
+                // The privilege keeps its role, to fetch further handles to itself from
+                Privilege^ privilege = gcnew Privilege(privileges.collection[i]);
+                privilege->_role = this;
+                mlist->Add(privilege);
+            }
         }
         // Remove the memory we previously allocated to the collection
         delete[] privileges.collection;
@@ -2,20 +2,23 @@
 /// Implements the rule class.
 /// </summary>
 #include "Rule.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Rule::Rule(VxSdk::IVxRule* vxRule) {
     _rule = vxRule;
+    NativeMemory::Add(_rule);
 }
 
 VxSdkNet::Rule::!Rule() {
-    _rule->Delete();
+    NativeReleaseQueue::Release(_rule);
     _rule = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Rule::HaltScript() {
-    return (Results::Value)_rule->HaltScript();
+    SdkCall sdkCall("IVxRule::HaltScript");
+    return (Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _rule->HaltScript());
 }
 
 System::Collections::Generic::List<VxSdkNet::TimeTable^>^ VxSdkNet::Rule::GetTimeTables(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
@@ -40,12 +43,14 @@ System::Collections::Generic::List<VxSdkNet::TimeTable^>^ VxSdkNet::Rule::GetTim
     }
 
     // Make the GetTimeTables call, which will return with the total time table count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _rule->GetTimeTables(timeTables);
+    SdkCall sdkCall("IVxRule::GetTimeTables", timeTables);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _rule->GetTimeTables(timeTables));
     // The result should be kInsufficientSize if the number of time tables for the rule are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxTimeTable collection
         timeTables.collection = new VxSdk::IVxTimeTable*[timeTables.collectionSize];
-        result = _rule->GetTimeTables(timeTables);
+        sdkCall.Restart("IVxRule::GetTimeTables", timeTables);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _rule->GetTimeTables(timeTables));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < timeTables.collectionSize; i++) {
@@ -59,13 +64,15 @@ System::Collections::Generic::List<VxSdkNet::TimeTable^>^ VxSdkNet::Rule::GetTim
 }
 
 VxSdkNet::Results::Value VxSdkNet::Rule::Refresh() {
-    return (VxSdkNet::Results::Value)_rule->Refresh();
+    SdkCall sdkCall("IVxRule::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _rule->Refresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::Rule::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _rule->GetLimits(limits);
+    SdkCall sdkCall("IVxRule::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _rule->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -91,7 +98,8 @@ System::String ^ VxSdkNet::Rule::_GetScript() {
 
     // If the script data is not available the result will return VxSdk::VxResult::kActionUnavailable,
     // otherwise VxSdk::VxResult::kInsufficientSize
-    VxSdk::VxResult::Value result = _rule->GetScript(scriptData, size);
+    SdkCall sdkCall("IVxRule::GetScript");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _rule->GetScript(scriptData, size));
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the script data
         scriptData = new char[size];
@@ -143,7 +151,8 @@ VxSdkNet::Results::Value VxSdkNet::Rule::_SetResponses(System::Collections::Gene
     }
 
     // Attempt to set the responses and return the result
-    VxSdkNet::Results::Value result = (VxSdkNet::Results::Value)_rule->SetResponses(responses, responseListSize);
+    SdkCall sdkCall("IVxRule::SetResponses");
+    VxSdkNet::Results::Value result = (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _rule->SetResponses(responses, responseListSize));
     for (int i = 0; i < responseListSize; i++) {
         delete responses[i];
     }
@@ -157,7 +166,8 @@ VxSdkNet::Results::Value VxSdkNet::Rule::_SetResponses(System::Collections::Gene
 VxSdkNet::Results::Value VxSdkNet::Rule::_SetScript(System::String ^ scriptData) {
     // Set the script value for the rule
     std::string val = Utils::ConvertCSharpString(scriptData);
-    return (VxSdkNet::Results::Value)_rule->SetScript((char*)val.c_str());
+    SdkCall sdkCall("IVxRule::SetScript");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _rule->SetScript((char*)val.c_str()));
 }
 
 VxSdkNet::Results::Value VxSdkNet::Rule::_SetTimeTables(System::Collections::Generic::List<TimeTable^>^ timeTableList) {
@@ -174,7 +184,8 @@ VxSdkNet::Results::Value VxSdkNet::Rule::_SetTimeTables(System::Collections::Gen
     }
 
     // Attempt to set the time tables and return the result
-    VxSdk::VxResult::Value result = _rule->SetTimeTables(timeTableIds, timeTableListSize);
+    SdkCall sdkCall("IVxRule::SetTimeTables");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _rule->SetTimeTables(timeTableIds, timeTableListSize));
     for (int i = 0; i < timeTableListSize; i++) {
         delete[] timeTableIds[i];
     }
@@ -204,7 +215,8 @@ VxSdkNet::Results::Value VxSdkNet::Rule::_SetTriggers(System::Collections::Gener
     }
 
     // Attempt to set the triggers and return the result
-    VxSdkNet::Results::Value result = (VxSdkNet::Results::Value)_rule->SetTriggers(triggers, triggerListSize);
+    SdkCall sdkCall("IVxRule::SetTriggers");
+    VxSdkNet::Results::Value result = (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _rule->SetTriggers(triggers, triggerListSize));
     for (int i = 0; i < triggerListSize; i++) {
         delete triggers[i];
     }
@@ -2,15 +2,17 @@
 /// Implements the schedule class.
 /// </summary>
 #include "Schedule.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Schedule::Schedule(VxSdk::IVxSchedule* vxSchedule) {
     _schedule = vxSchedule;
+    NativeMemory::Add(_schedule);
 }
 
 VxSdkNet::Schedule::!Schedule() {
-    _schedule->Delete();
+    NativeReleaseQueue::Release(_schedule);
     _schedule = nullptr;
 }
 
@@ -39,7 +41,8 @@ VxSdkNet::Results::Value VxSdkNet::Schedule::AddScheduleTrigger(VxSdkNet::NewSch
         }
     }
 
-    VxSdk::VxResult::Value result = _schedule->AddScheduleTrigger(newTrigger);
+    SdkCall sdkCall("IVxSchedule::AddScheduleTrigger");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _schedule->AddScheduleTrigger(newTrigger));
     delete[] newTrigger.eventProperties;
     newTrigger.eventProperties = nullptr;
 
@@ -53,43 +56,8 @@ VxSdkNet::Results::Value VxSdkNet::Schedule::DeleteScheduleTrigger(VxSdkNet::Sch
 }
 
 List<VxSdkNet::DataSource^>^ VxSdkNet::Schedule::GetLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
-    // Create a list of managed data source objects
-    List<VxSdkNet::DataSource^>^ mlist = gcnew List<VxSdkNet::DataSource^>();
-    // Create a collection of unmanaged data source objects
-    VxSdk::VxCollection<VxSdk::IVxDataSource**> dataSources;
-
-    if (filters != nullptr && filters->Count > 0) {
-        // Create our filter
-        VxSdk::VxCollectionFilter* collFilters = new VxSdk::VxCollectionFilter[filters->Count];
-        int i = 0;
-        for each (KeyValuePair<Filters::Value, System::String^>^ kvp in filters)
-        {
-            collFilters[i].key = static_cast<VxSdk::VxCollectionFilterItem::Value>(kvp->Key);
-            VxSdk::Utilities::StrCopySafe(collFilters[i++].value, Utils::ConvertCSharpString(kvp->Value).c_str());
-        }
-
-        // Add the filters to the collection 
-        dataSources.filterSize = filters->Count;
-        dataSources.filters = collFilters;
-    }
-
-    // Make the GetLinks call, which will return with the total data source count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _schedule->GetLinks(dataSources);
-    // The result should be kInsufficientSize if the number of data sources on the system are greater than 0
-    if (result == VxSdk::VxResult::kInsufficientSize) {
-        // Allocate enough space for the IVxDataSource collection
-        dataSources.collection = new VxSdk::IVxDataSource*[dataSources.collectionSize];
-        result = _schedule->GetLinks(dataSources);
-        // The result should now be kOK since we have allocated enough space
-        if (result == VxSdk::VxResult::kOK) {
-            for (int i = 0; i < dataSources.collectionSize; i++) {
-                mlist->Add(gcnew VxSdkNet::DataSource(dataSources.collection[i]));
-            }
-        }
-        // Remove the memory we previously allocated to the collection
-        delete[] dataSources.collection;
-    }
-    return mlist;
+    VxSdk::VxResult::Value result;
+    return _GetLinkedDataSources(filters, result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::Schedule::Link(List<VxSdkNet::DataSource^>^ dataSources) {
@@ -98,7 +66,9 @@ VxSdkNet::Results::Value VxSdkNet::Schedule::Link(List<VxSdkNet::DataSource^>^ d
     // Iterate the managed list of data sources
     for (int i = 0; i < dataSources->Count; i++) {
         // Link the data sources to the schedule
-        result = _schedule->Link(*dataSources[i]->_dataSource);
+        NativeReadLock nativeLock(dataSources[i]->_nativeLock);
+        SdkCall sdkCall("IVxSchedule::Link");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _schedule->Link(*dataSources[i]->_dataSource));
     }
 
     // Unless there was an issue linking the data sources the result should be VxSdk::VxResult::kOK
@@ -107,7 +77,15 @@ VxSdkNet::Results::Value VxSdkNet::Schedule::Link(List<VxSdkNet::DataSource^>^ d
 
 
 VxSdkNet::Results::Value VxSdkNet::Schedule::Refresh() {
-    return (VxSdkNet::Results::Value)_schedule->Refresh();
+    SdkCall sdkCall("IVxSchedule::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _schedule->Refresh());
+}
+
+Dictionary<System::String^, VxSdkNet::Results::Value>^ VxSdkNet::Schedule::SetLinkedDataSources(List<VxSdkNet::DataSource^>^ dataSources) {
+    VxSdk::VxResult::Value readResult;
+    List<VxSdkNet::DataSource^>^ linked = _GetLinkedDataSources(nullptr, readResult);
+    return BulkLink::SetLinked<DataSource>(dataSources, linked, readResult, gcnew BulkLink::LinkDelegate(this, &VxSdkNet::Schedule::_LinkDataSource),
+        gcnew BulkLink::FetchDelegate(this, &VxSdkNet::Schedule::_Fetch));
 }
 
 VxSdkNet::Results::Value VxSdkNet::Schedule::Unlink(List<VxSdkNet::DataSource^>^ dataSources) {
@@ -116,17 +94,30 @@ VxSdkNet::Results::Value VxSdkNet::Schedule::Unlink(List<VxSdkNet::DataSource^>^
     // Iterate the managed list of data sources
     for (int i = 0; i < dataSources->Count; i++) {
         // UnLink the data sources to the schedule
-        result = _schedule->UnLink(*dataSources[i]->_dataSource);
+        NativeReadLock nativeLock(dataSources[i]->_nativeLock);
+        SdkCall sdkCall("IVxSchedule::UnLink");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _schedule->UnLink(*dataSources[i]->_dataSource));
     }
 
     // Unless there was an issue unlinking the data sources the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
+System::Object^ VxSdkNet::Schedule::_Fetch() {
+    // Schedules are fetched from the system the map belongs to
+    if (_identityMap == nullptr || _identityMap->_system == nullptr)
+        return nullptr;
+
+    VxSdk::IVxSchedule* schedule = BulkLink::_FetchHandle("IVxSystem::GetSchedules", _identityMap->_system, &VxSdk::IVxSystem::GetSchedules,
+        VxSdk::VxCollectionFilterItem::kId, Id);
+    return schedule == nullptr ? nullptr : IdentityMap::Wrap<VxSdkNet::Schedule>(_identityMap, schedule);
+}
+
 VxSdkNet::ResourceLimits^ VxSdkNet::Schedule::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _schedule->GetLimits(limits);
+    SdkCall sdkCall("IVxSchedule::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _schedule->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -135,6 +126,48 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Schedule::_GetLimits() {
     return nullptr;
 }
 
+List<VxSdkNet::DataSource^>^ VxSdkNet::Schedule::_GetLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result) {
+    // Create a list of managed data source objects
+    List<VxSdkNet::DataSource^>^ mlist = gcnew List<VxSdkNet::DataSource^>();
+    // Create a collection of unmanaged data source objects
+    VxSdk::VxCollection<VxSdk::IVxDataSource**> dataSources;
+
+    if (filters != nullptr && filters->Count > 0) {
+        // Create our filter
+        VxSdk::VxCollectionFilter* collFilters = new VxSdk::VxCollectionFilter[filters->Count];
+        int i = 0;
+        for each (KeyValuePair<Filters::Value, System::String^>^ kvp in filters)
+        {
+            collFilters[i].key = static_cast<VxSdk::VxCollectionFilterItem::Value>(kvp->Key);
+            VxSdk::Utilities::StrCopySafe(collFilters[i++].value, Utils::ConvertCSharpString(kvp->Value).c_str());
+        }
+
+        // Add the filters to the collection 
+        dataSources.filterSize = filters->Count;
+        dataSources.filters = collFilters;
+    }
+
+    // Make the GetLinks call, which will return with the total data source count, this allows the client to allocate memory
+    SdkCall sdkCall("IVxSchedule::GetLinks", dataSources);
+    result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _schedule->GetLinks(dataSources));
+    // The result should be kInsufficientSize if the number of data sources on the system are greater than 0
+    if (result == VxSdk::VxResult::kInsufficientSize) {
+        // Allocate enough space for the IVxDataSource collection
+        dataSources.collection = new VxSdk::IVxDataSource*[dataSources.collectionSize];
+        sdkCall.Restart("IVxSchedule::GetLinks", dataSources);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _schedule->GetLinks(dataSources));
+        // The result should now be kOK since we have allocated enough space
+        if (result == VxSdk::VxResult::kOK) {
+            for (int i = 0; i < dataSources.collectionSize; i++) {
+                mlist->Add(IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSources.collection[i]));
+            }
+        }
+        // Remove the memory we previously allocated to the collection
+        delete[] dataSources.collection;
+    }
+    return mlist;
+}
+
 List<VxSdkNet::ScheduleTrigger^>^ VxSdkNet::Schedule::_GetScheduleTriggers() {
     // Create a list of managed trigger objects
     List<VxSdkNet::ScheduleTrigger^>^ mlist = gcnew List<VxSdkNet::ScheduleTrigger^>();
@@ -143,12 +176,14 @@ List<VxSdkNet::ScheduleTrigger^>^ VxSdkNet::Schedule::_GetScheduleTriggers() {
 
     // Make the GetScheduleTriggers call, which will return with the total trigger count,
     // this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _schedule->GetScheduleTriggers(scheduleTriggers);
+    SdkCall sdkCall("IVxSchedule::GetScheduleTriggers", scheduleTriggers);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _schedule->GetScheduleTriggers(scheduleTriggers));
     // Unless there are no triggers associated with the schedule, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxScheduleTrigger collection
         scheduleTriggers.collection = new VxSdk::IVxScheduleTrigger*[scheduleTriggers.collectionSize];
-        result = _schedule->GetScheduleTriggers(scheduleTriggers);
+        sdkCall.Restart("IVxSchedule::GetScheduleTriggers", scheduleTriggers);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _schedule->GetScheduleTriggers(scheduleTriggers));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < scheduleTriggers.collectionSize; i++)
@@ -159,3 +194,10 @@ List<VxSdkNet::ScheduleTrigger^>^ VxSdkNet::Schedule::_GetScheduleTriggers() {
     }
     return mlist;
 }
+
+VxSdkNet::Results::Value VxSdkNet::Schedule::_LinkDataSource(System::Object^ item, bool link) {
+    DataSource^ dataSource = safe_cast<DataSource^>(item);
+    NativeReadLock nativeLock(dataSource->_nativeLock);
+    VxSdk::VxResult::Value result = link ? _schedule->Link(*dataSource->_dataSource) : _schedule->UnLink(*dataSource->_dataSource);
+    return VxSdkNet::Results::Value(result);
+}
@@ -2,27 +2,31 @@
 /// Implements the schedule trigger class.
 /// </summary>
 #include "ScheduleTrigger.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System;
 using namespace System::Collections::Generic;
 
 VxSdkNet::ScheduleTrigger::ScheduleTrigger(VxSdk::IVxScheduleTrigger* vxScheduleTrigger) {
     _scheduleTrigger = vxScheduleTrigger;
+    NativeMemory::Add(_scheduleTrigger);
 }
 
 VxSdkNet::ScheduleTrigger::!ScheduleTrigger() {
-    _scheduleTrigger->Delete();
+    NativeReleaseQueue::Release(_scheduleTrigger);
     _scheduleTrigger = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::ScheduleTrigger::Refresh() {
-    return (VxSdkNet::Results::Value)_scheduleTrigger->Refresh();
+    SdkCall sdkCall("IVxScheduleTrigger::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _scheduleTrigger->Refresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::ScheduleTrigger::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _scheduleTrigger->GetLimits(limits);
+    SdkCall sdkCall("IVxScheduleTrigger::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _scheduleTrigger->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
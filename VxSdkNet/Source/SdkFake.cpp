@@ -0,0 +1,76 @@
+/// <summary>
+/// Implements the sdk fake class.
+/// </summary>
+#include "SdkFake.h"
+
+#ifdef VXSDKNET_FAKE_SDK
+int VxSdkNet::SdkFake::DataSourceCount::get() {
+    return VxSdkFake::GetSettings().dataSourceCount;
+}
+
+void VxSdkNet::SdkFake::DataSourceCount::set(int value) {
+    VxSdkFake::Settings settings = VxSdkFake::GetSettings();
+    settings.dataSourceCount = value;
+    VxSdkFake::SetSettings(settings);
+}
+
+int VxSdkNet::SdkFake::DataSourcesPerDevice::get() {
+    return VxSdkFake::GetSettings().dataSourcesPerDevice;
+}
+
+void VxSdkNet::SdkFake::DataSourcesPerDevice::set(int value) {
+    VxSdkFake::Settings settings = VxSdkFake::GetSettings();
+    settings.dataSourcesPerDevice = value;
+    VxSdkFake::SetSettings(settings);
+}
+
+int VxSdkNet::SdkFake::EventCount::get() {
+    return VxSdkFake::GetSettings().eventCount;
+}
+
+void VxSdkNet::SdkFake::EventCount::set(int value) {
+    VxSdkFake::Settings settings = VxSdkFake::GetSettings();
+    settings.eventCount = value;
+    VxSdkFake::SetSettings(settings);
+}
+
+int VxSdkNet::SdkFake::EventInterval::get() {
+    return VxSdkFake::GetSettings().eventInterval;
+}
+
+void VxSdkNet::SdkFake::EventInterval::set(int value) {
+    VxSdkFake::Settings settings = VxSdkFake::GetSettings();
+    settings.eventInterval = value;
+    VxSdkFake::SetSettings(settings);
+}
+
+int VxSdkNet::SdkFake::EventsPerInterval::get() {
+    return VxSdkFake::GetSettings().eventsPerInterval;
+}
+
+void VxSdkNet::SdkFake::EventsPerInterval::set(int value) {
+    VxSdkFake::Settings settings = VxSdkFake::GetSettings();
+    settings.eventsPerInterval = value;
+    VxSdkFake::SetSettings(settings);
+}
+
+int VxSdkNet::SdkFake::Seed::get() {
+    return static_cast<int>(VxSdkFake::GetSettings().seed);
+}
+
+void VxSdkNet::SdkFake::Seed::set(int value) {
+    VxSdkFake::Settings settings = VxSdkFake::GetSettings();
+    settings.seed = static_cast<unsigned int>(value);
+    VxSdkFake::SetSettings(settings);
+}
+
+int VxSdkNet::SdkFake::SituationTypeCount::get() {
+    return VxSdkFake::GetSettings().situationTypeCount;
+}
+
+void VxSdkNet::SdkFake::SituationTypeCount::set(int value) {
+    VxSdkFake::Settings settings = VxSdkFake::GetSettings();
+    settings.situationTypeCount = value;
+    VxSdkFake::SetSettings(settings);
+}
+#endif // VXSDKNET_FAKE_SDK
@@ -0,0 +1,53 @@
+/// <summary>
+/// Implements the sdk faults class.
+/// </summary>
+#include <msclr/lock.h>
+#include "SdkFaults.h"
+#include "Utils.h"
+
+using namespace System;
+using namespace System::Threading;
+
+void VxSdkNet::SdkFaults::SetSeed(int seed) {
+    msclr::lock randomLock(_randomLock);
+    _random = gcnew Random(seed);
+}
+
+void VxSdkNet::SdkFaults::_Delay(const char* method) {
+    if (Latency <= 0 && LatencyJitter <= 0)
+        return;
+
+    if (!_IsTarget(method))
+        return;
+
+    int delay = Math::Max(Latency, 0);
+    if (LatencyJitter > 0) {
+        msclr::lock randomLock(_randomLock);
+        delay += _random->Next(LatencyJitter + 1);
+    }
+
+    Thread::Sleep(delay);
+}
+
+VxSdk::VxResult::Value VxSdkNet::SdkFaults::_GetError() {
+    return static_cast<VxSdk::VxResult::Value>(Results::Value::CommunicationError);
+}
+
+bool VxSdkNet::SdkFaults::_Inject(const char* method) {
+    if (ErrorRate <= 0 || !_IsTarget(method))
+        return false;
+
+    {
+        msclr::lock randomLock(_randomLock);
+        if (_random->NextDouble() >= ErrorRate)
+            return false;
+    }
+
+    Interlocked::Increment(_injectedErrorCount);
+    return true;
+}
+
+bool VxSdkNet::SdkFaults::_IsTarget(const char* method) {
+    String^ prefix = MethodPrefix;
+    return String::IsNullOrEmpty(prefix) || gcnew String(method)->StartsWith(prefix, StringComparison::Ordinal);
+}
@@ -0,0 +1,44 @@
+/// <summary>
+/// Implements the sdk method metrics class.
+/// </summary>
+#include "SdkMethodMetrics.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+
+VxSdkNet::SdkMethodMetrics::SdkMethodMetrics(String^ name, array<long long>^ counts) {
+    _name = name;
+    _counts = counts;
+    for (int i = 0; i < SdkMetrics::BucketCount; i++)
+        _callCount += counts[i];
+}
+
+TimeSpan VxSdkNet::SdkMethodMetrics::GetLatencyPercentile(double percentile) {
+    if (_callCount == 0)
+        return TimeSpan::Zero;
+
+    // Find the bucket holding the call at the percentile and report the middle of its range
+    long long target = static_cast<long long>(Math::Ceiling(Math::Min(Math::Max(percentile, 0.0), 100.0) / 100 * _callCount));
+    long long seen = 0;
+    for (int i = 0; i < SdkMetrics::BucketCount; i++) {
+        seen += _counts[i];
+        if (seen >= Math::Max(target, 1LL)) {
+            long long start = SdkMetrics::_GetBucketStart(i);
+            long long end = i + 1 < SdkMetrics::BucketCount ? SdkMetrics::_GetBucketStart(i + 1) : start + 1;
+            return _ToTimeSpan((start + end - 1) / 2.0);
+        }
+    }
+
+    return TimeSpan::Zero;
+}
+
+Dictionary<VxSdkNet::Results::Value, long long>^ VxSdkNet::SdkMethodMetrics::ResultCounts::get() {
+    Dictionary<Results::Value, long long>^ mlist = gcnew Dictionary<Results::Value, long long>();
+    for (int i = 0; i < SdkMetrics::ResultCount; i++) {
+        long long count = _counts[SdkMetrics::ResultSlot + i];
+        if (count > 0)
+            mlist[Results::Value(i)] = count;
+    }
+
+    return mlist;
+}
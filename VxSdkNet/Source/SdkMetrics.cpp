@@ -0,0 +1,219 @@
+/// <summary>
+/// Implements the sdk metrics class.
+/// </summary>
+#include <msclr/lock.h>
+#include "SdkMetricsSnapshot.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Diagnostics;
+using namespace System::Threading;
+
+VxSdkNet::SdkMetricsSnapshot^ VxSdkNet::SdkMetrics::GetSnapshot() {
+    List<SdkThreadMetrics^>^ threads;
+    array<array<long long>^>^ retiredSites = gcnew array<array<long long>^>(SiteCount);
+    {
+        msclr::lock threadsLock(_threads);
+        threads = gcnew List<SdkThreadMetrics^>(_threads);
+        for (int site = 0; site < SiteCount; site++) {
+            if (_retiredSites[site] != nullptr)
+                retiredSites[site] = safe_cast<array<long long>^>(_retiredSites[site]->Clone());
+        }
+    }
+
+    // Combine the tables of every thread, including those that have exited, and of every site with the same method
+    // name
+    Dictionary<String^, array<long long>^>^ methods = gcnew Dictionary<String^, array<long long>^>();
+    for (int site = 0; site < SiteCount; site++) {
+        String^ name = _siteNames[site];
+        if (name == nullptr)
+            continue;
+
+        array<long long>^ counts = retiredSites[site];
+        if (counts != nullptr) {
+            array<long long>^ methodCounts;
+            if (methods->TryGetValue(name, methodCounts))
+                _AddCounts(methodCounts, counts);
+            else
+                methods[name] = counts;
+
+            counts = methods[name];
+        }
+
+        for each (SdkThreadMetrics^ thread in threads) {
+            array<long long>^ threadCounts = thread->Sites[site];
+            if (threadCounts == nullptr)
+                continue;
+
+            if (counts == nullptr && !methods->TryGetValue(name, counts)) {
+                counts = gcnew array<long long>(SlotCount);
+                methods[name] = counts;
+            }
+
+            _AddCounts(counts, threadCounts);
+        }
+    }
+
+    return gcnew SdkMetricsSnapshot(methods);
+}
+
+void VxSdkNet::SdkMetrics::Reset() {
+    msclr::lock threadsLock(_threads);
+    Array::Clear(_retiredSites, 0, _retiredSites->Length);
+    for each (SdkThreadMetrics^ thread in _threads) {
+        for each (array<long long>^ counts in thread->Sites) {
+            if (counts != nullptr)
+                Array::Clear(counts, 0, counts->Length);
+        }
+
+        thread->TraceCount = 0;
+    }
+}
+
+void VxSdkNet::SdkMetrics::WriteChromeTrace(IO::TextWriter^ writer) {
+    List<SdkThreadMetrics^>^ threads;
+    {
+        msclr::lock threadsLock(_threads);
+        threads = gcnew List<SdkThreadMetrics^>(_threads);
+    }
+
+    // Each call is written as a complete event, with its start and duration in microseconds
+    int processId = Process::GetCurrentProcess()->Id;
+    double microsecondsPerTick = 1000000.0 / Stopwatch::Frequency;
+    writer->Write("{\"traceEvents\":[");
+    bool first = true;
+    for each (SdkThreadMetrics^ thread in threads) {
+        array<long long>^ trace = thread->Trace;
+        if (trace == nullptr)
+            continue;
+
+        int capacity = trace->Length / 3;
+        long long traceCount = thread->TraceCount;
+        for (long long n = Math::Max(traceCount - capacity, 0LL); n < traceCount; n++) {
+            int i = static_cast<int>(n % capacity) * 3;
+            String^ name = _siteNames[static_cast<int>(trace[i + 2] >> 32)];
+            Results::Value result = Results::Value(static_cast<int>(trace[i + 2] & 0xFFFFFFFF));
+            if (!first)
+                writer->Write(",");
+
+            writer->Write(String::Format(Globalization::CultureInfo::InvariantCulture,
+                "{{\"name\":\"{0}\",\"cat\":\"VxSdk\",\"ph\":\"X\",\"ts\":{1:0.###},\"dur\":{2:0.###},\"pid\":{3},\"tid\":{4},\"args\":{{\"result\":\"{5}\"}}}}",
+                name, trace[i] * microsecondsPerTick, trace[i + 1] * microsecondsPerTick, processId, thread->ThreadId, result));
+            first = false;
+        }
+    }
+
+    writer->Write("]}");
+    writer->Flush();
+}
+
+int VxSdkNet::SdkMetrics::_GetSite(const char* method) {
+    // Sites are keyed by the address of their method name, which is a string literal at each call site
+    IntPtr key = IntPtr(const_cast<char*>(method));
+    int site = static_cast<int>((key.ToInt64() >> 3) & (MaxSites - 1));
+    for (int probe = 0; probe < MaxSites; probe++) {
+        IntPtr current = _siteKeys[site];
+        if (current == key)
+            return site;
+
+        if (current == IntPtr::Zero) {
+            IntPtr previous = Interlocked::CompareExchange(_siteKeys[site], key, IntPtr::Zero);
+            if (previous == IntPtr::Zero) {
+                _siteNames[site] = gcnew String(method);
+                return site;
+            }
+
+            if (previous == key)
+                return site;
+        }
+
+        site = (site + 1) & (MaxSites - 1);
+    }
+
+    // Should the table ever fill, further methods are counted together under a site of their own
+    if (_siteNames[OverflowSite] == nullptr)
+        _siteNames[OverflowSite] = "(other)";
+
+    return OverflowSite;
+}
+
+void VxSdkNet::SdkMetrics::_Record(const char* method, long long start, int result, const int* count) {
+    long long ticks = Stopwatch::GetTimestamp() - start;
+    SdkThreadMetrics^ thread = _thread;
+    if (thread == nullptr)
+        thread = _RegisterThread();
+
+    int site = _GetSite(method);
+    array<long long>^ counts = thread->Sites[site];
+    if (counts == nullptr) {
+        counts = gcnew array<long long>(SlotCount);
+        thread->Sites[site] = counts;
+    }
+
+    counts[_GetBucket(ticks)]++;
+    counts[ResultSlot + Math::Min(Math::Max(result, 0), ResultCount - 1)]++;
+    counts[LatencySlot] += ticks;
+    if (count != nullptr && result == VxSdk::VxResult::kOK) {
+        counts[SizeCountSlot]++;
+        counts[SizeTotalSlot] += *count;
+        if (*count > counts[SizeMaxSlot])
+            counts[SizeMaxSlot] = *count;
+    }
+
+    // Keep the most recent calls for the trace, overwriting the oldest
+    array<long long>^ trace = thread->Trace;
+    if (trace == nullptr && _traceCapacity > 0) {
+        trace = gcnew array<long long>(_traceCapacity * 3);
+        thread->Trace = trace;
+    }
+
+    if (trace != nullptr) {
+        int i = static_cast<int>(thread->TraceCount % (trace->Length / 3)) * 3;
+        trace[i] = start;
+        trace[i + 1] = ticks;
+        trace[i + 2] = (static_cast<long long>(site) << 32) | static_cast<unsigned int>(result);
+        thread->TraceCount++;
+    }
+}
+
+void VxSdkNet::SdkMetrics::_AddCounts(array<long long>^ counts, array<long long>^ added) {
+    for (int i = 0; i < SlotCount; i++) {
+        if (i == SizeMaxSlot)
+            counts[i] = Math::Max(counts[i], added[i]);
+        else
+            counts[i] += added[i];
+    }
+}
+
+VxSdkNet::SdkThreadMetrics^ VxSdkNet::SdkMetrics::_RegisterThread() {
+    SdkThreadMetrics^ thread = gcnew SdkThreadMetrics();
+    thread->Owner = Thread::CurrentThread;
+    thread->ThreadId = thread->Owner->ManagedThreadId;
+    thread->Sites = gcnew array<array<long long>^>(SiteCount);
+    _thread = thread;
+
+    // Fold the tables of threads that have exited into the retired totals, so that the list only holds live threads;
+    // their recent calls are dropped from the trace
+    msclr::lock threadsLock(_threads);
+    for (int i = _threads->Count - 1; i >= 0; i--) {
+        SdkThreadMetrics^ retired = _threads[i];
+        if (retired->Owner->IsAlive)
+            continue;
+
+        for (int site = 0; site < SiteCount; site++) {
+            array<long long>^ counts = retired->Sites[site];
+            if (counts == nullptr)
+                continue;
+
+            if (_retiredSites[site] == nullptr)
+                _retiredSites[site] = gcnew array<long long>(SlotCount);
+
+            _AddCounts(_retiredSites[site], counts);
+        }
+
+        _threads->RemoveAt(i);
+    }
+
+    _threads->Add(thread);
+    return thread;
+}
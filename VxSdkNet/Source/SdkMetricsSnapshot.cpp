@@ -0,0 +1,60 @@
+/// <summary>
+/// Implements the sdk metrics snapshot class.
+/// </summary>
+#include "SdkMetricsSnapshot.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Globalization;
+
+VxSdkNet::SdkMetricsSnapshot::SdkMetricsSnapshot(Dictionary<String^, array<long long>^>^ methods) {
+    _taken = DateTime::UtcNow;
+    _methods = gcnew List<SdkMethodMetrics^>();
+    for each (KeyValuePair<String^, array<long long>^> method in methods)
+        _methods->Add(gcnew SdkMethodMetrics(method.Key, method.Value));
+
+    _methods->Sort(gcnew Comparison<SdkMethodMetrics^>(&VxSdkNet::SdkMetricsSnapshot::_CompareTotalLatency));
+}
+
+VxSdkNet::SdkMethodMetrics^ VxSdkNet::SdkMetricsSnapshot::GetMethod(String^ name) {
+    for each (SdkMethodMetrics^ method in _methods) {
+        if (method->Name == name)
+            return method;
+    }
+
+    return nullptr;
+}
+
+String^ VxSdkNet::SdkMetricsSnapshot::ToJson() {
+    Text::StringBuilder^ json = gcnew Text::StringBuilder();
+    json->AppendFormat(CultureInfo::InvariantCulture, "{{\"taken\":\"{0:o}\",\"methods\":[", _taken);
+    for (int i = 0; i < _methods->Count; i++) {
+        SdkMethodMetrics^ method = _methods[i];
+        if (i > 0)
+            json->Append(",");
+
+        // Latencies are written in microseconds
+        json->AppendFormat(CultureInfo::InvariantCulture,
+            "{{\"name\":\"{0}\",\"calls\":{1},\"totalUs\":{2:0.###},\"averageUs\":{3:0.###},\"p50Us\":{4:0.###},\"p99Us\":{5:0.###},\"maxUs\":{6:0.###},",
+            method->Name, method->CallCount, method->TotalLatency.TotalMilliseconds * 1000, method->AverageLatency.TotalMilliseconds * 1000,
+            method->GetLatencyPercentile(50).TotalMilliseconds * 1000, method->GetLatencyPercentile(99).TotalMilliseconds * 1000,
+            method->MaxLatency.TotalMilliseconds * 1000);
+        json->AppendFormat(CultureInfo::InvariantCulture, "\"collections\":{0},\"averageSize\":{1:0.###},\"maxSize\":{2},\"results\":{{",
+            method->CollectionCount, method->AverageCollectionSize, method->MaxCollectionSize);
+
+        bool first = true;
+        for each (KeyValuePair<Results::Value, long long> result in method->ResultCounts) {
+            json->AppendFormat(CultureInfo::InvariantCulture, first ? "\"{0}\":{1}" : ",\"{0}\":{1}", result.Key, result.Value);
+            first = false;
+        }
+
+        json->Append("}}");
+    }
+
+    json->Append("]}");
+    return json->ToString();
+}
+
+int VxSdkNet::SdkMetricsSnapshot::_CompareTotalLatency(SdkMethodMetrics^ a, SdkMethodMetrics^ b) {
+    return b->TotalLatency.CompareTo(a->TotalLatency);
+}
@@ -0,0 +1,238 @@
+/// <summary>
+/// Implements the sdk recorder class.
+/// </summary>
+#include <msclr/lock.h>
+#include "SdkRecorder.h"
+#include "Utils.h"
+
+using namespace System;
+using namespace System::Collections::Concurrent;
+using namespace System::Diagnostics;
+using namespace System::IO;
+using namespace System::Threading;
+
+bool VxSdkNet::SdkRecorder::Start(String^ filePath) {
+    msclr::lock recorderLock(_recorderLock);
+    Stop();
+
+    FileStream^ stream;
+    try {
+        // Allow the trace to be read while it is being recorded
+        stream = gcnew FileStream(filePath, FileMode::Create, FileAccess::Write, FileShare::Read, 65536);
+    }
+    catch (IOException^) {
+        return false;
+    }
+    catch (UnauthorizedAccessException^) {
+        return false;
+    }
+    catch (ArgumentException^) {
+        return false;
+    }
+
+    // The header holds the timestamp frequency and the time recording started; call times are relative to it
+    _startedAt = Stopwatch::GetTimestamp();
+    _writer = gcnew BinaryWriter(stream, Text::Encoding::UTF8);
+    _writer->Write(FileMagic);
+    _writer->Write(FileVersion);
+    _writer->Write(Stopwatch::Frequency);
+    _writer->Write(DateTime::UtcNow.Ticks);
+    _writer->Flush();
+
+    _entries = gcnew ConcurrentQueue<SdkRecorderEntry^>();
+    _pendingCount = 0;
+    _droppedCount = 0;
+    _recordedCount = 0;
+    _thread = gcnew Thread(gcnew ThreadStart(&VxSdkNet::SdkRecorder::_Write));
+    _thread->IsBackground = true;
+    _thread->Name = "SdkRecorder";
+    _recording = true;
+    _thread->Start();
+    return true;
+}
+
+void VxSdkNet::SdkRecorder::Stop() {
+    msclr::lock recorderLock(_recorderLock);
+    if (_thread == nullptr)
+        return;
+
+    // Stop queueing calls before waiting for the writer, which writes any already queued before it exits
+    _recording = false;
+    _entries = nullptr;
+    _wake->Set();
+    _thread->Join();
+    _thread = nullptr;
+    _writer = nullptr;
+}
+
+void VxSdkNet::SdkRecorder::_Record(const char* method, long long start, int result, const int* count, const int* filterSize,
+    VxSdk::VxCollectionFilter* const* filters, const SdkCollectionItems* items) {
+    ConcurrentQueue<SdkRecorderEntry^>^ entries = _entries;
+    if (entries == nullptr)
+        return;
+
+    // Drop the call rather than let the queue grow without bound when the file cannot keep up
+    if (Interlocked::Increment(_pendingCount) > _maxPending) {
+        Interlocked::Decrement(_pendingCount);
+        Interlocked::Increment(_droppedCount);
+        return;
+    }
+
+    SdkRecorderEntry^ entry = gcnew SdkRecorderEntry();
+    entry->Site = SdkMetrics::_GetSite(method);
+    entry->ThreadId = Thread::CurrentThread->ManagedThreadId;
+    entry->Start = start - _startedAt;
+    entry->Duration = Stopwatch::GetTimestamp() - start;
+    entry->Result = result;
+    entry->CollectionSize = count != nullptr ? *count : -1;
+
+    // Copy the filters now, as the caller frees them as soon as the call returns
+    if (filterSize != nullptr && *filterSize > 0 && *filters != nullptr) {
+        entry->FilterKeys = gcnew array<int>(*filterSize);
+        entry->FilterValues = gcnew array<String^>(*filterSize);
+        for (int i = 0; i < *filterSize; i++) {
+            entry->FilterKeys[i] = (*filters)[i].key;
+            entry->FilterValues[i] = Utils::ConvertCppString((*filters)[i].value);
+        }
+    }
+
+    // Copy the fields of the items returned too, as the caller releases them once it has wrapped them
+    entry->ItemKind = items != nullptr ? items->ItemKind : SdkCollectionItems::kNone;
+    if (entry->ItemKind != SdkCollectionItems::kNone && _includeItems && result == VxSdk::VxResult::kOK && *count > 0) {
+        const void* const* itemArray = *static_cast<const void* const* const*>(items->Items);
+        if (itemArray != nullptr) {
+            entry->Items = gcnew array<array<unsigned char>^>(*count);
+            for (int i = 0; i < *count; i++)
+                entry->Items[i] = itemArray[i] != nullptr ? _SerializeItem(items->ItemKind, itemArray[i]) : gcnew array<unsigned char>(0);
+        }
+    }
+
+    entries->Enqueue(entry);
+    Interlocked::Increment(_recordedCount);
+}
+
+array<unsigned char>^ VxSdkNet::SdkRecorder::_SerializeItem(SdkCollectionItems::Kind kind, const void* item) {
+    // Each type has its fields written one by one, in the order SdkTraceReader reads them back
+    MemoryStream^ stream = gcnew MemoryStream();
+    BinaryWriter^ writer = gcnew BinaryWriter(stream, Text::Encoding::UTF8);
+    if (kind == SdkCollectionItems::kDataSource) {
+        const VxSdk::IVxDataSource* dataSource = static_cast<const VxSdk::IVxDataSource*>(item);
+        _WriteString(writer, Utils::ConvertCppString(dataSource->id));
+        _WriteString(writer, Utils::ConvertCppString(dataSource->name));
+        _WriteString(writer, Utils::ConvertCppString(dataSource->ip));
+        _WriteVarint(writer, static_cast<unsigned int>(dataSource->number));
+        _WriteVarint(writer, dataSource->type);
+        _WriteVarint(writer, dataSource->state);
+        writer->Write(dataSource->isEnabled);
+        writer->Write(dataSource->isRecording);
+    }
+    else if (kind == SdkCollectionItems::kDevice) {
+        const VxSdk::IVxDevice* device = static_cast<const VxSdk::IVxDevice*>(item);
+        _WriteString(writer, Utils::ConvertCppString(device->id));
+        _WriteString(writer, Utils::ConvertCppString(device->name));
+        _WriteString(writer, Utils::ConvertCppString(device->ip));
+        _WriteString(writer, Utils::ConvertCppString(device->hostname));
+        _WriteString(writer, Utils::ConvertCppString(device->model));
+        _WriteString(writer, Utils::ConvertCppString(device->serial));
+        _WriteString(writer, Utils::ConvertCppString(device->vendor));
+        _WriteString(writer, Utils::ConvertCppString(device->version));
+        _WriteVarint(writer, static_cast<unsigned int>(device->port));
+        _WriteVarint(writer, device->type);
+        _WriteVarint(writer, device->state);
+    }
+    else if (kind == SdkCollectionItems::kEvent) {
+        const VxSdk::IVxEvent* vxEvent = static_cast<const VxSdk::IVxEvent*>(item);
+        _WriteString(writer, Utils::ConvertCppString(vxEvent->id));
+        _WriteString(writer, Utils::ConvertCppString(vxEvent->situationType));
+        _WriteString(writer, Utils::ConvertCppString(vxEvent->situationName));
+        _WriteString(writer, Utils::ConvertCppString(vxEvent->generatorDeviceId));
+        _WriteString(writer, Utils::ConvertCppString(vxEvent->generatorDeviceName));
+        _WriteString(writer, Utils::ConvertCppString(vxEvent->sourceDeviceId));
+        _WriteString(writer, Utils::ConvertCppString(vxEvent->sourceDeviceName));
+        _WriteString(writer, Utils::ConvertCppString(vxEvent->time));
+        _WriteVarint(writer, vxEvent->severity);
+    }
+
+    writer->Flush();
+    return stream->ToArray();
+}
+
+void VxSdkNet::SdkRecorder::_Write() {
+    BinaryWriter^ writer = _writer;
+    ConcurrentQueue<SdkRecorderEntry^>^ entries = _entries;
+    array<bool>^ isMethodWritten = gcnew array<bool>(SdkMetrics::SiteCount);
+    long long previousStart = 0;
+    try {
+        while (true) {
+            // Check for a stop before writing, so that every call queued before it is written
+            bool isStopping = !_recording;
+            SdkRecorderEntry^ entry;
+            while (entries->TryDequeue(entry)) {
+                Interlocked::Decrement(_pendingCount);
+
+                // Each method name is written once, before its first call
+                if (!isMethodWritten[entry->Site]) {
+                    writer->Write(MethodRecord);
+                    _WriteVarint(writer, entry->Site);
+                    _WriteString(writer, SdkMetrics::_siteNames[entry->Site]);
+                    isMethodWritten[entry->Site] = true;
+                }
+
+                // Start times are delta encoded; calls on different threads may be queued slightly out of order, so
+                // the delta is zigzag encoded
+                long long delta = entry->Start - previousStart;
+                previousStart = entry->Start;
+                writer->Write(CallRecord);
+                _WriteVarint(writer, entry->Site);
+                _WriteVarint(writer, entry->ThreadId);
+                _WriteVarint(writer, static_cast<unsigned long long>((delta << 1) ^ (delta >> 63)));
+                _WriteVarint(writer, entry->Duration);
+                _WriteVarint(writer, entry->Result);
+                _WriteVarint(writer, entry->CollectionSize + 1);
+                int filterCount = entry->FilterKeys != nullptr ? entry->FilterKeys->Length : 0;
+                _WriteVarint(writer, filterCount);
+                for (int i = 0; i < filterCount; i++) {
+                    _WriteVarint(writer, entry->FilterKeys[i]);
+                    _WriteString(writer, entry->FilterValues[i]);
+                }
+
+                int itemCount = entry->Items != nullptr ? entry->Items->Length : 0;
+                _WriteVarint(writer, entry->ItemKind);
+                _WriteVarint(writer, itemCount);
+                for (int i = 0; i < itemCount; i++) {
+                    _WriteVarint(writer, entry->Items[i]->Length);
+                    writer->Write(entry->Items[i]);
+                }
+            }
+
+            writer->Flush();
+            if (isStopping)
+                return;
+
+            _wake->WaitOne(FlushInterval);
+        }
+    }
+    catch (IOException^) {
+        // Stop recording if the file can no longer be written to
+        _recording = false;
+    }
+    finally {
+        delete writer;
+    }
+}
+
+void VxSdkNet::SdkRecorder::_WriteString(BinaryWriter^ writer, String^ value) {
+    array<unsigned char>^ bytes = Text::Encoding::UTF8->GetBytes(value != nullptr ? value : String::Empty);
+    _WriteVarint(writer, bytes->Length);
+    writer->Write(bytes);
+}
+
+void VxSdkNet::SdkRecorder::_WriteVarint(BinaryWriter^ writer, unsigned long long value) {
+    // Write seven bits at a time, with the high bit set on every byte but the last
+    while (value >= 0x80) {
+        writer->Write(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+
+    writer->Write(static_cast<unsigned char>(value));
+}
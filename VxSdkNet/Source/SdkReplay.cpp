@@ -0,0 +1,155 @@
+/// <summary>
+/// Implements the sdk replay class.
+/// </summary>
+#include <msclr/lock.h>
+#include "SdkTraceReader.h"
+#include "Utils.h"
+#ifdef VXSDKNET_FAKE_SDK
+#include "FakeSdk.h"
+#endif
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Diagnostics;
+using namespace System::IO;
+using namespace System::Threading;
+
+bool VxSdkNet::SdkReplay::Start(String^ filePath, double timeScale) {
+    Dictionary<String^, Queue<SdkReplayCall>^>^ calls = gcnew Dictionary<String^, Queue<SdkReplayCall>^>();
+    Dictionary<String^, SdkTraceItem^>^ items = gcnew Dictionary<String^, SdkTraceItem^>();
+    try {
+        SdkTraceReader reader(filePath);
+#ifdef VXSDKNET_FAKE_SDK
+        reader._readItems = true;
+#else
+        reader._readItems = false;
+#endif
+
+        // Keep only what is replayed, with the durations converted to timestamp ticks and scaled
+        double scale = Math::Max(timeScale, 0.0) * Stopwatch::Frequency / TimeSpan::TicksPerSecond;
+        for (SdkTraceRecord^ record = reader.ReadNext(); record != nullptr; record = reader.ReadNext()) {
+            Queue<SdkReplayCall>^ methodCalls;
+            if (!calls->TryGetValue(record->Method, methodCalls)) {
+                methodCalls = gcnew Queue<SdkReplayCall>();
+                calls[record->Method] = methodCalls;
+            }
+
+            SdkReplayCall call;
+            call.Duration = static_cast<long long>(record->Duration.Ticks * scale);
+            call.Result = static_cast<int>(record->Result);
+            methodCalls->Enqueue(call);
+
+            // The latest recorded copy of each item is served
+            if (record->CollectionItems != nullptr) {
+                for each (SdkTraceItem^ item in record->CollectionItems)
+                    items[static_cast<int>(item->Kind) + ":" + item->Id] = item;
+            }
+        }
+    }
+    catch (IOException^) {
+        return false;
+    }
+    catch (UnauthorizedAccessException^) {
+        return false;
+    }
+    catch (ArgumentException^) {
+        return false;
+    }
+
+    msclr::lock replayLock(_replayLock);
+#ifdef VXSDKNET_FAKE_SDK
+    _Serve(items->Values);
+#endif
+    _calls = calls;
+    _missedCount = 0;
+    _replayedCount = 0;
+    _replaying = true;
+    return true;
+}
+
+void VxSdkNet::SdkReplay::Stop() {
+    msclr::lock replayLock(_replayLock);
+    _replaying = false;
+    _calls = nullptr;
+#ifdef VXSDKNET_FAKE_SDK
+    VxSdkFake::ClearRecording();
+#endif
+}
+
+bool VxSdkNet::SdkReplay::_Next(const char* method, long long& duration, VxSdk::VxResult::Value& result) {
+    String^ name = gcnew String(method);
+    {
+        msclr::lock replayLock(_replayLock);
+        Queue<SdkReplayCall>^ methodCalls;
+        if (_calls != nullptr && _calls->TryGetValue(name, methodCalls) && methodCalls->Count > 0) {
+            SdkReplayCall call = methodCalls->Dequeue();
+            duration = call.Duration;
+            result = static_cast<VxSdk::VxResult::Value>(call.Result);
+            Interlocked::Increment(_replayedCount);
+            return true;
+        }
+    }
+
+    Interlocked::Increment(_missedCount);
+    return false;
+}
+
+#ifdef VXSDKNET_FAKE_SDK
+void VxSdkNet::SdkReplay::_Serve(IEnumerable<SdkTraceItem^>^ items) {
+    VxSdkFake::Recording recording;
+    for each (SdkTraceItem^ item in items) {
+        Dictionary<String^, Object^>^ fields = item->Fields;
+        switch (item->Kind) {
+        case SdkTraceItem::ItemKind::DataSource: {
+            VxSdkFake::DataSourceRecord dataSource;
+            dataSource.id = Utils::ConvertCSharpString(item->Id);
+            dataSource.name = Utils::ConvertCSharpString(safe_cast<String^>(fields["name"]));
+            dataSource.ip = Utils::ConvertCSharpString(safe_cast<String^>(fields["ip"]));
+            dataSource.deviceIndex = -1;
+            dataSource.number = safe_cast<int>(fields["number"]);
+            dataSource.type = static_cast<VxSdkFake::DataSourceType::Value>(safe_cast<int>(fields["type"]));
+            dataSource.state = static_cast<VxSdkFake::State::Value>(safe_cast<int>(fields["state"]));
+            dataSource.isEnabled = safe_cast<bool>(fields["isEnabled"]);
+            dataSource.isRecording = safe_cast<bool>(fields["isRecording"]);
+            dataSource.pruningThreshold = 0;
+            dataSource.retentionLimit = 0;
+            recording.dataSources.push_back(dataSource);
+            break;
+        }
+        case SdkTraceItem::ItemKind::Device: {
+            VxSdkFake::DeviceRecord device;
+            device.id = Utils::ConvertCSharpString(item->Id);
+            device.name = Utils::ConvertCSharpString(safe_cast<String^>(fields["name"]));
+            device.ip = Utils::ConvertCSharpString(safe_cast<String^>(fields["ip"]));
+            device.hostname = Utils::ConvertCSharpString(safe_cast<String^>(fields["hostname"]));
+            device.model = Utils::ConvertCSharpString(safe_cast<String^>(fields["model"]));
+            device.serial = Utils::ConvertCSharpString(safe_cast<String^>(fields["serial"]));
+            device.vendor = Utils::ConvertCSharpString(safe_cast<String^>(fields["vendor"]));
+            device.version = Utils::ConvertCSharpString(safe_cast<String^>(fields["version"]));
+            device.port = safe_cast<int>(fields["port"]);
+            device.type = safe_cast<int>(fields["type"]);
+            device.state = static_cast<VxSdkFake::State::Value>(safe_cast<int>(fields["state"]));
+            device.isDeleted = false;
+            recording.devices.push_back(device);
+            break;
+        }
+        case SdkTraceItem::ItemKind::Event: {
+            VxSdkFake::EventRecord event;
+            event.id = Utils::ConvertCSharpString(item->Id);
+            event.situationType = Utils::ConvertCSharpString(safe_cast<String^>(fields["situationType"]));
+            event.situationName = Utils::ConvertCSharpString(safe_cast<String^>(fields["situationName"]));
+            event.generatorDeviceId = Utils::ConvertCSharpString(safe_cast<String^>(fields["generatorDeviceId"]));
+            event.generatorDeviceName = Utils::ConvertCSharpString(safe_cast<String^>(fields["generatorDeviceName"]));
+            event.sourceDeviceId = Utils::ConvertCSharpString(safe_cast<String^>(fields["sourceDeviceId"]));
+            event.sourceDeviceName = Utils::ConvertCSharpString(safe_cast<String^>(fields["sourceDeviceName"]));
+            event.time = Utils::ConvertCSharpString(safe_cast<String^>(fields["time"]));
+            event.severity = static_cast<unsigned short>(safe_cast<int>(fields["severity"]));
+            recording.events.push_back(event);
+            break;
+        }
+        }
+    }
+
+    VxSdkFake::SetRecording(recording);
+}
+#endif
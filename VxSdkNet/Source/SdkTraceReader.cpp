@@ -0,0 +1,203 @@
+/// <summary>
+/// Implements the sdk trace reader class.
+/// </summary>
+#include "SdkTraceReader.h"
+
+using namespace System;
+using namespace System::Collections::Generic;
+using namespace System::Diagnostics;
+using namespace System::IO;
+using namespace System::IO::MemoryMappedFiles;
+using namespace System::Threading;
+
+VxSdkNet::SdkTraceReader::SdkTraceReader(String^ filePath) {
+    const int kHeaderSize = 24;
+    _methods = gcnew Dictionary<int, String^>();
+    _readItems = true;
+
+    // Share the file for writing so that a trace can be read while it is still being recorded
+    FileStream^ stream = gcnew FileStream(filePath, FileMode::Open, FileAccess::Read, FileShare::ReadWrite);
+    if (stream->Length < kHeaderSize) {
+        delete stream;
+        throw gcnew InvalidDataException("The file is not an SDK trace.");
+    }
+
+    _file = MemoryMappedFile::CreateFromFile(stream, nullptr, 0, MemoryMappedFileAccess::Read, nullptr, HandleInheritability::None, false);
+    _reader = gcnew BinaryReader(_file->CreateViewStream(0, 0, MemoryMappedFileAccess::Read), Text::Encoding::UTF8);
+
+    // Traces from earlier versions are read too
+    int magic = _reader->ReadInt32();
+    _version = _reader->ReadInt32();
+    if (magic != SdkRecorder::FileMagic || _version < 1 || _version > SdkRecorder::FileVersion) {
+        delete _reader;
+        _reader = nullptr;
+        delete _file;
+        _file = nullptr;
+        throw gcnew InvalidDataException("The file is not an SDK trace.");
+    }
+
+    _ticksPerSecond = static_cast<double>(_reader->ReadInt64());
+    _startTime = DateTime(_reader->ReadInt64(), DateTimeKind::Utc);
+}
+
+VxSdkNet::SdkTraceReader::~SdkTraceReader() {
+    if (_reader != nullptr) {
+        delete _reader;
+        _reader = nullptr;
+    }
+
+    if (_file != nullptr) {
+        delete _file;
+        _file = nullptr;
+    }
+}
+
+VxSdkNet::SdkTraceRecord^ VxSdkNet::SdkTraceReader::ReadNext() {
+    if (_reader == nullptr)
+        return nullptr;
+
+    try {
+        while (true) {
+            // The mapped view is padded with zeros to a whole page, so anything other than a record marks the end
+            unsigned char kind = _reader->ReadByte();
+            if (kind == SdkRecorder::MethodRecord) {
+                int site = static_cast<int>(_ReadVarint(_reader));
+                _methods[site] = _ReadString(_reader);
+                continue;
+            }
+
+            if (kind != SdkRecorder::CallRecord)
+                return nullptr;
+
+            SdkTraceRecord^ record = gcnew SdkTraceRecord();
+            String^ method;
+            _methods->TryGetValue(static_cast<int>(_ReadVarint(_reader)), method);
+            record->_method = method != nullptr ? method : String::Empty;
+            record->_threadId = static_cast<int>(_ReadVarint(_reader));
+
+            // Undo the zigzag encoding of the start time delta
+            unsigned long long delta = _ReadVarint(_reader);
+            _previousStart += static_cast<long long>(delta >> 1) ^ -static_cast<long long>(delta & 1);
+            record->_start = _ToTimeSpan(_previousStart);
+            record->_duration = _ToTimeSpan(static_cast<long long>(_ReadVarint(_reader)));
+            record->_result = Results::Value(static_cast<int>(_ReadVarint(_reader)));
+            record->_collectionSize = static_cast<int>(_ReadVarint(_reader)) - 1;
+            record->_filters = gcnew Dictionary<Filters::Value, String^>();
+            int filterCount = static_cast<int>(_ReadVarint(_reader));
+            for (int i = 0; i < filterCount; i++) {
+                Filters::Value key = Filters::Value(static_cast<int>(_ReadVarint(_reader)));
+                record->_filters[key] = _ReadString(_reader);
+            }
+
+            // Version 2 traces hold the raw memory of the items, which is skipped
+            record->_items = gcnew List<SdkTraceItem^>();
+            int itemKind = _version >= 3 ? static_cast<int>(_ReadVarint(_reader)) : SdkCollectionItems::kNone;
+            int itemCount = _version >= 2 ? static_cast<int>(_ReadVarint(_reader)) : 0;
+            for (int i = 0; i < itemCount; i++) {
+                int length = static_cast<int>(_ReadVarint(_reader));
+                if (!_readItems || itemKind == SdkCollectionItems::kNone) {
+                    _reader->BaseStream->Seek(length, SeekOrigin::Current);
+                    continue;
+                }
+
+                array<unsigned char>^ fields = _reader->ReadBytes(length);
+                if (fields->Length < length)
+                    throw gcnew EndOfStreamException();
+
+                record->_items->Add(_ParseItem(itemKind, fields));
+            }
+
+            return record;
+        }
+    }
+    catch (EndOfStreamException^) {
+        // The last call of a trace that is still being recorded may be incomplete
+        return nullptr;
+    }
+}
+
+VxSdkNet::SdkTraceRecord^ VxSdkNet::SdkTraceReader::ReadNext(double timeScale) {
+    SdkTraceRecord^ record = ReadNext();
+    if (record == nullptr)
+        return nullptr;
+
+    // Time the calls from the first one paced, rather than from the start of the recording
+    if (_paceStartedAt == 0) {
+        _paceStartedAt = Stopwatch::GetTimestamp();
+        _paceOffset = record->Start;
+    }
+
+    double dueAt = (record->Start - _paceOffset).TotalMilliseconds * Math::Max(timeScale, 0.0);
+    double elapsed = (Stopwatch::GetTimestamp() - _paceStartedAt) * 1000.0 / Stopwatch::Frequency;
+    if (dueAt > elapsed)
+        Thread::Sleep(TimeSpan::FromTicks(static_cast<long long>((dueAt - elapsed) * TimeSpan::TicksPerMillisecond)));
+
+    return record;
+}
+
+VxSdkNet::SdkTraceItem^ VxSdkNet::SdkTraceReader::_ParseItem(int kind, array<unsigned char>^ fields) {
+    // Read the fields back in the order SdkRecorder wrote them
+    BinaryReader^ reader = gcnew BinaryReader(gcnew MemoryStream(fields, false), Text::Encoding::UTF8);
+    SdkTraceItem^ item = gcnew SdkTraceItem(static_cast<SdkTraceItem::ItemKind>(kind));
+    if (kind == SdkCollectionItems::kDataSource) {
+        item->_fields["id"] = _ReadString(reader);
+        item->_fields["name"] = _ReadString(reader);
+        item->_fields["ip"] = _ReadString(reader);
+        item->_fields["number"] = static_cast<int>(_ReadVarint(reader));
+        item->_fields["type"] = static_cast<int>(_ReadVarint(reader));
+        item->_fields["state"] = static_cast<int>(_ReadVarint(reader));
+        item->_fields["isEnabled"] = reader->ReadBoolean();
+        item->_fields["isRecording"] = reader->ReadBoolean();
+    }
+    else if (kind == SdkCollectionItems::kDevice) {
+        item->_fields["id"] = _ReadString(reader);
+        item->_fields["name"] = _ReadString(reader);
+        item->_fields["ip"] = _ReadString(reader);
+        item->_fields["hostname"] = _ReadString(reader);
+        item->_fields["model"] = _ReadString(reader);
+        item->_fields["serial"] = _ReadString(reader);
+        item->_fields["vendor"] = _ReadString(reader);
+        item->_fields["version"] = _ReadString(reader);
+        item->_fields["port"] = static_cast<int>(_ReadVarint(reader));
+        item->_fields["type"] = static_cast<int>(_ReadVarint(reader));
+        item->_fields["state"] = static_cast<int>(_ReadVarint(reader));
+    }
+    else if (kind == SdkCollectionItems::kEvent) {
+        item->_fields["id"] = _ReadString(reader);
+        item->_fields["situationType"] = _ReadString(reader);
+        item->_fields["situationName"] = _ReadString(reader);
+        item->_fields["generatorDeviceId"] = _ReadString(reader);
+        item->_fields["generatorDeviceName"] = _ReadString(reader);
+        item->_fields["sourceDeviceId"] = _ReadString(reader);
+        item->_fields["sourceDeviceName"] = _ReadString(reader);
+        item->_fields["time"] = _ReadString(reader);
+        item->_fields["severity"] = static_cast<int>(_ReadVarint(reader));
+    }
+
+    return item;
+}
+
+String^ VxSdkNet::SdkTraceReader::_ReadString(BinaryReader^ reader) {
+    int length = static_cast<int>(_ReadVarint(reader));
+    array<unsigned char>^ bytes = reader->ReadBytes(length);
+    if (bytes->Length < length)
+        throw gcnew EndOfStreamException();
+
+    return Text::Encoding::UTF8->GetString(bytes);
+}
+
+unsigned long long VxSdkNet::SdkTraceReader::_ReadVarint(BinaryReader^ reader) {
+    unsigned long long value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        unsigned char byte = reader->ReadByte();
+        value |= static_cast<unsigned long long>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+            return value;
+    }
+
+    throw gcnew InvalidDataException("Invalid variable length integer.");
+}
+
+TimeSpan VxSdkNet::SdkTraceReader::_ToTimeSpan(long long ticks) {
+    return TimeSpan(static_cast<long long>(ticks * (TimeSpan::TicksPerSecond / _ticksPerSecond)));
+}
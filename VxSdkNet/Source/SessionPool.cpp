@@ -0,0 +1,200 @@
+/// <summary>
+/// Implements the session pool class.
+/// </summary>
+#include <msclr/lock.h>
+#include "SessionPool.h"
+
+using namespace System;
+using namespace System::Collections::Concurrent;
+using namespace System::Collections::Generic;
+using namespace System::Diagnostics;
+using namespace System::Threading;
+
+VxSdkNet::SessionPool::SessionPool(TokenDelegate^ tokenSource) {
+    _tokenSource = tokenSource;
+    _fetchLock = gcnew Object();
+    _refreshTimer = gcnew Timer(gcnew TimerCallback(this, &VxSdkNet::SessionPool::_OnRefreshTimer), nullptr, Timeout::Infinite, Timeout::Infinite);
+    MaxConcurrentLogins = 16;
+    RefreshMargin = 60000;
+    TokenLifetime = 3600000;
+}
+
+VxSdkNet::SessionPool::~SessionPool() {
+    // Stop refreshing the token; systems already logged in keep their sessions
+    msclr::lock fetchLock(_fetchLock);
+    _isDisposed = true;
+    delete _refreshTimer;
+}
+
+String^ VxSdkNet::SessionPool::GetToken() {
+    Results::Value result;
+    return _GetToken(result);
+}
+
+VxSdkNet::Results::Value VxSdkNet::SessionPool::Login(VXSystem^ system) {
+    long long startedAt = Stopwatch::GetTimestamp();
+    Results::Value result;
+    String^ token = _GetToken(result);
+    if (token != nullptr)
+        result = system->Login(token);
+
+    // The token may have been revoked before its expected lifetime, so obtain a new one and try once more
+    if (result == Results::Value::AuthExpired) {
+        Results::Value fetchResult = Results::Value::OK;
+        {
+            msclr::lock fetchLock(_fetchLock);
+            if (String::Equals(_token, token))
+                fetchResult = _Fetch();
+        }
+
+        // Report why a new token could not be obtained, rather than trying the revoked one again
+        if (fetchResult != Results::Value::OK) {
+            result = fetchResult;
+        }
+        else {
+            token = _GetToken(result);
+            if (token != nullptr)
+                result = system->Login(token);
+        }
+    }
+
+    long long loginTime = Stopwatch::GetTimestamp() - startedAt;
+    Interlocked::Increment(_loginCount);
+    Interlocked::Add(_totalLoginTime, loginTime);
+    long long currentMax = Interlocked::Read(_maxLoginTime);
+    while (loginTime > currentMax) {
+        long long previous = Interlocked::CompareExchange(_maxLoginTime, loginTime, currentMax);
+        if (previous == currentMax)
+            break;
+
+        currentMax = previous;
+    }
+
+    return result;
+}
+
+Dictionary<VxSdkNet::VXSystem^, VxSdkNet::Results::Value>^ VxSdkNet::SessionPool::Login(IEnumerable<VXSystem^>^ systems) {
+    SessionPoolJob^ job = gcnew SessionPoolJob();
+    job->Systems = gcnew ConcurrentQueue<VXSystem^>(systems);
+    job->SystemResults = gcnew Dictionary<VXSystem^, Results::Value>();
+
+    // Obtain the token up front so that the workers do not all queue up for it
+    GetToken();
+
+    // Log the systems in using a bounded number of workers
+    int workers = Math::Min(Math::Max(MaxConcurrentLogins, 1), job->Systems->Count);
+    if (workers > 0) {
+        job->Workers = gcnew CountdownEvent(workers);
+        for (int i = 0; i < workers; i++)
+            ThreadPool::QueueUserWorkItem(gcnew WaitCallback(this, &VxSdkNet::SessionPool::_RunLogins), job);
+
+        job->Workers->Wait();
+    }
+
+    return job->SystemResults;
+}
+
+VxSdkNet::Results::Value VxSdkNet::SessionPool::Refresh() {
+    msclr::lock fetchLock(_fetchLock);
+    return _Fetch();
+}
+
+TimeSpan VxSdkNet::SessionPool::AverageLoginTime::get() {
+    long long loginCount = Interlocked::Read(_loginCount);
+    if (loginCount == 0)
+        return TimeSpan::Zero;
+
+    return TimeSpan::FromSeconds(static_cast<double>(Interlocked::Read(_totalLoginTime)) / loginCount / Stopwatch::Frequency);
+}
+
+TimeSpan VxSdkNet::SessionPool::MaxLoginTime::get() {
+    return TimeSpan::FromSeconds(static_cast<double>(Interlocked::Read(_maxLoginTime)) / Stopwatch::Frequency);
+}
+
+VxSdkNet::Results::Value VxSdkNet::SessionPool::_Fetch() {
+    // The token source is the caller's code, so an exception from it fails the fetch rather than the login or worker
+    // thread it runs on
+    String^ token;
+    try {
+        token = _tokenSource();
+    }
+    catch (Exception^) {
+        return Results::Value::UnknownError;
+    }
+
+    if (String::IsNullOrEmpty(token))
+        return Results::Value::Unauthenticated;
+
+    {
+        msclr::lock tokenLock(this);
+        _token = token;
+        _tokenObtainedAt = Stopwatch::GetTimestamp();
+    }
+
+    Interlocked::Increment(_tokenCount);
+
+    // Replace the token in the background before it expires, so that logins never wait for it
+    if (!_isDisposed)
+        _refreshTimer->Change(Math::Max(TokenLifetime - RefreshMargin, 0), Timeout::Infinite);
+
+    return Results::Value::OK;
+}
+
+String^ VxSdkNet::SessionPool::_GetCurrentToken(int margin) {
+    // The token is only returned if it is valid for at least the margin, in milliseconds
+    msclr::lock tokenLock(this);
+    if (_token == nullptr)
+        return nullptr;
+
+    long long age = (Stopwatch::GetTimestamp() - _tokenObtainedAt) * 1000 / Stopwatch::Frequency;
+    return age < TokenLifetime - margin ? _token : nullptr;
+}
+
+String^ VxSdkNet::SessionPool::_GetToken(Results::Value% result) {
+    result = Results::Value::OK;
+    String^ token = _GetCurrentToken(RefreshMargin);
+    if (token != nullptr)
+        return token;
+
+    // Only one caller obtains the token; the others wait for it rather than obtaining their own
+    msclr::lock fetchLock(_fetchLock);
+    token = _GetCurrentToken(RefreshMargin);
+    if (token == nullptr) {
+        result = _Fetch();
+
+        // A token obtained earlier is still used if a new one could not be obtained, but only until it expires
+        token = _GetCurrentToken(0);
+    }
+
+    if (token == nullptr && result == Results::Value::OK)
+        result = Results::Value::Unauthenticated;
+
+    return token;
+}
+
+void VxSdkNet::SessionPool::_OnRefreshTimer(Object^ state) {
+    const int kRetryDelay = 5000;
+    msclr::lock fetchLock(_fetchLock);
+    if (_isDisposed)
+        return;
+
+    // Keep the current token and try again shortly if a new one could not be obtained
+    if (_Fetch() != Results::Value::OK)
+        _refreshTimer->Change(kRetryDelay, Timeout::Infinite);
+}
+
+void VxSdkNet::SessionPool::_RunLogins(Object^ state) {
+    SessionPoolJob^ job = safe_cast<SessionPoolJob^>(state);
+    try {
+        VXSystem^ system;
+        while (job->Systems->TryDequeue(system)) {
+            Results::Value result = Login(system);
+
+            msclr::lock resultsLock(job->SystemResults);
+            job->SystemResults[system] = result;
+        }
+    }
+    finally {
+        job->Workers->Signal();
+    }
+}
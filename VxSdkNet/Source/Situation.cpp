@@ -2,16 +2,18 @@
 /// Implements the situation class.
 /// </summary>
 #include "Situation.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System;
 using namespace System::Collections::Generic;
 
 VxSdkNet::Situation::Situation(VxSdk::IVxSituation* vxSituation) {
     _situation = vxSituation;
+    NativeMemory::Add(_situation);
 }
 
 VxSdkNet::Situation::!Situation() {
-    _situation->Delete();
+    NativeReleaseQueue::Release(_situation);
     _situation = nullptr;
 }
 
@@ -44,7 +46,8 @@ VxSdkNet::Notification^ VxSdkNet::Situation::AddNotification(VxSdkNet::NewNotifi
     VxSdkNet::Notification^ retNotification = nullptr;
     // Make the call to add the notification to the situation
     VxSdk::IVxNotification* notificationItem = nullptr;
-    VxSdk::VxResult::Value result = _situation->AddNotification(vxNotification, notificationItem);
+    SdkCall sdkCall("IVxSituation::AddNotification");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->AddNotification(vxNotification, notificationItem));
 
     // Unless there was an issue adding the notification the result should be VxSdk::VxResult::kOK
     if (result == VxSdk::VxResult::kOK) {
@@ -54,7 +57,8 @@ VxSdkNet::Notification^ VxSdkNet::Situation::AddNotification(VxSdkNet::NewNotifi
 }
 
 VxSdkNet::Results::Value VxSdkNet::Situation::DeleteAudioFile() {
-    return (Results::Value)_situation->DeleteAudioFile();
+    SdkCall sdkCall("IVxSituation::DeleteAudioFile");
+    return (Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->DeleteAudioFile());
 }
 
 System::String^ VxSdkNet::Situation::GetAudioFileUri() {
@@ -63,7 +67,8 @@ System::String^ VxSdkNet::Situation::GetAudioFileUri() {
 
     // If the audio file uri is not available on the situation the result will return VxSdk::VxResult::kActionUnavailable,
     // otherwise VxSdk::VxResult::kInsufficientSize
-    VxSdk::VxResult::Value result = _situation->GetAudioFile(audioEndpoint, size);
+    SdkCall sdkCall("IVxSituation::GetAudioFile");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->GetAudioFile(audioEndpoint, size));
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for audioEndpoint
         audioEndpoint = new char[size];
@@ -74,83 +79,13 @@ System::String^ VxSdkNet::Situation::GetAudioFileUri() {
 }
 
 System::Collections::Generic::List<VxSdkNet::DataSource^>^ VxSdkNet::Situation::GetLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
-    // Create a list of managed data sources
-    List<VxSdkNet::DataSource^>^ mlist = gcnew List<VxSdkNet::DataSource^>();
-    // Create a collection of unmanaged data sources
-    VxSdk::VxCollection<VxSdk::IVxDataSource**> dataSources;
-
-    if (filters != nullptr && filters->Count > 0) {
-        // Create our filter
-        VxSdk::VxCollectionFilter* collFilters = new VxSdk::VxCollectionFilter[filters->Count];
-        int i = 0;
-        for each (KeyValuePair<Filters::Value, System::String^>^ kvp in filters)
-        {
-            collFilters[i].key = static_cast<VxSdk::VxCollectionFilterItem::Value>(kvp->Key);
-            VxSdk::Utilities::StrCopySafe(collFilters[i++].value, Utils::ConvertCSharpString(kvp->Value).c_str());
-        }
-
-        // Add the filters to the collection 
-        dataSources.filterSize = filters->Count;
-        dataSources.filters = collFilters;
-    }
-
-    // Make the GetLinks call, which will return with the total data source count, this
-    // allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _situation->GetLinks(dataSources);
-    // As long as there are data sources linked the result should be VxSdk::VxResult::kInsufficientSize
-    if (result == VxSdk::VxResult::kInsufficientSize) {
-        // Allocate enough space for the IVxDataSource collection
-        dataSources.collection = new VxSdk::IVxDataSource*[dataSources.collectionSize];
-        result = _situation->GetLinks(dataSources);
-        // The result should now be kOK since we have allocated enough space
-        if (result == VxSdk::VxResult::kOK) {
-            for (int i = 0; i < dataSources.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::DataSource(dataSources.collection[i]));
-        }
-        // Remove the memory we previously allocated to the collection
-        delete[] dataSources.collection;
-    }
-    return mlist;
+    VxSdk::VxResult::Value result;
+    return _GetLinkedDataSources(filters, result);
 }
 
 System::Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::Situation::GetLinkedDevices(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
-    // Create a list of managed devices
-    List<VxSdkNet::Device^>^ mlist = gcnew List<VxSdkNet::Device^>();
-    // Create a collection of unmanaged devices
-    VxSdk::VxCollection<VxSdk::IVxDevice**> devices;
-
-    if (filters != nullptr && filters->Count > 0) {
-        // Create our filter
-        VxSdk::VxCollectionFilter* collFilters = new VxSdk::VxCollectionFilter[filters->Count];
-        int i = 0;
-        for each (KeyValuePair<Filters::Value, System::String^>^ kvp in filters)
-        {
-            collFilters[i].key = static_cast<VxSdk::VxCollectionFilterItem::Value>(kvp->Key);
-            VxSdk::Utilities::StrCopySafe(collFilters[i++].value, Utils::ConvertCSharpString(kvp->Value).c_str());
-        }
-
-        // Add the filters to the collection 
-        devices.filterSize = filters->Count;
-        devices.filters = collFilters;
-    }
-
-    // Make the GetLinks call, which will return with the total device count, this allows the
-    // client to allocate memory.
-    VxSdk::VxResult::Value result = _situation->GetLinks(devices);
-    // As long as there are devices linked the result should be VxSdk::VxResult::kInsufficientSize
-    if (result == VxSdk::VxResult::kInsufficientSize) {
-        // Allocate enough space for the IVxDevice collection
-        devices.collection = new VxSdk::IVxDevice*[devices.collectionSize];
-        result = _situation->GetLinks(devices);
-        // The result should now be kOK since we have allocated enough space
-        if (result == VxSdk::VxResult::kOK) {
-            for (int i = 0; i < devices.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::Device(devices.collection[i]));
-        }
-        // Remove the memory we previously allocated to the collection
-        delete[] devices.collection;
-    }
-    return mlist;
+    VxSdk::VxResult::Value result;
+    return _GetLinkedDevices(filters, result);
 }
 
 List<VxSdkNet::Notification^>^ VxSdkNet::Situation::GetNotifications(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
@@ -175,12 +110,14 @@ List<VxSdkNet::Notification^>^ VxSdkNet::Situation::GetNotifications(System::Col
     }
 
     // Make the GetNotifications call, which will return with the total notification count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _situation->GetNotifications(notifications);
+    SdkCall sdkCall("IVxSituation::GetNotifications", notifications);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->GetNotifications(notifications));
     // The result should be kInsufficientSize if the number of notifications assigned to the situation are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxNotification collection
         notifications.collection = new VxSdk::IVxNotification*[notifications.collectionSize];
-        result = _situation->GetNotifications(notifications);
+        sdkCall.Restart("IVxSituation::GetNotifications", notifications);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->GetNotifications(notifications));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < notifications.collectionSize; i++) {
@@ -195,20 +132,25 @@ List<VxSdkNet::Notification^>^ VxSdkNet::Situation::GetNotifications(System::Col
 
 VxSdkNet::Results::Value VxSdkNet::Situation::Link(VxSdkNet::DataSource^ dataSource) {
     // Link a data source to a situation
-    VxSdk::VxResult::Value result = _situation->Link(*dataSource->_dataSource);
+    NativeReadLock nativeLock(dataSource->_nativeLock);
+    SdkCall sdkCall("IVxSituation::Link");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->Link(*dataSource->_dataSource));
     // Unless there was an issue linking the data source the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::Situation::Link(VxSdkNet::Device^ device) {
     // Link a device to a situation
-    VxSdk::VxResult::Value result = _situation->Link(*device->_device);
+    NativeReadLock nativeLock(device->_nativeLock);
+    SdkCall sdkCall("IVxSituation::Link");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->Link(*device->_device));
     // Unless there was an issue linking the device the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::Situation::Refresh() {
-    return (VxSdkNet::Results::Value)_situation->Refresh();
+    SdkCall sdkCall("IVxSituation::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::Situation::RemoveNotification(VxSdkNet::Notification^ notification) {
@@ -228,27 +170,57 @@ VxSdkNet::Results::Value VxSdkNet::Situation::SetAudioFile(System::String^ audio
     VxSdk::Utilities::StrCopySafe(audio, Utils::ConvertCSharpString(audioPath).c_str(), len);
 
     // Set the audio path
-    return (VxSdkNet::Results::Value)_situation->SetAudioFile(audio);
+    SdkCall sdkCall("IVxSituation::SetAudioFile");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->SetAudioFile(audio));
+}
+
+Dictionary<System::String^, VxSdkNet::Results::Value>^ VxSdkNet::Situation::SetLinkedDataSources(List<VxSdkNet::DataSource^>^ dataSources) {
+    VxSdk::VxResult::Value readResult;
+    List<VxSdkNet::DataSource^>^ linked = _GetLinkedDataSources(nullptr, readResult);
+    return BulkLink::SetLinked<DataSource>(dataSources, linked, readResult, gcnew BulkLink::LinkDelegate(this, &VxSdkNet::Situation::_LinkDataSource),
+        gcnew BulkLink::FetchDelegate(this, &VxSdkNet::Situation::_Fetch));
+}
+
+Dictionary<System::String^, VxSdkNet::Results::Value>^ VxSdkNet::Situation::SetLinkedDevices(List<VxSdkNet::Device^>^ devices) {
+    VxSdk::VxResult::Value readResult;
+    List<VxSdkNet::Device^>^ linked = _GetLinkedDevices(nullptr, readResult);
+    return BulkLink::SetLinked<Device>(devices, linked, readResult, gcnew BulkLink::LinkDelegate(this, &VxSdkNet::Situation::_LinkDevice),
+        gcnew BulkLink::FetchDelegate(this, &VxSdkNet::Situation::_Fetch));
 }
 
 VxSdkNet::Results::Value VxSdkNet::Situation::UnLink(VxSdkNet::DataSource^ dataSource) {
     // Unlink a data source from a situation
-    VxSdk::VxResult::Value result = _situation->UnLink(*dataSource->_dataSource);
+    NativeReadLock nativeLock(dataSource->_nativeLock);
+    SdkCall sdkCall("IVxSituation::UnLink");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->UnLink(*dataSource->_dataSource));
     // Unless there was an issue unlinking the data source the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::Situation::UnLink(VxSdkNet::Device^ device) {
     // Unlink a device from a situation
-    VxSdk::VxResult::Value result = _situation->UnLink(*device->_device);
+    NativeReadLock nativeLock(device->_nativeLock);
+    SdkCall sdkCall("IVxSituation::UnLink");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->UnLink(*device->_device));
     // Unless there was an issue unlinking the device the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
+System::Object^ VxSdkNet::Situation::_Fetch() {
+    // Situations are fetched from the system the map belongs to, by their unique type
+    if (_identityMap == nullptr || _identityMap->_system == nullptr)
+        return nullptr;
+
+    VxSdk::IVxSituation* situation = BulkLink::_FetchHandle("IVxSystem::GetSituations", _identityMap->_system, &VxSdk::IVxSystem::GetSituations,
+        VxSdk::VxCollectionFilterItem::kType, Type);
+    return situation == nullptr ? nullptr : IdentityMap::Wrap<VxSdkNet::Situation>(_identityMap, situation);
+}
+
 VxSdkNet::ResourceLimits^ VxSdkNet::Situation::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _situation->GetLimits(limits);
+    SdkCall sdkCall("IVxSituation::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -257,6 +229,90 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Situation::_GetLimits() {
     return nullptr;
 }
 
+System::Collections::Generic::List<VxSdkNet::DataSource^>^ VxSdkNet::Situation::_GetLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result) {
+    // Create a list of managed data sources
+    List<VxSdkNet::DataSource^>^ mlist = gcnew List<VxSdkNet::DataSource^>();
+    // Create a collection of unmanaged data sources
+    VxSdk::VxCollection<VxSdk::IVxDataSource**> dataSources;
+
+    if (filters != nullptr && filters->Count > 0) {
+        // Create our filter
+        VxSdk::VxCollectionFilter* collFilters = new VxSdk::VxCollectionFilter[filters->Count];
+        int i = 0;
+        for each (KeyValuePair<Filters::Value, System::String^>^ kvp in filters)
+        {
+            collFilters[i].key = static_cast<VxSdk::VxCollectionFilterItem::Value>(kvp->Key);
+            VxSdk::Utilities::StrCopySafe(collFilters[i++].value, Utils::ConvertCSharpString(kvp->Value).c_str());
+        }
+
+        // Add the filters to the collection 
+        dataSources.filterSize = filters->Count;
+        dataSources.filters = collFilters;
+    }
+
+    // Make the GetLinks call, which will return with the total data source count, this
+    // allows the client to allocate memory.
+    SdkCall sdkCall("IVxSituation::GetLinks", dataSources);
+    result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->GetLinks(dataSources));
+    // As long as there are data sources linked the result should be VxSdk::VxResult::kInsufficientSize
+    if (result == VxSdk::VxResult::kInsufficientSize) {
+        // Allocate enough space for the IVxDataSource collection
+        dataSources.collection = new VxSdk::IVxDataSource*[dataSources.collectionSize];
+        sdkCall.Restart("IVxSituation::GetLinks", dataSources);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->GetLinks(dataSources));
+        // The result should now be kOK since we have allocated enough space
+        if (result == VxSdk::VxResult::kOK) {
+            for (int i = 0; i < dataSources.collectionSize; i++)
+                mlist->Add(IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSources.collection[i]));
+        }
+        // Remove the memory we previously allocated to the collection
+        delete[] dataSources.collection;
+    }
+    return mlist;
+}
+
+System::Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::Situation::_GetLinkedDevices(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result) {
+    // Create a list of managed devices
+    List<VxSdkNet::Device^>^ mlist = gcnew List<VxSdkNet::Device^>();
+    // Create a collection of unmanaged devices
+    VxSdk::VxCollection<VxSdk::IVxDevice**> devices;
+
+    if (filters != nullptr && filters->Count > 0) {
+        // Create our filter
+        VxSdk::VxCollectionFilter* collFilters = new VxSdk::VxCollectionFilter[filters->Count];
+        int i = 0;
+        for each (KeyValuePair<Filters::Value, System::String^>^ kvp in filters)
+        {
+            collFilters[i].key = static_cast<VxSdk::VxCollectionFilterItem::Value>(kvp->Key);
+            VxSdk::Utilities::StrCopySafe(collFilters[i++].value, Utils::ConvertCSharpString(kvp->Value).c_str());
+        }
+
+        // Add the filters to the collection 
+        devices.filterSize = filters->Count;
+        devices.filters = collFilters;
+    }
+
+    // Make the GetLinks call, which will return with the total device count, this allows the
+    // client to allocate memory.
+    SdkCall sdkCall("IVxSituation::GetLinks", devices);
+    result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->GetLinks(devices));
+    // As long as there are devices linked the result should be VxSdk::VxResult::kInsufficientSize
+    if (result == VxSdk::VxResult::kInsufficientSize) {
+        // Allocate enough space for the IVxDevice collection
+        devices.collection = new VxSdk::IVxDevice*[devices.collectionSize];
+        sdkCall.Restart("IVxSituation::GetLinks", devices);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _situation->GetLinks(devices));
+        // The result should now be kOK since we have allocated enough space
+        if (result == VxSdk::VxResult::kOK) {
+            for (int i = 0; i < devices.collectionSize; i++)
+                mlist->Add(IdentityMap::Intern<VxSdkNet::Device>(_identityMap, devices.collection[i]));
+        }
+        // Remove the memory we previously allocated to the collection
+        delete[] devices.collection;
+    }
+    return mlist;
+}
+
 List<int>^ VxSdkNet::Situation::_GetSnoozeIntervals() {
     // Create a managed list of integers
     List<int>^ mlist = gcnew List<int>();
@@ -266,3 +322,17 @@ List<int>^ VxSdkNet::Situation::_GetSnoozeIntervals() {
 
     return mlist;
 }
+
+VxSdkNet::Results::Value VxSdkNet::Situation::_LinkDataSource(System::Object^ item, bool link) {
+    DataSource^ dataSource = safe_cast<DataSource^>(item);
+    NativeReadLock nativeLock(dataSource->_nativeLock);
+    VxSdk::VxResult::Value result = link ? _situation->Link(*dataSource->_dataSource) : _situation->UnLink(*dataSource->_dataSource);
+    return VxSdkNet::Results::Value(result);
+}
+
+VxSdkNet::Results::Value VxSdkNet::Situation::_LinkDevice(System::Object^ item, bool link) {
+    Device^ device = safe_cast<Device^>(item);
+    NativeReadLock nativeLock(device->_nativeLock);
+    VxSdk::VxResult::Value result = link ? _situation->Link(*device->_device) : _situation->UnLink(*device->_device);
+    return VxSdkNet::Results::Value(result);
+}
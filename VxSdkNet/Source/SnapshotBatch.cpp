@@ -0,0 +1,169 @@
+/// <summary>
+/// Implements the snapshot batch class.
+/// </summary>
+#include <msclr/lock.h>
+#include "SnapshotBatch.h"
+
+using namespace System;
+using namespace System::Collections::Concurrent;
+using namespace System::Collections::Generic;
+using namespace System::Threading;
+
+VxSdkNet::SnapshotBatch::SnapshotBatch() {
+    MaxConcurrentRequests = 8;
+    MaxConcurrentResolves = 16;
+    Timeout = 10000;
+    Width = 0;
+}
+
+List<VxSdkNet::SnapshotResult^>^ VxSdkNet::SnapshotBatch::Take(IEnumerable<DataSource^>^ dataSources, DateTime time,
+    ResultDelegate^ callback) {
+    SnapshotJob^ job = gcnew SnapshotJob();
+    job->DataSources = gcnew ConcurrentQueue<DataSource^>(dataSources);
+    job->Fetches = gcnew SemaphoreSlim(Math::Max(MaxConcurrentRequests, 1));
+    job->Callback = callback;
+    job->Results = gcnew List<SnapshotResult^>();
+    job->Time = time.ToUniversalTime();
+
+    // Resolve the data sources using a bounded number of workers; the fetches they make are bounded separately
+    int workers = Math::Min(Math::Max(MaxConcurrentResolves, 1), job->DataSources->Count);
+    if (workers > 0) {
+        job->Workers = gcnew CountdownEvent(workers);
+        for (int i = 0; i < workers; i++)
+            ThreadPool::QueueUserWorkItem(gcnew WaitCallback(this, &VxSdkNet::SnapshotBatch::_RunRequests), job);
+
+        job->Workers->Wait();
+    }
+
+    return job->Results;
+}
+
+VxSdkNet::Results::Value VxSdkNet::SnapshotBatch::_Download(String^ uri, array<unsigned char>^% imageData) {
+    System::Net::HttpWebRequest^ request = safe_cast<System::Net::HttpWebRequest^>(System::Net::WebRequest::Create(uri));
+    request->Timeout = Timeout;
+    request->KeepAlive = true;
+
+    // Allow as many persistent connections to the server as there may be fetches
+    if (request->ServicePoint->ConnectionLimit < MaxConcurrentRequests)
+        request->ServicePoint->ConnectionLimit = MaxConcurrentRequests;
+
+    System::Net::WebResponse^ response = nullptr;
+    try {
+        response = request->GetResponse();
+        System::IO::MemoryStream^ data = gcnew System::IO::MemoryStream();
+        response->GetResponseStream()->CopyTo(data);
+        imageData = data->ToArray();
+        return imageData->Length > 0 ? Results::Value::OK : Results::Value::OperationFailed;
+    }
+    catch (System::Net::WebException^ e) {
+        // The snapshot is served by the storage holding the clip, so failing to reach it means the storage is unavailable
+        System::Net::HttpWebResponse^ httpResponse = dynamic_cast<System::Net::HttpWebResponse^>(e->Response);
+        if (httpResponse != nullptr) {
+            System::Net::HttpStatusCode statusCode = httpResponse->StatusCode;
+            delete httpResponse;
+            if (statusCode == System::Net::HttpStatusCode::ServiceUnavailable)
+                return Results::Value::StorageUnavailable;
+            if (statusCode == System::Net::HttpStatusCode::Unauthorized)
+                return Results::Value::Unauthenticated;
+            if (statusCode == System::Net::HttpStatusCode::Forbidden)
+                return Results::Value::Unauthorized;
+
+            return Results::Value::OperationFailed;
+        }
+
+        if (e->Status == System::Net::WebExceptionStatus::ConnectFailure || e->Status == System::Net::WebExceptionStatus::NameResolutionFailure ||
+            e->Status == System::Net::WebExceptionStatus::Timeout)
+            return Results::Value::StorageUnavailable;
+
+        return Results::Value::CommunicationError;
+    }
+    catch (System::IO::IOException^) {
+        return Results::Value::CommunicationError;
+    }
+    finally {
+        if (response != nullptr)
+            delete response;
+    }
+}
+
+List<VxSdkNet::Clip^>^ VxSdkNet::SnapshotBatch::_GetCoveringClips(DataSource^ dataSource, DateTime time) {
+    Dictionary<Filters::Value, String^>^ filters = gcnew Dictionary<Filters::Value, String^>();
+    filters->Add(Filters::Value::SearchStartTime, Utils::ConvertCppString(Utils::ConvertCSharpDateTime(time)));
+    filters->Add(Filters::Value::SearchEndTime, Utils::ConvertCppString(Utils::ConvertCSharpDateTime(time.AddSeconds(1))));
+
+    // A time may be covered by clips on more than one data storage; any of them can provide the snapshot
+    List<Clip^>^ mlist = gcnew List<Clip^>();
+    for each (Clip^ clip in dataSource->GetClips(filters)) {
+        if (clip->StartTime <= time && clip->EndTime > time)
+            mlist->Add(clip);
+    }
+
+    return mlist;
+}
+
+void VxSdkNet::SnapshotBatch::_RunRequests(Object^ state) {
+    SnapshotJob^ job = safe_cast<SnapshotJob^>(state);
+    try {
+        DataSource^ dataSource;
+        while (job->DataSources->TryDequeue(dataSource)) {
+            SnapshotResult^ result = _Take(dataSource, job->Time, job->Fetches);
+
+            // Pass results to the callback one at a time so that it does not need to be thread safe
+            msclr::lock resultsLock(job->Results);
+            job->Results->Add(result);
+            if (job->Callback != nullptr) {
+                try {
+                    job->Callback(result);
+                }
+                catch (Exception^) {
+                    // Don't let the callback's exception escape onto the worker thread
+                    Interlocked::Increment(_callbackErrors);
+                }
+            }
+        }
+    }
+    finally {
+        job->Workers->Signal();
+    }
+}
+
+VxSdkNet::SnapshotResult^ VxSdkNet::SnapshotBatch::_Take(DataSource^ dataSource, DateTime time, SemaphoreSlim^ fetches) {
+    SnapshotResult^ result = gcnew SnapshotResult(dataSource);
+    System::Diagnostics::Stopwatch^ elapsed = System::Diagnostics::Stopwatch::StartNew();
+
+    List<Clip^>^ clips = _GetCoveringClips(dataSource, time);
+    if (clips->Count == 0) {
+        result->_result = dataSource->State == DataSource::States::Offline ? Results::Value::CameraUnavailable : Results::Value::OperationFailed;
+        result->_duration = elapsed->Elapsed;
+        return result;
+    }
+
+    SnapshotFilter^ filter = gcnew SnapshotFilter();
+    filter->StartTime = time;
+    filter->Width = Width;
+    for each (Clip^ clip in clips) {
+        result->_clip = clip;
+        String^ uri = clip->GetSnapshotEndpoint(filter);
+        if (String::IsNullOrEmpty(uri)) {
+            result->_result = Results::Value::ActionUnavailable;
+            continue;
+        }
+
+        array<unsigned char>^ imageData = nullptr;
+        fetches->Wait();
+        try {
+            result->_result = _Download(uri, imageData);
+        }
+        finally {
+            fetches->Release();
+        }
+
+        if (result->_result == Results::Value::OK) {
+            result->_snapshot = gcnew Thumbnail(dataSource->Id, time, imageData);
+            break;
+        }
+    }
+
+    result->_duration = elapsed->Elapsed;
+    return result;
+}
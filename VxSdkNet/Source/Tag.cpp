@@ -5,96 +5,28 @@
 #include "Device.h"
 #include "Tag.h"
 #include "User.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Tag::Tag(VxSdk::IVxTag* vxTag) {
     _tag = vxTag;
+    NativeMemory::Add(_tag);
 }
 
 VxSdkNet::Tag::!Tag() {
-    _tag->Delete();
+    NativeReleaseQueue::Release(_tag);
     _tag = nullptr;
 }
 
 System::Collections::Generic::List<VxSdkNet::DataSource^>^ VxSdkNet::Tag::GetLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
-    // Create a list of managed data sources
-    List<DataSource^>^ mlist = gcnew List<DataSource^>();
-    // Create a collection of unmanaged data sources
-    VxSdk::VxCollection<VxSdk::IVxDataSource**> dataSources;
-
-    if (filters != nullptr && filters->Count > 0) {
-        // Create our filter
-        VxSdk::VxCollectionFilter* collFilters = new VxSdk::VxCollectionFilter[filters->Count];
-        int i = 0;
-        for each (KeyValuePair<Filters::Value, System::String^>^ kvp in filters)
-        {
-            collFilters[i].key = static_cast<VxSdk::VxCollectionFilterItem::Value>(kvp->Key);
-            VxSdk::Utilities::StrCopySafe(collFilters[i++].value, Utils::ConvertCSharpString(kvp->Value).c_str());
-        }
-
-        // Add the filters to the collection 
-        dataSources.filterSize = filters->Count;
-        dataSources.filters = collFilters;
-    }
-
-    // Make the GetLinkedDataSources call, which will return with the total data source count, this
-    // allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _tag->GetLinks(dataSources);
-    // As long as there are data sources linked the result should be VxSdk::VxResult::kInsufficientSize
-    if (result == VxSdk::VxResult::kInsufficientSize) {
-        // Allocate enough space for the IVxDataSource collection
-        dataSources.collection = new VxSdk::IVxDataSource*[dataSources.collectionSize];
-        result = _tag->GetLinks(dataSources);
-        // The result should now be kOK since we have allocated enough space
-        if (result == VxSdk::VxResult::kOK) {
-            for (int i = 0; i < dataSources.collectionSize; i++)
-                mlist->Add(gcnew DataSource(dataSources.collection[i]));
-        }
-        // Remove the memory we previously allocated to the collection
-        delete[] dataSources.collection;
-    }
-    return mlist;
+    VxSdk::VxResult::Value result;
+    return _GetLinkedDataSources(filters, result);
 }
 
 System::Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::Tag::GetLinkedDevices(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters) {
-    // Create a list of managed devices
-    List<Device^>^ mlist = gcnew List<Device^>();
-    // Create a collection of unmanaged devices
-    VxSdk::VxCollection<VxSdk::IVxDevice**> devices;
-
-    if (filters != nullptr && filters->Count > 0) {
-        // Create our filter
-        VxSdk::VxCollectionFilter* collFilters = new VxSdk::VxCollectionFilter[filters->Count];
-        int i = 0;
-        for each (KeyValuePair<Filters::Value, System::String^>^ kvp in filters)
-        {
-            collFilters[i].key = static_cast<VxSdk::VxCollectionFilterItem::Value>(kvp->Key);
-            VxSdk::Utilities::StrCopySafe(collFilters[i++].value, Utils::ConvertCSharpString(kvp->Value).c_str());
-        }
-
-        // Add the filters to the collection 
-        devices.filterSize = filters->Count;
-        devices.filters = collFilters;
-    }
-
-    // Make the GetLinkedDevices call, which will return with the total device count, this allows the
-    // client to allocate memory.
-    VxSdk::VxResult::Value result = _tag->GetLinks(devices);
-    // As long as there are devices linked the result should be VxSdk::VxResult::kInsufficientSize
-    if (result == VxSdk::VxResult::kInsufficientSize) {
-        // Allocate enough space for the IVxDevice collection
-        devices.collection = new VxSdk::IVxDevice*[devices.collectionSize];
-        result = _tag->GetLinks(devices);
-        // The result should now be kOK since we have allocated enough space
-        if (result == VxSdk::VxResult::kOK) {
-            for (int i = 0; i < devices.collectionSize; i++)
-                mlist->Add(gcnew Device(devices.collection[i]));
-        }
-        // Remove the memory we previously allocated to the collection
-        delete[] devices.collection;
-    }
-    return mlist;
+    VxSdk::VxResult::Value result;
+    return _GetLinkedDevices(filters, result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::Tag::Link(List<VxSdkNet::DataSource^>^ dataSources) {
@@ -103,7 +35,9 @@ VxSdkNet::Results::Value VxSdkNet::Tag::Link(List<VxSdkNet::DataSource^>^ dataSo
     // Iterate the managed list of data sources
     for (int i = 0; i < dataSources->Count; i++) {
         // Link the data sources to the tag
-        result = _tag->Link(*dataSources[i]->_dataSource);
+        NativeReadLock nativeLock(dataSources[i]->_nativeLock);
+        SdkCall sdkCall("IVxTag::Link");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _tag->Link(*dataSources[i]->_dataSource));
     }
 
     // Unless there was an issue linking the data sources the result should be VxSdk::VxResult::kOK
@@ -116,7 +50,9 @@ VxSdkNet::Results::Value VxSdkNet::Tag::Link(List<VxSdkNet::Device^>^ devices) {
     // Iterate the managed list of devices
     for (int i = 0; i < devices->Count; i++) {
         // Link the devices to the tag
-        result = _tag->Link(*devices[i]->_device);
+        NativeReadLock nativeLock(devices[i]->_nativeLock);
+        SdkCall sdkCall("IVxTag::Link");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _tag->Link(*devices[i]->_device));
     }
 
     // Unless there was an issue linking the devices the result should be VxSdk::VxResult::kOK
@@ -125,13 +61,29 @@ VxSdkNet::Results::Value VxSdkNet::Tag::Link(List<VxSdkNet::Device^>^ devices) {
 
 VxSdkNet::Results::Value VxSdkNet::Tag::Merge(VxSdkNet::Tag^ tag) {
     // Make the call to merge this tag into an existing tag
-    VxSdk::VxResult::Value result = _tag->Merge(*tag->_tag);
+    SdkCall sdkCall("IVxTag::Merge");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _tag->Merge(*tag->_tag));
     // Unless there was an issue merging tags the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::Tag::Refresh() {
-    return (VxSdkNet::Results::Value)_tag->Refresh();
+    SdkCall sdkCall("IVxTag::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _tag->Refresh());
+}
+
+Dictionary<System::String^, VxSdkNet::Results::Value>^ VxSdkNet::Tag::SetLinkedDataSources(List<VxSdkNet::DataSource^>^ dataSources) {
+    VxSdk::VxResult::Value readResult;
+    List<VxSdkNet::DataSource^>^ linked = _GetLinkedDataSources(nullptr, readResult);
+    return BulkLink::SetLinked<DataSource>(dataSources, linked, readResult, gcnew BulkLink::LinkDelegate(this, &VxSdkNet::Tag::_LinkDataSource),
+        gcnew BulkLink::FetchDelegate(this, &VxSdkNet::Tag::_Fetch));
+}
+
+Dictionary<System::String^, VxSdkNet::Results::Value>^ VxSdkNet::Tag::SetLinkedDevices(List<VxSdkNet::Device^>^ devices) {
+    VxSdk::VxResult::Value readResult;
+    List<VxSdkNet::Device^>^ linked = _GetLinkedDevices(nullptr, readResult);
+    return BulkLink::SetLinked<Device>(devices, linked, readResult, gcnew BulkLink::LinkDelegate(this, &VxSdkNet::Tag::_LinkDevice),
+        gcnew BulkLink::FetchDelegate(this, &VxSdkNet::Tag::_Fetch));
 }
 
 VxSdkNet::Results::Value VxSdkNet::Tag::Unlink(List<VxSdkNet::DataSource^>^ dataSources) {
@@ -140,7 +92,9 @@ VxSdkNet::Results::Value VxSdkNet::Tag::Unlink(List<VxSdkNet::DataSource^>^ data
     // Iterate the managed list of data sources
     for (int i = 0; i < dataSources->Count; i++) {
         // UnLink the data sources to the tag
-        result = _tag->UnLink(*dataSources[i]->_dataSource);
+        NativeReadLock nativeLock(dataSources[i]->_nativeLock);
+        SdkCall sdkCall("IVxTag::UnLink");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _tag->UnLink(*dataSources[i]->_dataSource));
     }
 
     // Unless there was an issue unlinking the data sources the result should be VxSdk::VxResult::kOK
@@ -153,17 +107,30 @@ VxSdkNet::Results::Value VxSdkNet::Tag::Unlink(List<VxSdkNet::Device^>^ devices)
     // Iterate the managed list of devices
     for (int i = 0; i < devices->Count; i++) {
         // UnLink the devices to the tag
-        result = _tag->UnLink(*devices[i]->_device);
+        NativeReadLock nativeLock(devices[i]->_nativeLock);
+        SdkCall sdkCall("IVxTag::UnLink");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _tag->UnLink(*devices[i]->_device));
     }
 
     // Unless there was an issue unlinking the devices the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
+System::Object^ VxSdkNet::Tag::_Fetch() {
+    // Tags are fetched from the system the map belongs to
+    if (_identityMap == nullptr || _identityMap->_system == nullptr)
+        return nullptr;
+
+    VxSdk::IVxTag* tag = BulkLink::_FetchHandle("IVxSystem::GetTags", _identityMap->_system, &VxSdk::IVxSystem::GetTags,
+        VxSdk::VxCollectionFilterItem::kId, Id);
+    return tag == nullptr ? nullptr : IdentityMap::Wrap<VxSdkNet::Tag>(_identityMap, tag);
+}
+
 VxSdkNet::ResourceLimits^ VxSdkNet::Tag::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _tag->GetLimits(limits);
+    SdkCall sdkCall("IVxTag::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _tag->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -172,10 +139,95 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Tag::_GetLimits() {
     return nullptr;
 }
 
+System::Collections::Generic::List<VxSdkNet::DataSource^>^ VxSdkNet::Tag::_GetLinkedDataSources(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result) {
+    // Create a list of managed data sources
+    List<DataSource^>^ mlist = gcnew List<DataSource^>();
+    // Create a collection of unmanaged data sources
+    VxSdk::VxCollection<VxSdk::IVxDataSource**> dataSources;
+
+    if (filters != nullptr && filters->Count > 0) {
+        // Create our filter
+        VxSdk::VxCollectionFilter* collFilters = new VxSdk::VxCollectionFilter[filters->Count];
+        int i = 0;
+        for each (KeyValuePair<Filters::Value, System::String^>^ kvp in filters)
+        {
+            collFilters[i].key = static_cast<VxSdk::VxCollectionFilterItem::Value>(kvp->Key);
+            VxSdk::Utilities::StrCopySafe(collFilters[i++].value, Utils::ConvertCSharpString(kvp->Value).c_str());
+        }
+
+        // Add the filters to the collection 
+        dataSources.filterSize = filters->Count;
+        dataSources.filters = collFilters;
+    }
+
+    // Make the GetLinkedDataSources call, which will return with the total data source count, this
+    // allows the client to allocate memory.
+    SdkCall sdkCall("IVxTag::GetLinks", dataSources);
+    result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _tag->GetLinks(dataSources));
+    // As long as there are data sources linked the result should be VxSdk::VxResult::kInsufficientSize
+    if (result == VxSdk::VxResult::kInsufficientSize) {
+        // Allocate enough space for the IVxDataSource collection
+        dataSources.collection = new VxSdk::IVxDataSource*[dataSources.collectionSize];
+        sdkCall.Restart("IVxTag::GetLinks", dataSources);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _tag->GetLinks(dataSources));
+        // The result should now be kOK since we have allocated enough space
+        if (result == VxSdk::VxResult::kOK) {
+            for (int i = 0; i < dataSources.collectionSize; i++)
+                mlist->Add(IdentityMap::Intern<DataSource>(_identityMap, dataSources.collection[i]));
+        }
+        // Remove the memory we previously allocated to the collection
+        delete[] dataSources.collection;
+    }
+    return mlist;
+}
+
+System::Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::Tag::_GetLinkedDevices(System::Collections::Generic::Dictionary<Filters::Value, System::String^>^ filters, VxSdk::VxResult::Value& result) {
+    // Create a list of managed devices
+    List<Device^>^ mlist = gcnew List<Device^>();
+    // Create a collection of unmanaged devices
+    VxSdk::VxCollection<VxSdk::IVxDevice**> devices;
+
+    if (filters != nullptr && filters->Count > 0) {
+        // Create our filter
+        VxSdk::VxCollectionFilter* collFilters = new VxSdk::VxCollectionFilter[filters->Count];
+        int i = 0;
+        for each (KeyValuePair<Filters::Value, System::String^>^ kvp in filters)
+        {
+            collFilters[i].key = static_cast<VxSdk::VxCollectionFilterItem::Value>(kvp->Key);
+            VxSdk::Utilities::StrCopySafe(collFilters[i++].value, Utils::ConvertCSharpString(kvp->Value).c_str());
+        }
+
+        // Add the filters to the collection 
+        devices.filterSize = filters->Count;
+        devices.filters = collFilters;
+    }
+
+    // Make the GetLinkedDevices call, which will return with the total device count, this allows the
+    // client to allocate memory.
+    SdkCall sdkCall("IVxTag::GetLinks", devices);
+    result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _tag->GetLinks(devices));
+    // As long as there are devices linked the result should be VxSdk::VxResult::kInsufficientSize
+    if (result == VxSdk::VxResult::kInsufficientSize) {
+        // Allocate enough space for the IVxDevice collection
+        devices.collection = new VxSdk::IVxDevice*[devices.collectionSize];
+        sdkCall.Restart("IVxTag::GetLinks", devices);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _tag->GetLinks(devices));
+        // The result should now be kOK since we have allocated enough space
+        if (result == VxSdk::VxResult::kOK) {
+            for (int i = 0; i < devices.collectionSize; i++)
+                mlist->Add(IdentityMap::Intern<Device>(_identityMap, devices.collection[i]));
+        }
+        // Remove the memory we previously allocated to the collection
+        delete[] devices.collection;
+    }
+    return mlist;
+}
+
 VxSdkNet::User^ VxSdkNet::Tag::_GetOwner() {
     // Get the user that owns this tag
     VxSdk::IVxUser* user = nullptr;
-    VxSdk::VxResult::Value result = _tag->GetOwner(user);
+    SdkCall sdkCall("IVxTag::GetOwner");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _tag->GetOwner(user));
 
     // Return the user if GetOwner was successful
     if (result == VxSdk::VxResult::kOK)
@@ -187,11 +239,26 @@ VxSdkNet::User^ VxSdkNet::Tag::_GetOwner() {
 VxSdkNet::Tag^ VxSdkNet::Tag::_GetParent() {
     // Get the parent tag of this tag, if available
     VxSdk::IVxTag* tag = nullptr;
-    VxSdk::VxResult::Value result = _tag->GetParent(tag);
+    SdkCall sdkCall("IVxTag::GetParent");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _tag->GetParent(tag));
 
     // Return the parent tag if GetParent was successful
     if (result == VxSdk::VxResult::kOK)
-        return gcnew VxSdkNet::Tag(tag);
+        return IdentityMap::Wrap<VxSdkNet::Tag>(_identityMap, tag);
 
     return nullptr;
 }
+
+VxSdkNet::Results::Value VxSdkNet::Tag::_LinkDataSource(System::Object^ item, bool link) {
+    DataSource^ dataSource = safe_cast<DataSource^>(item);
+    NativeReadLock nativeLock(dataSource->_nativeLock);
+    VxSdk::VxResult::Value result = link ? _tag->Link(*dataSource->_dataSource) : _tag->UnLink(*dataSource->_dataSource);
+    return VxSdkNet::Results::Value(result);
+}
+
+VxSdkNet::Results::Value VxSdkNet::Tag::_LinkDevice(System::Object^ item, bool link) {
+    Device^ device = safe_cast<Device^>(item);
+    NativeReadLock nativeLock(device->_nativeLock);
+    VxSdk::VxResult::Value result = link ? _tag->Link(*device->_device) : _tag->UnLink(*device->_device);
+    return VxSdkNet::Results::Value(result);
+}
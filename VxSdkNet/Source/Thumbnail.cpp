@@ -0,0 +1,14 @@
+/// <summary>
+/// Implements the thumbnail class.
+/// </summary>
+#include <msclr/lock.h>
+#include "Thumbnail.h"
+
+System::Drawing::Image^ VxSdkNet::Thumbnail::Image::get() {
+    // Decode the image on first use; the stream must remain open for the lifetime of the image
+    msclr::lock thumbnailLock(this);
+    if (_image == nullptr && _imageData != nullptr)
+        _image = System::Drawing::Image::FromStream(gcnew System::IO::MemoryStream(_imageData));
+
+    return _image;
+}
@@ -0,0 +1,247 @@
+/// <summary>
+/// Implements the thumbnail strip class.
+/// </summary>
+#include <msclr/lock.h>
+#include "ThumbnailStrip.h"
+
+using namespace System;
+using namespace System::Collections::Concurrent;
+using namespace System::Collections::Generic;
+using namespace System::Threading;
+
+typedef KeyValuePair<String^, VxSdkNet::Thumbnail^> ThumbnailEntry;
+
+VxSdkNet::ThumbnailCache::ThumbnailCache(int capacity) : _capacity(capacity) {
+    _entries = gcnew Dictionary<String^, LinkedListNode<ThumbnailEntry>^>();
+    _recent = gcnew LinkedList<ThumbnailEntry>();
+}
+
+void VxSdkNet::ThumbnailCache::Add(String^ key, Thumbnail^ thumbnail) {
+    msclr::lock cacheLock(this);
+    LinkedListNode<ThumbnailEntry>^ node;
+    if (_entries->TryGetValue(key, node))
+        _recent->Remove(node);
+
+    // The most recently used entries are kept at the front of the list
+    _entries[key] = _recent->AddFirst(ThumbnailEntry(key, thumbnail));
+    _Trim();
+}
+
+void VxSdkNet::ThumbnailCache::Clear() {
+    msclr::lock cacheLock(this);
+    _entries->Clear();
+    _recent->Clear();
+}
+
+VxSdkNet::Thumbnail^ VxSdkNet::ThumbnailCache::Get(String^ key) {
+    msclr::lock cacheLock(this);
+    LinkedListNode<ThumbnailEntry>^ node;
+    if (!_entries->TryGetValue(key, node))
+        return nullptr;
+
+    _recent->Remove(node);
+    _recent->AddFirst(node);
+    return node->Value.Value;
+}
+
+void VxSdkNet::ThumbnailCache::Capacity::set(int value) {
+    msclr::lock cacheLock(this);
+    _capacity = value;
+    _Trim();
+}
+
+void VxSdkNet::ThumbnailCache::_Trim() {
+    // Evict the least recently used entries
+    while (_entries->Count > _capacity && _recent->Last != nullptr) {
+        _entries->Remove(_recent->Last->Value.Key);
+        _recent->RemoveLast();
+    }
+}
+
+VxSdkNet::ThumbnailStrip::ThumbnailStrip(DataSource^ dataSource) {
+    _dataSource = dataSource;
+    _dataSourceId = dataSource->Id;
+    MaxConcurrentRequests = 4;
+    Timeout = 10000;
+    Width = 160;
+}
+
+void VxSdkNet::ThumbnailStrip::ClearCache() {
+    _cache->Clear();
+}
+
+int VxSdkNet::ThumbnailStrip::Generate(DateTime startTime, DateTime endTime, TimeSpan spacing, ThumbnailDelegate^ callback) {
+    startTime = startTime.ToUniversalTime();
+    endTime = endTime.ToUniversalTime();
+    if (callback == nullptr || spacing <= TimeSpan::Zero || endTime <= startTime)
+        return 0;
+
+    ThumbnailJob^ job = gcnew ThumbnailJob();
+    job->Requests = gcnew ConcurrentQueue<ThumbnailRequest^>();
+    job->Callback = callback;
+
+    // Thumbnails are aligned to multiples of the spacing so that overlapping ranges share cache entries
+    long long firstBucket = (startTime.Ticks + spacing.Ticks - 1) / spacing.Ticks;
+    long long lastBucket = (endTime.Ticks - 1) / spacing.Ticks;
+
+    List<Clip^>^ clips = nullptr;
+    array<long long>^ clipStarts = nullptr;
+    array<long long>^ clipEnds = nullptr;
+    array<long long>^ clipMaxEnds = nullptr;
+    for (long long bucket = firstBucket; bucket <= lastBucket; bucket++) {
+        DateTime time(bucket * spacing.Ticks, DateTimeKind::Utc);
+        String^ key = _GetKey(bucket, spacing);
+
+        // Deliver cached thumbnails straight away
+        Thumbnail^ thumbnail = _cache->Get(key);
+        if (thumbnail != nullptr) {
+            job->Delivered++;
+            callback(thumbnail);
+            continue;
+        }
+
+        // Resolve the clips for the whole range the first time one is needed
+        if (clips == nullptr) {
+            Dictionary<Filters::Value, String^>^ filters = gcnew Dictionary<Filters::Value, String^>();
+            filters->Add(Filters::Value::SearchStartTime, Utils::ConvertCppString(Utils::ConvertCSharpDateTime(startTime)));
+            filters->Add(Filters::Value::SearchEndTime, Utils::ConvertCppString(Utils::ConvertCSharpDateTime(endTime)));
+            clips = _dataSource->GetClips(filters);
+
+            // Parse the clip times once so that each lookup is a binary search.  The latest end of each clip and
+            // those that start before it bounds how far back a covering clip can be.
+            array<Clip^>^ sortedClips = clips->ToArray();
+            clipStarts = gcnew array<long long>(sortedClips->Length);
+            clipEnds = gcnew array<long long>(sortedClips->Length);
+            clipMaxEnds = gcnew array<long long>(sortedClips->Length);
+            for (int i = 0; i < sortedClips->Length; i++)
+                clipStarts[i] = sortedClips[i]->StartTime.Ticks;
+
+            Array::Sort(clipStarts, sortedClips);
+            for (int i = 0; i < sortedClips->Length; i++) {
+                clipEnds[i] = sortedClips[i]->EndTime.Ticks;
+                clipMaxEnds[i] = i > 0 ? Math::Max(clipMaxEnds[i - 1], clipEnds[i]) : clipEnds[i];
+            }
+
+            clips = gcnew List<Clip^>(sortedClips);
+        }
+
+        // Find the clip that covers the thumbnail time, if any; the latest starting clip is checked first, stopping
+        // once no earlier clip runs past the time
+        int index = Array::BinarySearch(clipStarts, time.Ticks);
+        if (index < 0)
+            index = ~index - 1;
+
+        for (int i = index; i >= 0 && clipMaxEnds[i] > time.Ticks; i--) {
+            if (clipEnds[i] > time.Ticks) {
+                job->Requests->Enqueue(gcnew ThumbnailRequest(clips[i], time, key));
+                break;
+            }
+        }
+    }
+
+    // Fetch the remaining thumbnails using a bounded number of workers
+    int workers = Math::Min(Math::Max(MaxConcurrentRequests, 1), job->Requests->Count);
+    if (workers > 0) {
+        job->Workers = gcnew CountdownEvent(workers);
+        for (int i = 0; i < workers; i++)
+            ThreadPool::QueueUserWorkItem(gcnew WaitCallback(this, &VxSdkNet::ThumbnailStrip::_RunRequests), job);
+
+        job->Workers->Wait();
+    }
+
+    return job->Delivered;
+}
+
+array<unsigned char>^ VxSdkNet::ThumbnailStrip::_Download(String^ uri) {
+    System::Net::HttpWebRequest^ request = safe_cast<System::Net::HttpWebRequest^>(System::Net::WebRequest::Create(uri));
+    request->Timeout = Timeout;
+    request->KeepAlive = true;
+
+    // Allow as many persistent connections to the server as there are workers
+    if (request->ServicePoint->ConnectionLimit < MaxConcurrentRequests)
+        request->ServicePoint->ConnectionLimit = MaxConcurrentRequests;
+
+    System::Net::WebResponse^ response = nullptr;
+    try {
+        response = request->GetResponse();
+        System::IO::MemoryStream^ imageData = gcnew System::IO::MemoryStream();
+        response->GetResponseStream()->CopyTo(imageData);
+        return imageData->ToArray();
+    }
+    catch (System::Net::WebException^) {
+        return nullptr;
+    }
+    catch (System::IO::IOException^) {
+        return nullptr;
+    }
+    finally {
+        if (response != nullptr)
+            delete response;
+    }
+}
+
+VxSdkNet::Thumbnail^ VxSdkNet::ThumbnailStrip::_Fetch(Clip^ clip, DateTime time, String^ key) {
+    // Share the fetch with any other request for the same thumbnail that is already in progress
+    PendingThumbnail^ pending = gcnew PendingThumbnail();
+    PendingThumbnail^ existing = _pending->GetOrAdd(key, pending);
+    if (existing != pending) {
+        existing->Completed->WaitOne();
+        return existing->Result;
+    }
+
+    // The thumbnail may have been cached by a fetch that completed since the cache was checked
+    Thumbnail^ thumbnail = nullptr;
+    try {
+        thumbnail = _cache->Get(key);
+        if (thumbnail == nullptr) {
+            SnapshotFilter^ filter = gcnew SnapshotFilter();
+            filter->StartTime = time;
+            filter->Width = Width;
+            String^ uri = clip->GetSnapshotEndpoint(filter);
+
+            array<unsigned char>^ imageData = String::IsNullOrEmpty(uri) ? nullptr : _Download(uri);
+            if (imageData != nullptr && imageData->Length > 0) {
+                thumbnail = gcnew Thumbnail(_dataSourceId, time, imageData);
+                _cache->Add(key, thumbnail);
+            }
+        }
+    }
+    finally {
+        // Release any requests waiting on this fetch, even if it failed
+        pending->Result = thumbnail;
+        PendingThumbnail^ removed;
+        _pending->TryRemove(key, removed);
+        pending->Completed->Set();
+    }
+
+    return thumbnail;
+}
+
+String^ VxSdkNet::ThumbnailStrip::_GetKey(long long bucket, TimeSpan spacing) {
+    return String::Format("{0}|{1}|{2}|{3}", _dataSourceId, Width, spacing.Ticks, bucket);
+}
+
+void VxSdkNet::ThumbnailStrip::_RunRequests(Object^ state) {
+    ThumbnailJob^ job = safe_cast<ThumbnailJob^>(state);
+    try {
+        ThumbnailRequest^ request;
+        while (job->Requests->TryDequeue(request)) {
+            Thumbnail^ thumbnail = _Fetch(request->Clip, request->Time, request->Key);
+            if (thumbnail != nullptr) {
+                // Pass thumbnails to the callback one at a time so that it does not need to be thread safe
+                msclr::lock jobLock(job);
+                job->Delivered++;
+                try {
+                    job->Callback(thumbnail);
+                }
+                catch (Exception^) {
+                    // Don't let the callback's exception escape onto the worker thread
+                    Interlocked::Increment(_callbackErrors);
+                }
+            }
+        }
+    }
+    finally {
+        job->Workers->Signal();
+    }
+}
@@ -2,26 +2,30 @@
 /// Implements the time table class.
 /// </summary>
 #include "TimeTable.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::TimeTable::TimeTable(VxSdk::IVxTimeTable* vxTimeTable) {
     _timeTable = vxTimeTable;
+    NativeMemory::Add(_timeTable);
 }
 
 VxSdkNet::TimeTable::!TimeTable() {
-    _timeTable->Delete();
+    NativeReleaseQueue::Release(_timeTable);
     _timeTable = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::TimeTable::Refresh() {
-    return (VxSdkNet::Results::Value)_timeTable->Refresh();
+    SdkCall sdkCall("IVxTimeTable::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _timeTable->Refresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::TimeTable::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _timeTable->GetLimits(limits);
+    SdkCall sdkCall("IVxTimeTable::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _timeTable->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -54,7 +58,8 @@ VxSdkNet::Results::Value VxSdkNet::TimeTable::_SetWeeklyTimeRanges(System::Colle
         }
     }
     // Attempt to set the weekly time ranges and return the result
-    VxSdkNet::Results::Value result = (VxSdkNet::Results::Value)_timeTable->SetWeeklyTimeRanges(timeRanges, timeRangeListSize);
+    SdkCall sdkCall("IVxTimeTable::SetWeeklyTimeRanges");
+    VxSdkNet::Results::Value result = (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _timeTable->SetWeeklyTimeRanges(timeRanges, timeRangeListSize));
     for (int i = 0; i < timeRangeListSize; i++) {
         delete[] timeRanges[i];
     }
@@ -3,21 +3,24 @@
 /// </summary>
 
 #include "User.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::User::User(VxSdk::IVxUser* vxUser) {
     _user = vxUser;
+    NativeMemory::Add(_user);
 }
 
 VxSdkNet::User::!User() {
-    _user->Delete();
+    NativeReleaseQueue::Release(_user);
     _user = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::User::AddToRole(VxSdkNet::Role^ role) {
     // Make the call to add the user to the role
-    VxSdk::VxResult::Value result = _user->AddToRole(*role->_role);
+    SdkCall sdkCall("IVxUser::AddToRole");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _user->AddToRole(*role->_role));
     // Unless there was an issue adding the user the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -45,12 +48,14 @@ System::Collections::Generic::List<VxSdkNet::DataObject^>^ VxSdkNet::User::GetDa
 
     // Make the GetDataObjects call, which will return with the total data object count, this allows the
     // client to allocate memory.
-    VxSdk::VxResult::Value result = _user->GetDataObjects(dataObjects);
+    SdkCall sdkCall("IVxUser::GetDataObjects", dataObjects);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _user->GetDataObjects(dataObjects));
     // As long as there are data objects linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDataObject collection
         dataObjects.collection = new VxSdk::IVxDataObject*[dataObjects.collectionSize];
-        result = _user->GetDataObjects(dataObjects);
+        sdkCall.Restart("IVxUser::GetDataObjects", dataObjects);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _user->GetDataObjects(dataObjects));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < dataObjects.collectionSize; i++)
@@ -85,12 +90,14 @@ System::Collections::Generic::List<VxSdkNet::Role^>^ VxSdkNet::User::GetRoles(Sy
 
     // Make the GetRoles call, which will return with the total role count, this
     // allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _user->GetRoles(roles);
+    SdkCall sdkCall("IVxUser::GetRoles", roles);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _user->GetRoles(roles));
     // As long as there are roles linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxRole collection
         roles.collection = new VxSdk::IVxRole*[roles.collectionSize];
-        result = _user->GetRoles(roles);
+        sdkCall.Restart("IVxUser::GetRoles", roles);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _user->GetRoles(roles));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < roles.collectionSize; i++)
@@ -125,12 +132,14 @@ System::Collections::Generic::List<VxSdkNet::Tag^>^ VxSdkNet::User::GetTags(Syst
 
     // Make the GetTags call, which will return with the total tag count, this
     // allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _user->GetTags(tags);
+    SdkCall sdkCall("IVxUser::GetTags", tags);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _user->GetTags(tags));
     // As long as there are tags linked the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxTag collection
         tags.collection = new VxSdk::IVxTag*[tags.collectionSize];
-        result = _user->GetTags(tags);
+        sdkCall.Restart("IVxUser::GetTags", tags);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _user->GetTags(tags));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < tags.collectionSize; i++)
@@ -143,12 +152,14 @@ System::Collections::Generic::List<VxSdkNet::Tag^>^ VxSdkNet::User::GetTags(Syst
 }
 
 VxSdkNet::Results::Value VxSdkNet::User::Refresh() {
-    return (VxSdkNet::Results::Value)_user->Refresh();
+    SdkCall sdkCall("IVxUser::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _user->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::User::RemoveFromRole(VxSdkNet::Role^ role) {
     // Make the call to remove the user from the role
-    VxSdk::VxResult::Value result = _user->RemoveFromRole(*role->_role);
+    SdkCall sdkCall("IVxUser::RemoveFromRole");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _user->RemoveFromRole(*role->_role));
     // Unless there was an issue removing the user from the role the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -158,7 +169,8 @@ VxSdkNet::Results::Value VxSdkNet::User::SetPassword(System::String^ newPassword
     VxSdk::Utilities::StrCopySafe(password, Utils::ConvertCSharpString(newPassword).c_str());
 
     // Make the call to set the users password
-    VxSdk::VxResult::Value result = _user->SetPassword(password, mustChangePassword);
+    SdkCall sdkCall("IVxUser::SetPassword");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _user->SetPassword(password, mustChangePassword));
     // Unless there was an issue setting the password the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -173,7 +185,8 @@ bool VxSdkNet::User::_GetAccountState() {
 VxSdkNet::ResourceLimits^ VxSdkNet::User::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _user->GetLimits(limits);
+    SdkCall sdkCall("IVxUser::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _user->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -185,7 +198,8 @@ VxSdkNet::ResourceLimits^ VxSdkNet::User::_GetLimits() {
 VxSdkNet::UserAccount^ VxSdkNet::User::_GetUserAccount() {
     // Get the user account for this user
     VxSdk::IVxUserAccount* userAccount = nullptr;
-    VxSdk::VxResult::Value result = _user->GetUserAccount(userAccount);
+    SdkCall sdkCall("IVxUser::GetUserAccount");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _user->GetUserAccount(userAccount));
 
     // Return the user account if GetUserAccount was successful
     if (result == VxSdk::VxResult::kOK)
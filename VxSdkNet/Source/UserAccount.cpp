@@ -3,26 +3,30 @@
 /// </summary>
 
 #include "UserAccount.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::UserAccount::UserAccount(VxSdk::IVxUserAccount* vxUserAccount) {
     _userAccount = vxUserAccount;
+    NativeMemory::Add(_userAccount);
 }
 
 VxSdkNet::UserAccount::!UserAccount() {
-    _userAccount->Delete();
+    NativeReleaseQueue::Release(_userAccount);
     _userAccount = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::UserAccount::Refresh() {
-    return (VxSdkNet::Results::Value)_userAccount->Refresh();
+    SdkCall sdkCall("IVxUserAccount::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _userAccount->Refresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::UserAccount::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _userAccount->GetLimits(limits);
+    SdkCall sdkCall("IVxUserAccount::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _userAccount->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
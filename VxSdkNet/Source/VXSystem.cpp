@@ -1,6 +1,7 @@
 /// <summary>
 /// Implements the VX System class.
 /// </summary>
+#include <msclr/lock.h>
 #include "AnalyticSession.h"
 #include "VxSystem.h"
 #include "VxSdk.h"
@@ -39,6 +40,9 @@ VxSdkNet::VXSystem::VXSystem(String^ ip, String^ licenseKey) : _loginInfo(new Vx
     VxSdk::Utilities::StrCopySafe(_loginInfo->licenseKey, Utils::ConvertCSharpString(licenseKey).c_str());
     _loginInfo->useSsl = true;
     _eventDelegate = nullptr;
+    _eventHandlers = gcnew List<EventDelegate^>();
+    _identityMap = gcnew IdentityMap();
+    _notificationLock = gcnew Object();
 }
 
 VxSdkNet::VXSystem::VXSystem(String^ ip, int port, bool useSSL, String^ licenseKey) : _loginInfo(new VxSdk::VxLoginInfo()) {
@@ -48,13 +52,19 @@ VxSdkNet::VXSystem::VXSystem(String^ ip, int port, bool useSSL, String^ licenseK
     _loginInfo->port = port;
     _loginInfo->useSsl = useSSL;
     _eventDelegate = nullptr;
+    _eventHandlers = gcnew List<EventDelegate^>();
+    _identityMap = gcnew IdentityMap();
+    _notificationLock = gcnew Object();
 }
 
 VxSdkNet::VXSystem::!VXSystem() {
     // Delete system object
     if (_system != nullptr) {
-        // Unsubscribe to the system events
+        // Unsubscribe to the system events, including those of any other subscribers
         UnsubscribeToEvents();
+        if (_notificationUsers > 0)
+            _system->StopNotifications();
+
         _system->StopInternalNotifications();
         delete _callback;
         _system->Delete();
@@ -76,7 +86,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddAnalyticSession(NewAnalyticSessi
     VxSdk::Utilities::StrCopySafe(vxNewAnalyticSession.source, Utils::ConvertCSharpString(newAnalyticSession->Source).c_str());
 
     // Attempt to add the analytic session
-    return VxSdkNet::Results::Value(_system->AddAnalyticSession(vxNewAnalyticSession));
+    SdkCall sdkCall("IVxSystem::AddAnalyticSession");
+    return VxSdkNet::Results::Value(sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddAnalyticSession(vxNewAnalyticSession)));
 }
 
 VxSdkNet::Results::Value VxSdkNet::VXSystem::AddBookmark(VxSdkNet::NewBookmark^ newBookmark) {
@@ -92,7 +103,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddBookmark(VxSdkNet::NewBookmark^
     vxBookmark.isLocked = newBookmark->IsLocked;
 
     // Make the call to add the bookmark into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddBookmark(vxBookmark);
+    SdkCall sdkCall("IVxSystem::AddBookmark");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddBookmark(vxBookmark));
     // Unless there was an issue creating the bookmark the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -106,7 +118,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddDataObject(VxSdkNet::NewDataObje
     vxDataObject.isPrivate = newDataObject->IsPrivate;
 
     // Make the call to add the data object into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddDataObject(vxDataObject);
+    SdkCall sdkCall("IVxSystem::AddDataObject");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddDataObject(vxDataObject));
     // Unless there was an issue creating the data object the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -138,7 +151,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddDevice(VxSdkNet::NewDevice^ newD
     }
 
     // Make the call to add the device into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddDevice(vxNewDevice);
+    SdkCall sdkCall("IVxSystem::AddDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddDevice(vxNewDevice));
     // Unless there was an issue creating the device the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -148,7 +162,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddDrawing(System::String^ drawingN
     VxSdk::Utilities::StrCopySafe(vxDrawing.name, Utils::ConvertCSharpString(drawingName).c_str());
 
     // Make the call to add the drawing into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddDrawing(vxDrawing);
+    SdkCall sdkCall("IVxSystem::AddDrawing");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddDrawing(vxDrawing));
     // Unless there was an issue creating the drawing the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -180,7 +195,8 @@ VxSdkNet::Export^ VxSdkNet::VXSystem::AddExport(VxSdkNet::NewExport^ newExport)
     VxSdkNet::Export^ retExport = nullptr;
     // Attempt to create the export
     VxSdk::IVxExport* exportItem = nullptr;
-    VxSdk::VxResult::Value result = _system->CreateExport(vxExport, exportItem);
+    SdkCall sdkCall("IVxSystem::CreateExport");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->CreateExport(vxExport, exportItem));
 
     // Unless there was an issue initiating the export the result should be VxSdk::VxResult::kOK
     if (result == VxSdk::VxResult::kOK) {
@@ -200,7 +216,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddFile(System::String^ filePath, S
     VxSdk::Utilities::StrCopySafe(name, Utils::ConvertCSharpString(filename).c_str());
 
     // Make the call to add the drawing into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddFile((char*)Utils::ConvertCSharpString(filePath).c_str(), name);
+    SdkCall sdkCall("IVxSystem::AddFile");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddFile((char*)Utils::ConvertCSharpString(filePath).c_str(), name));
     // Unless there was an issue creating the drawing the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -214,11 +231,12 @@ VxSdkNet::ManualRecording^ VxSdkNet::VXSystem::AddManualRecording(VxSdkNet::NewM
     VxSdkNet::ManualRecording^ retManualRecording = nullptr;
     // Make the call to add the manual recording into VideoXpert
     VxSdk::IVxManualRecording* manualRecordingItem = nullptr;
-    VxSdk::VxResult::Value result = _system->AddManualRecording(vxNewManualRecording, manualRecordingItem);
+    SdkCall sdkCall("IVxSystem::AddManualRecording");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddManualRecording(vxNewManualRecording, manualRecordingItem));
 
     // Unless there was an issue adding the manual recording the result should be VxSdk::VxResult::kOK
     if (result == VxSdk::VxResult::kOK) {
-        retManualRecording = gcnew VxSdkNet::ManualRecording(manualRecordingItem);
+        retManualRecording = IdentityMap::Wrap<VxSdkNet::ManualRecording>(_identityMap, manualRecordingItem);
     }
     return retManualRecording;
 }
@@ -234,14 +252,16 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddMember(NewMember^ newMember) {
     vxNewMember.rtspCapability = (VxSdk::VxRtspCapability::Value)newMember->RtspCapabilities;
 
     // Make the call to add the member into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddMember(vxNewMember);
+    SdkCall sdkCall("IVxSystem::AddMember");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddMember(vxNewMember));
     // Unless there was an issue adding the member the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
 
 VxSdkNet::Results::Value VxSdkNet::VXSystem::AddMonitorWall(System::String^ monitorWallName) {
     // Make the call to add the monitor wall into VideoXpert
-    VxSdk::VxResult::Value result = _system->CreateMonitorWall(Utils::ConvertCSharpString(monitorWallName).c_str());
+    SdkCall sdkCall("IVxSystem::CreateMonitorWall");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->CreateMonitorWall(Utils::ConvertCSharpString(monitorWallName).c_str()));
     // Unless there was an issue creating the monitor wall the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -269,11 +289,12 @@ VxSdkNet::Recording^ VxSdkNet::VXSystem::AddRecording(VxSdkNet::NewRecording^ ne
     VxSdkNet::Recording^ retRecording = nullptr;
     // Make the call to add the recording into VideoXpert
     VxSdk::IVxRecording* recordingItem = nullptr;
-    VxSdk::VxResult::Value result = _system->AddRecording(vxNewRecording, recordingItem);
+    SdkCall sdkCall("IVxSystem::AddRecording");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddRecording(vxNewRecording, recordingItem));
 
     // Unless there was an issue adding the recording the result should be VxSdk::VxResult::kOK
     if (result == VxSdk::VxResult::kOK) {
-        retRecording = gcnew VxSdkNet::Recording(recordingItem);
+        retRecording = IdentityMap::Wrap<VxSdkNet::Recording>(_identityMap, recordingItem);
     }
     return retRecording;
 }
@@ -286,7 +307,8 @@ VxSdkNet::Report^ VxSdkNet::VXSystem::AddReport(NewReport^ newReport) {
     VxSdkNet::Report^ retReport = nullptr;
     // Make the call to add the report into VideoXpert
     VxSdk::IVxReport* reportItem = nullptr;
-    VxSdk::VxResult::Value result = _system->CreateReport(vxNewReport, reportItem);
+    SdkCall sdkCall("IVxSystem::CreateReport");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->CreateReport(vxNewReport, reportItem));
 
     // Unless there was an issue adding the report the result should be VxSdk::VxResult::kOK
     if (result == VxSdk::VxResult::kOK) {
@@ -364,7 +386,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddReportTemplate(NewReportTemplate
     }
 
     // Make the call to add the report template into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddReportTemplate(vxNewReportTemplate);
+    SdkCall sdkCall("IVxSystem::AddReportTemplate");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddReportTemplate(vxNewReportTemplate));
 
     delete[] vxNewReportTemplate.fields;
     delete[] vxNewReportTemplate.filters;
@@ -376,7 +399,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddReportTemplate(NewReportTemplate
 
 VxSdkNet::Results::Value VxSdkNet::VXSystem::AddRole(System::String^ roleName) {
     // Make the call to add the role into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddRole(Utils::ConvertCSharpString(roleName).c_str());
+    SdkCall sdkCall("IVxSystem::AddRole");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddRole(Utils::ConvertCSharpString(roleName).c_str()));
     // Unless there was an issue creating the role the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -434,7 +458,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddRule(VxSdkNet::NewRule^ newRule)
     }
 
     // Make the call to add the rule into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddRule(vxNewRule);
+    SdkCall sdkCall("IVxSystem::AddRule");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddRule(vxNewRule));
 
     for (int i = 0; i < vxNewRule.timeTableIdSize; i++)
         delete[] vxNewRule.timeTableIds[i];
@@ -481,7 +506,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddSchedule(VxSdkNet::NewSchedule^
     }
 
     // Make the call to add the schedule into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddSchedule(vxSchedule);
+    SdkCall sdkCall("IVxSystem::AddSchedule");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddSchedule(vxSchedule));
 
     // Unless there was an issue adding the schedule the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
@@ -512,7 +538,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddSituation(VxSdkNet::NewSituation
     }
 
     // Make the call to add the situation into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddSituation(vxSituation);
+    SdkCall sdkCall("IVxSystem::AddSituation");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddSituation(vxSituation));
 
     // Remove the memory we previously allocated
     delete[] vxSituation.snoozeIntervals;
@@ -529,7 +556,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddTag(VxSdkNet::NewTag^ newTag) {
     vxTag.isPublic = newTag->IsPublic;
 
     // Make the call to add the tag into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddTag(vxTag);
+    SdkCall sdkCall("IVxSystem::AddTag");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddTag(vxTag));
     // Unless there was an issue creating the tag the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -561,7 +589,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddTimeTable(VxSdkNet::NewTimeTable
     }
 
     // Make the call to add the time table into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddTimeTable(vxNewTimeTable);
+    SdkCall sdkCall("IVxSystem::AddTimeTable");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddTimeTable(vxNewTimeTable));
 
     delete[] vxNewTimeTable.weeklyTimeRanges;
     vxNewTimeTable.weeklyTimeRanges = nullptr;
@@ -594,7 +623,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddUser(VxSdkNet::NewUser^ newUser)
     }
 
     // Make the call to add the user into VideoXpert
-    VxSdk::VxResult::Value result = _system->AddUser(vxNewUser);
+    SdkCall sdkCall("IVxSystem::AddUser");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->AddUser(vxNewUser));
 
     delete[] vxNewUser.phoneNumbers;
     vxNewUser.phoneNumbers = nullptr;
@@ -614,7 +644,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddVxMonitor(NewMonitor^ newMonitor
     vxNewMonitor.yResolution = newMonitor->ResolutionY;
 
     // Make the call to add the monitor into VideoXpert
-    VxSdk::VxResult::Value result = _system->CreateMonitor(vxNewMonitor);
+    SdkCall sdkCall("IVxSystem::CreateMonitor");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->CreateMonitor(vxNewMonitor));
     // Unless there was an issue creating the monitor the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -622,12 +653,16 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::AddVxMonitor(NewMonitor^ newMonitor
 VxSdkNet::Results::Value VxSdkNet::VXSystem::CommissionDevice(VxSdkNet::Device^ device) {
     // Get the license object
     VxSdk::IVxLicense* license = nullptr;
-    VxSdk::VxResult::Value result = _system->GetLicense(license);
+    SdkCall sdkCall("IVxSystem::GetLicense");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetLicense(license));
     if (license == nullptr)
         return (VxSdkNet::Results::Value)result;
 
-    if (result == VxSdk::VxResult::kOK )
-        result = license->CommissionDevice(*device->_device);
+    if (result == VxSdk::VxResult::kOK ) {
+        NativeReadLock nativeLock(device->_nativeLock);
+        sdkCall.Restart("IVxLicense::CommissionDevice");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : license->CommissionDevice(*device->_device));
+    }
 
     license->Delete();
     license = nullptr;
@@ -638,12 +673,16 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::CommissionDevice(VxSdkNet::Device^
 VxSdkNet::Results::Value VxSdkNet::VXSystem::DecommissionDevice(VxSdkNet::Device^ device) {
     // Get the license object
     VxSdk::IVxLicense* license = nullptr;
-    VxSdk::VxResult::Value result = _system->GetLicense(license);
+    SdkCall sdkCall("IVxSystem::GetLicense");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetLicense(license));
     if (license == nullptr)
         return (VxSdkNet::Results::Value)result;
 
-    if (result == VxSdk::VxResult::kOK )
-        result = license->DecommissionDevice(*device->_device);
+    if (result == VxSdk::VxResult::kOK ) {
+        NativeReadLock nativeLock(device->_nativeLock);
+        sdkCall.Restart("IVxLicense::DecommissionDevice");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : license->DecommissionDevice(*device->_device));
+    }
 
     license->Delete();
     license = nullptr;
@@ -677,7 +716,9 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::DeleteDataObject(VxSdkNet::DataObje
 
 VxSdkNet::Results::Value VxSdkNet::VXSystem::DeleteDevice(VxSdkNet::Device^ device) {
     // To delete a device simply make a DeleteDevice call
-    VxSdk::VxResult::Value result = device->_device->DeleteDevice();
+    NativeReadLock nativeLock(device->_nativeLock);
+    SdkCall sdkCall("IVxDevice::DeleteDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : device->_device->DeleteDevice());
     // Unless there was an issue deleting the device the result should be VxSdk::VxResult::kOK
     return VxSdkNet::Results::Value(result);
 }
@@ -816,16 +857,18 @@ List<VxSdkNet::AccessPoint^>^ VxSdkNet::VXSystem::GetAccessPoints(System::Collec
     }
 
     // Make the GetAccessPoints call, which will return with the total count of access points, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetAccessPoints(accessPoints);
+    SdkCall sdkCall("IVxSystem::GetAccessPoints", accessPoints);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetAccessPoints(accessPoints));
     // Unless there are no access points on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetAccessPoints call
         accessPoints.collection = new VxSdk::IVxAccessPoint * [accessPoints.collectionSize];
-        result = _system->GetAccessPoints(accessPoints);
+        sdkCall.Restart("IVxSystem::GetAccessPoints", accessPoints);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetAccessPoints(accessPoints));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < accessPoints.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::AccessPoint(accessPoints.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::AccessPoint>(_identityMap, accessPoints.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] accessPoints.collection;
@@ -855,16 +898,18 @@ List<VxSdkNet::AlarmInput^>^ VxSdkNet::VXSystem::GetAlarmInputs(System::Collecti
     }
 
     // Make the GetAlarmInputs call, which will return with the total count of alarm inputs, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetAlarmInputs(alarmInputs);
+    SdkCall sdkCall("IVxSystem::GetAlarmInputs", alarmInputs);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetAlarmInputs(alarmInputs));
     // Unless there are no alarm inputs on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetAlarmInputs call
         alarmInputs.collection = new VxSdk::IVxAlarmInput*[alarmInputs.collectionSize];
-        result = _system->GetAlarmInputs(alarmInputs);
+        sdkCall.Restart("IVxSystem::GetAlarmInputs", alarmInputs);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetAlarmInputs(alarmInputs));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < alarmInputs.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::AlarmInput(alarmInputs.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::AlarmInput>(_identityMap, alarmInputs.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] alarmInputs.collection;
@@ -894,16 +939,18 @@ List<VxSdkNet::AnalyticSession^>^ VxSdkNet::VXSystem::GetAnalyticSessions(System
     }
 
     // Make the GetAnalyticSessions call, which will return with the total analytic session count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetAnalyticSessions(analyticSessions);
+    SdkCall sdkCall("IVxSystem::GetAnalyticSessions", analyticSessions);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetAnalyticSessions(analyticSessions));
     // As long as there are analytic sessions for this datasource the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxAnalyticSession collection
         analyticSessions.collection = new VxSdk::IVxAnalyticSession * [analyticSessions.collectionSize];
-        result = _system->GetAnalyticSessions(analyticSessions);
+        sdkCall.Restart("IVxSystem::GetAnalyticSessions", analyticSessions);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetAnalyticSessions(analyticSessions));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < analyticSessions.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::AnalyticSession(analyticSessions.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::AnalyticSession>(_identityMap, analyticSessions.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] analyticSessions.collection;
@@ -933,16 +980,18 @@ List<VxSdkNet::Bookmark^>^ VxSdkNet::VXSystem::GetBookmarks(System::Collections:
     }
 
     // Make the GetBookmarks call, which will return with the total bookmark count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _system->GetBookmarks(bookmarks);
+    SdkCall sdkCall("IVxSystem::GetBookmarks", bookmarks);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetBookmarks(bookmarks));
     // The result should be kInsufficientSize if the number of bookmarks on the system are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxBookmark collection
         bookmarks.collection = new VxSdk::IVxBookmark*[bookmarks.collectionSize];
-        result = _system->GetBookmarks(bookmarks);
+        sdkCall.Restart("IVxSystem::GetBookmarks", bookmarks);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetBookmarks(bookmarks));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < bookmarks.collectionSize; i++) {
-                mlist->Add(gcnew VxSdkNet::Bookmark(bookmarks.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::Bookmark>(_identityMap, bookmarks.collection[i]));
             }
         }
         // Remove the memory we previously allocated to the collection
@@ -973,12 +1022,14 @@ List<VxSdkNet::DataObject^>^ VxSdkNet::VXSystem::GetDataObjects(System::Collecti
     }
 
     // Make the GetDataObjects call, which will return with the total data object count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _system->GetDataObjects(dataObjects);
+    SdkCall sdkCall("IVxSystem::GetDataObjects", dataObjects);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDataObjects(dataObjects));
     // The result should be kInsufficientSize if the number of data objects on the system are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDataObject collection
         dataObjects.collection = new VxSdk::IVxDataObject*[dataObjects.collectionSize];
-        result = _system->GetDataObjects(dataObjects);
+        sdkCall.Restart("IVxSystem::GetDataObjects", dataObjects);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDataObjects(dataObjects));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < dataObjects.collectionSize; i++) {
@@ -1013,16 +1064,18 @@ Collections::Generic::List<VxSdkNet::DataSource^>^ VxSdkNet::VXSystem::GetDataSo
     }
 
     // Make the GetDataSources call, which will return with the total data source count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetDataSources(dataSources);
+    SdkCall sdkCall("IVxSystem::GetDataSources", dataSources);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDataSources(dataSources));
     // Unless there are no data sources on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDataSource collection
         dataSources.collection = new VxSdk::IVxDataSource*[dataSources.collectionSize];
-        result = _system->GetDataSources(dataSources);
+        sdkCall.Restart("IVxSystem::GetDataSources", dataSources);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDataSources(dataSources));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < dataSources.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::DataSource(dataSources.collection[i]));
+                mlist->Add(IdentityMap::Intern<VxSdkNet::DataSource>(_identityMap, dataSources.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] dataSources.collection;
@@ -1052,16 +1105,18 @@ List<VxSdkNet::DataStorage^>^ VxSdkNet::VXSystem::GetDataStorages(System::Collec
     }
 
     // Make the GetDataStorages call, which will return with the total storage count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _system->GetDataStorages(dataStorages);
+    SdkCall sdkCall("IVxSystem::GetDataStorages", dataStorages);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDataStorages(dataStorages));
     // The result should be kInsufficientSize if the number of data storages on the system are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDataStorage collection
         dataStorages.collection = new VxSdk::IVxDataStorage*[dataStorages.collectionSize];
-        result = _system->GetDataStorages(dataStorages);
+        sdkCall.Restart("IVxSystem::GetDataStorages", dataStorages);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDataStorages(dataStorages));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < dataStorages.collectionSize; i++) {
-                mlist->Add(gcnew VxSdkNet::DataStorage(dataStorages.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::DataStorage>(_identityMap, dataStorages.collection[i]));
             }
         }
         // Remove the memory we previously allocated to the collection
@@ -1092,16 +1147,18 @@ List<VxSdkNet::DeviceAssignment^>^ VxSdkNet::VXSystem::GetDeviceAssignments(Syst
     }
 
     // Make the GetDeviceAssignments call, which will return with the total count of device assignments, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetDeviceAssignments(deviceAssignments);
+    SdkCall sdkCall("IVxSystem::GetDeviceAssignments", deviceAssignments);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDeviceAssignments(deviceAssignments));
     // Unless there are no device assignments on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetDeviceAssignments call
         deviceAssignments.collection = new VxSdk::IVxDeviceAssignment*[deviceAssignments.collectionSize];
-        result = _system->GetDeviceAssignments(deviceAssignments);
+        sdkCall.Restart("IVxSystem::GetDeviceAssignments", deviceAssignments);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDeviceAssignments(deviceAssignments));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < deviceAssignments.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::DeviceAssignment(deviceAssignments.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::DeviceAssignment>(_identityMap, deviceAssignments.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] deviceAssignments.collection;
@@ -1131,16 +1188,18 @@ Collections::Generic::List<VxSdkNet::Device^>^ VxSdkNet::VXSystem::GetDevices(Sy
     }
 
     // Make the GetDevices call, which will return with the total device count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetDevices(devices);
+    SdkCall sdkCall("IVxSystem::GetDevices", devices);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDevices(devices));
     // Unless there are no devices on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDevice collection
         devices.collection = new VxSdk::IVxDevice*[devices.collectionSize];
-        result = _system->GetDevices(devices);
+        sdkCall.Restart("IVxSystem::GetDevices", devices);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDevices(devices));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < devices.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::Device(devices.collection[i]));
+                mlist->Add(IdentityMap::Intern<VxSdkNet::Device>(_identityMap, devices.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] devices.collection;
@@ -1170,16 +1229,18 @@ Collections::Generic::List<VxSdkNet::ManualRecording^>^ VxSdkNet::VXSystem::GetM
     }
 
     // Make the GetManualRecordings call, which will return with the total manual recording count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetManualRecordings(manualRecordings);
+    SdkCall sdkCall("IVxSystem::GetManualRecordings", manualRecordings);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetManualRecordings(manualRecordings));
     // Unless there are no manual recordings on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxManualRecording collection
         manualRecordings.collection = new VxSdk::IVxManualRecording*[manualRecordings.collectionSize];
-        result = _system->GetManualRecordings(manualRecordings);
+        sdkCall.Restart("IVxSystem::GetManualRecordings", manualRecordings);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetManualRecordings(manualRecordings));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < manualRecordings.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::ManualRecording(manualRecordings.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::ManualRecording>(_identityMap, manualRecordings.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] manualRecordings.collection;
@@ -1209,12 +1270,14 @@ Collections::Generic::List<VxSdkNet::Member^>^ VxSdkNet::VXSystem::GetMembers(Sy
     }
 
     // Make the GetMembers call, which will return with the total member count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetMembers(members);
+    SdkCall sdkCall("IVxSystem::GetMembers", members);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetMembers(members));
     // Unless there are no members on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxMember collection
         members.collection = new VxSdk::IVxMember*[members.collectionSize];
-        result = _system->GetMembers(members);
+        sdkCall.Restart("IVxSystem::GetMembers", members);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetMembers(members));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < members.collectionSize; i++)
@@ -1248,16 +1311,18 @@ List<VxSdkNet::Monitor^>^ VxSdkNet::VXSystem::GetMonitors(System::Collections::G
     }
 
     // Make the GetExports call, which will return with the total export count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetMonitors(monitors);
+    SdkCall sdkCall("IVxSystem::GetMonitors", monitors);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetMonitors(monitors));
     // Unless there are no exports on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxExport collection
         monitors.collection = new VxSdk::IVxMonitor*[monitors.collectionSize];
-        result = _system->GetMonitors(monitors);
+        sdkCall.Restart("IVxSystem::GetMonitors", monitors);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetMonitors(monitors));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < monitors.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::Monitor(monitors.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::Monitor>(_identityMap, monitors.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] monitors.collection;
@@ -1287,12 +1352,14 @@ List<VxSdkNet::MonitorWall^>^ VxSdkNet::VXSystem::GetMonitorWalls(System::Collec
     }
 
     // Make the GetExports call, which will return with the total export count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetMonitorWalls(monitorWalls);
+    SdkCall sdkCall("IVxSystem::GetMonitorWalls", monitorWalls);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetMonitorWalls(monitorWalls));
     // Unless there are no exports on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxExport collection
         monitorWalls.collection = new VxSdk::IVxMonitorWall*[monitorWalls.collectionSize];
-        result = _system->GetMonitorWalls(monitorWalls);
+        sdkCall.Restart("IVxSystem::GetMonitorWalls", monitorWalls);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetMonitorWalls(monitorWalls));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < monitorWalls.collectionSize; i++)
@@ -1326,12 +1393,14 @@ List<VxSdkNet::Drawing^>^ VxSdkNet::VXSystem::GetDrawings(System::Collections::G
     }
 
     // Make the GetDrawings call, which will return with the total drawing count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _system->GetDrawings(drawings);
+    SdkCall sdkCall("IVxSystem::GetDrawings", drawings);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDrawings(drawings));
     // The result should be kInsufficientSize if the number of drawings on the system are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDrawing collection
         drawings.collection = new VxSdk::IVxDrawing*[drawings.collectionSize];
-        result = _system->GetDrawings(drawings);
+        sdkCall.Restart("IVxSystem::GetDrawings", drawings);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDrawings(drawings));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < drawings.collectionSize; i++) {
@@ -1366,12 +1435,14 @@ List<VxSdkNet::Driver^>^ VxSdkNet::VXSystem::GetDrivers(System::Collections::Gen
     }
 
     // Make the GetDrivers call, which will return with the total driver count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _system->GetDrivers(drivers);
+    SdkCall sdkCall("IVxSystem::GetDrivers", drivers);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDrivers(drivers));
     // The result should be kInsufficientSize if the number of drivers on the system are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxDriver collection
         drivers.collection = new VxSdk::IVxDriver*[drivers.collectionSize];
-        result = _system->GetDrivers(drivers);
+        sdkCall.Restart("IVxSystem::GetDrivers", drivers);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDrivers(drivers));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < drivers.collectionSize; i++) {
@@ -1406,16 +1477,18 @@ List<VxSdkNet::Event^>^ VxSdkNet::VXSystem::GetEvents(System::Collections::Gener
     }
 
     // Make the GetEvents call, which will return with the total event count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetEvents(events);
+    SdkCall sdkCall("IVxSystem::GetEvents", events);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetEvents(events));
     // The result should be kInsufficientSize if the number of events on the system are greater than 0 (always)
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxEvent collection
         events.collection = new VxSdk::IVxEvent*[events.collectionSize];
-        result = _system->GetEvents(events);
+        sdkCall.Restart("IVxSystem::GetEvents", events);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetEvents(events));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < events.collectionSize; i++) {
-                mlist->Add(gcnew VxSdkNet::Event(events.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::Event>(_identityMap, events.collection[i]));
             }
         }
         // Remove the memory we previously allocated to the collection
@@ -1448,7 +1521,8 @@ VxSdkNet::ExportEstimate^ VxSdkNet::VXSystem::GetExportEstimate(NewExport^ newEx
     VxSdkNet::ExportEstimate^ retExportEstimate = nullptr;
     // Attempt to create the export estimate
     VxSdk::VxExportEstimate* exportEstimate = nullptr;
-    VxSdk::VxResult::Value result = _system->GetExportEstimate(vxNewExport, exportEstimate);
+    SdkCall sdkCall("IVxSystem::GetExportEstimate");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetExportEstimate(vxNewExport, exportEstimate));
 
     // Unless there was an issue estimating the export the result should be VxSdk::VxResult::kOK
     if (result == VxSdk::VxResult::kOK) {
@@ -1485,12 +1559,14 @@ List<VxSdkNet::Export^>^ VxSdkNet::VXSystem::GetExports(System::Collections::Gen
     }
 
     // Make the GetExports call, which will return with the total export count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetExports(exports);
+    SdkCall sdkCall("IVxSystem::GetExports", exports);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetExports(exports));
     // Unless there are no exports on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxExport collection
         exports.collection = new VxSdk::IVxExport*[exports.collectionSize];
-        result = _system->GetExports(exports);
+        sdkCall.Restart("IVxSystem::GetExports", exports);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetExports(exports));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < exports.collectionSize; i++)
@@ -1524,12 +1600,14 @@ List<VxSdkNet::VxFile^>^ VxSdkNet::VXSystem::GetFiles(System::Collections::Gener
     }
 
     // Make the GetFiles call, which will return with the total file count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetFiles(files);
+    SdkCall sdkCall("IVxSystem::GetFiles", files);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetFiles(files));
     // Unless there are no files on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxFile collection
         files.collection = new VxSdk::IVxFile * [files.collectionSize];
-        result = _system->GetFiles(files);
+        sdkCall.Restart("IVxSystem::GetFiles", files);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetFiles(files));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < files.collectionSize; i++)
@@ -1544,7 +1622,8 @@ List<VxSdkNet::VxFile^>^ VxSdkNet::VXSystem::GetFiles(System::Collections::Gener
 VxSdkNet::License^ VxSdkNet::VXSystem::GetLicense() {
     // Get the license object
     VxSdk::IVxLicense* license = nullptr;
-    VxSdk::VxResult::Value result = _system->GetLicense(license);
+    SdkCall sdkCall("IVxSystem::GetLicense");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetLicense(license));
 
     // Return the license if GetLicense was successful
     if (result == VxSdk::VxResult::kOK)
@@ -1575,16 +1654,18 @@ Collections::Generic::List<VxSdkNet::Recording^>^ VxSdkNet::VXSystem::GetRecordi
     }
 
     // Make the GetRecordings call, which will return with the total recording count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetRecordings(recordings);
+    SdkCall sdkCall("IVxSystem::GetRecordings", recordings);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetRecordings(recordings));
     // Unless there are no recordings on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxRecording collection
         recordings.collection = new VxSdk::IVxRecording * [recordings.collectionSize];
-        result = _system->GetRecordings(recordings);
+        sdkCall.Restart("IVxSystem::GetRecordings", recordings);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetRecordings(recordings));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < recordings.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::Recording(recordings.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::Recording>(_identityMap, recordings.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] recordings.collection;
@@ -1614,16 +1695,18 @@ List<VxSdkNet::RelayOutput^>^ VxSdkNet::VXSystem::GetRelayOutputs(System::Collec
     }
 
     // Make the GetRelayOutputs call, which will return with the total count of relay outputs, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetRelayOutputs(relayOutputs);
+    SdkCall sdkCall("IVxSystem::GetRelayOutputs", relayOutputs);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetRelayOutputs(relayOutputs));
     // Unless there are no relay outputs on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // An array of pointers is allocated using the size returned by the previous GetRelayOutputs call
         relayOutputs.collection = new VxSdk::IVxRelayOutput*[relayOutputs.collectionSize];
-        result = _system->GetRelayOutputs(relayOutputs);
+        sdkCall.Restart("IVxSystem::GetRelayOutputs", relayOutputs);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetRelayOutputs(relayOutputs));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < relayOutputs.collectionSize; i++)
-                mlist->Add(gcnew VxSdkNet::RelayOutput(relayOutputs.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::RelayOutput>(_identityMap, relayOutputs.collection[i]));
         }
         // Remove the memory we previously allocated to the collection
         delete[] relayOutputs.collection;
@@ -1653,12 +1736,14 @@ System::Collections::Generic::List<VxSdkNet::Report^>^ VxSdkNet::VXSystem::GetRe
     }
 
     // Make the GetReports call, which will return with the total report count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _system->GetReports(reports);
+    SdkCall sdkCall("IVxSystem::GetReports", reports);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetReports(reports));
     // The result should be kInsufficientSize if the number of reports on the system are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxReport collection
         reports.collection = new VxSdk::IVxReport*[reports.collectionSize];
-        result = _system->GetReports(reports);
+        sdkCall.Restart("IVxSystem::GetReports", reports);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetReports(reports));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < reports.collectionSize; i++) {
@@ -1694,12 +1779,14 @@ System::Collections::Generic::List<VxSdkNet::ReportTemplate^>^ VxSdkNet::VXSyste
     }
 
     // Make the GetReportTemplates call, which will return with the total report template count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _system->GetReportTemplates(reportTemplates);
+    SdkCall sdkCall("IVxSystem::GetReportTemplates", reportTemplates);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetReportTemplates(reportTemplates));
     // The result should be kInsufficientSize if the number of report templates on the system are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxReportTemplate collection
         reportTemplates.collection = new VxSdk::IVxReportTemplate*[reportTemplates.collectionSize];
-        result = _system->GetReportTemplates(reportTemplates);
+        sdkCall.Restart("IVxSystem::GetReportTemplates", reportTemplates);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetReportTemplates(reportTemplates));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < reportTemplates.collectionSize; i++) {
@@ -1734,12 +1821,14 @@ List<VxSdkNet::Role^>^ VxSdkNet::VXSystem::GetRoles(System::Collections::Generic
     }
 
     // Make the GetRoles call, which will return with the total role count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _system->GetRoles(roles);
+    SdkCall sdkCall("IVxSystem::GetRoles", roles);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetRoles(roles));
     // The result should be kInsufficientSize if the number of roles on the system are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxRole collection
         roles.collection = new VxSdk::IVxRole*[roles.collectionSize];
-        result = _system->GetRoles(roles);
+        sdkCall.Restart("IVxSystem::GetRoles", roles);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetRoles(roles));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < roles.collectionSize; i++) {
@@ -1774,12 +1863,14 @@ System::Collections::Generic::List<VxSdkNet::Rule^>^ VxSdkNet::VXSystem::GetRule
     }
 
     // Make the GetRules call, which will return with the total rule count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _system->GetRules(rules);
+    SdkCall sdkCall("IVxSystem::GetRules", rules);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetRules(rules));
     // The result should be kInsufficientSize if the number of rules on the system are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxRule collection
         rules.collection = new VxSdk::IVxRule*[rules.collectionSize];
-        result = _system->GetRules(rules);
+        sdkCall.Restart("IVxSystem::GetRules", rules);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetRules(rules));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < rules.collectionSize; i++) {
@@ -1814,16 +1905,18 @@ List<VxSdkNet::Schedule^>^ VxSdkNet::VXSystem::GetSchedules(System::Collections:
     }
 
     // Make the GetSchedules call, which will return with the total schedule count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _system->GetSchedules(schedules);
+    SdkCall sdkCall("IVxSystem::GetSchedules", schedules);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetSchedules(schedules));
     // The result should be kInsufficientSize if the number of schedules on the system are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxSchedule collection
         schedules.collection = new VxSdk::IVxSchedule*[schedules.collectionSize];
-        result = _system->GetSchedules(schedules);
+        sdkCall.Restart("IVxSystem::GetSchedules", schedules);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetSchedules(schedules));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < schedules.collectionSize; i++) {
-                mlist->Add(gcnew VxSdkNet::Schedule(schedules.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::Schedule>(_identityMap, schedules.collection[i]));
             }
         }
         // Remove the memory we previously allocated to the collection
@@ -1854,16 +1947,18 @@ List<VxSdkNet::Situation^>^ VxSdkNet::VXSystem::GetSituations(System::Collection
     }
 
     // Make the GetSituations call, which will return with the total situation count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetSituations(situations);
+    SdkCall sdkCall("IVxSystem::GetSituations", situations);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetSituations(situations));
     // The result should be kInsufficientSize if the number of situations on the system are greater than 0 (always)
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxSituation collection
         situations.collection = new VxSdk::IVxSituation*[situations.collectionSize];
-        result = _system->GetSituations(situations);
+        sdkCall.Restart("IVxSystem::GetSituations", situations);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetSituations(situations));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < situations.collectionSize; i++) {
-                mlist->Add(gcnew VxSdkNet::Situation(situations.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::Situation>(_identityMap, situations.collection[i]));
             }
         }
         // Remove the memory we previously allocated to the collection
@@ -1894,16 +1989,18 @@ List<VxSdkNet::Tag^>^ VxSdkNet::VXSystem::GetTags(System::Collections::Generic::
     }
 
     // Make the GetTags call, which will return with the total tag count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _system->GetTags(tags);
+    SdkCall sdkCall("IVxSystem::GetTags", tags);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetTags(tags));
     // The result should be kInsufficientSize if the number of tags on the system are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxTag collection
         tags.collection = new VxSdk::IVxTag*[tags.collectionSize];
-        result = _system->GetTags(tags);
+        sdkCall.Restart("IVxSystem::GetTags", tags);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetTags(tags));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < tags.collectionSize; i++) {
-                mlist->Add(gcnew VxSdkNet::Tag(tags.collection[i]));
+                mlist->Add(IdentityMap::Wrap<VxSdkNet::Tag>(_identityMap, tags.collection[i]));
             }
         }
         // Remove the memory we previously allocated to the collection
@@ -1934,12 +2031,14 @@ System::Collections::Generic::List< VxSdkNet::TimeTable^>^ VxSdkNet::VXSystem::G
     }
 
     // Make the GetTimeTables call, which will return with the total time tables count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _system->GetTimeTables(timeTables);
+    SdkCall sdkCall("IVxSystem::GetTimeTables", timeTables);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetTimeTables(timeTables));
     // The result should be kInsufficientSize if the number of time tables on the system are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxTimeTable collection
         timeTables.collection = new VxSdk::IVxTimeTable*[timeTables.collectionSize];
-        result = _system->GetTimeTables(timeTables);
+        sdkCall.Restart("IVxSystem::GetTimeTables", timeTables);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetTimeTables(timeTables));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < timeTables.collectionSize; i++) {
@@ -1974,12 +2073,14 @@ List<VxSdkNet::User^>^ VxSdkNet::VXSystem::GetUsers(System::Collections::Generic
     }
 
     // Make the GetTags call, which will return with the total tag count, this allows the client to allocate memory
-    VxSdk::VxResult::Value result = _system->GetUsers(users);
+    SdkCall sdkCall("IVxSystem::GetUsers", users);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetUsers(users));
     // The result should be kInsufficientSize if the number of tags on the system are greater than 0
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxTag collection
         users.collection = new VxSdk::IVxUser*[users.collectionSize];
-        result = _system->GetUsers(users);
+        sdkCall.Restart("IVxSystem::GetUsers", users);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetUsers(users));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < users.collectionSize; i++) {
@@ -2009,7 +2110,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::InjectEvent(VxSdkNet::NewEvent^ new
     }
 
     // Make the call to insert the event into VideoXpert
-    VxSdk::VxResult::Value result = _system->InsertEvent(vxEvent);
+    SdkCall sdkCall("IVxSystem::InsertEvent");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->InsertEvent(vxEvent));
 
     delete[] vxEvent.properties;
     vxEvent.properties = nullptr;
@@ -2029,8 +2131,9 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::Login(String^ username, String^ pas
     VxSdk::VxResult::Value result = VxSdk::VxSystemLogin(*_loginInfo, system);
     if (result == VxSdk::VxResult::kOK || result == VxSdk::VxResult::kSdkLicenseGracePeriodActive) {
         _system = system;
+        _identityMap->_system = system;
         // Create a new callback delegate
-        _callback = gcnew EventCallbackDelegate(&_FireEvent);
+        _callback = gcnew EventCallbackDelegate(this, &VxSdkNet::VXSystem::_OnEvent);
         _internalCallback = gcnew InternalEventCallbackDelegate(&_FireInternalEvent);
     }
     else if (system != nullptr) {
@@ -2050,8 +2153,9 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::Login(String^ authToken) {
     VxSdk::VxResult::Value result = VxSdk::VxSystemLogin(*_loginInfo, system);
     if (result == VxSdk::VxResult::kOK || result == VxSdk::VxResult::kSdkLicenseGracePeriodActive) {
         _system = system;
+        _identityMap->_system = system;
         // Create a new callback delegate
-        _callback = gcnew EventCallbackDelegate(&_FireEvent);
+        _callback = gcnew EventCallbackDelegate(this, &VxSdkNet::VXSystem::_OnEvent);
         _internalCallback = gcnew InternalEventCallbackDelegate(&_FireInternalEvent);
     }
     else if (system != nullptr) {
@@ -2063,7 +2167,8 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::Login(String^ authToken) {
 }
 
 VxSdkNet::Results::Value VxSdkNet::VXSystem::Refresh() {
-    return (VxSdkNet::Results::Value)_system->Refresh();
+    SdkCall sdkCall("IVxSystem::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::VXSystem::RemoveMember(Member^ memberItem) {
@@ -2088,15 +2193,21 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::SubscribeToEventsByType(VxSdkNet::V
             situationCollection.collection[i] = situations[i]->_situation;
     }
 
+    msclr::lock notificationLock(_notificationLock);
     UnsubscribeToEvents();
 
-    // Subscribe to the system events using the situation types
-    VxSdk::VxResult::Value result = _system->StartNotifications(
-        VxSdk::VxEventCallback(Marshal::GetFunctionPointerForDelegate(_callback).ToPointer()), situationCollection, userNotification);
+    // Subscribe to the system events using the situation types; the system has a single subscription, so the filter
+    // applies to any other subscribers too until it is unsubscribed
+    SdkCall sdkCall("IVxSystem::StartNotifications");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->StartNotifications(
+        VxSdk::VxEventCallback(Marshal::GetFunctionPointerForDelegate(_callback).ToPointer()), situationCollection, userNotification));
 
     // Add a new subscription to the EventDelegate
-    _eventDelegate = eventDelegate;
-    _systemEvent += _eventDelegate;
+    if (result == VxSdk::VxResult::kOK) {
+        _eventDelegate = eventDelegate;
+        _systemEvent += _eventDelegate;
+        _notificationUsers++;
+    }
 
     delete[] situationCollection.collection;
 
@@ -2105,16 +2216,27 @@ VxSdkNet::Results::Value VxSdkNet::VXSystem::SubscribeToEventsByType(VxSdkNet::V
 }
 
 VxSdkNet::Results::Value VxSdkNet::VXSystem::UnsubscribeToEvents() {
-    // Unsubscribe to the system events
-    VxSdk::VxResult::Value result = _system->StopNotifications();
-
+    msclr::lock notificationLock(_notificationLock);
     if (_eventDelegate != nullptr) {
         // Remove the EventDelegate subscription
         _systemEvent -= _eventDelegate;
         _eventDelegate = nullptr;
+        _notificationUsers--;
+
+        // Other subscribers keep receiving the system events, no longer filtered by situation type
+        if (_notificationUsers > 0) {
+            SdkCall sdkCall("IVxSystem::StartNotifications");
+            return VxSdkNet::Results::Value(sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->StartNotifications(
+                VxSdk::VxEventCallback(Marshal::GetFunctionPointerForDelegate(_callback).ToPointer()))));
+        }
     }
 
-    return VxSdkNet::Results::Value(result);
+    if (_notificationUsers > 0)
+        return VxSdkNet::Results::Value::OK;
+
+    // Unsubscribe to the system events
+    SdkCall sdkCall("IVxSystem::StopNotifications");
+    return VxSdkNet::Results::Value(sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->StopNotifications()));
 };
 
 bool VxSdkNet::VXSystem::ValidateMember(System::String^ host, int port, System::String^ username, System::String^ password) {
@@ -2126,7 +2248,7 @@ bool VxSdkNet::VXSystem::ValidateMember(System::String^ host, int port, System::
 void VxSdkNet::VXSystem::_FireEvent(VxSdk::IVxEvent* vxEvent) {
     // Fire the notification if there is a subscription to the system events
     if (_systemEvent != nullptr)
-        return _systemEvent(gcnew Event(vxEvent));
+        return _systemEvent(IdentityMap::Wrap<Event>(_identityMap, vxEvent));
 }
 
 void VxSdkNet::VXSystem::_FireInternalEvent(VxSdk::VxInternalEvent* vxInternalEvent) {
@@ -2138,7 +2260,8 @@ void VxSdkNet::VXSystem::_FireInternalEvent(VxSdk::VxInternalEvent* vxInternalEv
 VxSdkNet::Configuration::Auth^ VxSdkNet::VXSystem::_GetAuthConfig() {
     // Get the auth configuration
     VxSdk::IVxConfiguration::Auth* authConfig = nullptr;
-    VxSdk::VxResult::Value result = _system->GetAuthenticationConfiguration(authConfig);
+    SdkCall sdkCall("IVxSystem::GetAuthenticationConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetAuthenticationConfiguration(authConfig));
 
     // Return the auth configuration if GetAuthenticationConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2159,12 +2282,14 @@ System::Collections::Generic::List<VxSdkNet::NewReportTemplate^>^ VxSdkNet::VXSy
     VxSdk::VxCollection<VxSdk::VxNewReportTemplate**> newReportTemplates;
 
     // Make the GetAvailableReportTemplates call, which will return with the total template count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetAvailableReportTemplates(newReportTemplates);
+    SdkCall sdkCall("IVxSystem::GetAvailableReportTemplates", newReportTemplates);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetAvailableReportTemplates(newReportTemplates));
     // Unless there are no templates on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the VxNewReportTemplate collection
         newReportTemplates.collection = new VxSdk::VxNewReportTemplate*[newReportTemplates.collectionSize];
-        result = _system->GetAvailableReportTemplates(newReportTemplates);
+        sdkCall.Restart("IVxSystem::GetAvailableReportTemplates", newReportTemplates);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetAvailableReportTemplates(newReportTemplates));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < newReportTemplates.collectionSize; i++)
@@ -2182,12 +2307,14 @@ System::Collections::Generic::List<System::String^>^ VxSdkNet::VXSystem::_GetAva
     int size = 0;
 
     // Make the GetAvailableScheduleTriggerEvents call, which will return with the total situation type count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _system->GetAvailableScheduleTriggerEvents(situationTypes, size);
+    SdkCall sdkCall("IVxSystem::GetAvailableScheduleTriggerEvents");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetAvailableScheduleTriggerEvents(situationTypes, size));
     // Unless there are no situation types on the system, this should return VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the situation types
         situationTypes = new char*[size];
-        result = _system->GetAvailableScheduleTriggerEvents(situationTypes, size);
+        sdkCall.Restart("IVxSystem::GetAvailableScheduleTriggerEvents");
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetAvailableScheduleTriggerEvents(situationTypes, size));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < size; i++)
@@ -2203,7 +2330,8 @@ System::Collections::Generic::List<System::String^>^ VxSdkNet::VXSystem::_GetAva
 VxSdkNet::Configuration::Bookmark^ VxSdkNet::VXSystem::_GetBookmarkConfig() {
     // Get the bookmark configuration
     VxSdk::IVxConfiguration::Bookmark* bookmarkConfig = nullptr;
-    VxSdk::VxResult::Value result = _system->GetBookmarkConfiguration(bookmarkConfig);
+    SdkCall sdkCall("IVxSystem::GetBookmarkConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetBookmarkConfiguration(bookmarkConfig));
 
     // Return the bookmark configuration if GetBookmarkConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2220,7 +2348,8 @@ VxSdkNet::Configuration::Bookmark^ VxSdkNet::VXSystem::_GetBookmarkConfig() {
 VxSdkNet::Configuration::Cluster^ VxSdkNet::VXSystem::_GetClusterConfig() {
     // Get the cluster configuration
     VxSdk::IVxConfiguration::Cluster* cluster = nullptr;
-    VxSdk::VxResult::Value result = _system->GetClusterConfiguration(cluster);
+    SdkCall sdkCall("IVxSystem::GetClusterConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetClusterConfiguration(cluster));
 
     // Return the cluster configuration if GetClusterConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2237,7 +2366,8 @@ VxSdkNet::Configuration::Cluster^ VxSdkNet::VXSystem::_GetClusterConfig() {
 VxSdkNet::User^ VxSdkNet::VXSystem::_GetCurrentUser() {
     // Get the user object
     VxSdk::IVxUser* user = nullptr;
-    VxSdk::VxResult::Value result = _system->GetCurrentUser(user);
+    SdkCall sdkCall("IVxSystem::GetCurrentUser");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetCurrentUser(user));
 
     // Return the user if GetCurrentUser was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2254,7 +2384,8 @@ VxSdkNet::User^ VxSdkNet::VXSystem::_GetCurrentUser() {
 VxSdkNet::Discovery^ VxSdkNet::VXSystem::_GetDiscoveryStatus() {
     // Get the discovery object
     VxSdk::IVxDiscovery* discovery = nullptr;
-    VxSdk::VxResult::Value result = _system->GetDiscoveryStatus(discovery);
+    SdkCall sdkCall("IVxSystem::GetDiscoveryStatus");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetDiscoveryStatus(discovery));
 
     // Return the discovery status if GetDiscoveryStatus was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2271,7 +2402,8 @@ VxSdkNet::Discovery^ VxSdkNet::VXSystem::_GetDiscoveryStatus() {
 VxSdkNet::Configuration::Event^ VxSdkNet::VXSystem::_GetEventConfig() {
     // Get the event configuration
     VxSdk::IVxConfiguration::Event* eventConfig = nullptr;
-    VxSdk::VxResult::Value result = _system->GetEventConfiguration(eventConfig);
+    SdkCall sdkCall("IVxSystem::GetEventConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetEventConfiguration(eventConfig));
 
     // Return the event configuration if GetEventConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2288,7 +2420,8 @@ VxSdkNet::Configuration::Event^ VxSdkNet::VXSystem::_GetEventConfig() {
 VxSdkNet::Configuration::Export^ VxSdkNet::VXSystem::_GetExportConfig() {
     // Get the export configuration
     VxSdk::IVxConfiguration::Export* exportConfig = nullptr;
-    VxSdk::VxResult::Value result = _system->GetExportConfiguration(exportConfig);
+    SdkCall sdkCall("IVxSystem::GetExportConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetExportConfiguration(exportConfig));
 
     // Return the export configuration if GetExportConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2305,11 +2438,12 @@ VxSdkNet::Configuration::Export^ VxSdkNet::VXSystem::_GetExportConfig() {
 VxSdkNet::Device^ VxSdkNet::VXSystem::_GetHostDevice() {
     // Get the device which hosts this system
     VxSdk::IVxDevice* device = nullptr;
-    VxSdk::VxResult::Value result = _system->GetHostDevice(device);
+    SdkCall sdkCall("IVxSystem::GetHostDevice");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetHostDevice(device));
 
     // Return the device if GetHostDevice was successful
     if (result == VxSdk::VxResult::kOK) {
-        return gcnew Device(device);
+        return IdentityMap::Intern<Device>(_identityMap, device);
     }
     else if (device != nullptr) {
         device->Delete();
@@ -2322,7 +2456,8 @@ VxSdkNet::Device^ VxSdkNet::VXSystem::_GetHostDevice() {
 VxSdkNet::Configuration::Ldap^ VxSdkNet::VXSystem::_GetLdapConfig() {
     // Get the LDAP configuration
     VxSdk::IVxConfiguration::Ldap* ldapConfig = nullptr;
-    VxSdk::VxResult::Value result = _system->GetLdapConfiguration(ldapConfig);
+    SdkCall sdkCall("IVxSystem::GetLdapConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetLdapConfiguration(ldapConfig));
 
     // Return the LDAP configuration if GetLdapConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2339,7 +2474,8 @@ VxSdkNet::Configuration::Ldap^ VxSdkNet::VXSystem::_GetLdapConfig() {
 VxSdkNet::PermissionSchema^ VxSdkNet::VXSystem::_GetPermissionSchema() {
     // Get the permission schema
     VxSdk::VxPermissionSchema* permissionSchema = nullptr;
-    VxSdk::VxResult::Value result = _system->GetRolePermissionSchema(permissionSchema);
+    SdkCall sdkCall("IVxSystem::GetRolePermissionSchema");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetRolePermissionSchema(permissionSchema));
 
     // Return the permission schema if GetRolePermissionSchema was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2356,7 +2492,8 @@ VxSdkNet::PermissionSchema^ VxSdkNet::VXSystem::_GetPermissionSchema() {
 VxSdkNet::Configuration::Report^ VxSdkNet::VXSystem::_GetReportConfig() {
     // Get the report configuration
     VxSdk::IVxConfiguration::Report* reportConfig = nullptr;
-    VxSdk::VxResult::Value result = _system->GetReportConfiguration(reportConfig);
+    SdkCall sdkCall("IVxSystem::GetReportConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetReportConfiguration(reportConfig));
 
     // Return the report configuration if GetReportConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2373,7 +2510,8 @@ VxSdkNet::Configuration::Report^ VxSdkNet::VXSystem::_GetReportConfig() {
 VxSdkNet::Configuration::Server^ VxSdkNet::VXSystem::_GetServerConfig() {
     // Get the  server configuration
     VxSdk::IVxConfiguration::Server* serverConfig = nullptr;
-    VxSdk::VxResult::Value result = _system->GetServerConfiguration(serverConfig);
+    SdkCall sdkCall("IVxSystem::GetServerConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetServerConfiguration(serverConfig));
 
     // Return the  server configuration if GetServerConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2390,7 +2528,8 @@ VxSdkNet::Configuration::Server^ VxSdkNet::VXSystem::_GetServerConfig() {
 VxSdkNet::Configuration::Smtp^ VxSdkNet::VXSystem::_GetSmtpConfig() {
     // Get the SMTP configuration
     VxSdk::IVxConfiguration::Smtp* smtpConfig = nullptr;
-    VxSdk::VxResult::Value result = _system->GetSmtpConfiguration(smtpConfig);
+    SdkCall sdkCall("IVxSystem::GetSmtpConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetSmtpConfiguration(smtpConfig));
 
     // Return the SMTP configuration if GetSmtpConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2407,7 +2546,8 @@ VxSdkNet::Configuration::Smtp^ VxSdkNet::VXSystem::_GetSmtpConfig() {
 VxSdkNet::Configuration::Snmp^ VxSdkNet::VXSystem::_GetSnmpConfig() {
     // Get the SNMP configuration
     VxSdk::IVxConfiguration::Snmp* snmpConfig = nullptr;
-    VxSdk::VxResult::Value result = _system->GetSnmpConfiguration(snmpConfig);
+    SdkCall sdkCall("IVxSystem::GetSnmpConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetSnmpConfiguration(snmpConfig));
 
     // Return the SNMP configuration if GetSnmpConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2424,7 +2564,8 @@ VxSdkNet::Configuration::Snmp^ VxSdkNet::VXSystem::_GetSnmpConfig() {
 VxSdkNet::Configuration::Time^ VxSdkNet::VXSystem::_GetTimeConfig() {
     // Get the time configuration
     VxSdk::IVxConfiguration::Time* timeConfig = nullptr;
-    VxSdk::VxResult::Value result = _system->GetTimeConfiguration(timeConfig);
+    SdkCall sdkCall("IVxSystem::GetTimeConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetTimeConfiguration(timeConfig));
 
     // Return the time configuration if GetTimeConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2441,7 +2582,8 @@ VxSdkNet::Configuration::Time^ VxSdkNet::VXSystem::_GetTimeConfig() {
 VxSdkNet::Configuration::Twilio^ VxSdkNet::VXSystem::_GetTwilioConfig() {
     // Get the Twilio configuration
     VxSdk::IVxConfiguration::Twilio* twilioConfig = nullptr;
-    VxSdk::VxResult::Value result = _system->GetTwilioConfiguration(twilioConfig);
+    SdkCall sdkCall("IVxSystem::GetTwilioConfiguration");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->GetTwilioConfiguration(twilioConfig));
 
     // Return the Twilio configuration if GetTwilioConfiguration was successful
     if (result == VxSdk::VxResult::kOK) {
@@ -2455,18 +2597,86 @@ VxSdkNet::Configuration::Twilio^ VxSdkNet::VXSystem::_GetTwilioConfig() {
     return nullptr;
 }
 
+void VxSdkNet::VXSystem::_OnEvent(VxSdk::IVxEvent* vxEvent) {
+    // Without a subscriber of its own, this system's events only go to the system event subscribers
+    EventDelegate^ siteEvent = _siteEvent;
+    if (siteEvent == nullptr)
+        return _FireEvent(vxEvent);
+
+    // Both subscribers share the one managed event, which owns the native event
+    Event^ managedEvent = IdentityMap::Wrap<Event>(_identityMap, vxEvent);
+    siteEvent(managedEvent);
+    if (_systemEvent != nullptr)
+        _systemEvent(managedEvent);
+}
+
+VxSdkNet::Results::Value VxSdkNet::VXSystem::_StartSiteEvents(EventDelegate^ siteEvent) {
+    // Pass the system events to the given delegate as well as any system event subscribers
+    msclr::lock notificationLock(_notificationLock);
+    _siteEvent = siteEvent;
+    VxSdkNet::Results::Value result = _StartNotifications();
+    if (result != VxSdkNet::Results::Value::OK)
+        _siteEvent = nullptr;
+
+    return result;
+}
+
+VxSdkNet::Results::Value VxSdkNet::VXSystem::_StopSiteEvents() {
+    msclr::lock notificationLock(_notificationLock);
+    if (_siteEvent == nullptr)
+        return VxSdkNet::Results::Value::OK;
+
+    _siteEvent = nullptr;
+    return _StopNotifications();
+}
+
+VxSdkNet::Results::Value VxSdkNet::VXSystem::_StartNotifications() {
+    // Only the first subscriber starts the notifications, so that a filter set by another is kept
+    msclr::lock notificationLock(_notificationLock);
+    if (_notificationUsers == 0) {
+        SdkCall sdkCall("IVxSystem::StartNotifications");
+        VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->StartNotifications(
+            VxSdk::VxEventCallback(Marshal::GetFunctionPointerForDelegate(_callback).ToPointer())));
+        if (result != VxSdk::VxResult::kOK)
+            return VxSdkNet::Results::Value(result);
+    }
+
+    _notificationUsers++;
+    return VxSdkNet::Results::Value::OK;
+}
+
+VxSdkNet::Results::Value VxSdkNet::VXSystem::_StopNotifications() {
+    // Only the last subscriber stops the notifications
+    msclr::lock notificationLock(_notificationLock);
+    if (_notificationUsers == 0 || --_notificationUsers > 0)
+        return VxSdkNet::Results::Value::OK;
+
+    SdkCall sdkCall("IVxSystem::StopNotifications");
+    return VxSdkNet::Results::Value(sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _system->StopNotifications()));
+}
+
 void VxSdkNet::VXSystem::SystemEvent::add(EventDelegate ^eventDelegate) {
-    // Subscribe to the system events
-    _system->StartNotifications(VxSdk::VxEventCallback(Marshal::GetFunctionPointerForDelegate(_callback).ToPointer()));
+    // Subscribe to the system events, and only add the handler once that has succeeded
+    msclr::lock notificationLock(_notificationLock);
+    if (_StartNotifications() != VxSdkNet::Results::Value::OK)
+        return;
+
     // Add a new subscription to the EventDelegate
+    _eventHandlers->Add(eventDelegate);
     _systemEvent += eventDelegate;
 };
 
 void VxSdkNet::VXSystem::SystemEvent::remove(EventDelegate ^eventDelegate) {
-    // Unsubscribe to the system events
-    _system->StopNotifications();
+    // Only a handler added here releases a subscriber, so that one that was never added cannot stop the
+    // notifications of another
+    msclr::lock notificationLock(_notificationLock);
+    if (!_eventHandlers->Remove(eventDelegate))
+        return;
+
     // Remove the EventDelegate subscription
     _systemEvent -= eventDelegate;
+    // Unsubscribe to the system events
+    _StopNotifications();
 };
 
 void VxSdkNet::VXSystem::InternalEvent::add(InternalEventDelegate ^sdkEventDelegate) {
@@ -2,26 +2,30 @@
 /// Implements the volume class.
 /// </summary>
 #include "Volume.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::Volume::Volume(VxSdk::IVxVolume* vxVolume) {
     _volume = vxVolume;
+    NativeMemory::Add(_volume);
 }
 
 VxSdkNet::Volume::!Volume() {
-    _volume->Delete();
+    NativeReleaseQueue::Release(_volume);
     _volume = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::Volume::Refresh() {
-    return (VxSdkNet::Results::Value)_volume->Refresh();
+    SdkCall sdkCall("IVxVolume::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _volume->Refresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::Volume::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _volume->GetLimits(limits);
+    SdkCall sdkCall("IVxVolume::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _volume->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -33,7 +37,8 @@ VxSdkNet::ResourceLimits^ VxSdkNet::Volume::_GetLimits() {
 VxSdkNet::VolumeGroup^ VxSdkNet::Volume::_GetVolumeGroup() {
     // Get the volume group
     VxSdk::IVxVolumeGroup* volumeGroup = nullptr;
-    VxSdk::VxResult::Value result = _volume->GetVolumeGroup(volumeGroup);
+    SdkCall sdkCall("IVxVolume::GetVolumeGroup");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _volume->GetVolumeGroup(volumeGroup));
 
     // Return the volume group if GetVolumeGroup was successful
     if (result == VxSdk::VxResult::kOK)
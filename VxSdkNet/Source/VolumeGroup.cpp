@@ -3,15 +3,17 @@
 /// </summary>
 #include "VolumeGroup.h"
 #include "Volume.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::VolumeGroup::VolumeGroup(VxSdk::IVxVolumeGroup* vxVolumeGroup) {
     _volumeGroup = vxVolumeGroup;
+    NativeMemory::Add(_volumeGroup);
 }
 
 VxSdkNet::VolumeGroup::!VolumeGroup() {
-    _volumeGroup->Delete();
+    NativeReleaseQueue::Release(_volumeGroup);
     _volumeGroup = nullptr;
 }
 
@@ -37,12 +39,14 @@ List<VxSdkNet::ResourceRel^>^ VxSdkNet::VolumeGroup::GetVolumeRelations(System::
     }
 
     // Make the GetVolumeRelations call, which will return with the total resource count, this allows the client to allocate memory.
-    VxSdk::VxResult::Value result = _volumeGroup->GetVolumeRelations(resourceRels);
+    SdkCall sdkCall("IVxVolumeGroup::GetVolumeRelations", resourceRels);
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _volumeGroup->GetVolumeRelations(resourceRels));
     // As long as there are related resources for this volume group the result should be VxSdk::VxResult::kInsufficientSize
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for the IVxResourceRel collection
         resourceRels.collection = new VxSdk::IVxResourceRel * [resourceRels.collectionSize];
-        result = _volumeGroup->GetVolumeRelations(resourceRels);
+        sdkCall.Restart("IVxVolumeGroup::GetVolumeRelations", resourceRels);
+        result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _volumeGroup->GetVolumeRelations(resourceRels));
         // The result should now be kOK since we have allocated enough space
         if (result == VxSdk::VxResult::kOK) {
             for (int i = 0; i < resourceRels.collectionSize; i++)
@@ -55,13 +59,15 @@ List<VxSdkNet::ResourceRel^>^ VxSdkNet::VolumeGroup::GetVolumeRelations(System::
 }
 
 VxSdkNet::Results::Value VxSdkNet::VolumeGroup::Refresh() {
-    return (VxSdkNet::Results::Value)_volumeGroup->Refresh();
+    SdkCall sdkCall("IVxVolumeGroup::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _volumeGroup->Refresh());
 }
 
 VxSdkNet::ResourceLimits^ VxSdkNet::VolumeGroup::_GetLimits() {
     // Get the limits for this resource
     VxSdk::VxLimits* limits = nullptr;
-    VxSdk::VxResult::Value result = _volumeGroup->GetLimits(limits);
+    SdkCall sdkCall("IVxVolumeGroup::GetLimits");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _volumeGroup->GetLimits(limits));
 
     // Return the limits if GetLimits was successful
     if (result == VxSdk::VxResult::kOK)
@@ -2,18 +2,21 @@
 /// Implements the vx file class.
 /// </summary>
 #include "VxFile.h"
+#include "NativeReleaseQueue.h"
 
 VxSdkNet::VxFile::VxFile(VxSdk::IVxFile* vxFile) {
     _vxFile = vxFile;
+    NativeMemory::Add(_vxFile);
 }
 
 VxSdkNet::VxFile::!VxFile() {
-    _vxFile->Delete();
+    NativeReleaseQueue::Release(_vxFile);
     _vxFile = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::VxFile::Refresh() {
-    return (VxSdkNet::Results::Value)_vxFile->Refresh();
+    SdkCall sdkCall("IVxFile::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _vxFile->Refresh());
 }
 
 System::String^ VxSdkNet::VxFile::_GetFileEndpoint() {
@@ -22,7 +25,8 @@ System::String^ VxSdkNet::VxFile::_GetFileEndpoint() {
 
     // If the file endpoint is not available on the system the result will return VxSdk::VxResult::kActionUnavailable,
     // otherwise VxSdk::VxResult::kInsufficientSize
-    VxSdk::VxResult::Value result = _vxFile->GetFileEndpoint(fileEndpoint, size);
+    SdkCall sdkCall("IVxFile::GetFileEndpoint");
+    VxSdk::VxResult::Value result = sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _vxFile->GetFileEndpoint(fileEndpoint, size));
     if (result == VxSdk::VxResult::kInsufficientSize) {
         // Allocate enough space for fileEndpoint
         fileEndpoint = new char[size];
@@ -2,26 +2,31 @@
 /// Implements the vx file recovery class.
 /// </summary>
 #include "VxFileRecovery.h"
+#include "NativeReleaseQueue.h"
 
 using namespace System::Collections::Generic;
 
 VxSdkNet::VxFileRecovery::VxFileRecovery(VxSdk::IVxFileRecovery* vxFileRecovery) {
     _vxFileRecovery = vxFileRecovery;
+    NativeMemory::Add(_vxFileRecovery);
 }
 
 VxSdkNet::VxFileRecovery::!VxFileRecovery() {
-    _vxFileRecovery->Delete();
+    NativeReleaseQueue::Release(_vxFileRecovery);
     _vxFileRecovery = nullptr;
 }
 
 VxSdkNet::Results::Value VxSdkNet::VxFileRecovery::Halt() {
-    return (VxSdkNet::Results::Value)_vxFileRecovery->Halt();
+    SdkCall sdkCall("IVxFileRecovery::Halt");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _vxFileRecovery->Halt());
 }
 
 VxSdkNet::Results::Value VxSdkNet::VxFileRecovery::Refresh() {
-    return (VxSdkNet::Results::Value)_vxFileRecovery->Refresh();
+    SdkCall sdkCall("IVxFileRecovery::Refresh");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _vxFileRecovery->Refresh());
 }
 
 VxSdkNet::Results::Value VxSdkNet::VxFileRecovery::Trigger(System::String^ volumeId, System::DateTime startTime, System::DateTime endTime) {
-    return (VxSdkNet::Results::Value)_vxFileRecovery->Trigger(Utils::ConvertCSharpString(volumeId).c_str(), Utils::ConvertCSharpDateTime(startTime).c_str(), Utils::ConvertCSharpDateTime(endTime).c_str());
+    SdkCall sdkCall("IVxFileRecovery::Trigger");
+    return (VxSdkNet::Results::Value)sdkCall.End(sdkCall.Faulted() ? sdkCall.Fault() : _vxFileRecovery->Trigger(Utils::ConvertCSharpString(volumeId).c_str(), Utils::ConvertCSharpDateTime(startTime).c_str(), Utils::ConvertCSharpDateTime(endTime).c_str()));
 }
\ No newline at end of file
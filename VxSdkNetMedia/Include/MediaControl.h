@@ -5,6 +5,9 @@
 #include "MediaEvent.h"
 #include "StreamEvent.h"
 #include "PelcoDataEvent.h"
+#include "PrewarmedStream.h"
+#include "ReconnectPolicy.h"
+#include "StreamStatistics.h"
 #include "Utils.h"
 #include "DataSource.h"
 
@@ -119,6 +122,12 @@ namespace VxSdkNet {
         /// <param name="pelcoDataManagedEvent">The Pelco data event sent from the stream as a managed type.</param>
         delegate void PelcoDataEventDelegate(PelcoDataManagedEvent^ pelcoDataManagedEvent);
 
+        /// <summary>
+        /// The managed statistics event delegate.
+        /// </summary>
+        /// <param name="statistics">A snapshot of the stream statistics.</param>
+        delegate void StatisticsEventDelegate(StreamStatistics^ statistics);
+
         /// <summary>
         /// Constructor.
         /// </summary>
@@ -145,11 +154,10 @@ namespace VxSdkNet {
         MediaControl(System::String^ rtspVideoEndpoint, System::String^ rtspAudioEndpoint, System::String^ username, System::String^ password);
 
         /// <summary>
-        /// Virtual destructor.
+        /// Virtual destructor.  Stops the statistics events, releases any prewarmed stream and, once any reconnect
+        /// holding the controller has finished with it, the controller.
         /// </summary>
-        virtual ~MediaControl() {
-            this->!MediaControl();
-        }
+        virtual ~MediaControl();
 
         /// <summary>
         /// Finaliser.
@@ -242,6 +250,40 @@ namespace VxSdkNet {
         /// <param name="rtspAudioEndpoint">The RTSP endpoint of the audio stream.</param>
         void SetDataSource(System::String^ rtspVideoEndpoint, System::String^ rtspAudioEndpoint);
 
+        /// <summary>
+        /// Opens a stream for the given data source in the background so that it can be switched to with
+        /// <see cref="SwapToPrewarmed"/> without rebuilding the pipeline.  Replaces any stream previously prewarmed
+        /// by this control.  Prewarmed streams play live.
+        /// </summary>
+        /// <param name="videoDataSource">The data source to use to create the video stream.</param>
+        /// <param name="videoDataInterface">The data interface to use to create the video stream.</param>
+        /// <param name="audioDataSource">The data source to use to create the audio stream.</param>
+        /// <param name="audioDataInterface">The data interface to use to create the audio stream.</param>
+        /// <returns><c>true</c> if the stream is being prewarmed, <c>false</c> if <see cref="MaxPrewarmedStreams"/> has been reached.</returns>
+        bool PrewarmDataSource(DataSource^ videoDataSource, DataInterface^ videoDataInterface, DataSource^ audioDataSource, DataInterface^ audioDataInterface);
+
+        /// <summary>
+        /// Opens a stream for the given RTSP endpoints in the background so that it can be switched to with
+        /// <see cref="SwapToPrewarmed"/> without rebuilding the pipeline.  Replaces any stream previously prewarmed
+        /// by this control.  Prewarmed streams play live.
+        /// </summary>
+        /// <param name="rtspVideoEndpoint">The RTSP endpoint of the video stream.</param>
+        /// <param name="rtspAudioEndpoint">The RTSP endpoint of the audio stream.</param>
+        /// <returns><c>true</c> if the stream is being prewarmed, <c>false</c> if <see cref="MaxPrewarmedStreams"/> has been reached.</returns>
+        bool PrewarmDataSource(System::String^ rtspVideoEndpoint, System::String^ rtspAudioEndpoint);
+
+        /// <summary>
+        /// Discards the stream prewarmed by this control, if any.
+        /// </summary>
+        void CancelPrewarm();
+
+        /// <summary>
+        /// Switches the control to the prewarmed stream.  If the prewarmed stream is still opening this waits for it
+        /// to finish opening.
+        /// </summary>
+        /// <returns><c>true</c> if the control switched to the prewarmed stream, otherwise <c>false</c>.</returns>
+        bool SwapToPrewarmed();
+
         /// <summary>
         /// Set the display window using the given window handle.
         /// </summary>
@@ -253,12 +295,45 @@ namespace VxSdkNet {
         /// </summary>
         void Stop();
 
+        /// <summary>
+        /// Resets the stream statistics counters.
+        /// </summary>
+        void ResetStatistics();
+
+        /// <summary>
+        /// Gets or sets the policy used to automatically reconnect the stream when the connection is lost.  Only
+        /// streams that are playing are reconnected.
+        /// </summary>
+        /// <value>The reconnect policy; <c>nullptr</c> (default) to leave recovery to the client.</value>
+        property ReconnectPolicy^ AutoReconnect {
+            ReconnectPolicy^ get() { return _reconnectPolicy; }
+            void set(ReconnectPolicy^ value) { _reconnectPolicy = value; }
+        }
+
+        /// <summary>
+        /// Gets whether the prewarmed stream has received its first frame and can be switched to without a gap.
+        /// </summary>
+        /// <value><c>true</c> if the prewarmed stream is ready, otherwise <c>false</c>.</value>
+        property bool IsPrewarmReady {
+            bool get() { return _prewarmed != nullptr && _prewarmed->IsReady; }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of prewarmed streams that may be open at once across all controls in the
+        /// process.  Defaults to 4.
+        /// </summary>
+        /// <value>The maximum number of prewarmed streams.</value>
+        static property int MaxPrewarmedStreams {
+            int get() { return PrewarmedStream::MaxPrewarmedStreams; }
+            void set(int value) { PrewarmedStream::MaxPrewarmedStreams = value; }
+        }
+
         /// <summary>
         /// Get the status of the pipeline.
         /// </summary>
         /// <returns>True if pipeline is active, otherwise false.</returns>
         property bool IsPipelineActive {
-            bool get() { return _control->IsPipelineActive(); }
+            bool get();
         }
 
         /// <summary>
@@ -266,7 +341,7 @@ namespace VxSdkNet {
         /// </summary>
         /// <value>The current stream mode.</value>
         property Modes Mode {
-            Modes get() { return (Modes)_control->GetMode(); }
+            Modes get();
         }
 
         /// <summary>
@@ -274,8 +349,25 @@ namespace VxSdkNet {
         /// </summary>
         /// <value>The aspect ratio.</value>
         property AspectRatios AspectRatio {
-            AspectRatios get() { return (AspectRatios)_control->GetAspectRatio(); }
-            void set(AspectRatios value) { _control->SetAspectRatio((MediaController::IStream::AspectRatios)value); }
+            AspectRatios get();
+            void set(AspectRatios value);
+        }
+
+        /// <summary>
+        /// Gets a snapshot of the stream health statistics.
+        /// </summary>
+        /// <value>The current stream statistics.</value>
+        property StreamStatistics^ Statistics {
+            StreamStatistics^ get() { return _statistics->Snapshot(); }
+        }
+
+        /// <summary>
+        /// Gets or sets the interval at which the <see cref="StatisticsEvent"/> is raised.  Defaults to 1 second.
+        /// </summary>
+        /// <value>The statistics event interval.</value>
+        property System::TimeSpan StatisticsInterval {
+            System::TimeSpan get() { return _statisticsInterval; }
+            void set(System::TimeSpan value);
         }
 
         /// <summary>
@@ -283,8 +375,8 @@ namespace VxSdkNet {
         /// </summary>
         /// <value>True if the rendered video should stretch to fit its display window, otherwise false.</value>
         property bool StretchToFit {
-            bool get() { return _control->GetStretchToFit(); }
-            void set(bool value) { _control->SetStretchToFit(value); }
+            bool get();
+            void set(bool value);
         }
 
         /// <summary>
@@ -311,10 +403,19 @@ namespace VxSdkNet {
             void remove(PelcoDataEventDelegate ^eventDelegate);
         }
 
+        /// <summary>
+        /// StatisticsEvent is raised every <see cref="StatisticsInterval"/> with a snapshot of the stream statistics.
+        /// </summary>
+        event StatisticsEventDelegate ^ StatisticsEvent {
+            void add(StatisticsEventDelegate ^eventDelegate);
+            void remove(StatisticsEventDelegate ^eventDelegate);
+        }
+
         bool AddVideoOverlayData(System::String^ overlayData, VideoOverlayDataPositions position, bool incudeDateTime);
 
     internal:
         MediaController::IController* _control;
+        System::Object^ _controlLock;
         void _FireTimestampEvent(MediaController::TimestampEvent* timeEvent);
         TimestampCallbackDelegate ^ _timestampCallback;
         TimestampEventDelegate ^ _timestampEvent;
@@ -323,7 +424,36 @@ namespace VxSdkNet {
         StreamEventDelegate ^ _streamEvent;
         PelcoDataCallbackDelegate ^_pelcoDataCallback;
         PelcoDataEventDelegate ^_pelcoDataEvent;
+        PelcoDataManagedEvent^ _pelcoDataArgs;
         void _FirePelcoDataEvent(MediaController::PelcoDataEvent* event);
+        StreamStatisticsCollector^ _statistics;
+        System::TimeSpan _statisticsInterval;
+        System::Threading::Timer^ _statisticsTimer;
+        StatisticsEventDelegate ^ _statisticsEvent;
+        void _AddObservers();
+        void _RegisterObservers(MediaController::IController* control);
+        PrewarmedStream^ _prewarmed;
+        System::IntPtr _window;
+        void _FireStatisticsEvent(System::Object^ state);
+        DataSource^ _videoSource;
+        DataInterface^ _videoInterface;
+        DataSource^ _audioSource;
+        DataInterface^ _audioInterface;
+        System::String^ _rtspVideoEndpoint;
+        System::String^ _rtspAudioEndpoint;
+        System::String^ _rtspUsername;
+        System::String^ _rtspPassword;
+        ReconnectPolicy^ _reconnectPolicy;
+        float _speed;
+        RTSPNetworkTransports _transport;
+        bool _isPlaying;
+        bool _isPlayback;
+        unsigned int _lastTimestamp;
+        int _requestGeneration;
+        int _isReconnecting;
+        MediaController::MediaRequest _CreateRequest();
+        void _Reconnect(System::Object^ state);
+        bool _Resume(bool resumePlayback);
     };
 }
 #endif // MediaControl_h__
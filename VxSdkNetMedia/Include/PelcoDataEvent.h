@@ -2,15 +2,24 @@
 #define PelcoDataManagedEvent_h__
 
 #include "MediaController.h"
+#include "PelcoDataRecord.h"
 
 namespace VxSdkNet {
 
     /// <summary>
-    /// The PelcoDataManagedEvent class represents an Pelco data event that has been sent from a stream.
+    /// The PelcoDataManagedEvent class represents an Pelco data event that has been sent from a stream.  The
+    /// <see cref="MediaControl"/> reuses one event, and copies each payload into a buffer that it recycles, so
+    /// delivering an event allocates nothing.  The event, its payload and its <see cref="Record"/> are only valid
+    /// for the duration of the event callback; use <see cref="ToArray"/> or <see cref="CopyTo"/> to keep the payload.
     /// </summary>
     public ref class PelcoDataManagedEvent {
     public:
 
+        /// <summary>
+        /// The maximum Pelco data payload length, in bytes, that will be read from an event.
+        /// </summary>
+        static const int MaxLength = 65536;
+
         /// <summary>
         /// Values that represent the streaming events.
         /// </summary>
@@ -26,7 +35,29 @@ namespace VxSdkNet {
         /// Constructor.
         /// </summary>
         /// <param name="pelcoDataEvent">The Pelco data event.</param>
-        PelcoDataManagedEvent(MediaController::PelcoDataEvent* pelcoDataEvent) : _pelcoDataEvent(pelcoDataEvent) {};
+        PelcoDataManagedEvent(MediaController::PelcoDataEvent* pelcoDataEvent) : _pelcoDataEvent(pelcoDataEvent) {
+            _Load(pelcoDataEvent);
+        };
+
+        /// <summary>
+        /// Copies the Pelco data payload to an array.
+        /// </summary>
+        /// <param name="destination">The array to copy the payload to.</param>
+        /// <param name="destinationIndex">The index in the destination at which copying begins.</param>
+        /// <returns>The number of bytes copied; 0 if the destination is too small to hold the payload.</returns>
+        int CopyTo(array<unsigned char>^ destination, int destinationIndex);
+
+        /// <summary>
+        /// Copies the Pelco data payload to a new array.  Use this to keep the payload beyond the event callback.
+        /// </summary>
+        /// <returns>A new array containing the payload.</returns>
+        array<unsigned char>^ ToArray();
+
+        /// <summary>
+        /// Gets the Pelco data payload as a string.
+        /// </summary>
+        /// <returns>The payload decoded as UTF-8.</returns>
+        virtual System::String^ ToString() override;
 
         /// <summary>
         /// Gets the event type.
@@ -35,12 +66,12 @@ namespace VxSdkNet {
         property EventTypes EventType {
         public:
             EventTypes get() {
-                return (EventTypes)_pelcoDataEvent->eventType;
+                return _eventType;
             }
         }
         
         /// <summary>
-        /// Gets the Pelco data string.
+        /// Gets the native Pelco data string.
         /// </summary>
         /// <value>The Pelco data string.</value>
         property unsigned char * PelcoBytes {
@@ -49,9 +80,47 @@ namespace VxSdkNet {
                 return (_pelcoDataEvent->pelcoData);
             }
         }
-        
+
+        /// <summary>
+        /// Gets the byte at the given position of the Pelco data payload.
+        /// </summary>
+        /// <param name="index">The zero based position in the payload.</param>
+        /// <value>The payload byte; 0 if the index is outside of the payload.</value>
+        property unsigned char default[int] {
+        public:
+            unsigned char get(int index) {
+                return index >= 0 && index < _length ? _buffer[index] : 0;
+            }
+        }
+
+        /// <summary>
+        /// Gets the payload parsed into <c>name=value</c> fields.  The payload is parsed on first use, into a record
+        /// that is reused for every event.
+        /// </summary>
+        /// <value>The parsed payload.</value>
+        property PelcoDataRecord^ Record {
+        public:
+            PelcoDataRecord^ get();
+        }
+
+        /// <summary>
+        /// Gets the length of the Pelco data payload in bytes.
+        /// </summary>
+        /// <value>The payload length.</value>
+        property int Length {
+        public:
+            int get() { return _length; }
+        }
+
     internal:
+        PelcoDataManagedEvent() : _pelcoDataEvent(nullptr), _length(0), _isParsed(false) {};
         MediaController::PelcoDataEvent* _pelcoDataEvent;
+        EventTypes _eventType;
+        array<unsigned char>^ _buffer;
+        int _length;
+        PelcoDataRecord^ _record;
+        bool _isParsed;
+        void _Load(MediaController::PelcoDataEvent* pelcoDataEvent);
     };
 }
 #endif // PelcoDataManagedEvent_h__
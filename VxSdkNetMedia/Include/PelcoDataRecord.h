@@ -0,0 +1,63 @@
+#ifndef PelcoDataRecord_h__
+#define PelcoDataRecord_h__
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The PelcoDataRecord class is the parsed form of a Pelco data payload: text made of <c>name=value</c> fields
+    /// separated by semicolons, ampersands or line breaks.  Fields are located by their offsets in the payload, so
+    /// parsing, looking up fields and reading numbers allocate nothing; only <see cref="GetName"/> and
+    /// <see cref="GetValue"/> create strings.  Like the <see cref="PelcoDataManagedEvent"/> it belongs to, the record
+    /// is reused for every event and is only valid for the duration of the event callback.
+    /// </summary>
+    public ref class PelcoDataRecord {
+    public:
+
+        /// <summary>
+        /// Gets the index of the first field with the given name.
+        /// </summary>
+        /// <param name="name">The field name, compared ordinally.</param>
+        /// <returns>The index of the field; -1 if the record has no such field.</returns>
+        int FindField(System::String^ name);
+
+        /// <summary>
+        /// Gets the name of a field.
+        /// </summary>
+        /// <param name="index">The index of the field.</param>
+        /// <returns>The field name; <c>null</c> if the index is outside of the record.</returns>
+        System::String^ GetName(int index);
+
+        /// <summary>
+        /// Gets the value of a field.
+        /// </summary>
+        /// <param name="index">The index of the field.</param>
+        /// <returns>The field value decoded as UTF-8; <c>null</c> if the index is outside of the record.</returns>
+        System::String^ GetValue(int index);
+
+        /// <summary>
+        /// Gets the value of a field as a number, without allocating.
+        /// </summary>
+        /// <param name="index">The index of the field.</param>
+        /// <param name="value">The value of the field, if it is a decimal integer.</param>
+        /// <returns><c>true</c> if the field value is a decimal integer, otherwise <c>false</c>.</returns>
+        bool TryGetInt64(int index, [System::Runtime::InteropServices::Out] long long% value);
+
+        /// <summary>
+        /// Gets the number of fields in the record.
+        /// </summary>
+        /// <value>The number of fields.</value>
+        property int FieldCount {
+        public:
+            int get() { return _fieldCount; }
+        }
+
+    internal:
+        PelcoDataRecord() : _fieldCount(0), _length(0) {}
+        array<unsigned char>^ _buffer;
+        array<int>^ _fields;
+        int _fieldCount;
+        int _length;
+        void _Parse(array<unsigned char>^ buffer, int length);
+    };
+}
+#endif // PelcoDataRecord_h__
@@ -0,0 +1,95 @@
+// Declares the PrewarmedStream class.
+#ifndef PrewarmedStream_h__
+#define PrewarmedStream_h__
+
+#include "MediaController.h"
+#include "DataSource.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The PrewarmedStream class opens a stream for a <see cref="MediaControl"/> in the background so that it can
+    /// be swapped in without rebuilding the pipeline.  The number of prewarmed streams in the process is capped
+    /// to bound the memory and server sessions they hold.
+    /// </summary>
+    private ref class PrewarmedStream {
+    public:
+
+        /// <summary>
+        /// The native event callback delegate.
+        /// </summary>
+        /// <param name="timeEvent">The time event sent from the stream.</param>
+        [System::Runtime::InteropServices::UnmanagedFunctionPointer(
+            System::Runtime::InteropServices::CallingConvention::Cdecl)]
+        delegate void TimestampCallbackDelegate(MediaController::TimestampEvent* timeEvent);
+
+        /// <summary>
+        /// Creates a prewarmed stream and starts opening it in the background.
+        /// </summary>
+        /// <param name="videoSource">The data source to use to create the video stream.</param>
+        /// <param name="videoInterface">The data interface to use to create the video stream.</param>
+        /// <param name="audioSource">The data source to use to create the audio stream.</param>
+        /// <param name="audioInterface">The data interface to use to create the audio stream.</param>
+        /// <param name="rtspVideoEndpoint">The RTSP endpoint of the video stream.</param>
+        /// <param name="rtspAudioEndpoint">The RTSP endpoint of the audio stream.</param>
+        /// <returns>The prewarmed stream; <c>nullptr</c> if the maximum number of prewarmed streams is open.</returns>
+        static PrewarmedStream^ Open(DataSource^ videoSource, DataInterface^ videoInterface, DataSource^ audioSource,
+            DataInterface^ audioInterface, System::String^ rtspVideoEndpoint, System::String^ rtspAudioEndpoint);
+
+        /// <summary>
+        /// Destructor.
+        /// </summary>
+        virtual ~PrewarmedStream() {
+            this->!PrewarmedStream();
+        }
+
+        /// <summary>
+        /// Finaliser.
+        /// </summary>
+        !PrewarmedStream();
+
+        /// <summary>
+        /// Waits for the stream to finish opening and takes ownership of its controller.
+        /// </summary>
+        /// <returns>The controller; <c>nullptr</c> if the stream could not be opened.</returns>
+        MediaController::IController* Detach();
+
+        /// <summary>
+        /// Gets whether the stream has received its first frame.
+        /// </summary>
+        /// <value><c>true</c> if the stream is ready to be swapped in, otherwise <c>false</c>.</value>
+        property bool IsReady {
+            bool get() { return _isReady; }
+        }
+
+        /// <summary>
+        /// Gets or sets the maximum number of prewarmed streams that may be open at once in the process.
+        /// Defaults to 4.
+        /// </summary>
+        /// <value>The maximum number of prewarmed streams.</value>
+        static property int MaxPrewarmedStreams {
+            int get() { return _maxPrewarmedStreams; }
+            void set(int value) { _maxPrewarmedStreams = value; }
+        }
+
+    internal:
+        PrewarmedStream() {}
+        DataSource^ _videoSource;
+        DataInterface^ _videoInterface;
+        DataSource^ _audioSource;
+        DataInterface^ _audioInterface;
+        System::String^ _rtspVideoEndpoint;
+        System::String^ _rtspAudioEndpoint;
+        MediaController::IController* _control;
+        System::Threading::ManualResetEvent^ _opened;
+        TimestampCallbackDelegate^ _timestampCallback;
+        bool _isReady;
+        bool _isCanceled;
+        static int _maxPrewarmedStreams = 4;
+        static int _openStreams;
+        void _Open(System::Object^ state);
+        void _OnTimestamp(MediaController::TimestampEvent* timeEvent);
+        void _Release(MediaController::IController* control);
+    };
+}
+#endif // PrewarmedStream_h__
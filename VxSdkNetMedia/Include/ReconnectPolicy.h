@@ -0,0 +1,90 @@
+// Declares the ReconnectPolicy class.
+#ifndef ReconnectPolicy_h__
+#define ReconnectPolicy_h__
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The ReconnectPolicy class describes how a <see cref="MediaControl"/> automatically recovers a stream after
+    /// a connection lost event.  Attempts are spaced using jittered exponential backoff and the number of
+    /// reconnects in progress across all streams in the process is capped by <see cref="MaxConcurrentReconnects"/>.
+    /// </summary>
+    public ref class ReconnectPolicy {
+    public:
+
+        /// <summary>
+        /// Default constructor.
+        /// </summary>
+        ReconnectPolicy() {
+            InitialDelay = System::TimeSpan::FromSeconds(1);
+            MaxDelay = System::TimeSpan::FromSeconds(60);
+            Multiplier = 2.0;
+            Jitter = 0.5;
+            MaxAttempts = 0;
+            ResumePlayback = true;
+        }
+
+        /// <summary>
+        /// Gets the delay to wait before the given reconnect attempt.
+        /// </summary>
+        /// <param name="attempt">The zero based reconnect attempt.</param>
+        /// <param name="random">The random number generator used to apply jitter.</param>
+        /// <returns>The delay before the reconnect attempt.</returns>
+        System::TimeSpan GetDelay(int attempt, System::Random^ random);
+
+        /// <summary>
+        /// Gets or sets the delay before the first reconnect attempt.  Defaults to 1 second.
+        /// </summary>
+        /// <value>The initial delay.</value>
+        property System::TimeSpan InitialDelay;
+
+        /// <summary>
+        /// Gets or sets the fraction of each delay, between 0 and 1, that is randomized so that streams which lost
+        /// their connection at the same time do not reconnect at the same time.  Defaults to 0.5.
+        /// </summary>
+        /// <value>The jitter fraction.</value>
+        property double Jitter;
+
+        /// <summary>
+        /// Gets or sets the maximum number of reconnect attempts; 0 to keep retrying until the connection is restored
+        /// or the stream is stopped.  Defaults to 0.
+        /// </summary>
+        /// <value>The maximum number of reconnect attempts.</value>
+        property int MaxAttempts;
+
+        /// <summary>
+        /// Gets or sets the upper bound of the delay between reconnect attempts.  Defaults to 60 seconds.
+        /// </summary>
+        /// <value>The maximum delay.</value>
+        property System::TimeSpan MaxDelay;
+
+        /// <summary>
+        /// Gets or sets the factor the delay is multiplied by after each failed attempt.  Defaults to 2.
+        /// </summary>
+        /// <value>The backoff multiplier.</value>
+        property double Multiplier;
+
+        /// <summary>
+        /// Gets or sets whether a playback stream should resume from the last timestamp received before the
+        /// connection was lost.  If <c>false</c> the stream resumes live.  Defaults to <c>true</c>.
+        /// </summary>
+        /// <value><c>true</c> to resume playback at the last timestamp, otherwise <c>false</c>.</value>
+        property bool ResumePlayback;
+
+        /// <summary>
+        /// Gets or sets the maximum number of reconnects that may be in progress at once across all streams in the
+        /// process.  Defaults to 4.
+        /// </summary>
+        /// <value>The maximum number of concurrent reconnects.</value>
+        static property int MaxConcurrentReconnects {
+        public:
+            int get() { return _maxConcurrentReconnects; }
+            void set(int value);
+        }
+
+    internal:
+        static int _maxConcurrentReconnects = 4;
+        static System::Threading::SemaphoreSlim^ _reconnectSlots = gcnew System::Threading::SemaphoreSlim(4);
+    };
+}
+#endif // ReconnectPolicy_h__
@@ -0,0 +1,250 @@
+// Declares the StreamStatistics class.
+#ifndef StreamStatistics_h__
+#define StreamStatistics_h__
+
+#include "MediaController.h"
+
+namespace VxSdkNet {
+
+    /// <summary>
+    /// The StreamStatistics class represents a point in time snapshot of the health counters collected
+    /// for a stream.  Counters are accumulated from the time the stream was created or the statistics
+    /// were last reset.
+    /// </summary>
+    public ref class StreamStatistics {
+    public:
+
+        /// <summary>
+        /// Gets the number of connection lost events received from the stream.
+        /// </summary>
+        /// <value>The number of connection lost events.</value>
+        property long long ConnectionsLost {
+        public:
+            long long get() { return _connectionsLost; }
+        }
+
+        /// <summary>
+        /// Gets the number of connection restored events received from the stream.
+        /// </summary>
+        /// <value>The number of connection restored events.</value>
+        property long long ConnectionsRestored {
+        public:
+            long long get() { return _connectionsRestored; }
+        }
+
+        /// <summary>
+        /// Gets the amount of time that statistics have been collected for.
+        /// </summary>
+        /// <value>The collection period.</value>
+        property System::TimeSpan Elapsed {
+        public:
+            System::TimeSpan get() { return _elapsed; }
+        }
+
+        /// <summary>
+        /// Gets the current frame rate, calculated from the arrival interval of stream timestamps.
+        /// </summary>
+        /// <value>The frame rate in frames per second; 0 if no frames have been received.</value>
+        property double FrameRate {
+        public:
+            double get() { return _frameRate; }
+        }
+
+        /// <summary>
+        /// Gets the number of frame timestamps received from the stream.
+        /// </summary>
+        /// <value>The number of frames received.</value>
+        property long long FramesReceived {
+        public:
+            long long get() { return _framesReceived; }
+        }
+
+        /// <summary>
+        /// Gets whether the stream is currently connected, based on the last connection event received.
+        /// </summary>
+        /// <value><c>true</c> if the stream is connected, otherwise <c>false</c>.</value>
+        property bool IsConnected {
+        public:
+            bool get() { return _isConnected; }
+        }
+
+        /// <summary>
+        /// Gets the interarrival jitter of the stream, calculated from the difference between the spacing of
+        /// the stream timestamps and the spacing of their arrival.
+        /// </summary>
+        /// <value>The smoothed interarrival jitter.</value>
+        property System::TimeSpan Jitter {
+        public:
+            System::TimeSpan get() { return _jitter; }
+        }
+
+        /// <summary>
+        /// Gets the stream timestamp of the last frame received.
+        /// </summary>
+        /// <value>The last frame timestamp (UTC); <c>DateTime.MinValue</c> if no frames have been received.</value>
+        property System::DateTime LastFrameTime {
+        public:
+            System::DateTime get() { return _lastFrameTime; }
+        }
+
+        /// <summary>
+        /// Gets the number of frames that arrived more than twice the average frame interval after the
+        /// previous frame.
+        /// </summary>
+        /// <value>The number of late frames.</value>
+        property long long LateFrames {
+        public:
+            long long get() { return _lateFrames; }
+        }
+
+        /// <summary>
+        /// Gets the duration of the most recent completed outage; the time from a connection lost event until
+        /// the connection was restored.
+        /// </summary>
+        /// <value>The duration of the last outage.</value>
+        property System::TimeSpan LastOutage {
+        public:
+            System::TimeSpan get() { return _lastOutage; }
+        }
+
+        /// <summary>
+        /// Gets the end-to-end latency of the last frame received; the difference between the local clock and the
+        /// stream timestamp.  Only meaningful for live streams with a synchronized clock.
+        /// </summary>
+        /// <value>The end-to-end latency.</value>
+        property System::TimeSpan Latency {
+        public:
+            System::TimeSpan get() { return _latency; }
+        }
+
+        /// <summary>
+        /// Gets the number of Pelco data payload bytes received from the stream.
+        /// </summary>
+        /// <value>The number of Pelco data bytes.</value>
+        property long long PelcoDataBytes {
+        public:
+            long long get() { return _pelcoDataBytes; }
+        }
+
+        /// <summary>
+        /// Gets the number of Pelco data events received from the stream.
+        /// </summary>
+        /// <value>The number of Pelco data events.</value>
+        property long long PelcoDataEvents {
+        public:
+            long long get() { return _pelcoDataEvents; }
+        }
+
+        /// <summary>
+        /// Gets the number of reconnect attempts made by the <see cref="ReconnectPolicy"/> of the stream.
+        /// </summary>
+        /// <value>The number of reconnect attempts.</value>
+        property long long ReconnectAttempts {
+        public:
+            long long get() { return _reconnectAttempts; }
+        }
+
+        /// <summary>
+        /// Gets the time from the last change of data source until the first frame of the new source was received.
+        /// </summary>
+        /// <value>The latency of the last stream switch.</value>
+        property System::TimeSpan SwitchLatency {
+        public:
+            System::TimeSpan get() { return _switchLatency; }
+        }
+
+        /// <summary>
+        /// Gets the amount of time since the last frame was received.  A value that keeps growing while
+        /// <see cref="IsConnected"/> is <c>true</c> indicates a stalled stream.
+        /// </summary>
+        /// <value>The time since the last frame was received.</value>
+        property System::TimeSpan TimeSinceLastFrame {
+        public:
+            System::TimeSpan get() { return _timeSinceLastFrame; }
+        }
+
+        /// <summary>
+        /// Gets the number of gaps detected in the stream timestamps; a gap is counted when a timestamp
+        /// moves backwards or skips ahead by more than twice the average frame interval.
+        /// </summary>
+        /// <value>The number of timestamp gaps.</value>
+        property long long TimestampGaps {
+        public:
+            long long get() { return _timestampGaps; }
+        }
+
+        /// <summary>
+        /// Gets the total amount of time the stream has spent disconnected.
+        /// </summary>
+        /// <value>The total outage time.</value>
+        property System::TimeSpan TotalOutage {
+        public:
+            System::TimeSpan get() { return _totalOutage; }
+        }
+
+    internal:
+        StreamStatistics() {}
+        long long _connectionsLost;
+        long long _connectionsRestored;
+        System::TimeSpan _elapsed;
+        double _frameRate;
+        long long _framesReceived;
+        bool _isConnected;
+        System::TimeSpan _jitter;
+        System::DateTime _lastFrameTime;
+        long long _lateFrames;
+        System::TimeSpan _lastOutage;
+        System::TimeSpan _latency;
+        long long _pelcoDataBytes;
+        long long _pelcoDataEvents;
+        long long _reconnectAttempts;
+        System::TimeSpan _switchLatency;
+        System::TimeSpan _timeSinceLastFrame;
+        long long _timestampGaps;
+        System::TimeSpan _totalOutage;
+    };
+
+    /// <summary>
+    /// Accumulates the stream health counters for a MediaControl.  The Record methods are called from the
+    /// stream callback thread and only use atomic operations, so collection can be left enabled permanently.
+    /// </summary>
+    private ref class StreamStatisticsCollector {
+    public:
+        StreamStatisticsCollector();
+        void RecordTimestamp(MediaController::TimestampEvent* timeEvent);
+        void RecordStreamEvent(MediaController::StreamEvent* streamEvent);
+        void RecordPelcoData(int length);
+        void RecordReconnectAttempt(bool succeeded);
+        void RecordSourceChange();
+        void Reset();
+        StreamStatistics^ Snapshot();
+
+        property bool IsConnected {
+            bool get() { return System::Threading::Interlocked::Read(_outageStartUs) == 0; }
+        }
+
+    internal:
+        static long long _NowMicroseconds();
+        void _EndOutage();
+        long long _startUs;
+        long long _framesReceived;
+        long long _lateFrames;
+        long long _timestampGaps;
+        long long _pelcoDataEvents;
+        long long _pelcoDataBytes;
+        long long _connectionsLost;
+        long long _connectionsRestored;
+        long long _lastArrivalUs;
+        long long _lastStreamUs;
+        long long _avgIntervalUs;
+        long long _jitterScaledUs;
+        long long _latencyUs;
+        long long _outageStartUs;
+        long long _outageTotalUs;
+        long long _lastOutageUs;
+        long long _reconnectAttempts;
+        long long _switchStartUs;
+        long long _switchLatencyUs;
+    };
+}
+#endif // StreamStatistics_h__
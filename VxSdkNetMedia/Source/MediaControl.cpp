@@ -1,11 +1,17 @@
 /// <summary>
 /// Implements the MediaControl class.
 /// </summary>
+#include <msclr/lock.h>
 #include "MediaControl.h"
 
 using namespace System::Runtime::InteropServices;
+using namespace System::Threading;
 
 VxSdkNet::MediaControl::MediaControl(DataSource^ videoSource, DataInterface^ videoInterface, DataSource^ audioSource, DataInterface^ audioInterface) {
+    // Keep the sources' native objects in place until the controller has taken the request
+    NativeReadLock videoLock(videoSource != nullptr ? videoSource->_nativeLock : nullptr);
+    NativeReadLock audioLock(audioSource != nullptr ? audioSource->_nativeLock : nullptr);
+
     // Create a new MediaRequest object
     MediaController::MediaRequest request = MediaController::MediaRequest();
     if (videoSource != nullptr) {
@@ -18,11 +24,18 @@ VxSdkNet::MediaControl::MediaControl(DataSource^ videoSource, DataInterface^ vid
         request.audioDataInterface = *audioInterface->_dataInterface;
     }
 
+    // Keep the sources so the stream can be rebuilt on reconnect
+    _videoSource = videoSource;
+    _videoInterface = videoInterface;
+    _audioSource = audioSource;
+    _audioInterface = audioInterface;
+
     // Get the MediaController which allows the client to control streams
     MediaController::IController* control = nullptr;
     MediaController::GetController(&request, &control);
 
     _control = control;
+    _AddObservers();
 }
 
 VxSdkNet::MediaControl::MediaControl(System::String^ rtspVideoEndpoint, System::String^ rtspAudioEndpoint) {
@@ -34,11 +47,16 @@ VxSdkNet::MediaControl::MediaControl(System::String^ rtspVideoEndpoint, System::
     request.rtspVideoEndpoint = _strdup((char*)videoEndpoint.c_str());
     request.rtspAudioEndpoint = _strdup((char*)audioEndpoint.c_str());
 
+    // Keep the endpoints so the stream can be rebuilt on reconnect
+    _rtspVideoEndpoint = rtspVideoEndpoint;
+    _rtspAudioEndpoint = rtspAudioEndpoint;
+
     // Get the MediaController which allows the client to control streams
     MediaController::IController* control = nullptr;
     MediaController::GetController(&request, &control);
 
     _control = control;
+    _AddObservers();
 }
 
 VxSdkNet::MediaControl::MediaControl(System::String^ rtspVideoEndpoint, System::String^ rtspAudioEndpoint, System::String^ username, System::String^ password) {
@@ -54,65 +72,82 @@ VxSdkNet::MediaControl::MediaControl(System::String^ rtspVideoEndpoint, System::
     request.username = _strdup((char*)rtspUsername.c_str());
     request.password = _strdup((char*)rtspPassword.c_str());
 
+    // Keep the endpoints and credentials so the stream can be rebuilt on reconnect
+    _rtspVideoEndpoint = rtspVideoEndpoint;
+    _rtspAudioEndpoint = rtspAudioEndpoint;
+    _rtspUsername = username;
+    _rtspPassword = password;
+
     // Get the MediaController which allows the client to control streams
     MediaController::IController* control = nullptr;
     MediaController::GetController(&request, &control);
 
     _control = control;
+    _AddObservers();
 }
 
-VxSdkNet::MediaControl::!MediaControl() {
-    // Clear all subscriptions to the timestamp events
-    if (_control != nullptr) {
-        _control->ClearObservers();
-        delete _control;
-        _control = nullptr;
-    }
-
-    if (_timestampEvent != nullptr) {
-        delete _timestampEvent;
-        _timestampEvent = nullptr;
-    }
+VxSdkNet::MediaControl::~MediaControl() {
+    // Abandon any reconnect in progress
+    Interlocked::Increment(_requestGeneration);
 
-    if (_streamEvent != nullptr) {
-        delete _streamEvent;
-        _streamEvent = nullptr;
+    // Stop raising statistics events
+    if (_statisticsTimer != nullptr) {
+        delete _statisticsTimer;
+        _statisticsTimer = nullptr;
     }
 
-    if (_pelcoDataEvent != nullptr) {
-        delete _pelcoDataEvent;
-        _pelcoDataEvent = nullptr;
+    // Release the prewarmed stream
+    if (_prewarmed != nullptr) {
+        delete _prewarmed;
+        _prewarmed = nullptr;
     }
 
-    if (_timestampCallback != nullptr) {
-        delete _timestampCallback;
-        _timestampCallback = nullptr;
+    // Release the controller once any reconnect holding it has finished with it
+    {
+        msclr::lock controlLock(_controlLock);
+        this->!MediaControl();
     }
 
-    if (_streamCallback != nullptr) {
-        delete _streamCallback;
-        _streamCallback = nullptr;
-    }
+    _timestampEvent = nullptr;
+    _streamEvent = nullptr;
+    _pelcoDataEvent = nullptr;
+}
 
-    if (_pelcoDataCallback != nullptr) {
-        delete _pelcoDataCallback;
-        _pelcoDataCallback = nullptr;
+VxSdkNet::MediaControl::!MediaControl() {
+    // Clear all subscriptions to the timestamp events; the managed members may already have been finalized, so only
+    // the native controller is released here
+    if (_control != nullptr) {
+        _control->ClearObservers();
+        delete _control;
+        _control = nullptr;
     }
 }
 
 void VxSdkNet::MediaControl::GoToLive() {
+    msclr::lock controlLock(_controlLock);
+    Interlocked::Increment(_requestGeneration);
+    _isPlaying = true;
+    _isPlayback = false;
     _control->GoToLive();
 }
 
 void VxSdkNet::MediaControl::Pause() {
+    msclr::lock controlLock(_controlLock);
+    Interlocked::Increment(_requestGeneration);
+    _isPlaying = false;
     _control->Pause();
 }
 
 bool VxSdkNet::MediaControl::Play(float speed) {
-    return _control->Play(speed, 0, MediaController::IStream::kUDP);
+    return VxSdkNet::MediaControl::Play(speed, RTSPNetworkTransports::UDP);
 }
 
 bool VxSdkNet::MediaControl::Play(float speed, VxSdkNet::MediaControl::RTSPNetworkTransports networkTransport) {
+    msclr::lock controlLock(_controlLock);
+    Interlocked::Increment(_requestGeneration);
+    _isPlaying = true;
+    _speed = speed;
+    _transport = networkTransport;
     return _control->Play(speed, 0, (MediaController::IStream::RTSPNetworkTransport) networkTransport);
 }
 
@@ -123,16 +158,19 @@ bool VxSdkNet::MediaControl::StartLocalRecording(System::String^ filePath, Syste
 bool VxSdkNet::MediaControl::StartLocalRecording(System::String^ filePath, System::String^ fileName, bool includeOverlays) {
     std::string path = Utils::ConvertCSharpString(filePath);
     std::string name = Utils::ConvertCSharpString(fileName);
+    msclr::lock controlLock(_controlLock);
     return _control->StartLocalRecording((char*)path.c_str(), (char*)name.c_str(), includeOverlays);
 }
 
 void VxSdkNet::MediaControl::StopLocalRecording() {
+    msclr::lock controlLock(_controlLock);
     _control->StopLocalRecording();
 }
 
 bool VxSdkNet::MediaControl::SnapShot(System::String^ filePath, System::String^ fileName) {
     std::string path = Utils::ConvertCSharpString(filePath);
     std::string name = Utils::ConvertCSharpString(fileName);
+    msclr::lock controlLock(_controlLock);
     return _control->SnapShot((char*)path.c_str(), (char*)name.c_str());
 }
 
@@ -145,10 +183,20 @@ bool VxSdkNet::MediaControl::Seek(System::DateTime time, float speed, VxSdkNet::
     System::TimeSpan ts = (time - System::DateTime(1970, 1, 1, 0, 0, 0));
     unsigned int seekTime = safe_cast<unsigned int>(ts.TotalSeconds);
 
+    msclr::lock controlLock(_controlLock);
+    Interlocked::Increment(_requestGeneration);
+    _isPlaying = true;
+    _isPlayback = true;
+    _speed = speed;
+    _transport = networkTransport;
     return _control->Play(speed, seekTime, (MediaController::IStream::RTSPNetworkTransport) networkTransport);
 }
 
 void VxSdkNet::MediaControl::SetDataSource(DataSource^ videoSource, DataInterface^ videoInterface, DataSource^ audioSource, DataInterface^ audioInterface) {
+    // Keep the sources' native objects in place until the controller has taken the request
+    NativeReadLock videoLock(videoSource != nullptr ? videoSource->_nativeLock : nullptr);
+    NativeReadLock audioLock(audioSource != nullptr ? audioSource->_nativeLock : nullptr);
+
     // Create a new MediaRequest object
     MediaController::MediaRequest request;
     if (videoSource != nullptr) {
@@ -161,7 +209,18 @@ void VxSdkNet::MediaControl::SetDataSource(DataSource^ videoSource, DataInterfac
         request.audioDataInterface = *audioInterface->_dataInterface;
     }
 
+    // Keep the sources so the stream can be rebuilt on reconnect
+    msclr::lock controlLock(_controlLock);
+    Interlocked::Increment(_requestGeneration);
+    _videoSource = videoSource;
+    _videoInterface = videoInterface;
+    _audioSource = audioSource;
+    _audioInterface = audioInterface;
+    _rtspVideoEndpoint = nullptr;
+    _rtspAudioEndpoint = nullptr;
+
     // Update the stream settings for the MediaController using the MediaRequest
+    _statistics->RecordSourceChange();
     _control->NewRequest(request);
 }
 
@@ -174,21 +233,157 @@ void VxSdkNet::MediaControl::SetDataSource(System::String^ rtspVideoEndpoint, Sy
     request.rtspVideoEndpoint = _strdup((char*)videoEndpoint.c_str());
     request.rtspAudioEndpoint = _strdup((char*)audioEndpoint.c_str());
 
+    // Keep the endpoints so the stream can be rebuilt on reconnect
+    msclr::lock controlLock(_controlLock);
+    Interlocked::Increment(_requestGeneration);
+    _videoSource = nullptr;
+    _audioSource = nullptr;
+    _rtspVideoEndpoint = rtspVideoEndpoint;
+    _rtspAudioEndpoint = rtspAudioEndpoint;
+    _rtspUsername = nullptr;
+    _rtspPassword = nullptr;
+
     // Update the stream settings for the MediaController using the MediaRequest
+    _statistics->RecordSourceChange();
     _control->NewRequest(request);
 }
 
+bool VxSdkNet::MediaControl::PrewarmDataSource(DataSource^ videoSource, DataInterface^ videoInterface, DataSource^ audioSource, DataInterface^ audioInterface) {
+    CancelPrewarm();
+    _prewarmed = PrewarmedStream::Open(videoSource, videoInterface, audioSource, audioInterface, nullptr, nullptr);
+    return _prewarmed != nullptr;
+}
+
+bool VxSdkNet::MediaControl::PrewarmDataSource(System::String^ rtspVideoEndpoint, System::String^ rtspAudioEndpoint) {
+    CancelPrewarm();
+    _prewarmed = PrewarmedStream::Open(nullptr, nullptr, nullptr, nullptr, rtspVideoEndpoint, rtspAudioEndpoint);
+    return _prewarmed != nullptr;
+}
+
+void VxSdkNet::MediaControl::CancelPrewarm() {
+    if (_prewarmed != nullptr) {
+        delete _prewarmed;
+        _prewarmed = nullptr;
+    }
+}
+
+bool VxSdkNet::MediaControl::SwapToPrewarmed() {
+    PrewarmedStream^ prewarmed = _prewarmed;
+    _prewarmed = nullptr;
+    if (prewarmed == nullptr)
+        return false;
+
+    // Take over the prewarmed controller; it is already connected and playing
+    MediaController::IController* control = prewarmed->Detach();
+    if (control == nullptr) {
+        delete prewarmed;
+        return false;
+    }
+
+    // Move the observers over to the new stream before it replaces the old one, so that a failure leaves the old
+    // stream in place
+    try {
+        _RegisterObservers(control);
+    }
+    catch (System::Exception^) {
+        control->ClearObservers();
+        control->Stop();
+        delete control;
+        delete prewarmed;
+        throw;
+    }
+
+    msclr::lock controlLock(_controlLock);
+    _statistics->RecordSourceChange();
+    Interlocked::Increment(_requestGeneration);
+    MediaController::IController* previousControl = _control;
+    _control = control;
+    _videoSource = prewarmed->_videoSource;
+    _videoInterface = prewarmed->_videoInterface;
+    _audioSource = prewarmed->_audioSource;
+    _audioInterface = prewarmed->_audioInterface;
+    _rtspVideoEndpoint = prewarmed->_rtspVideoEndpoint;
+    _rtspAudioEndpoint = prewarmed->_rtspAudioEndpoint;
+    _rtspUsername = nullptr;
+    _rtspPassword = nullptr;
+    _isPlaying = true;
+    _isPlayback = false;
+    _speed = 1;
+    _transport = RTSPNetworkTransports::UDP;
+
+    // Move the display window over to the new stream before tearing down the old one
+    if (_window != System::IntPtr::Zero)
+        _control->SetWindow(static_cast<HWND>(_window.ToPointer()));
+
+    if (previousControl != nullptr) {
+        previousControl->ClearObservers();
+        previousControl->Stop();
+        delete previousControl;
+    }
+
+    delete prewarmed;
+    return true;
+}
+
 void VxSdkNet::MediaControl::SetVideoWindow(System::IntPtr windowHandle) {
     // Set the display for the MediaController using windowHandle
     HWND VideoWindow = static_cast<HWND>(windowHandle.ToPointer());
+    msclr::lock controlLock(_controlLock);
     _control->SetWindow(VideoWindow);
+    _window = windowHandle;
 }
 
 void VxSdkNet::MediaControl::Stop() {
+    msclr::lock controlLock(_controlLock);
+    Interlocked::Increment(_requestGeneration);
+    _isPlaying = false;
     _control->Stop();
 }
 
+bool VxSdkNet::MediaControl::IsPipelineActive::get() {
+    msclr::lock controlLock(_controlLock);
+    return _control->IsPipelineActive();
+}
+
+VxSdkNet::MediaControl::Modes VxSdkNet::MediaControl::Mode::get() {
+    msclr::lock controlLock(_controlLock);
+    return (Modes)_control->GetMode();
+}
+
+VxSdkNet::MediaControl::AspectRatios VxSdkNet::MediaControl::AspectRatio::get() {
+    msclr::lock controlLock(_controlLock);
+    return (AspectRatios)_control->GetAspectRatio();
+}
+
+void VxSdkNet::MediaControl::AspectRatio::set(AspectRatios value) {
+    msclr::lock controlLock(_controlLock);
+    _control->SetAspectRatio((MediaController::IStream::AspectRatios)value);
+}
+
+bool VxSdkNet::MediaControl::StretchToFit::get() {
+    msclr::lock controlLock(_controlLock);
+    return _control->GetStretchToFit();
+}
+
+void VxSdkNet::MediaControl::StretchToFit::set(bool value) {
+    msclr::lock controlLock(_controlLock);
+    _control->SetStretchToFit(value);
+}
+
+void VxSdkNet::MediaControl::ResetStatistics() {
+    _statistics->Reset();
+}
+
+void VxSdkNet::MediaControl::StatisticsInterval::set(System::TimeSpan value) {
+    _statisticsInterval = value;
+
+    // Apply the new interval to the statistics timer if it is running
+    if (_statisticsTimer != nullptr)
+        _statisticsTimer->Change(_statisticsInterval, _statisticsInterval);
+}
+
 void VxSdkNet::MediaControl::TimestampEvent::add(TimestampEventDelegate ^eventDelegate) {
+    msclr::lock controlLock(_controlLock);
     if (_timestampCallback == nullptr) {
         // Set the callback for timestamp events
         _timestampCallback = gcnew TimestampCallbackDelegate(this, &VxSdkNet::MediaControl::_FireTimestampEvent);
@@ -205,12 +400,16 @@ void VxSdkNet::MediaControl::TimestampEvent::remove(TimestampEventDelegate ^even
 };
 
 void VxSdkNet::MediaControl::_FireTimestampEvent(MediaController::TimestampEvent* timeEvent) {
+    _statistics->RecordTimestamp(timeEvent);
+    _lastTimestamp = timeEvent->unixTime;
+
     // Fire the notification if there is a subscription to the timestamp events
     if (_timestampEvent != nullptr)
         return _timestampEvent(gcnew MediaEvent(timeEvent));
 }
 
 void VxSdkNet::MediaControl::StreamEvent::add(StreamEventDelegate ^eventDelegate) {
+    msclr::lock controlLock(_controlLock);
     if (_streamCallback == nullptr) {
         // Set the callback for stream events
         _streamCallback = gcnew StreamCallbackDelegate(this, &VxSdkNet::MediaControl::_FireStreamEvent);
@@ -227,12 +426,21 @@ void VxSdkNet::MediaControl::StreamEvent::remove(StreamEventDelegate ^eventDeleg
 };
 
 void VxSdkNet::MediaControl::_FireStreamEvent(MediaController::StreamEvent* streamEvent) {
+    _statistics->RecordStreamEvent(streamEvent);
+
+    // Start recovering the stream if it was playing when the connection was lost
+    if ((StreamingEvent::EventTypes)streamEvent->eventType == StreamingEvent::EventTypes::ConnectionLost &&
+        _reconnectPolicy != nullptr && _isPlaying && Interlocked::CompareExchange(_isReconnecting, 1, 0) == 0) {
+        ThreadPool::QueueUserWorkItem(gcnew WaitCallback(this, &VxSdkNet::MediaControl::_Reconnect), _requestGeneration);
+    }
+
     // Fire the notification if there is a subscription to the stream events
     if (_streamEvent != nullptr)
         return _streamEvent(gcnew StreamingEvent(streamEvent));
 }
 
 void VxSdkNet::MediaControl::PelcoDataEvent::add(PelcoDataEventDelegate ^eventDelegate) {
+    msclr::lock controlLock(_controlLock);
     if (_pelcoDataCallback == nullptr) {
         // Set the callback for PelcoData events
         _pelcoDataCallback = gcnew PelcoDataCallbackDelegate(this, &VxSdkNet::MediaControl::_FirePelcoDataEvent);
@@ -249,12 +457,155 @@ void VxSdkNet::MediaControl::PelcoDataEvent::remove(PelcoDataEventDelegate ^even
 };
 
 void VxSdkNet::MediaControl::_FirePelcoDataEvent(MediaController::PelcoDataEvent* event) {
+    // Reuse the same managed event and payload buffer for every Pelco data event; subscribers read it during the
+    // callback, and copy the payload out with ToArray or CopyTo to keep it
+    if (_pelcoDataArgs == nullptr)
+        _pelcoDataArgs = gcnew PelcoDataManagedEvent();
+
+    _pelcoDataArgs->_Load(event);
+    _statistics->RecordPelcoData(_pelcoDataArgs->Length);
+
     // Fire the notification if there is a subscription to the Pelco data events
     if (_pelcoDataEvent != nullptr)
-        return _pelcoDataEvent(gcnew PelcoDataManagedEvent(event));
+        return _pelcoDataEvent(_pelcoDataArgs);
+}
+
+void VxSdkNet::MediaControl::StatisticsEvent::add(StatisticsEventDelegate ^eventDelegate) {
+    // Add a new subscription to the StatisticsEventDelegate
+    _statisticsEvent += eventDelegate;
+
+    // Start the statistics timer on the first subscription
+    if (_statisticsTimer == nullptr) {
+        _statisticsTimer = gcnew System::Threading::Timer(
+            gcnew System::Threading::TimerCallback(this, &VxSdkNet::MediaControl::_FireStatisticsEvent),
+            nullptr, _statisticsInterval, _statisticsInterval);
+    }
+};
+
+void VxSdkNet::MediaControl::StatisticsEvent::remove(StatisticsEventDelegate ^eventDelegate) {
+    // Remove the StatisticsEventDelegate subscription
+    _statisticsEvent -= eventDelegate;
+
+    // Stop the statistics timer once there are no subscriptions left
+    if (_statisticsEvent == nullptr && _statisticsTimer != nullptr) {
+        delete _statisticsTimer;
+        _statisticsTimer = nullptr;
+    }
+};
+
+void VxSdkNet::MediaControl::_FireStatisticsEvent(System::Object^ state) {
+    // Fire the notification if there is a subscription to the statistics events
+    StatisticsEventDelegate^ statisticsEvent = _statisticsEvent;
+    if (statisticsEvent != nullptr)
+        statisticsEvent(_statistics->Snapshot());
+}
+
+void VxSdkNet::MediaControl::_AddObservers() {
+    _controlLock = gcnew System::Object();
+    _statistics = gcnew StreamStatisticsCollector();
+    _statisticsInterval = System::TimeSpan::FromSeconds(1);
+    _speed = 1;
+
+    // Observe the stream up front so that statistics are collected whether or not the client has
+    // subscribed to the managed events; the callbacks are created even without a controller, so that one
+    // swapped in later can be observed
+    _timestampCallback = gcnew TimestampCallbackDelegate(this, &VxSdkNet::MediaControl::_FireTimestampEvent);
+    _streamCallback = gcnew StreamCallbackDelegate(this, &VxSdkNet::MediaControl::_FireStreamEvent);
+    _pelcoDataCallback = gcnew PelcoDataCallbackDelegate(this, &VxSdkNet::MediaControl::_FirePelcoDataEvent);
+    if (_control != nullptr)
+        _RegisterObservers(_control);
+}
+
+void VxSdkNet::MediaControl::_RegisterObservers(MediaController::IController* control) {
+    control->AddObserver(MediaController::TimestampEventCallback(Marshal::GetFunctionPointerForDelegate(_timestampCallback).ToPointer()));
+    control->AddStreamObserver(MediaController::StreamEventCallback(Marshal::GetFunctionPointerForDelegate(_streamCallback).ToPointer()));
+    control->AddPelcoDataObserver(MediaController::PelcoDataEventCallback(Marshal::GetFunctionPointerForDelegate(_pelcoDataCallback).ToPointer()));
+}
+
+MediaController::MediaRequest VxSdkNet::MediaControl::_CreateRequest() {
+    // Create a new MediaRequest object from the last sources set by the client
+    MediaController::MediaRequest request;
+    if (_videoSource != nullptr) {
+        request.dataSource = _videoSource->_dataSource;
+        request.dataInterface = *_videoInterface->_dataInterface;
+    }
+
+    if (_audioSource != nullptr) {
+        request.audioDataSource = _audioSource->_dataSource;
+        request.audioDataInterface = *_audioInterface->_dataInterface;
+    }
+
+    if (_rtspVideoEndpoint != nullptr) {
+        std::string videoEndpoint = Utils::ConvertCSharpString(_rtspVideoEndpoint);
+        std::string audioEndpoint = Utils::ConvertCSharpString(_rtspAudioEndpoint);
+        request.rtspVideoEndpoint = _strdup((char*)videoEndpoint.c_str());
+        request.rtspAudioEndpoint = _strdup((char*)audioEndpoint.c_str());
+    }
+
+    if (_rtspUsername != nullptr) {
+        std::string rtspUsername = Utils::ConvertCSharpString(_rtspUsername);
+        std::string rtspPassword = Utils::ConvertCSharpString(_rtspPassword);
+        request.username = _strdup((char*)rtspUsername.c_str());
+        request.password = _strdup((char*)rtspPassword.c_str());
+    }
+
+    return request;
+}
+
+void VxSdkNet::MediaControl::_Reconnect(System::Object^ state) {
+    int generation = safe_cast<int>(state);
+    ReconnectPolicy^ policy = _reconnectPolicy;
+
+    // Seed each stream differently so that streams which lost their connection together spread out their attempts
+    System::Random^ random = gcnew System::Random(System::Guid::NewGuid().GetHashCode());
+    for (int attempt = 0; policy != nullptr && (policy->MaxAttempts == 0 || attempt < policy->MaxAttempts); attempt++) {
+        Thread::Sleep(policy->GetDelay(attempt, random));
+
+        // Stop if the connection was restored by the stream or the client has since stopped or changed the stream
+        if (_control == nullptr || Volatile::Read(_requestGeneration) != generation || _statistics->IsConnected)
+            break;
+
+        // Limit the number of streams reconnecting at the same time, and check again under the control lock, as the
+        // client may have stopped, changed or released the stream while this was waiting
+        SemaphoreSlim^ reconnectSlots = ReconnectPolicy::_reconnectSlots;
+        reconnectSlots->Wait();
+        bool isStale = false;
+        bool resumed = false;
+        try {
+            msclr::lock controlLock(_controlLock);
+            isStale = _control == nullptr || Volatile::Read(_requestGeneration) != generation;
+            if (!isStale)
+                resumed = _Resume(policy->ResumePlayback);
+        }
+        finally {
+            reconnectSlots->Release();
+        }
+
+        if (isStale)
+            break;
+
+        _statistics->RecordReconnectAttempt(resumed);
+        if (resumed)
+            break;
+    }
+
+    Interlocked::Exchange(_isReconnecting, 0);
+}
+
+bool VxSdkNet::MediaControl::_Resume(bool resumePlayback) {
+    // The caller holds the control lock
+    // Keep the sources' native objects in place until the controller has taken the request
+    NativeReadLock videoLock(_videoSource != nullptr ? _videoSource->_nativeLock : nullptr);
+    NativeReadLock audioLock(_audioSource != nullptr ? _audioSource->_nativeLock : nullptr);
+
+    // Rebuild the stream and resume playback at the last timestamp received, otherwise resume live
+    _control->NewRequest(_CreateRequest());
+    unsigned int seekTime = resumePlayback && _isPlayback ? _lastTimestamp : 0;
+    return _control->Play(_speed, seekTime, (MediaController::IStream::RTSPNetworkTransport)_transport);
 }
 
 bool VxSdkNet::MediaControl::AddVideoOverlayData(System::String^ overlayData, VideoOverlayDataPositions position, bool includeDateTime) {
     std::string toPassIn(Utils::ConvertCSharpString(overlayData));
+    msclr::lock controlLock(_controlLock);
     return _control->AddVideoOverlayData(toPassIn, (MediaController::IController::VideoOverlayDataPosition) position, includeDateTime);
 }
@@ -0,0 +1,69 @@
+/// <summary>
+/// Implements the PelcoDataManagedEvent class.
+/// </summary>
+#include <string.h>
+#include "PelcoDataEvent.h"
+
+using namespace System::Runtime::InteropServices;
+
+namespace {
+    // The initial size of the recycled payload buffer
+    const int kInitialBufferSize = 256;
+}
+
+int VxSdkNet::PelcoDataManagedEvent::CopyTo(array<unsigned char>^ destination, int destinationIndex) {
+    if (destination == nullptr || destinationIndex < 0 || destination->Length - destinationIndex < _length)
+        return 0;
+
+    System::Buffer::BlockCopy(_buffer, 0, destination, destinationIndex, _length);
+    return _length;
+}
+
+array<unsigned char>^ VxSdkNet::PelcoDataManagedEvent::ToArray() {
+    array<unsigned char>^ payload = gcnew array<unsigned char>(_length);
+    if (_length > 0)
+        System::Buffer::BlockCopy(_buffer, 0, payload, 0, _length);
+
+    return payload;
+}
+
+VxSdkNet::PelcoDataRecord^ VxSdkNet::PelcoDataManagedEvent::Record::get() {
+    if (_record == nullptr)
+        _record = gcnew PelcoDataRecord();
+
+    if (!_isParsed) {
+        _record->_Parse(_buffer, _length);
+        _isParsed = true;
+    }
+
+    return _record;
+}
+
+System::String^ VxSdkNet::PelcoDataManagedEvent::ToString() {
+    if (_length == 0)
+        return System::String::Empty;
+
+    return System::Text::Encoding::UTF8->GetString(_buffer, 0, _length);
+}
+
+void VxSdkNet::PelcoDataManagedEvent::_Load(MediaController::PelcoDataEvent* pelcoDataEvent) {
+    _pelcoDataEvent = pelcoDataEvent;
+    _eventType = (EventTypes)pelcoDataEvent->eventType;
+
+    // The Pelco data is a null terminated string; bound the scan in case the terminator is missing
+    const char* pelcoData = reinterpret_cast<const char*>(pelcoDataEvent->pelcoData);
+    _length = pelcoData != nullptr ? static_cast<int>(strnlen(pelcoData, MaxLength)) : 0;
+
+    // Grow the recycled buffer only when a larger payload arrives
+    if (_buffer == nullptr || _buffer->Length < _length) {
+        int size = _buffer == nullptr ? kInitialBufferSize : _buffer->Length;
+        while (size < _length)
+            size *= 2;
+
+        _buffer = gcnew array<unsigned char>(size);
+    }
+
+    _isParsed = false;
+    if (_length > 0)
+        Marshal::Copy(System::IntPtr(pelcoDataEvent->pelcoData), _buffer, 0, _length);
+}
@@ -0,0 +1,117 @@
+/// <summary>
+/// Implements the PelcoDataRecord class.
+/// </summary>
+#include "PelcoDataRecord.h"
+
+namespace {
+    // The number of ints stored per field: name start, name length, value start and value length
+    const int kFieldStride = 4;
+
+    // The initial number of fields that the recycled field table can hold
+    const int kInitialFieldCount = 16;
+
+    // Gets whether a byte ends a field
+    bool IsSeparator(unsigned char value) {
+        return value == ';' || value == '&' || value == '\n' || value == '\r';
+    }
+}
+
+int VxSdkNet::PelcoDataRecord::FindField(System::String^ name) {
+    if (name == nullptr)
+        return -1;
+
+    // Compare the name against the payload bytes directly; field names are ASCII
+    for (int i = 0; i < _fieldCount; i++) {
+        int start = _fields[i * kFieldStride];
+        int length = _fields[i * kFieldStride + 1];
+        if (length != name->Length)
+            continue;
+
+        int j = 0;
+        while (j < length && _buffer[start + j] == name[j])
+            j++;
+
+        if (j == length)
+            return i;
+    }
+
+    return -1;
+}
+
+System::String^ VxSdkNet::PelcoDataRecord::GetName(int index) {
+    if (index < 0 || index >= _fieldCount)
+        return nullptr;
+
+    return System::Text::Encoding::UTF8->GetString(_buffer, _fields[index * kFieldStride], _fields[index * kFieldStride + 1]);
+}
+
+System::String^ VxSdkNet::PelcoDataRecord::GetValue(int index) {
+    if (index < 0 || index >= _fieldCount)
+        return nullptr;
+
+    return System::Text::Encoding::UTF8->GetString(_buffer, _fields[index * kFieldStride + 2], _fields[index * kFieldStride + 3]);
+}
+
+bool VxSdkNet::PelcoDataRecord::TryGetInt64(int index, long long% value) {
+    value = 0;
+    if (index < 0 || index >= _fieldCount)
+        return false;
+
+    int position = _fields[index * kFieldStride + 2];
+    int end = position + _fields[index * kFieldStride + 3];
+    bool isNegative = position < end && _buffer[position] == '-';
+    if (isNegative)
+        position++;
+
+    if (position == end)
+        return false;
+
+    long long result = 0;
+    for (; position < end; position++) {
+        unsigned char digit = _buffer[position] - '0';
+        if (digit > 9 || result > (System::Int64::MaxValue - digit) / 10)
+            return false;
+
+        result = result * 10 + digit;
+    }
+
+    value = isNegative ? -result : result;
+    return true;
+}
+
+void VxSdkNet::PelcoDataRecord::_Parse(array<unsigned char>^ buffer, int length) {
+    _buffer = buffer;
+    _length = length;
+    _fieldCount = 0;
+    if (_fields == nullptr)
+        _fields = gcnew array<int>(kInitialFieldCount * kFieldStride);
+
+    int position = 0;
+    while (position < length) {
+        // Find the end of the field and its name
+        int start = position;
+        int equals = -1;
+        while (position < length && !IsSeparator(buffer[position])) {
+            if (equals < 0 && buffer[position] == '=')
+                equals = position;
+
+            position++;
+        }
+
+        int end = position++;
+        if (end == start)
+            continue;
+
+        // Grow the recycled field table only when a payload has more fields than it can hold
+        if ((_fieldCount + 1) * kFieldStride > _fields->Length)
+            System::Array::Resize(_fields, _fields->Length * 2);
+
+        // A field without a value is stored with an empty one
+        int offset = _fieldCount * kFieldStride;
+        _fields[offset] = start;
+        _fields[offset + 1] = (equals < 0 ? end : equals) - start;
+        _fields[offset + 2] = equals < 0 ? end : equals + 1;
+        _fields[offset + 3] = equals < 0 ? 0 : end - equals - 1;
+        _fieldCount++;
+    }
+}
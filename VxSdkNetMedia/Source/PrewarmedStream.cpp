@@ -0,0 +1,125 @@
+/// <summary>
+/// Implements the PrewarmedStream class.
+/// </summary>
+#include <msclr/lock.h>
+#include "PrewarmedStream.h"
+
+using namespace System::Runtime::InteropServices;
+using namespace System::Threading;
+
+VxSdkNet::PrewarmedStream^ VxSdkNet::PrewarmedStream::Open(DataSource^ videoSource, DataInterface^ videoInterface,
+    DataSource^ audioSource, DataInterface^ audioInterface, System::String^ rtspVideoEndpoint, System::String^ rtspAudioEndpoint) {
+    // Reserve a slot for the stream, giving it back if the maximum number of streams is already open
+    if (Interlocked::Increment(_openStreams) > _maxPrewarmedStreams) {
+        Interlocked::Decrement(_openStreams);
+        return nullptr;
+    }
+
+    PrewarmedStream^ stream = gcnew PrewarmedStream();
+    stream->_videoSource = videoSource;
+    stream->_videoInterface = videoInterface;
+    stream->_audioSource = audioSource;
+    stream->_audioInterface = audioInterface;
+    stream->_rtspVideoEndpoint = rtspVideoEndpoint;
+    stream->_rtspAudioEndpoint = rtspAudioEndpoint;
+    stream->_opened = gcnew ManualResetEvent(false);
+
+    // Negotiating the stream can take several seconds, so do it off the calling thread
+    ThreadPool::QueueUserWorkItem(gcnew WaitCallback(stream, &VxSdkNet::PrewarmedStream::_Open));
+    return stream;
+}
+
+VxSdkNet::PrewarmedStream::!PrewarmedStream() {
+    MediaController::IController* control = nullptr;
+    {
+        msclr::lock streamLock(this);
+        // If the stream is still opening it is released once opened
+        _isCanceled = true;
+        control = _control;
+        _control = nullptr;
+    }
+
+    if (control != nullptr)
+        _Release(control);
+}
+
+MediaController::IController* VxSdkNet::PrewarmedStream::Detach() {
+    _opened->WaitOne();
+
+    MediaController::IController* control = nullptr;
+    {
+        msclr::lock streamLock(this);
+        control = _control;
+        _control = nullptr;
+    }
+
+    // The controller is now owned by the caller and no longer counts towards the prewarmed streams
+    if (control != nullptr) {
+        control->ClearObservers();
+        Interlocked::Decrement(_openStreams);
+    }
+
+    return control;
+}
+
+void VxSdkNet::PrewarmedStream::_Open(System::Object^ state) {
+    // Keep the sources' native objects in place until the controller has taken the request
+    NativeReadLock videoLock(_videoSource != nullptr ? _videoSource->_nativeLock : nullptr);
+    NativeReadLock audioLock(_audioSource != nullptr ? _audioSource->_nativeLock : nullptr);
+
+    // Create a new MediaRequest object
+    MediaController::MediaRequest request;
+    if (_videoSource != nullptr) {
+        request.dataSource = _videoSource->_dataSource;
+        request.dataInterface = *_videoInterface->_dataInterface;
+    }
+
+    if (_audioSource != nullptr) {
+        request.audioDataSource = _audioSource->_dataSource;
+        request.audioDataInterface = *_audioInterface->_dataInterface;
+    }
+
+    if (_rtspVideoEndpoint != nullptr) {
+        std::string videoEndpoint = Utils::ConvertCSharpString(_rtspVideoEndpoint);
+        std::string audioEndpoint = Utils::ConvertCSharpString(_rtspAudioEndpoint);
+        request.rtspVideoEndpoint = _strdup((char*)videoEndpoint.c_str());
+        request.rtspAudioEndpoint = _strdup((char*)audioEndpoint.c_str());
+    }
+
+    // Get a controller for the stream and start it so that it connects and begins buffering
+    MediaController::IController* control = nullptr;
+    MediaController::GetController(&request, &control);
+    if (control != nullptr) {
+        _timestampCallback = gcnew TimestampCallbackDelegate(this, &VxSdkNet::PrewarmedStream::_OnTimestamp);
+        control->AddObserver(MediaController::TimestampEventCallback(Marshal::GetFunctionPointerForDelegate(_timestampCallback).ToPointer()));
+        control->Play(1, 0, MediaController::IStream::kUDP);
+    }
+
+    bool isCanceled;
+    {
+        msclr::lock streamLock(this);
+        isCanceled = _isCanceled;
+        if (!isCanceled)
+            _control = control;
+    }
+
+    // Release the controller if the stream was discarded while it was opening
+    if (isCanceled && control != nullptr)
+        _Release(control);
+    else if (control == nullptr)
+        Interlocked::Decrement(_openStreams);
+
+    _opened->Set();
+}
+
+void VxSdkNet::PrewarmedStream::_OnTimestamp(MediaController::TimestampEvent* timeEvent) {
+    // The first timestamp means the stream is connected and decoding
+    _isReady = true;
+}
+
+void VxSdkNet::PrewarmedStream::_Release(MediaController::IController* control) {
+    control->ClearObservers();
+    control->Stop();
+    delete control;
+    Interlocked::Decrement(_openStreams);
+}
@@ -0,0 +1,26 @@
+/// <summary>
+/// Implements the ReconnectPolicy class.
+/// </summary>
+#include "ReconnectPolicy.h"
+
+System::TimeSpan VxSdkNet::ReconnectPolicy::GetDelay(int attempt, System::Random^ random) {
+    // Grow the delay exponentially from the initial delay, capped at the maximum delay
+    double delayMs = InitialDelay.TotalMilliseconds * System::Math::Pow(System::Math::Max(Multiplier, 1.0), attempt);
+    delayMs = System::Math::Min(delayMs, MaxDelay.TotalMilliseconds);
+
+    // Randomize the jittered portion of the delay
+    double jitter = System::Math::Min(System::Math::Max(Jitter, 0.0), 1.0);
+    delayMs -= delayMs * jitter * random->NextDouble();
+
+    return System::TimeSpan::FromMilliseconds(delayMs);
+}
+
+void VxSdkNet::ReconnectPolicy::MaxConcurrentReconnects::set(int value) {
+    // At least one reconnect must be allowed at a time
+    if (value < 1)
+        value = 1;
+
+    // Reconnects already holding a slot release it to the semaphore they acquired it from
+    _maxConcurrentReconnects = value;
+    _reconnectSlots = gcnew System::Threading::SemaphoreSlim(value);
+}
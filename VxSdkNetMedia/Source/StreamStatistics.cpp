@@ -0,0 +1,177 @@
+/// <summary>
+/// Implements the StreamStatistics class.
+/// </summary>
+#include "StreamStatistics.h"
+#include "StreamEvent.h"
+
+using namespace System::Diagnostics;
+using namespace System::Threading;
+
+namespace {
+    // The number of 100ns ticks between 0001-01-01 and the unix epoch
+    const long long kUnixEpochTicks = 621355968000000000LL;
+
+    // Jitter is stored scaled by 16 so it can be smoothed with integer math (see RFC 3550, A.8)
+    const int kJitterScale = 16;
+
+    // New samples contribute 1/8th of their difference to the average frame interval
+    const int kIntervalWeight = 8;
+}
+
+VxSdkNet::StreamStatisticsCollector::StreamStatisticsCollector() {
+    Reset();
+}
+
+long long VxSdkNet::StreamStatisticsCollector::_NowMicroseconds() {
+    // Split the conversion to avoid overflowing on hosts with a long uptime
+    long long ticks = Stopwatch::GetTimestamp();
+    long long frequency = Stopwatch::Frequency;
+    return (ticks / frequency) * 1000000 + (ticks % frequency) * 1000000 / frequency;
+}
+
+void VxSdkNet::StreamStatisticsCollector::RecordTimestamp(MediaController::TimestampEvent* timeEvent) {
+    long long arrivalUs = _NowMicroseconds();
+    long long streamUs = static_cast<long long>(timeEvent->unixTime) * 1000000 + timeEvent->unixTimeMicroSeconds;
+    long long wallUs = (System::DateTime::UtcNow.Ticks - kUnixEpochTicks) / 10;
+
+    // The stream callback is the only writer of the interval fields, so plain reads are safe here
+    long long lastArrivalUs = _lastArrivalUs;
+    long long lastStreamUs = _lastStreamUs;
+    if (Interlocked::Increment(_framesReceived) > 1 && lastArrivalUs != 0) {
+        long long arrivalDelta = arrivalUs - lastArrivalUs;
+        long long streamDelta = streamUs - lastStreamUs;
+        long long avgIntervalUs = _avgIntervalUs;
+        if (avgIntervalUs > 0) {
+            if (arrivalDelta > 2 * avgIntervalUs)
+                Interlocked::Increment(_lateFrames);
+
+            if (streamDelta <= 0 || streamDelta > 2 * avgIntervalUs) {
+                Interlocked::Increment(_timestampGaps);
+            }
+            else {
+                // Only contiguous frames contribute to the jitter estimate
+                long long transit = arrivalDelta - streamDelta;
+                if (transit < 0)
+                    transit = -transit;
+
+                long long jitter = _jitterScaledUs;
+                jitter += transit - (jitter + kJitterScale / 2) / kJitterScale;
+                Interlocked::Exchange(_jitterScaledUs, jitter);
+            }
+        }
+
+        avgIntervalUs = avgIntervalUs == 0 ? arrivalDelta : avgIntervalUs + (arrivalDelta - avgIntervalUs) / kIntervalWeight;
+        Interlocked::Exchange(_avgIntervalUs, avgIntervalUs);
+    }
+
+    Interlocked::Exchange(_lastArrivalUs, arrivalUs);
+    Interlocked::Exchange(_lastStreamUs, streamUs);
+    Interlocked::Exchange(_latencyUs, wallUs - streamUs);
+
+    // Complete the measurement of a source change on the first frame from the new source
+    if (Interlocked::Read(_switchStartUs) != 0) {
+        long long switchStartUs = Interlocked::Exchange(_switchStartUs, 0LL);
+        if (switchStartUs != 0)
+            Interlocked::Exchange(_switchLatencyUs, arrivalUs - switchStartUs);
+    }
+}
+
+void VxSdkNet::StreamStatisticsCollector::RecordStreamEvent(MediaController::StreamEvent* streamEvent) {
+    StreamingEvent::EventTypes eventType = (StreamingEvent::EventTypes)streamEvent->eventType;
+    if (eventType == StreamingEvent::EventTypes::ConnectionLost) {
+        Interlocked::Increment(_connectionsLost);
+        Interlocked::CompareExchange(_outageStartUs, _NowMicroseconds(), 0LL);
+    }
+    else if (eventType == StreamingEvent::EventTypes::ConnectionRestored) {
+        Interlocked::Increment(_connectionsRestored);
+        _EndOutage();
+    }
+}
+
+void VxSdkNet::StreamStatisticsCollector::RecordPelcoData(int length) {
+    Interlocked::Increment(_pelcoDataEvents);
+    Interlocked::Add(_pelcoDataBytes, static_cast<long long>(length));
+}
+
+void VxSdkNet::StreamStatisticsCollector::RecordReconnectAttempt(bool succeeded) {
+    Interlocked::Increment(_reconnectAttempts);
+
+    // A successful reconnect ends the outage even if the stream does not report the connection as restored
+    if (succeeded)
+        _EndOutage();
+}
+
+void VxSdkNet::StreamStatisticsCollector::RecordSourceChange() {
+    Interlocked::Exchange(_switchStartUs, _NowMicroseconds());
+}
+
+void VxSdkNet::StreamStatisticsCollector::_EndOutage() {
+    long long outageStartUs = Interlocked::Exchange(_outageStartUs, 0LL);
+    if (outageStartUs != 0) {
+        long long outageUs = _NowMicroseconds() - outageStartUs;
+        Interlocked::Add(_outageTotalUs, outageUs);
+        Interlocked::Exchange(_lastOutageUs, outageUs);
+    }
+}
+
+void VxSdkNet::StreamStatisticsCollector::Reset() {
+    long long nowUs = _NowMicroseconds();
+    Interlocked::Exchange(_framesReceived, 0LL);
+    Interlocked::Exchange(_lateFrames, 0LL);
+    Interlocked::Exchange(_timestampGaps, 0LL);
+    Interlocked::Exchange(_pelcoDataEvents, 0LL);
+    Interlocked::Exchange(_pelcoDataBytes, 0LL);
+    Interlocked::Exchange(_connectionsLost, 0LL);
+    Interlocked::Exchange(_connectionsRestored, 0LL);
+    Interlocked::Exchange(_lastArrivalUs, 0LL);
+    Interlocked::Exchange(_lastStreamUs, 0LL);
+    Interlocked::Exchange(_avgIntervalUs, 0LL);
+    Interlocked::Exchange(_jitterScaledUs, 0LL);
+    Interlocked::Exchange(_latencyUs, 0LL);
+    Interlocked::Exchange(_outageTotalUs, 0LL);
+    Interlocked::Exchange(_lastOutageUs, 0LL);
+    Interlocked::Exchange(_reconnectAttempts, 0LL);
+    Interlocked::Exchange(_switchLatencyUs, 0LL);
+
+    // Keep an outage that is in progress, but only count it from the time of the reset
+    if (Interlocked::Read(_outageStartUs) != 0)
+        Interlocked::Exchange(_outageStartUs, nowUs);
+
+    Interlocked::Exchange(_startUs, nowUs);
+}
+
+VxSdkNet::StreamStatistics^ VxSdkNet::StreamStatisticsCollector::Snapshot() {
+    long long nowUs = _NowMicroseconds();
+    long long lastArrivalUs = Interlocked::Read(_lastArrivalUs);
+    long long lastStreamUs = Interlocked::Read(_lastStreamUs);
+    long long avgIntervalUs = Interlocked::Read(_avgIntervalUs);
+    long long outageStartUs = Interlocked::Read(_outageStartUs);
+    long long outageTotalUs = Interlocked::Read(_outageTotalUs);
+    long long startUs = Interlocked::Read(_startUs);
+
+    // Include the outage currently in progress, if any
+    if (outageStartUs != 0)
+        outageTotalUs += nowUs - outageStartUs;
+
+    StreamStatistics^ statistics = gcnew StreamStatistics();
+    statistics->_connectionsLost = Interlocked::Read(_connectionsLost);
+    statistics->_connectionsRestored = Interlocked::Read(_connectionsRestored);
+    statistics->_elapsed = System::TimeSpan::FromTicks((nowUs - startUs) * 10);
+    statistics->_frameRate = avgIntervalUs > 0 ? 1000000.0 / avgIntervalUs : 0.0;
+    statistics->_framesReceived = Interlocked::Read(_framesReceived);
+    statistics->_isConnected = outageStartUs == 0;
+    statistics->_jitter = System::TimeSpan::FromTicks(Interlocked::Read(_jitterScaledUs) / kJitterScale * 10);
+    statistics->_lastFrameTime = lastStreamUs > 0 ?
+        System::DateTime(kUnixEpochTicks + lastStreamUs * 10, System::DateTimeKind::Utc) : System::DateTime::MinValue;
+    statistics->_lateFrames = Interlocked::Read(_lateFrames);
+    statistics->_lastOutage = System::TimeSpan::FromTicks(Interlocked::Read(_lastOutageUs) * 10);
+    statistics->_latency = System::TimeSpan::FromTicks(Interlocked::Read(_latencyUs) * 10);
+    statistics->_pelcoDataBytes = Interlocked::Read(_pelcoDataBytes);
+    statistics->_pelcoDataEvents = Interlocked::Read(_pelcoDataEvents);
+    statistics->_reconnectAttempts = Interlocked::Read(_reconnectAttempts);
+    statistics->_switchLatency = System::TimeSpan::FromTicks(Interlocked::Read(_switchLatencyUs) * 10);
+    statistics->_timeSinceLastFrame = System::TimeSpan::FromTicks((nowUs - (lastArrivalUs != 0 ? lastArrivalUs : startUs)) * 10);
+    statistics->_timestampGaps = Interlocked::Read(_timestampGaps);
+    statistics->_totalOutage = System::TimeSpan::FromTicks(outageTotalUs * 10);
+    return statistics;
+}